@@ -0,0 +1,74 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+//! Benchmarks of AEAD sealing and opening. See benches/common/mod.rs.
+
+#![forbid(
+    anonymous_parameters,
+    box_pointers,
+    legacy_directory_ownership,
+    missing_copy_implementations,
+    missing_debug_implementations,
+    trivial_casts,
+    trivial_numeric_casts,
+    unstable_features,
+    unused_extern_crates,
+    unused_import_braces,
+    unused_qualifications,
+    unused_results,
+    variant_size_differences,
+    warnings,
+)]
+
+extern crate ring;
+
+mod common;
+
+use ring::aead;
+
+fn main() {
+    let b = common::Bencher::new();
+
+    for &(alg_name, alg) in &[("aes_128_gcm", &aead::AES_128_GCM),
+                              ("aes_256_gcm", &aead::AES_256_GCM),
+                              ("chacha20_poly1305", &aead::CHACHA20_POLY1305)] {
+        let key_bytes = vec![0x42u8; alg.key_len()];
+        let s_key = aead::SealingKey::new(alg, &key_bytes).unwrap();
+        let o_key = aead::OpeningKey::new(alg, &key_bytes).unwrap();
+        let nonce = vec![0u8; alg.nonce_len()];
+        let ad = [0u8; 13];
+
+        for &len in common::INPUT_LENS {
+            let tag_len = alg.tag_len();
+            let mut in_out = vec![0u8; len + tag_len];
+            b.run(&format!("aead::seal_in_place/{}/{}", alg_name, len), len,
+                  || aead::seal_in_place(&s_key, &nonce, &ad, &mut in_out,
+                                         tag_len).unwrap());
+
+            let mut sealed = vec![0u8; len + tag_len];
+            let _ = aead::seal_in_place(&s_key, &nonce, &ad, &mut sealed,
+                                        tag_len).unwrap();
+            // Each iteration opens a fresh copy of the sealed record, since
+            // opening replaces it with the plaintext.
+            let mut in_out = sealed.clone();
+            b.run(&format!("aead::open_in_place/{}/{}", alg_name, len), len,
+                  || {
+                      in_out.copy_from_slice(&sealed);
+                      aead::open_in_place(&o_key, &nonce, &ad, 0,
+                                          &mut in_out).unwrap().len()
+                  });
+        }
+    }
+}
@@ -0,0 +1,145 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+//! Benchmarks of key agreement. See benches/common/mod.rs.
+
+#![forbid(
+    anonymous_parameters,
+    box_pointers,
+    legacy_directory_ownership,
+    missing_copy_implementations,
+    missing_debug_implementations,
+    trivial_casts,
+    trivial_numeric_casts,
+    unstable_features,
+    unused_extern_crates,
+    unused_import_braces,
+    unused_qualifications,
+    unused_results,
+    variant_size_differences,
+    warnings,
+)]
+
+extern crate ring;
+extern crate untrusted;
+
+mod common;
+
+use ring::{agreement, error, rand};
+
+fn main() {
+    let b = common::Bencher::new();
+    let rng = rand::SystemRandom::new();
+
+    for &(alg_name, alg) in &[("x25519", &agreement::X25519),
+                              ("ecdh_p256", &agreement::ECDH_P256),
+                              ("ecdh_p384", &agreement::ECDH_P384)] {
+        b.run(&format!("agreement::EphemeralPrivateKey::generate/{}",
+                       alg_name), 0,
+              || agreement::EphemeralPrivateKey::generate(alg, &rng).unwrap());
+        let buffered_rng = rand::BufferedRandom::new();
+        b.run(&format!("agreement::EphemeralPrivateKey::generate/{}/\
+                        BufferedRandom", alg_name), 0,
+              || agreement::EphemeralPrivateKey::generate(alg, &buffered_rng)
+                     .unwrap());
+
+        let private_key =
+            agreement::EphemeralPrivateKey::generate(alg, &rng).unwrap();
+        let mut public_key = [0u8; agreement::PUBLIC_KEY_MAX_LEN];
+        let public_key = &mut public_key[..private_key.public_key_len()];
+        b.run(&format!("agreement::compute_public_key/{}", alg_name), 0,
+              || private_key.compute_public_key(public_key).unwrap());
+
+        // Each iteration generates a new private key, since
+        // `agree_ephemeral()` consumes it; subtract the cost of `generate`
+        // above to get the cost of the agreement alone.
+        let peer_public_key = untrusted::Input::from(public_key);
+        b.run(&format!("agreement::generate_and_agree_ephemeral/{}",
+                       alg_name), 0,
+              || {
+                  let my_private_key =
+                      agreement::EphemeralPrivateKey::generate(alg, &rng)
+                          .unwrap();
+                  agreement::agree_ephemeral(my_private_key, alg,
+                                             peer_public_key,
+                                             error::Unspecified,
+                                             |key_material| Ok(key_material[0]))
+                      .unwrap()
+              });
+
+        // Batches of eight, which is as many as are done at once.
+        let private_keys: Vec<agreement::EphemeralPrivateKey> = (0..8)
+            .map(|_| agreement::EphemeralPrivateKey::generate(alg, &rng)
+                         .unwrap())
+            .collect();
+        let mut public_keys = [[0u8; agreement::PUBLIC_KEY_MAX_LEN]; 8];
+        b.run(&format!("agreement::compute_public_keys/{}/x8", alg_name), 0,
+              || {
+                  let mut out: Vec<&mut [u8]> = public_keys.iter_mut()
+                      .map(|p| &mut p[..private_keys[0].public_key_len()])
+                      .collect();
+                  agreement::compute_public_keys(&private_keys, &mut out)
+                      .unwrap()
+              });
+
+        b.run(&format!("agreement::generate_and_agree_ephemeral_batch/{}/x8",
+                       alg_name), 0,
+              || {
+                  let agreements = (0..8).map(|_| {
+                      (agreement::EphemeralPrivateKey::generate(alg, &rng)
+                           .unwrap(),
+                       peer_public_key)
+                  });
+                  let mut sum = 0u8;
+                  agreement::agree_ephemeral_batch(agreements, alg, |result| {
+                      sum ^= result.unwrap()[0];
+                  });
+                  sum
+              });
+
+        bench_key_pair_pool(&b, &rng, alg_name, alg);
+    }
+}
+
+// The pool is refilled whenever it runs out, so the `take` benchmark is of the
+// amortized cost, which includes the precomputation. The precomputation
+// benchmark is of filling a pool of `KEY_PAIR_POOL_CAPACITY` key pairs.
+#[cfg(feature = "use_heap")]
+fn bench_key_pair_pool(b: &common::Bencher, rng: &rand::SystemRandom,
+                       alg_name: &str, alg: &'static agreement::Algorithm) {
+    const KEY_PAIR_POOL_CAPACITY: usize = 64;
+    b.run(&format!("agreement::EphemeralKeyPairPool::precompute/{}",
+                   alg_name), 0,
+          || {
+              let pool = agreement::EphemeralKeyPairPool::new(
+                  alg, KEY_PAIR_POOL_CAPACITY);
+              pool.precompute(rng).unwrap();
+              pool
+          });
+
+    let pool = agreement::EphemeralKeyPairPool::new(alg,
+                                                    KEY_PAIR_POOL_CAPACITY);
+    b.run(&format!("agreement::EphemeralKeyPairPool::take/{}", alg_name), 0,
+          || {
+              if pool.len() == 0 {
+                  pool.precompute(rng).unwrap();
+              }
+              pool.take(rng).unwrap()
+          });
+}
+
+#[cfg(not(feature = "use_heap"))]
+fn bench_key_pair_pool(_: &common::Bencher, _: &rand::SystemRandom, _: &str,
+                       _: &'static agreement::Algorithm) {}
@@ -0,0 +1,163 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+//! The harness shared by the benchmarks in benches/.
+//!
+//! libtest's `#[bench]` requires a nightly compiler and only reports ns/iter,
+//! so the benchmarks are built with `harness = false` and use this instead.
+//! `cargo bench` runs all of them; `cargo bench --bench aead -- gcm` runs the
+//! benchmarks of benches/aead.rs whose names contain "gcm". Each benchmark is
+//! run for `RING_BENCH_MILLIS` milliseconds (default 500) and the fastest of
+//! five samples is reported, as ns and ops/s per operation and, for those that
+//! process input, MB/s and cycles per byte. Cycles are counted with the time
+//! stamp counter on x86 and x86-64, which ticks at the CPU's nominal
+//! frequency; they aren't reported on other targets.
+
+use ring::cpu;
+use std;
+use std::time::{Duration, Instant};
+
+/// The sizes of inputs used for the benchmarks of bulk operations.
+#[allow(dead_code)] // Not every benchmark has bulk operations.
+pub const INPUT_LENS: &'static [usize] = &[16, 64, 256, 1350, 8192, 16384];
+
+pub struct Bencher {
+    filter: Option<String>,
+    sample_time: Duration,
+}
+
+impl Bencher {
+    /// Constructs a `Bencher` using the command line and the environment, and
+    /// prints the table header.
+    pub fn new() -> Bencher {
+        // `cargo bench` passes "--bench"; options like that are ignored.
+        let filter =
+            std::env::args().skip(1).find(|arg| !arg.starts_with("-"));
+        let millis = std::env::var("RING_BENCH_MILLIS").ok()
+            .and_then(|millis| millis.parse::<u64>().ok())
+            .unwrap_or(500);
+        let backends = cpu::ALL_PRIMITIVES.iter()
+            .map(|&primitive| format!("{:?}={}", primitive,
+                                      cpu::backend(primitive)))
+            .collect::<std::vec::Vec<_>>();
+        println!("backends: {}", backends.join(" "));
+        println!("{:<56} {:>12} {:>12} {:>10} {:>12}", "benchmark", "ns/op",
+                 "ops/s", "MB/s", "cycles/B");
+        Bencher {
+            filter,
+            sample_time: Duration::from_millis(millis / SAMPLES as u64),
+        }
+    }
+
+    /// Measures `f`, each call of which is one operation on `input_len` bytes
+    /// of input. `input_len` is zero for operations, like signing, whose cost
+    /// isn't per byte.
+    pub fn run<F, R>(&self, name: &str, input_len: usize, mut f: F)
+                     where F: FnMut() -> R {
+        if let Some(ref filter) = self.filter {
+            if !name.contains(filter.as_str()) {
+                return;
+            }
+        }
+
+        // Warm up, and find how many iterations fill a sample.
+        let mut iterations = 1u64;
+        loop {
+            let (elapsed, _) = measure(iterations, &mut f);
+            if elapsed >= self.sample_time / 4 {
+                let scale = self.sample_time.as_secs() as f64 * 1e9 +
+                            self.sample_time.subsec_nanos() as f64;
+                let scale = scale / nanos(elapsed);
+                iterations =
+                    std::cmp::max(1, (iterations as f64 * scale) as u64);
+                break;
+            }
+            iterations *= 2;
+        }
+
+        let mut best_nanos = std::f64::MAX;
+        let mut best_cycles = None;
+        for _ in 0..SAMPLES {
+            let (elapsed, cycles) = measure(iterations, &mut f);
+            let per_op = nanos(elapsed) / iterations as f64;
+            if per_op < best_nanos {
+                best_nanos = per_op;
+                best_cycles = cycles.map(|c| c as f64 / iterations as f64);
+            }
+        }
+
+        let ops_per_sec = 1e9 / best_nanos;
+        if input_len == 0 {
+            let cycles = match best_cycles {
+                Some(cycles) => format!("{:.0}/op", cycles),
+                None => "-".to_string(),
+            };
+            println!("{:<56} {:>12.1} {:>12.0} {:>10} {:>12}", name,
+                     best_nanos, ops_per_sec, "-", cycles);
+        } else {
+            let mb_per_sec = ops_per_sec * input_len as f64 / 1e6;
+            let cycles = match best_cycles {
+                Some(cycles) => format!("{:.2}", cycles / input_len as f64),
+                None => "-".to_string(),
+            };
+            println!("{:<56} {:>12.1} {:>12.0} {:>10.1} {:>12}", name,
+                     best_nanos, ops_per_sec, mb_per_sec, cycles);
+        }
+    }
+}
+
+const SAMPLES: u32 = 5;
+
+fn measure<F, R>(iterations: u64, f: &mut F) -> (Duration, Option<u64>)
+                 where F: FnMut() -> R {
+    let start_cycles = cycles();
+    let start = Instant::now();
+    for _ in 0..iterations {
+        let _ = black_box(f());
+    }
+    let elapsed = start.elapsed();
+    let cycles = match (start_cycles, cycles()) {
+        (Some(start), Some(end)) => Some(end.wrapping_sub(start)),
+        _ => None,
+    };
+    (elapsed, cycles)
+}
+
+fn nanos(d: Duration) -> f64 {
+    d.as_secs() as f64 * 1e9 + d.subsec_nanos() as f64
+}
+
+/// Keeps the compiler from optimizing away the computation of `value`.
+pub fn black_box<T>(value: T) -> T {
+    unsafe {
+        let result = std::ptr::read_volatile(&value);
+        std::mem::forget(value);
+        result
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+fn cycles() -> Option<u64> {
+    Some(unsafe { std::arch::x86_64::_rdtsc() })
+}
+
+#[cfg(target_arch = "x86")]
+fn cycles() -> Option<u64> {
+    Some(unsafe { std::arch::x86::_rdtsc() })
+}
+
+#[cfg(not(any(target_arch = "x86", target_arch = "x86_64")))]
+fn cycles() -> Option<u64> {
+    None
+}
@@ -0,0 +1,89 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+//! Benchmarks of digests, HMAC, PBKDF2, and HKDF. See benches/common/mod.rs.
+
+#![forbid(
+    anonymous_parameters,
+    box_pointers,
+    legacy_directory_ownership,
+    missing_copy_implementations,
+    missing_debug_implementations,
+    trivial_casts,
+    trivial_numeric_casts,
+    unstable_features,
+    unused_extern_crates,
+    unused_import_braces,
+    unused_qualifications,
+    unused_results,
+    variant_size_differences,
+    warnings,
+)]
+
+extern crate ring;
+
+mod common;
+
+use ring::{digest, hkdf, hmac, pbkdf2};
+
+static DIGEST_ALGS: &'static [(&'static str, &'static digest::Algorithm)] = &[
+    ("sha1", &digest::SHA1),
+    ("sha256", &digest::SHA256),
+    ("sha384", &digest::SHA384),
+    ("sha512", &digest::SHA512),
+];
+
+fn main() {
+    let b = common::Bencher::new();
+
+    for &(alg_name, alg) in DIGEST_ALGS {
+        for &len in common::INPUT_LENS {
+            let input = vec![0u8; len];
+            b.run(&format!("digest::digest/{}/{}", alg_name, len), len,
+                  || digest::digest(alg, &input));
+        }
+    }
+
+    for &(alg_name, alg) in DIGEST_ALGS {
+        let key = hmac::SigningKey::new(alg, &[0x42; 32]);
+        b.run(&format!("hmac::SigningKey::new/{}", alg_name), 0,
+              || hmac::SigningKey::new(alg, &[0x42; 32]));
+        for &len in common::INPUT_LENS {
+            let input = vec![0u8; len];
+            b.run(&format!("hmac::sign/{}/{}", alg_name, len), len,
+                  || hmac::sign(&key, &input));
+        }
+    }
+
+    for &(alg_name, alg) in &DIGEST_ALGS[1..] {
+        let mut out = vec![0u8; alg.output_len];
+        b.run(&format!("pbkdf2::derive/{}/1000_iterations", alg_name), 0,
+              || pbkdf2::derive(alg, 1000, b"salt", b"password", &mut out));
+    }
+
+    for &(alg_name, alg) in &DIGEST_ALGS[1..] {
+        let salt = hmac::SigningKey::new(alg, &[0x42; 32]);
+        let secret = [0x17u8; 32];
+        b.run(&format!("hkdf::extract/{}", alg_name), 0,
+              || hkdf::extract(&salt, &secret));
+
+        let prk = hkdf::extract(&salt, &secret);
+        for &len in &[32, 64, 128] {
+            let mut out = vec![0u8; len];
+            b.run(&format!("hkdf::expand/{}/{}", alg_name, len), len,
+                  || hkdf::expand(&prk, b"info", &mut out));
+        }
+    }
+}
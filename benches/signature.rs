@@ -0,0 +1,211 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+//! Benchmarks of signing, verification, and the parsing of private keys. See
+//! benches/common/mod.rs.
+
+#![forbid(
+    anonymous_parameters,
+    box_pointers,
+    legacy_directory_ownership,
+    missing_copy_implementations,
+    missing_debug_implementations,
+    trivial_casts,
+    trivial_numeric_casts,
+    unstable_features,
+    unused_extern_crates,
+    unused_import_braces,
+    unused_qualifications,
+    unused_results,
+    variant_size_differences,
+    warnings,
+)]
+
+extern crate ring;
+extern crate untrusted;
+
+mod common;
+
+use ring::{rand, signature, test};
+
+const MESSAGE: &'static [u8] = b"hello, world";
+
+fn main() {
+    let b = common::Bencher::new();
+    let rng = rand::SystemRandom::new();
+
+    bench_ed25519(&b, &rng);
+    bench_ecdsa(&b, &rng);
+    bench_rsa(&b, &rng);
+}
+
+fn bench_ed25519(b: &common::Bencher, rng: &rand::SystemRandom) {
+    let pkcs8 = signature::Ed25519KeyPair::generate_pkcs8(rng).unwrap();
+    let pkcs8 = untrusted::Input::from(&pkcs8);
+    b.run("signature::Ed25519KeyPair::from_pkcs8", 0,
+          || signature::Ed25519KeyPair::from_pkcs8(pkcs8).unwrap());
+
+    let key_pair = signature::Ed25519KeyPair::from_pkcs8(pkcs8).unwrap();
+    b.run("signature::Ed25519KeyPair::sign", 0, || key_pair.sign(MESSAGE));
+
+    let sig = key_pair.sign(MESSAGE);
+    let public_key = untrusted::Input::from(key_pair.public_key_bytes());
+    let msg = untrusted::Input::from(MESSAGE);
+    let sig = untrusted::Input::from(sig.as_ref());
+    b.run("signature::verify/ed25519", 0,
+          || signature::verify(&signature::ED25519, public_key, msg, sig)
+                 .unwrap());
+}
+
+fn bench_ecdsa(b: &common::Bencher, rng: &rand::SystemRandom) {
+    for &(alg_name, alg) in
+            &[("p256", &signature::ECDSA_P256_SHA256_FIXED_SIGNING),
+              ("p384", &signature::ECDSA_P384_SHA384_FIXED_SIGNING)] {
+        let pkcs8 = signature::ECDSAKeyPair::generate_pkcs8(alg, rng).unwrap();
+        let pkcs8 = untrusted::Input::from(pkcs8.as_ref());
+        b.run(&format!("signature::ECDSAKeyPair::from_pkcs8/{}", alg_name), 0,
+              || signature::ECDSAKeyPair::from_pkcs8(alg, pkcs8).unwrap());
+
+        let key_pair = signature::ECDSAKeyPair::from_pkcs8(alg, pkcs8).unwrap();
+        b.run(&format!("signature::ECDSAKeyPair::sign/{}", alg_name), 0,
+              || key_pair.sign(MESSAGE, rng).unwrap());
+        bench_ecdsa_nonce_pool(b, rng, alg_name, alg, &key_pair);
+    }
+
+    // From tests/ecdsa_verify_fixed_tests.txt.
+    for &(alg_name, alg, public_key, sig) in &[
+        ("p256_sha256", &signature::ECDSA_P256_SHA256_FIXED,
+         concat!("0430345fd47ea21a11129be651b0884bfac698377611acc9f689458e1",
+                 "3b9ed7d4b9d7599a68dcf125e7f31055ccb374cd04f6d6fd2b217438a",
+                 "63f6f667d50ef2f0"),
+         concat!("341f6779b75e98bb42e01095dd48356cbf9002dc704ac8bd2a8240b88",
+                 "d3796c6555843b1b4e264fe6ffe6e2b705a376c05c09404303ffe5d27",
+                 "11f3e3b3a010a1")),
+        ("p384_sha384", &signature::ECDSA_P384_SHA384_FIXED,
+         concat!("045c5e788a805c77d34128b8401cb59b2373b8b468336c9318252bf39",
+                 "fd31d2507557987a5180a9435f9fb8eb971c426f1c485170dcb18fb68",
+                 "8a257f89387a09fc4c5b8bd4b320616b54a0a7b1d1d7c6a0c59f6dff7",
+                 "8c78ad4e3d6fca9c9a17b96"),
+         concat!("85ac708d4b0126bac1f5eeebdf911409070a286fdde5649582611b600",
+                 "46de353761660dd03903f58b44148f25142eef8183475ec1f1392f3d6",
+                 "838abc0c01724709c446888bed7f2ce4642c6839dc18044a2a6ab9ddc",
+                 "960bfac79f6988e62d452")),
+    ] {
+        let public_key = test::from_hex(public_key).unwrap();
+        let public_key = untrusted::Input::from(&public_key);
+        let sig = test::from_hex(sig).unwrap();
+        let sig = untrusted::Input::from(&sig);
+        let msg = untrusted::Input::from(b"");
+        b.run(&format!("signature::verify/ecdsa_{}", alg_name), 0,
+              || signature::verify(alg, public_key, msg, sig).unwrap());
+    }
+}
+
+// The pool is refilled whenever it runs out, so the signing benchmark is of
+// the amortized cost, which includes the precomputation. The precomputation
+// benchmark is of filling a pool of `NONCE_POOL_CAPACITY` nonces.
+#[cfg(feature = "use_heap")]
+fn bench_ecdsa_nonce_pool(b: &common::Bencher, rng: &rand::SystemRandom,
+                          alg_name: &str,
+                          alg: &'static signature::ECDSASigningAlgorithm,
+                          key_pair: &signature::ECDSAKeyPair) {
+    const NONCE_POOL_CAPACITY: usize = 64;
+    b.run(&format!("signature::ECDSANoncePool::precompute/{}", alg_name), 0,
+          || {
+              let nonces = signature::ECDSANoncePool::new(alg,
+                                                          NONCE_POOL_CAPACITY);
+              nonces.precompute(rng).unwrap();
+              nonces
+          });
+
+    let nonces = signature::ECDSANoncePool::new(alg, NONCE_POOL_CAPACITY);
+    b.run(&format!("signature::ECDSAKeyPair::sign_with_nonce_pool/{}",
+                   alg_name), 0,
+          || {
+              if nonces.len() == 0 {
+                  nonces.precompute(rng).unwrap();
+              }
+              key_pair.sign_with_nonce_pool(&nonces, MESSAGE, rng).unwrap()
+          });
+}
+
+#[cfg(not(feature = "use_heap"))]
+fn bench_ecdsa_nonce_pool(_: &common::Bencher, _: &rand::SystemRandom, _: &str,
+                          _: &'static signature::ECDSASigningAlgorithm,
+                          _: &signature::ECDSAKeyPair) {}
+
+// The RSA PKCS#1 v1.5 SHA-256 signature of `MESSAGE` using
+// src/rsa/signature_rsa_example_private_key.der.
+#[cfg(feature = "use_heap")]
+const RSA_SIG: &'static [&'static str] = &[
+    "048efbc9eb5f7a6f55f6d7b9f7e6c3ce58e2db226562ca905e7f972e8f43b696",
+    "9b0ad878e0d6b290c5bbf2c05410a1efc9de051d91e5faa537e454306f5f526c",
+    "828379fe28a17e50c8bd4e7c834479da482305a78e198c988a177b9263cea27a",
+    "2a99c0da98e03b0cc8d880eccdeba7c16dd07f78d980739753690953d1b63106",
+    "145a80059ed38f52100a9a8d2c7c5371d91b70ce5b7b36d6b97ebef8798d09c0",
+    "1e5b6cb8a6a7fd1a4100d3527327b7d23f8a26187985d8702f8951346ea4a725",
+    "3e87f765ef587a728021bff37be55d1a8639809e3453ea5a2da482bfedeae185",
+    "79b51037cfecff5bece21d8c82ee6fa8eb0f43c43c3a23a983c3a2eea4e7d2dc",
+];
+
+#[cfg(feature = "use_heap")]
+fn bench_rsa(b: &common::Bencher, rng: &rand::SystemRandom) {
+    const PUBLIC_KEY_DER: &'static [u8] =
+        include_bytes!("../src/rsa/signature_rsa_example_public_key.der");
+
+    let sig = test::from_hex(&RSA_SIG.concat()).unwrap();
+    let public_key = untrusted::Input::from(PUBLIC_KEY_DER);
+    let msg = untrusted::Input::from(MESSAGE);
+    b.run("signature::verify/rsa_pkcs1_2048_sha256", 0,
+          || signature::verify(&signature::RSA_PKCS1_2048_8192_SHA256,
+                               public_key, msg, untrusted::Input::from(&sig))
+                 .unwrap());
+
+    bench_rsa_signing(b, rng, &sig);
+}
+
+#[cfg(not(feature = "use_heap"))]
+fn bench_rsa(_: &common::Bencher, _: &rand::SystemRandom) {}
+
+#[cfg(feature = "rsa_signing")]
+fn bench_rsa_signing(b: &common::Bencher, rng: &rand::SystemRandom,
+                     expected_sig: &[u8]) {
+    const PRIVATE_KEY_DER: &'static [u8] =
+        include_bytes!("../src/rsa/signature_rsa_example_private_key.der");
+
+    let private_key = untrusted::Input::from(PRIVATE_KEY_DER);
+    b.run("signature::RSAKeyPair::from_der/2048", 0,
+          || signature::RSAKeyPair::from_der(private_key).unwrap());
+
+    let key_pair = signature::RSAKeyPair::from_der(private_key).unwrap();
+    let hmac_key = ring::hmac::SigningKey::generate(&ring::digest::SHA256, rng)
+        .unwrap();
+    let precomputed = key_pair.serialize_precomputed(&hmac_key).unwrap();
+    let precomputed = untrusted::Input::from(&precomputed);
+    b.run("signature::RSAKeyPair::from_precomputed/2048", 0,
+          || signature::RSAKeyPair::from_precomputed(&hmac_key, precomputed)
+                 .unwrap());
+
+    let mut sig = vec![0u8; key_pair.public_modulus_len()];
+    let key_pair = std::sync::Arc::new(key_pair);
+    let mut signing_state = signature::RSASigningState::new(key_pair).unwrap();
+    b.run("signature::RSASigningState::sign/pkcs1_2048_sha256", 0,
+          || signing_state.sign(&signature::RSA_PKCS1_SHA256, rng, MESSAGE,
+                                &mut sig).unwrap());
+    assert_eq!(&sig[..], expected_sig);
+}
+
+#[cfg(all(feature = "use_heap", not(feature = "rsa_signing")))]
+fn bench_rsa_signing(_: &common::Bencher, _: &rand::SystemRandom, _: &[u8]) {}
@@ -57,12 +57,12 @@ const ARM: &'static str = "arm";
 #[cfg_attr(rustfmt, rustfmt_skip)]
 const RING_SRCS: &'static [(&'static [&'static str], &'static str)] = &[
     (&[], "crypto/aes/aes.c"),
+    (&[], "crypto/aes/aes_nohw.c"),
     (&[], "crypto/bn/bn.c"),
     (&[], "crypto/bn/exponentiation.c"),
     (&[], "crypto/bn/generic.c"),
     (&[], "crypto/bn/montgomery.c"),
     (&[], "crypto/bn/montgomery_inv.c"),
-    (&[], "crypto/bn/mul.c"),
     (&[], "crypto/bn/shift.c"),
     (&[], "crypto/cipher/e_aes.c"),
     (&[], "crypto/crypto.c"),
@@ -71,7 +71,9 @@ const RING_SRCS: &'static [(&'static [&'static str], &'static str)] = &[
     (&[], "crypto/ec/ecp_nistz256.c"),
     (&[], "crypto/ec/gfp_p256.c"),
     (&[], "crypto/ec/gfp_p384.c"),
+    (&[], "crypto/fipsmodule/sha/sha1.c"),
     (&[], "crypto/limbs/limbs.c"),
+    (&[], "crypto/limbs/limbs_inv.c"),
     (&[], "crypto/mem.c"),
     (&[], "crypto/modes/gcm.c"),
 
@@ -88,18 +90,28 @@ const RING_SRCS: &'static [(&'static [&'static str], &'static str)] = &[
     (&[X86], "crypto/fipsmodule/sha/asm/sha256-586.pl"),
     (&[X86], "crypto/fipsmodule/sha/asm/sha512-586.pl"),
 
+    (&[X86_64], "crypto/bn/exp65537-avx512.c"),
+    (&[X86_64], "crypto/bn/rsaz_exp.c"),
+    (&[X86_64], "crypto/chacha/chacha-avx2.c"),
+    (&[X86_64], "crypto/curve25519/curve25519-avx2.c"),
+    (&[X86_64], "crypto/curve25519/x25519-avx512.c"),
     (&[X86_64], "crypto/curve25519/x25519-x86_64.c"),
+    (&[X86_64], "crypto/fipsmodule/sha/sha256-avx2.c"),
+    (&[X86_64], "crypto/modes/gcm-avx512.c"),
+    (&[X86_64], "crypto/poly1305/poly1305-avx512.c"),
 
     (&[X86_64], "crypto/aes/asm/aes-x86_64.pl"),
     (&[X86_64], "crypto/aes/asm/aesni-x86_64.pl"),
     (&[X86_64], "crypto/aes/asm/bsaes-x86_64.pl"),
     (&[X86_64], "crypto/aes/asm/vpaes-x86_64.pl"),
     (&[X86_64], "crypto/bn/asm/x86_64-mont.pl"),
+    (&[X86_64], "crypto/bn/asm/rsaz-avx512.pl"),
     (&[X86_64], "crypto/bn/asm/x86_64-mont5.pl"),
     (&[X86_64], "crypto/chacha/asm/chacha-x86_64.pl"),
     (&[X86_64], "crypto/curve25519/asm/x25519-asm-x86_64.S"),
     (&[X86_64], "crypto/ec/asm/ecp_nistz256-x86_64.pl"),
     (&[X86_64], "crypto/ec/asm/p256-x86_64-asm.pl"),
+    (&[X86_64], "crypto/ec/asm/p384-x86_64.pl"),
     (&[X86_64], "crypto/modes/asm/aesni-gcm-x86_64.pl"),
     (&[X86_64], "crypto/modes/asm/ghash-x86_64.pl"),
     (&[X86_64], "crypto/poly1305/asm/poly1305-x86_64.pl"),
@@ -141,11 +153,14 @@ const RING_TEST_SRCS: &'static [&'static str] = &[
 
 #[cfg_attr(rustfmt, rustfmt_skip)]
 const RING_INCLUDES: &'static [&'static str] =
-    &["crypto/bn/internal.h",
+    &["crypto/aes/internal.h",
+      "crypto/bn/internal.h",
+      "crypto/bn/rsaz_exp.h",
       "crypto/cipher/internal.h",
       "crypto/curve25519/internal.h",
       "crypto/ec/ecp_nistz256_table.inl",
       "crypto/ec/ecp_nistz384.inl",
+      "crypto/ec/ecp_nistz384_table.inl",
       "crypto/ec/ecp_nistz.h",
       "crypto/ec/ecp_nistz384.h",
       "crypto/ec/ecp_nistz256.h",
@@ -312,7 +327,9 @@ fn ring_build_rs_main() {
     };
 
     let is_debug = env::var("DEBUG").unwrap() != "false";
-    let target = Target { arch, os, env, obj_ext, obj_opt, is_debug };
+    let cpu_defines = static_cpu_defines(&arch);
+    let target = Target { arch, os, env, obj_ext, obj_opt, is_debug,
+                          cpu_defines };
     let pregenerated =
         PathBuf::from(env::var("CARGO_MANIFEST_DIR").unwrap())
             .join(PREGENERATED);
@@ -361,6 +378,7 @@ struct Target {
     obj_ext: &'static str,
     obj_opt: &'static str,
     is_debug: bool,
+    cpu_defines: Vec<(&'static str, String)>,
 }
 
 impl Target {
@@ -370,6 +388,72 @@ impl Target {
     pub fn is_debug(&self) -> bool { self.is_debug }
 }
 
+// With the `static_cpu_features` feature, *ring* uses the CPU features that
+// the target is compiled for, i.e. the `target_feature`s that
+// `-C target-cpu` and `-C target-feature` enable, instead of detecting them
+// at runtime. These are the C preprocessor definitions that make
+// crypto/crypto.c initialize `GFp_ia32cap_P` or `GFp_armcap_P` with them.
+fn static_cpu_defines(arch: &str) -> Vec<(&'static str, String)> {
+    use std::env;
+
+    if env::var_os("CARGO_FEATURE_STATIC_CPU_FEATURES").is_none() {
+        return Vec::new();
+    }
+    let target_features =
+        env::var("CARGO_CFG_TARGET_FEATURE").unwrap_or_default();
+    let enabled = |name: &str| target_features.split(',').any(|f| f == name);
+
+    match arch {
+        X86 | X86_64 => {
+            // The bits of `GFp_ia32cap_P`; see include/GFp/cpu.h. The
+            // "Intel CPU" bit of word 0 can't be known statically, so it is
+            // never set.
+            const BITS: &'static [(&'static str, usize, u32)] = &[
+                ("fxsr", 0, 24), ("sse", 0, 25), ("sse2", 0, 26),
+                ("pclmulqdq", 1, 1), ("ssse3", 1, 9), ("fma", 1, 12),
+                ("sse4.1", 1, 19), ("sse4.2", 1, 20), ("movbe", 1, 22),
+                ("aes", 1, 25), ("avx", 1, 28),
+                ("bmi1", 2, 3), ("avx2", 2, 5), ("bmi2", 2, 8),
+                ("avx512f", 2, 16), ("avx512dq", 2, 17), ("adx", 2, 19),
+                ("avx512ifma", 2, 21), ("avx512cd", 2, 28), ("sha", 2, 29),
+                ("avx512bw", 2, 30), ("avx512vl", 2, 31),
+                ("vaes", 3, 9), ("vpclmulqdq", 3, 10),
+            ];
+            let mut words = [0u32; 4];
+            for &(name, index, bit) in BITS {
+                if enabled(name) {
+                    words[index] |= 1 << bit;
+                }
+            }
+            vec![
+                ("OPENSSL_STATIC_IA32CAP", "1".into()),
+                ("OPENSSL_STATIC_IA32CAP_0", format!("0x{:08x}u", words[0])),
+                ("OPENSSL_STATIC_IA32CAP_1", format!("0x{:08x}u", words[1])),
+                ("OPENSSL_STATIC_IA32CAP_2", format!("0x{:08x}u", words[2])),
+                ("OPENSSL_STATIC_IA32CAP_3", format!("0x{:08x}u", words[3])),
+            ]
+        },
+        ARM | AARCH64 => {
+            // The ARMv8 "aes" feature includes PMULL and "sha2" includes
+            // SHA-1.
+            let mut defines = vec![("OPENSSL_STATIC_ARMCAP", "1".into())];
+            if enabled("neon") {
+                defines.push(("OPENSSL_STATIC_ARMCAP_NEON", "1".into()));
+            }
+            if enabled("aes") {
+                defines.push(("OPENSSL_STATIC_ARMCAP_AES", "1".into()));
+                defines.push(("OPENSSL_STATIC_ARMCAP_PMULL", "1".into()));
+            }
+            if enabled("sha2") {
+                defines.push(("OPENSSL_STATIC_ARMCAP_SHA1", "1".into()));
+                defines.push(("OPENSSL_STATIC_ARMCAP_SHA256", "1".into()));
+            }
+            defines
+        },
+        _ => Vec::new(),
+    }
+}
+
 fn build_c_code(target: &Target, pregenerated: PathBuf, out_dir: &Path) {
     let includes_modified = RING_INCLUDES.par_iter()
         .with_max_len(1)
@@ -549,6 +633,9 @@ fn cc(file: &Path, ext: &str, target: &Target, warnings_are_errors: bool,
     for f in cpp_flags(target) {
         let _ = c.flag(&f);
     }
+    for &(name, ref value) in &target.cpu_defines {
+        let _ = c.define(name, Some(value.as_str()));
+    }
     if target.os() != "none" &&
         target.os() != "redox" &&
         target.os() != "windows" {
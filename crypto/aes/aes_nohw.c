@@ -0,0 +1,540 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* A constant-time AES implementation that doesn't use any lookup tables, for
+ * CPUs without AES instructions or the SIMD needed by the vector-permute and
+ * bitsliced assembly implementations. It is structured like BearSSL's
+ * |aes_ct64|: four blocks are processed in parallel, bitsliced so that each of
+ * the eight 64-bit words of the state holds one bit of every byte of the four
+ * blocks, and the S-box is computed as a circuit of bitwise operations (from
+ * "A depth-16 circuit for the AES S-box" by Joan Boyar and Rene Peralta).
+ *
+ * The same 64-bit code is used on 32-bit targets, where the compiler splits
+ * each 64-bit operation in two; that costs about the same as a two-block,
+ * 32-bit bitsliced implementation would. */
+
+#include "internal.h"
+
+#include <string.h>
+
+#include <GFp/type_check.h>
+
+#include "../internal.h"
+
+
+/* The number of blocks processed in parallel. */
+#define AES_NOHW_BATCH_SIZE 4
+
+static inline uint32_t aes_nohw_from_le_u32_ptr(const uint8_t *in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) |
+         ((uint32_t)in[3] << 24);
+}
+
+static inline void aes_nohw_to_le_u32_ptr(uint8_t *out, uint32_t v) {
+  out[0] = (uint8_t)v;
+  out[1] = (uint8_t)(v >> 8);
+  out[2] = (uint8_t)(v >> 16);
+  out[3] = (uint8_t)(v >> 24);
+}
+
+/* aes_nohw_ortho transposes the bits of |q| in groups: within each group of
+ * eight words, bit 8*i + j of word k is swapped with bit 8*i + k of word j.
+ * It is its own inverse. */
+static void aes_nohw_ortho(uint64_t q[8]) {
+#define AES_NOHW_SWAPN(cl, ch, s, x, y)                          \
+  do {                                                           \
+    uint64_t a = (x);                                            \
+    uint64_t b = (y);                                            \
+    (x) = (a & UINT64_C(cl)) | ((b & UINT64_C(cl)) << (s));      \
+    (y) = ((a & UINT64_C(ch)) >> (s)) | (b & UINT64_C(ch));      \
+  } while (0)
+#define AES_NOHW_SWAP2(x, y) \
+  AES_NOHW_SWAPN(0x5555555555555555, 0xaaaaaaaaaaaaaaaa, 1, x, y)
+#define AES_NOHW_SWAP4(x, y) \
+  AES_NOHW_SWAPN(0x3333333333333333, 0xcccccccccccccccc, 2, x, y)
+#define AES_NOHW_SWAP8(x, y) \
+  AES_NOHW_SWAPN(0x0f0f0f0f0f0f0f0f, 0xf0f0f0f0f0f0f0f0, 4, x, y)
+
+  AES_NOHW_SWAP2(q[0], q[1]);
+  AES_NOHW_SWAP2(q[2], q[3]);
+  AES_NOHW_SWAP2(q[4], q[5]);
+  AES_NOHW_SWAP2(q[6], q[7]);
+
+  AES_NOHW_SWAP4(q[0], q[2]);
+  AES_NOHW_SWAP4(q[1], q[3]);
+  AES_NOHW_SWAP4(q[4], q[6]);
+  AES_NOHW_SWAP4(q[5], q[7]);
+
+  AES_NOHW_SWAP8(q[0], q[4]);
+  AES_NOHW_SWAP8(q[1], q[5]);
+  AES_NOHW_SWAP8(q[2], q[6]);
+  AES_NOHW_SWAP8(q[3], q[7]);
+
+#undef AES_NOHW_SWAP8
+#undef AES_NOHW_SWAP4
+#undef AES_NOHW_SWAP2
+#undef AES_NOHW_SWAPN
+}
+
+/* aes_nohw_interleave_in spreads the four little-endian 32-bit words |w| of a
+ * block over |*q0| and |*q1| so that, after |aes_nohw_ortho|, the bytes of
+ * each column of the block are in the positions that |aes_nohw_shift_rows| and
+ * |aes_nohw_mix_columns| expect. */
+static void aes_nohw_interleave_in(uint64_t *q0, uint64_t *q1,
+                                   const uint32_t w[4]) {
+  uint64_t x0 = w[0];
+  uint64_t x1 = w[1];
+  uint64_t x2 = w[2];
+  uint64_t x3 = w[3];
+  x0 |= (x0 << 16);
+  x1 |= (x1 << 16);
+  x2 |= (x2 << 16);
+  x3 |= (x3 << 16);
+  x0 &= UINT64_C(0x0000ffff0000ffff);
+  x1 &= UINT64_C(0x0000ffff0000ffff);
+  x2 &= UINT64_C(0x0000ffff0000ffff);
+  x3 &= UINT64_C(0x0000ffff0000ffff);
+  x0 |= (x0 << 8);
+  x1 |= (x1 << 8);
+  x2 |= (x2 << 8);
+  x3 |= (x3 << 8);
+  x0 &= UINT64_C(0x00ff00ff00ff00ff);
+  x1 &= UINT64_C(0x00ff00ff00ff00ff);
+  x2 &= UINT64_C(0x00ff00ff00ff00ff);
+  x3 &= UINT64_C(0x00ff00ff00ff00ff);
+  *q0 = x0 | (x2 << 8);
+  *q1 = x1 | (x3 << 8);
+}
+
+/* aes_nohw_interleave_out is the inverse of |aes_nohw_interleave_in|. */
+static void aes_nohw_interleave_out(uint32_t w[4], uint64_t q0, uint64_t q1) {
+  uint64_t x0 = q0 & UINT64_C(0x00ff00ff00ff00ff);
+  uint64_t x1 = q1 & UINT64_C(0x00ff00ff00ff00ff);
+  uint64_t x2 = (q0 >> 8) & UINT64_C(0x00ff00ff00ff00ff);
+  uint64_t x3 = (q1 >> 8) & UINT64_C(0x00ff00ff00ff00ff);
+  x0 |= (x0 >> 8);
+  x1 |= (x1 >> 8);
+  x2 |= (x2 >> 8);
+  x3 |= (x3 >> 8);
+  x0 &= UINT64_C(0x0000ffff0000ffff);
+  x1 &= UINT64_C(0x0000ffff0000ffff);
+  x2 &= UINT64_C(0x0000ffff0000ffff);
+  x3 &= UINT64_C(0x0000ffff0000ffff);
+  w[0] = (uint32_t)x0 | (uint32_t)(x0 >> 16);
+  w[1] = (uint32_t)x1 | (uint32_t)(x1 >> 16);
+  w[2] = (uint32_t)x2 | (uint32_t)(x2 >> 16);
+  w[3] = (uint32_t)x3 | (uint32_t)(x3 >> 16);
+}
+
+/* aes_nohw_sub_bytes applies the S-box to every byte of the bitsliced state
+ * |q|, where |q[7]| holds the most significant bits. */
+static void aes_nohw_sub_bytes(uint64_t q[8]) {
+  uint64_t x0 = q[7];
+  uint64_t x1 = q[6];
+  uint64_t x2 = q[5];
+  uint64_t x3 = q[4];
+  uint64_t x4 = q[3];
+  uint64_t x5 = q[2];
+  uint64_t x6 = q[1];
+  uint64_t x7 = q[0];
+
+  /* Top linear transformation. */
+  uint64_t y14 = x3 ^ x5;
+  uint64_t y13 = x0 ^ x6;
+  uint64_t y9 = x0 ^ x3;
+  uint64_t y8 = x0 ^ x5;
+  uint64_t t0 = x1 ^ x2;
+  uint64_t y1 = t0 ^ x7;
+  uint64_t y4 = y1 ^ x3;
+  uint64_t y12 = y13 ^ y14;
+  uint64_t y2 = y1 ^ x0;
+  uint64_t y5 = y1 ^ x6;
+  uint64_t y3 = y5 ^ y8;
+  uint64_t t1 = x4 ^ y12;
+  uint64_t y15 = t1 ^ x5;
+  uint64_t y20 = t1 ^ x1;
+  uint64_t y6 = y15 ^ x7;
+  uint64_t y10 = y15 ^ t0;
+  uint64_t y11 = y20 ^ y9;
+  uint64_t y7 = x7 ^ y11;
+  uint64_t y17 = y10 ^ y11;
+  uint64_t y19 = y10 ^ y8;
+  uint64_t y16 = t0 ^ y11;
+  uint64_t y21 = y13 ^ y16;
+  uint64_t y18 = x0 ^ y16;
+
+  /* Non-linear section. */
+  uint64_t t2 = y12 & y15;
+  uint64_t t3 = y3 & y6;
+  uint64_t t4 = t3 ^ t2;
+  uint64_t t5 = y4 & x7;
+  uint64_t t6 = t5 ^ t2;
+  uint64_t t7 = y13 & y16;
+  uint64_t t8 = y5 & y1;
+  uint64_t t9 = t8 ^ t7;
+  uint64_t t10 = y2 & y7;
+  uint64_t t11 = t10 ^ t7;
+  uint64_t t12 = y9 & y11;
+  uint64_t t13 = y14 & y17;
+  uint64_t t14 = t13 ^ t12;
+  uint64_t t15 = y8 & y10;
+  uint64_t t16 = t15 ^ t12;
+  uint64_t t17 = t4 ^ t14;
+  uint64_t t18 = t6 ^ t16;
+  uint64_t t19 = t9 ^ t14;
+  uint64_t t20 = t11 ^ t16;
+  uint64_t t21 = t17 ^ y20;
+  uint64_t t22 = t18 ^ y19;
+  uint64_t t23 = t19 ^ y21;
+  uint64_t t24 = t20 ^ y18;
+
+  uint64_t t25 = t21 ^ t22;
+  uint64_t t26 = t21 & t23;
+  uint64_t t27 = t24 ^ t26;
+  uint64_t t28 = t25 & t27;
+  uint64_t t29 = t28 ^ t22;
+  uint64_t t30 = t23 ^ t24;
+  uint64_t t31 = t22 ^ t26;
+  uint64_t t32 = t31 & t30;
+  uint64_t t33 = t32 ^ t24;
+  uint64_t t34 = t23 ^ t33;
+  uint64_t t35 = t27 ^ t33;
+  uint64_t t36 = t24 & t35;
+  uint64_t t37 = t36 ^ t34;
+  uint64_t t38 = t27 ^ t36;
+  uint64_t t39 = t29 & t38;
+  uint64_t t40 = t25 ^ t39;
+
+  uint64_t t41 = t40 ^ t37;
+  uint64_t t42 = t29 ^ t33;
+  uint64_t t43 = t29 ^ t40;
+  uint64_t t44 = t33 ^ t37;
+  uint64_t t45 = t42 ^ t41;
+  uint64_t z0 = t44 & y15;
+  uint64_t z1 = t37 & y6;
+  uint64_t z2 = t33 & x7;
+  uint64_t z3 = t43 & y16;
+  uint64_t z4 = t40 & y1;
+  uint64_t z5 = t29 & y7;
+  uint64_t z6 = t42 & y11;
+  uint64_t z7 = t45 & y17;
+  uint64_t z8 = t41 & y10;
+  uint64_t z9 = t44 & y12;
+  uint64_t z10 = t37 & y3;
+  uint64_t z11 = t33 & y4;
+  uint64_t z12 = t43 & y13;
+  uint64_t z13 = t40 & y5;
+  uint64_t z14 = t29 & y2;
+  uint64_t z15 = t42 & y9;
+  uint64_t z16 = t45 & y14;
+  uint64_t z17 = t41 & y8;
+
+  /* Bottom linear transformation. */
+  uint64_t t46 = z15 ^ z16;
+  uint64_t t47 = z10 ^ z11;
+  uint64_t t48 = z5 ^ z13;
+  uint64_t t49 = z9 ^ z10;
+  uint64_t t50 = z2 ^ z12;
+  uint64_t t51 = z2 ^ z5;
+  uint64_t t52 = z7 ^ z8;
+  uint64_t t53 = z0 ^ z3;
+  uint64_t t54 = z6 ^ z7;
+  uint64_t t55 = z16 ^ z17;
+  uint64_t t56 = z12 ^ t48;
+  uint64_t t57 = t50 ^ t53;
+  uint64_t t58 = z4 ^ t46;
+  uint64_t t59 = z3 ^ t54;
+  uint64_t t60 = t46 ^ t57;
+  uint64_t t61 = z14 ^ t57;
+  uint64_t t62 = t52 ^ t58;
+  uint64_t t63 = t49 ^ t58;
+  uint64_t t64 = z4 ^ t59;
+  uint64_t t65 = t61 ^ t62;
+  uint64_t t66 = z1 ^ t63;
+  uint64_t s0 = t59 ^ t63;
+  uint64_t s6 = t56 ^ ~t62;
+  uint64_t s7 = t48 ^ ~t60;
+  uint64_t t67 = t64 ^ t65;
+  uint64_t s3 = t53 ^ t66;
+  uint64_t s4 = t51 ^ t66;
+  uint64_t s5 = t47 ^ t65;
+  uint64_t s1 = t64 ^ ~s3;
+  uint64_t s2 = t55 ^ ~t67;
+
+  q[7] = s0;
+  q[6] = s1;
+  q[5] = s2;
+  q[4] = s3;
+  q[3] = s4;
+  q[2] = s5;
+  q[1] = s6;
+  q[0] = s7;
+}
+
+static void aes_nohw_add_round_key(uint64_t q[8], const uint64_t rk[8]) {
+  for (size_t i = 0; i < 8; ++i) {
+    q[i] ^= rk[i];
+  }
+}
+
+static void aes_nohw_shift_rows(uint64_t q[8]) {
+  for (size_t i = 0; i < 8; ++i) {
+    uint64_t x = q[i];
+    q[i] = (x & UINT64_C(0x000000000000ffff)) |
+           ((x & UINT64_C(0x00000000fff00000)) >> 4) |
+           ((x & UINT64_C(0x00000000000f0000)) << 12) |
+           ((x & UINT64_C(0x0000ff0000000000)) >> 8) |
+           ((x & UINT64_C(0x000000ff00000000)) << 8) |
+           ((x & UINT64_C(0xf000000000000000)) >> 12) |
+           ((x & UINT64_C(0x0fff000000000000)) << 4);
+  }
+}
+
+static inline uint64_t aes_nohw_rotr32(uint64_t x) {
+  return (x << 32) | (x >> 32);
+}
+
+static void aes_nohw_mix_columns(uint64_t q[8]) {
+  uint64_t q0 = q[0];
+  uint64_t q1 = q[1];
+  uint64_t q2 = q[2];
+  uint64_t q3 = q[3];
+  uint64_t q4 = q[4];
+  uint64_t q5 = q[5];
+  uint64_t q6 = q[6];
+  uint64_t q7 = q[7];
+  uint64_t r0 = (q0 >> 16) | (q0 << 48);
+  uint64_t r1 = (q1 >> 16) | (q1 << 48);
+  uint64_t r2 = (q2 >> 16) | (q2 << 48);
+  uint64_t r3 = (q3 >> 16) | (q3 << 48);
+  uint64_t r4 = (q4 >> 16) | (q4 << 48);
+  uint64_t r5 = (q5 >> 16) | (q5 << 48);
+  uint64_t r6 = (q6 >> 16) | (q6 << 48);
+  uint64_t r7 = (q7 >> 16) | (q7 << 48);
+
+  q[0] = q7 ^ r7 ^ r0 ^ aes_nohw_rotr32(q0 ^ r0);
+  q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ aes_nohw_rotr32(q1 ^ r1);
+  q[2] = q1 ^ r1 ^ r2 ^ aes_nohw_rotr32(q2 ^ r2);
+  q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ aes_nohw_rotr32(q3 ^ r3);
+  q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ aes_nohw_rotr32(q4 ^ r4);
+  q[5] = q4 ^ r4 ^ r5 ^ aes_nohw_rotr32(q5 ^ r5);
+  q[6] = q5 ^ r5 ^ r6 ^ aes_nohw_rotr32(q6 ^ r6);
+  q[7] = q6 ^ r6 ^ r7 ^ aes_nohw_rotr32(q7 ^ r7);
+}
+
+/* aes_nohw_encrypt_batch encrypts the bitsliced blocks in |q| in place with
+ * the expanded round keys |rk|. */
+static void aes_nohw_encrypt_batch(const uint64_t *rk, unsigned rounds,
+                                   uint64_t q[8]) {
+  aes_nohw_add_round_key(q, rk);
+  for (unsigned i = 1; i < rounds; ++i) {
+    aes_nohw_sub_bytes(q);
+    aes_nohw_shift_rows(q);
+    aes_nohw_mix_columns(q);
+    aes_nohw_add_round_key(q, rk + 8 * i);
+  }
+  aes_nohw_sub_bytes(q);
+  aes_nohw_shift_rows(q);
+  aes_nohw_add_round_key(q, rk + 8 * rounds);
+}
+
+/* aes_nohw_to_batch bitslices the |num_blocks| blocks at |in|, which must be
+ * at most |AES_NOHW_BATCH_SIZE|. The remaining lanes are zero. */
+static void aes_nohw_to_batch(uint64_t q[8], const uint8_t *in,
+                              size_t num_blocks) {
+  memset(q, 0, 8 * sizeof(uint64_t));
+  for (size_t i = 0; i < num_blocks; ++i) {
+    uint32_t w[4];
+    for (size_t j = 0; j < 4; ++j) {
+      w[j] = aes_nohw_from_le_u32_ptr(in + 16 * i + 4 * j);
+    }
+    aes_nohw_interleave_in(&q[i], &q[i + 4], w);
+  }
+  aes_nohw_ortho(q);
+}
+
+/* aes_nohw_from_batch writes the first |num_blocks| blocks of the bitsliced
+ * |q| to |out|. |q| is clobbered. */
+static void aes_nohw_from_batch(uint8_t *out, size_t num_blocks,
+                                uint64_t q[8]) {
+  aes_nohw_ortho(q);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    uint32_t w[4];
+    aes_nohw_interleave_out(w, q[i], q[i + 4]);
+    for (size_t j = 0; j < 4; ++j) {
+      aes_nohw_to_le_u32_ptr(out + 16 * i + 4 * j, w[j]);
+    }
+  }
+}
+
+/* The key schedule is stored in |AES_KEY::rd_key| compressed: since every
+ * lane holds the same round key, two words per round are enough, with the
+ * bits of lane k of each group of four at bit positions 4*n + k.
+ * |aes_nohw_expand_round_keys| expands it to eight words per round. */
+
+OPENSSL_COMPILE_ASSERT(sizeof(((AES_KEY *)0)->rd_key) >=
+                           2 * (AES_MAXNR + 1) * sizeof(uint64_t),
+                       aes_nohw_compressed_key_schedule_fits);
+
+static void aes_nohw_expand_round_keys(uint64_t rk[8 * (AES_MAXNR + 1)],
+                                       const AES_KEY *key) {
+  uint64_t compressed[2 * (AES_MAXNR + 1)];
+  size_t n = 2 * ((size_t)key->rounds + 1);
+  memcpy(compressed, key->rd_key, n * sizeof(uint64_t));
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t x0 = compressed[i] & UINT64_C(0x1111111111111111);
+    uint64_t x1 = (compressed[i] & UINT64_C(0x2222222222222222)) >> 1;
+    uint64_t x2 = (compressed[i] & UINT64_C(0x4444444444444444)) >> 2;
+    uint64_t x3 = (compressed[i] & UINT64_C(0x8888888888888888)) >> 3;
+    /* Multiplying by 15 copies each bit to the three positions above it. */
+    rk[4 * i + 0] = (x0 << 4) - x0;
+    rk[4 * i + 1] = (x1 << 4) - x1;
+    rk[4 * i + 2] = (x2 << 4) - x2;
+    rk[4 * i + 3] = (x3 << 4) - x3;
+  }
+}
+
+/* aes_nohw_sub_word applies the S-box to each byte of |x|. */
+static uint32_t aes_nohw_sub_word(uint32_t x) {
+  uint64_t q[8] = { x, 0, 0, 0, 0, 0, 0, 0 };
+  aes_nohw_ortho(q);
+  aes_nohw_sub_bytes(q);
+  aes_nohw_ortho(q);
+  return (uint32_t)q[0];
+}
+
+int GFp_aes_nohw_set_encrypt_key(const uint8_t *key, unsigned bits,
+                                 AES_KEY *aeskey) {
+  static const uint8_t kRcon[10] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36,
+  };
+
+  if (!key || !aeskey) {
+    return -1;
+  }
+
+  unsigned rounds;
+  switch (bits) {
+    case 128:
+      rounds = 10;
+      break;
+    case 256:
+      rounds = 14;
+      break;
+    default:
+      return -2;
+  }
+
+  /* The key expansion works on little-endian words; rotating a word by a byte
+   * is then a right rotation by 8 bits. */
+  size_t nk = bits / 32;
+  size_t total_words = 4 * ((size_t)rounds + 1);
+  uint32_t w[4 * (AES_MAXNR + 1)];
+  for (size_t i = 0; i < nk; ++i) {
+    w[i] = aes_nohw_from_le_u32_ptr(key + 4 * i);
+  }
+  uint32_t tmp = w[nk - 1];
+  for (size_t i = nk, j = 0, k = 0; i < total_words; ++i) {
+    if (j == 0) {
+      tmp = (tmp << 24) | (tmp >> 8);
+      tmp = aes_nohw_sub_word(tmp) ^ kRcon[k];
+    } else if (nk > 6 && j == 4) {
+      tmp = aes_nohw_sub_word(tmp);
+    }
+    tmp ^= w[i - nk];
+    w[i] = tmp;
+    if (++j == nk) {
+      j = 0;
+      ++k;
+    }
+  }
+
+  uint64_t compressed[2 * (AES_MAXNR + 1)];
+  for (size_t i = 0; i <= rounds; ++i) {
+    uint64_t q[8];
+    aes_nohw_interleave_in(&q[0], &q[4], &w[4 * i]);
+    q[1] = q[0];
+    q[2] = q[0];
+    q[3] = q[0];
+    q[5] = q[4];
+    q[6] = q[4];
+    q[7] = q[4];
+    aes_nohw_ortho(q);
+    compressed[2 * i] = (q[0] & UINT64_C(0x1111111111111111)) |
+                        (q[1] & UINT64_C(0x2222222222222222)) |
+                        (q[2] & UINT64_C(0x4444444444444444)) |
+                        (q[3] & UINT64_C(0x8888888888888888));
+    compressed[2 * i + 1] = (q[4] & UINT64_C(0x1111111111111111)) |
+                            (q[5] & UINT64_C(0x2222222222222222)) |
+                            (q[6] & UINT64_C(0x4444444444444444)) |
+                            (q[7] & UINT64_C(0x8888888888888888));
+  }
+
+  memset(aeskey, 0, sizeof(*aeskey));
+  memcpy(aeskey->rd_key, compressed,
+         2 * ((size_t)rounds + 1) * sizeof(uint64_t));
+  aeskey->rounds = rounds;
+  return 0;
+}
+
+void GFp_aes_nohw_encrypt(const uint8_t *in, uint8_t *out, const AES_KEY *key) {
+  uint64_t rk[8 * (AES_MAXNR + 1)];
+  aes_nohw_expand_round_keys(rk, key);
+
+  uint64_t q[8];
+  aes_nohw_to_batch(q, in, 1);
+  aes_nohw_encrypt_batch(rk, key->rounds, q);
+  aes_nohw_from_batch(out, 1, q);
+}
+
+void GFp_aes_nohw_ctr32_encrypt_blocks(const uint8_t *in, uint8_t *out,
+                                       size_t blocks, const AES_KEY *key,
+                                       const uint8_t ivec[16]) {
+  if (blocks == 0) {
+    return;
+  }
+
+  uint64_t rk[8 * (AES_MAXNR + 1)];
+  aes_nohw_expand_round_keys(rk, key);
+
+  alignas(16) uint8_t counters[16 * AES_NOHW_BATCH_SIZE];
+  for (size_t i = 0; i < AES_NOHW_BATCH_SIZE; ++i) {
+    memcpy(counters + 16 * i, ivec, 12);
+  }
+  uint32_t ctr = from_be_u32_ptr(ivec + 12);
+
+  while (blocks > 0) {
+    size_t todo =
+        blocks < AES_NOHW_BATCH_SIZE ? blocks : AES_NOHW_BATCH_SIZE;
+    for (size_t i = 0; i < todo; ++i) {
+      /* The caller must ensure the counter won't wrap around. */
+      to_be_u32_ptr(counters + 16 * i + 12, ctr + (uint32_t)i);
+    }
+
+    uint64_t q[8];
+    aes_nohw_to_batch(q, counters, todo);
+    aes_nohw_encrypt_batch(rk, key->rounds, q);
+    alignas(16) uint8_t key_stream[16 * AES_NOHW_BATCH_SIZE];
+    aes_nohw_from_batch(key_stream, todo, q);
+
+    for (size_t i = 0; i < 16 * todo; ++i) {
+      out[i] = in[i] ^ key_stream[i];
+    }
+
+    ctr += (uint32_t)todo;
+    blocks -= todo;
+    in += 16 * todo;
+    out += 16 * todo;
+  }
+}
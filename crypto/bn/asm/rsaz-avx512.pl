@@ -0,0 +1,187 @@
+#!/usr/bin/env perl
+
+# Copyright 2017 Brian Smith.
+#
+# Permission to use, copy, modify, and/or distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+# SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+# OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+# CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+# Almost Montgomery Multiplication (AMM) in radix 2**52 using AVX-512 IFMA, for
+# 20, 30 and 40 digit (1040, 1560 and 2080 bit) operands. These are used by
+# rsaz_exp.c for the 1024, 1536 and 2048 bit moduli of the CRT halves of
+# RSA-2048, RSA-3072 and RSA-4096.
+#
+# See "Fast modular squaring with AVX512IFMA" by Nir Drucker and Shay Gueron,
+# and "Software Implementation of Modular Exponentiation, Using Advanced
+# Vector Instructions Architectures" by Shay Gueron and Vlad Krasnov.
+#
+# void GFp_rsaz_amm52x${n}_avx512ifma(uint64_t res[], const uint64_t a[],
+#                                    const uint64_t b[], const uint64_t m[],
+#                                    uint64_t k0);
+#
+# computes res = a * b * 2**(-52*n) (mod m), where k0 = -m**-1 (mod 2**52).
+# All of the arrays have ceil(n/8)*8 digits, where the digits past the n'th
+# are zero. Every digit of |a|, |b| and |m| must be less than 2**52, and the
+# digits of |res| are also normalized to be less than 2**52. If a, b < 2*m and
+# 4*m < 2**(52*n) then res < 2*m. |res| may alias |a| or |b|.
+#
+# The accumulator is kept in ceil(n/8) zmm registers with one digit per 64-bit
+# lane. The digits are not normalized until the end. Each digit of |b| adds at
+# most four 52-bit values to each lane, so no lane can overflow for n <= 40.
+#
+# Only zmm0-zmm5 and zmm16-zmm31 are used, because zmm6-zmm15 are (partially)
+# callee-saved in the Windows x64 calling convention.
+
+$flavour = shift;
+$output  = shift;
+if ($flavour =~ /\./) { $output = $flavour; undef $flavour; }
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\"";
+*STDOUT=*OUT;
+
+$code.=<<___;
+.text
+___
+
+my ($res,$a,$b,$m,$k0)=("%rdi","%rsi","%rdx","%rcx","%r8");
+my ($a0,$mask,$acc0,$bi,$t,$counter)=("%r9","%r10","%rax","%r11","%rcx",
+                                      "%rsi");
+my ($Bi,$Yi,$T,$zero)=map("%zmm$_",(0..3));
+
+sub amm52 {
+my ($n)=@_;
+my $v=($n+7)>>3;	# The number of zmm registers per operand.
+my @A=map("%zmm".(16+$_),(0..$v-1));
+my @M=map("%zmm".(16+$v+$_),(0..$v-1));
+my @R=map("%zmm".(16+2*$v+$_),(0..$v-1));
+my $R0x=$R[0]; $R0x =~ s/zmm/xmm/;
+my $Tx=$T; $Tx =~ s/zmm/xmm/;
+
+$code.=<<___;
+
+.globl	GFp_rsaz_amm52x${n}_avx512ifma
+.type	GFp_rsaz_amm52x${n}_avx512ifma,\@function,5
+.align	32
+GFp_rsaz_amm52x${n}_avx512ifma:
+	mov	\$0xfffffffffffff, $mask
+	mov	8*0($a), $a0
+	vpxorq	$zero, $zero, $zero
+___
+for (my $j=0; $j<$v; $j++) {
+$code.=<<___;
+	vmovdqu64	64*$j($a), $A[$j]
+	vmovdqu64	64*$j($m), $M[$j]
+	vpxorq	$R[$j], $R[$j], $R[$j]
+___
+}
+$code.=<<___;
+
+	mov	\$$n, $counter
+.Lamm52x${n}_loop:
+	# y = (R[0] + (a[0] * b[i] mod 2**52)) * k0 (mod 2**52)
+	mov	8*0($b), $bi
+	vpbroadcastq	$bi, $Bi
+	vmovq	$R0x, $acc0
+	mov	$a0, $t
+	imul	$bi, $t
+	add	$t, $acc0
+	imul	$k0, $acc0
+	and	$mask, $acc0
+	vpbroadcastq	$acc0, $Yi
+
+	# R += lo52(a * b[i]) + lo52(m * y)
+___
+for (my $j=0; $j<$v; $j++) {
+$code.=<<___;
+	vpmadd52luq	$Bi, $A[$j], $R[$j]
+___
+}
+for (my $j=0; $j<$v; $j++) {
+$code.=<<___;
+	vpmadd52luq	$Yi, $M[$j], $R[$j]
+___
+}
+$code.=<<___;
+
+	# R[0] is now divisible by 2**52. Shift R right by one digit, carrying
+	# the high bits of R[0] into the new R[0].
+	vmovq	$R0x, $acc0
+	shr	\$52, $acc0
+___
+for (my $j=0; $j<$v-1; $j++) {
+$code.=<<___;
+	valignq	\$1, $R[$j], $R[$j+1], $R[$j]
+___
+}
+$code.=<<___;
+	valignq	\$1, $R[$v-1], $zero, $R[$v-1]
+	vmovq	$acc0, $Tx
+	vpaddq	$T, $R[0], $R[0]
+
+	# R += hi52(a * b[i]) + hi52(m * y)
+___
+for (my $j=0; $j<$v; $j++) {
+$code.=<<___;
+	vpmadd52huq	$Bi, $A[$j], $R[$j]
+___
+}
+for (my $j=0; $j<$v; $j++) {
+$code.=<<___;
+	vpmadd52huq	$Yi, $M[$j], $R[$j]
+___
+}
+$code.=<<___;
+
+	lea	8($b), $b
+	dec	$counter
+	jnz	.Lamm52x${n}_loop
+
+___
+for (my $j=0; $j<$v; $j++) {
+$code.=<<___;
+	vmovdqu64	$R[$j], 64*$j($res)
+___
+}
+$code.=<<___;
+	vzeroupper
+
+	# Normalize the digits to 52 bits.
+	xor	$acc0, $acc0
+___
+for (my $j=0; $j<$n; $j++) {
+$code.=<<___;
+	add	8*$j($res), $acc0
+	mov	$acc0, $t
+	shr	\$52, $acc0
+	and	$mask, $t
+	mov	$t, 8*$j($res)
+___
+}
+$code.=<<___;
+	ret
+.size	GFp_rsaz_amm52x${n}_avx512ifma,.-GFp_rsaz_amm52x${n}_avx512ifma
+___
+}
+
+amm52(20);
+amm52(30);
+amm52(40);
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT;
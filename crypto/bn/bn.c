@@ -64,29 +64,6 @@
 #include "internal.h"
 
 
-void GFp_BN_init(BIGNUM *bn) {
-  memset(bn, 0, sizeof(BIGNUM));
-}
-
-void GFp_BN_free(BIGNUM *bn) {
-  /* Keep this in sync with the |Drop| impl for |BIGNUM| in
-   * |ring::rsa::bigint|. */
-
-  if (bn == NULL) {
-    return;
-  }
-
-  if ((bn->flags & BN_FLG_STATIC_DATA) == 0) {
-    OPENSSL_free(bn->d);
-  }
-
-  if (bn->flags & BN_FLG_MALLOCED) {
-    OPENSSL_free(bn);
-  } else {
-    bn->d = NULL;
-  }
-}
-
 int GFp_BN_copy(BIGNUM *dest, const BIGNUM *src) {
   if (src == dest) {
     return 1;
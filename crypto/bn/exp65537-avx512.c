@@ -0,0 +1,296 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* Eight independent exponentiations by the RSA public exponent 65537, one in
+ * each 64-bit lane of the ZMM registers, using the AVX-512 IFMA instructions.
+ * This is for batch RSA signature verification; nothing here is secret, but
+ * the code doesn't branch on the values anyway.
+ *
+ * A value modulo an |num|-limb modulus is |digits(num)| digits in radix
+ * 2**52, and a vector of digits holds digit |i| of eight values in lane order.
+ * The lanes may have different moduli, as long as they all have |num| limbs.
+ * Multiplication is Almost Montgomery Multiplication (AMM) with
+ * R' = 2**(52*digits): for |a, b < 2*n| it returns a value congruent to
+ * |a*b/R'| that is also less than |2*n|, because R' > 4*n.
+ *
+ * 65537 is 2**16 + 1, so the addition chain is sixteen squarings of
+ * |a*R'| followed by one multiplication by the unencoded |a|, which also
+ * cancels the Montgomery factor. */
+
+#include <GFp/bn.h>
+
+#include <assert.h>
+#include <string.h>
+
+#include <GFp/cpu.h>
+
+#include "../internal.h"
+#include "../limbs/limbs.h"
+
+
+#if defined(OPENSSL_X86_64) && !defined(OPENSSL_NO_ASM) &&              \
+    ((defined(__clang__) && __clang_major__ >= 6) ||                     \
+     (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 8))
+#define EXP65537_IFMA
+#endif
+
+
+/* Prototypes to avoid -Wmissing-prototypes warnings. */
+int GFp_exp65537_x8_eligible(size_t num);
+void GFp_exp65537_x8_oneRR(BN_ULONG r[], const BN_ULONG oneRR[],
+                           const BN_ULONG n[], size_t num);
+void GFp_exp65537_x8(BN_ULONG r[], const BN_ULONG a[],
+                     const BN_ULONG a_mont[], const BN_ULONG n[],
+                     const BN_ULONG n0[], size_t lanes, size_t num);
+
+
+#if defined(EXP65537_IFMA)
+
+#include <immintrin.h>
+
+#define IFMA __attribute__((target("avx512f,avx512ifma")))
+
+#define DIGIT_BITS 52
+#define DIGIT_MASK ((((BN_ULONG)1) << DIGIT_BITS) - 1)
+
+#define LANES 8
+
+/* The number of digits for the largest supported modulus, 4096 bits. */
+#define MAX_DIGITS 79
+
+/* Returns the number of digits for a modulus of |num| limbs: the smallest
+ * number for which R' >= 4 * 2**(64*num) > 4*n. */
+static size_t num_digits(size_t num) {
+  return (num * BN_BITS2 + 2 + DIGIT_BITS - 1) / DIGIT_BITS;
+}
+
+int GFp_exp65537_x8_eligible(size_t num) {
+  /* AVX512F (bit 16) and AVX512IFMA (bit 21) of CPUID leaf 7, EBX. */
+  static const uint32_t kAVX512FAndIFMA = (1u << 16) | (1u << 21);
+  if ((GFp_ia32cap_P[2] & kAVX512FAndIFMA) != kAVX512FAndIFMA) {
+    return 0;
+  }
+  /* RSA-2048, RSA-3072 and RSA-4096. */
+  return num == 32 || num == 48 || num == 64;
+}
+
+void GFp_exp65537_x8_oneRR(BN_ULONG r[], const BN_ULONG oneRR[],
+                           const BN_ULONG n[], size_t num) {
+  assert(num * BN_BITS2 <= num_digits(num) * DIGIT_BITS);
+  const size_t shift = num_digits(num) * DIGIT_BITS - num * BN_BITS2;
+  memmove(r, oneRR, num * sizeof(r[0]));
+  for (size_t i = 0; i < shift; ++i) {
+    LIMBS_shl_mod(r, r, n, num);
+  }
+}
+
+/* Sets lane |lane| of |out[0..digits]| to the |num|-limb value |in|. The
+ * unused high bits of the top digit are zero. */
+static void to_radix52_lane(BN_ULONG out[][LANES], size_t digits,
+                            size_t lane, const BN_ULONG in[], size_t num) {
+  for (size_t i = 0; i < digits; ++i) {
+    size_t bit = i * DIGIT_BITS;
+    size_t limb = bit / BN_BITS2;
+    size_t shift = bit % BN_BITS2;
+    BN_ULONG digit = 0;
+    if (limb < num) {
+      digit = in[limb] >> shift;
+      if (shift > BN_BITS2 - DIGIT_BITS && limb + 1 < num) {
+        digit |= in[limb + 1] << (BN_BITS2 - shift);
+      }
+    }
+    out[i][lane] = digit & DIGIT_MASK;
+  }
+}
+
+/* Sets the |num|-limb value |out| to the normalized digits |in|. The value
+ * must fit. */
+static void from_radix52(BN_ULONG out[], size_t num, const BN_ULONG in[],
+                         size_t digits) {
+  memset(out, 0, num * sizeof(out[0]));
+  for (size_t i = 0; i < digits; ++i) {
+    size_t bit = i * DIGIT_BITS;
+    size_t limb = bit / BN_BITS2;
+    size_t shift = bit % BN_BITS2;
+    if (limb < num) {
+      out[limb] |= in[i] << shift;
+      if (shift > BN_BITS2 - DIGIT_BITS && limb + 1 < num) {
+        out[limb + 1] |= in[i] >> (BN_BITS2 - shift);
+      }
+    }
+  }
+}
+
+/* r = r - m if r >= m, for normalized digits |r| and |m|. */
+static void reduce_once_radix52(BN_ULONG r[], const BN_ULONG m[],
+                                size_t digits) {
+  BN_ULONG t[MAX_DIGITS];
+  BN_ULONG borrow = 0;
+  for (size_t i = 0; i < digits; ++i) {
+    BN_ULONG d = r[i] - m[i] - borrow;
+    borrow = d >> (BN_BITS2 - 1);
+    t[i] = d & DIGIT_MASK;
+  }
+  /* |borrow| is one if and only if r < m. */
+  BN_ULONG keep_r = 0 - borrow;
+  for (size_t i = 0; i < digits; ++i) {
+    r[i] = (r[i] & keep_r) | (t[i] & ~keep_r);
+  }
+}
+
+/* res = a * b / R' (mod m), lane by lane, less than 2*m if a and b are. |res|
+ * may alias |a| and/or |b|.
+ *
+ * This is word-by-word Montgomery multiplication. Each iteration adds at most
+ * four products of less than 2**52 to each accumulator, and an accumulator
+ * is shifted out after at most |digits| iterations, so with |digits| <= 79
+ * the accumulators stay below 2**61. */
+IFMA static void amm52_x8(__m512i res[], const __m512i a[], const __m512i b[],
+                          const __m512i m[], __m512i k0, size_t digits) {
+  const __m512i mask = _mm512_set1_epi64((int64_t)DIGIT_MASK);
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i t[MAX_DIGITS + 1];
+  for (size_t j = 0; j <= digits; ++j) {
+    t[j] = zero;
+  }
+
+  for (size_t i = 0; i < digits; ++i) {
+    const __m512i bi = b[i];
+    for (size_t j = 0; j < digits; ++j) {
+      t[j] = _mm512_madd52lo_epu64(t[j], a[j], bi);
+      t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a[j], bi);
+    }
+    /* q = t * k0 (mod 2**52), so t + q*m == 0 (mod 2**52). */
+    const __m512i q = _mm512_madd52lo_epu64(zero, t[0], k0);
+    for (size_t j = 0; j < digits; ++j) {
+      t[j] = _mm512_madd52lo_epu64(t[j], m[j], q);
+      t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m[j], q);
+    }
+    /* Divide by 2**52, keeping the bits of |t[0]| above the zero digit. */
+    const __m512i carry = _mm512_srli_epi64(t[0], DIGIT_BITS);
+    for (size_t j = 0; j < digits; ++j) {
+      t[j] = t[j + 1];
+    }
+    t[0] = _mm512_add_epi64(t[0], carry);
+    t[digits] = zero;
+  }
+
+  /* The result is less than 2*m < R', so there is no carry out of the top. */
+  __m512i carry = zero;
+  for (size_t j = 0; j < digits; ++j) {
+    __m512i v = _mm512_add_epi64(t[j], carry);
+    carry = _mm512_srli_epi64(v, DIGIT_BITS);
+    res[j] = _mm512_and_si512(v, mask);
+  }
+}
+
+IFMA static void load_x8(__m512i out[], BN_ULONG digits_by_lane[][LANES],
+                         size_t digits) {
+  for (size_t i = 0; i < digits; ++i) {
+    out[i] = _mm512_loadu_si512(digits_by_lane[i]);
+  }
+}
+
+IFMA void GFp_exp65537_x8(BN_ULONG r[], const BN_ULONG a[],
+                          const BN_ULONG a_mont[], const BN_ULONG n[],
+                          const BN_ULONG n0[], size_t lanes, size_t num) {
+  assert(lanes >= 1);
+  assert(lanes <= LANES);
+  assert(GFp_exp65537_x8_eligible(num));
+
+  const size_t digits = num_digits(num);
+  assert(digits <= MAX_DIGITS);
+
+  /* Unused lanes have a zero modulus, which makes everything in them zero. */
+  BN_ULONG m_buf[MAX_DIGITS][LANES];
+  BN_ULONG buf[MAX_DIGITS][LANES];
+  BN_ULONG k0[LANES];
+  __m512i m[MAX_DIGITS];
+  __m512i base[MAX_DIGITS];
+  __m512i acc[MAX_DIGITS];
+
+  memset(m_buf, 0, sizeof(m_buf));
+  memset(buf, 0, sizeof(buf));
+  memset(k0, 0, sizeof(k0));
+  for (size_t lane = 0; lane < lanes; ++lane) {
+    to_radix52_lane(m_buf, digits, lane, &n[lane * num], num);
+    k0[lane] = n0[lane] & DIGIT_MASK;
+  }
+  load_x8(m, m_buf, digits);
+  const __m512i k0_x8 = _mm512_loadu_si512(k0);
+
+  for (size_t lane = 0; lane < lanes; ++lane) {
+    to_radix52_lane(buf, digits, lane, &a_mont[lane * num], num);
+  }
+  load_x8(acc, buf, digits);
+
+  for (size_t lane = 0; lane < lanes; ++lane) {
+    to_radix52_lane(buf, digits, lane, &a[lane * num], num);
+  }
+  load_x8(base, buf, digits);
+
+  /* acc = a**(2**16) * R'. */
+  for (size_t i = 0; i < 16; ++i) {
+    amm52_x8(acc, acc, acc, m, k0_x8, digits);
+  }
+  /* acc = a**(2**16) * R' * a / R' = a**65537. */
+  amm52_x8(acc, acc, base, m, k0_x8, digits);
+
+  for (size_t i = 0; i < digits; ++i) {
+    _mm512_storeu_si512(buf[i], acc[i]);
+  }
+  for (size_t lane = 0; lane < lanes; ++lane) {
+    BN_ULONG result[MAX_DIGITS];
+    BN_ULONG modulus[MAX_DIGITS];
+    for (size_t i = 0; i < digits; ++i) {
+      result[i] = buf[i][lane];
+      modulus[i] = m_buf[i][lane];
+    }
+    /* The result may be as large as 2*n, which may not fit in |num| limbs, so
+     * reduce it before converting it. */
+    reduce_once_radix52(result, modulus, digits);
+    from_radix52(&r[lane * num], num, result, digits);
+  }
+}
+
+#else
+
+int GFp_exp65537_x8_eligible(size_t num) {
+  (void)num;
+  return 0;
+}
+
+void GFp_exp65537_x8_oneRR(BN_ULONG r[], const BN_ULONG oneRR[],
+                           const BN_ULONG n[], size_t num) {
+  (void)r;
+  (void)oneRR;
+  (void)n;
+  (void)num;
+  assert(0);
+}
+
+void GFp_exp65537_x8(BN_ULONG r[], const BN_ULONG a[],
+                     const BN_ULONG a_mont[], const BN_ULONG n[],
+                     const BN_ULONG n0[], size_t lanes, size_t num) {
+  (void)r;
+  (void)a;
+  (void)a_mont;
+  (void)n;
+  (void)n0;
+  (void)lanes;
+  (void)num;
+  assert(0);
+}
+
+#endif
@@ -115,6 +115,8 @@
 #include <GFp/mem.h>
 
 #include "internal.h"
+#include "rsaz_exp.h"
+#include "../internal.h"
 
 
 #if defined(OPENSSL_X86_64)
@@ -240,6 +242,21 @@ static int copy_from_prebuf(BIGNUM *b, int top, unsigned char *buf, int idx,
 
 #endif /* defined(OPENSSL_X86_64) */
 
+#if defined(OPENSSL_BN_ASM_MONT5)
+#define MOD_EXP_CTIME_MAX_WINDOW 5
+#else
+#define MOD_EXP_CTIME_MAX_WINDOW BN_MAX_WINDOW_BITS_FOR_CTIME_EXPONENT_SIZE
+#endif
+
+/* The precomputed powers, |tmp|, |am| and (for |OPENSSL_BN_ASM_MONT5|) the copy
+ * of |n->d| fit in a buffer of this many bytes on the stack, for moduli up to
+ * 2048 bits. That is the size of the CRT halves of RSA-4096, so no private
+ * key operation needs a heap allocation. */
+#define MOD_EXP_CTIME_STACK_MAX_LIMBS (2048 / BN_BITS2)
+#define MOD_EXP_CTIME_STACK_BUF_LEN                                      \
+  (sizeof(BN_ULONG) * MOD_EXP_CTIME_STACK_MAX_LIMBS *                    \
+   ((1 << MOD_EXP_CTIME_MAX_WINDOW) + 3))
+
 /* Given a pointer value, compute the next address that is a cache line
  * multiple. */
 #define MOD_EXP_CTIME_ALIGN(x_)          \
@@ -268,12 +285,28 @@ int GFp_BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a_mont,
   int i, ret = 0, wvalue;
 
   int numPowers;
+  alignas(MOD_EXP_CTIME_MIN_CACHE_LINE_WIDTH) unsigned char
+      powerbufStack[MOD_EXP_CTIME_STACK_BUF_LEN];
   unsigned char *powerbufFree = NULL;
   int powerbufLen = 0;
   unsigned char *powerbuf = NULL;
   BIGNUM tmp, am;
 
   const int top = n->top;
+
+#if defined(RSAZ_AVX512_ENABLED)
+  if (GFp_rsaz_avx512_eligible(top)) {
+    /* |rr| may alias |a_mont|, and expanding it preserves its value. */
+    if (!GFp_bn_wexpand(rr, (size_t)top)) {
+      goto err;
+    }
+    GFp_rsaz_mod_exp_avx512(rr->d, a_mont, p, p_bits, one_mont, n, n0);
+    rr->top = top;
+    GFp_bn_correct_top(rr);
+    return 1;
+  }
+#endif
+
   /* The |OPENSSL_BN_ASM_MONT5| code requires top > 1. */
   if (top <= 1) {
     goto err;
@@ -296,27 +329,17 @@ int GFp_BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a_mont,
   powerbufLen +=
       sizeof(n->d[0]) *
       (top * numPowers + ((2 * top) > numPowers ? (2 * top) : numPowers));
-#ifdef alloca
-  if (powerbufLen < 3072) {
-    powerbufFree = alloca(powerbufLen + MOD_EXP_CTIME_MIN_CACHE_LINE_WIDTH);
-  } else
-#endif
-  {
+  if ((size_t)powerbufLen <= sizeof(powerbufStack)) {
+    powerbuf = powerbufStack;
+  } else {
     if ((powerbufFree = OPENSSL_malloc(
             powerbufLen + MOD_EXP_CTIME_MIN_CACHE_LINE_WIDTH)) == NULL) {
       goto err;
     }
+    powerbuf = MOD_EXP_CTIME_ALIGN(powerbufFree);
   }
-
-  powerbuf = MOD_EXP_CTIME_ALIGN(powerbufFree);
   memset(powerbuf, 0, powerbufLen);
 
-#ifdef alloca
-  if (powerbufLen < 3072) {
-    powerbufFree = NULL;
-  }
-#endif
-
   /* lay down tmp and am right after powers table */
   tmp.d = (BN_ULONG *)(powerbuf + sizeof(n->d[0]) * top * numPowers);
   am.d = tmp.d + top;
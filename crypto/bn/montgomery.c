@@ -111,7 +111,6 @@
 #include <assert.h>
 #include <string.h>
 
-#include <GFp/mem.h>
 #include <GFp/type_check.h>
 
 #include "internal.h"
@@ -210,6 +209,10 @@ int GFp_BN_from_montgomery_word(BIGNUM *ret, BIGNUM *r, const BIGNUM *n,
   return 1;
 }
 
+/* The largest modulus, in limbs, that |GFp_BN_mod_mul_mont| supports. This is
+ * the size of the largest RSA public modulus, 8192 bits. */
+#define BN_MOD_MUL_MONT_MAX_LIMBS (8192 / BN_BITS2)
+
 /* Assumes a < n and b < n */
 int GFp_BN_mod_mul_mont(BIGNUM *r, const BIGNUM *a, const BIGNUM *b,
                         const BIGNUM *n,
@@ -221,30 +224,35 @@ int GFp_BN_mod_mul_mont(BIGNUM *r, const BIGNUM *a, const BIGNUM *b,
     return 0;
   }
 
-  if (a->top == num && b->top == num) {
-    if (!GFp_bn_wexpand(r, num)) {
-      return 0;
-    }
-    GFp_bn_mul_mont(r->d, a->d, b->d, n->d, n0, num);
-    r->top = num;
-    GFp_bn_correct_top(r);
-    return 1;
+  if (num > BN_MOD_MUL_MONT_MAX_LIMBS || a->top > num || b->top > num) {
+    return 0;
   }
 
-  BIGNUM tmp;
-  GFp_BN_init(&tmp);
-
-  int ret = 0;
-
-  if (!GFp_BN_mul_no_alias(&tmp, a, b) ||
-      !GFp_BN_from_montgomery_word(r, &tmp, n, n0)) {
-    goto err;
+  /* |a| and/or |b| may alias |r|, so they must not be used until |r| has been
+   * expanded. */
+  if (!GFp_bn_wexpand(r, num)) {
+    return 0;
   }
 
-  ret = 1;
-
-err:
-  GFp_BN_free(&tmp);
+  /* Zero-pad shorter inputs on the stack so that |GFp_bn_mul_mont| can always
+   * be used. This avoids a heap-allocated temporary. */
+  BN_ULONG a_padded[BN_MOD_MUL_MONT_MAX_LIMBS];
+  BN_ULONG b_padded[BN_MOD_MUL_MONT_MAX_LIMBS];
+  const BN_ULONG *ap = a->d;
+  const BN_ULONG *bp = b->d;
+  if (a->top < num) {
+    memset(a_padded, 0, num * sizeof(a_padded[0]));
+    memcpy(a_padded, a->d, a->top * sizeof(a_padded[0]));
+    ap = a_padded;
+  }
+  if (b->top < num) {
+    memset(b_padded, 0, num * sizeof(b_padded[0]));
+    memcpy(b_padded, b->d, b->top * sizeof(b_padded[0]));
+    bp = b_padded;
+  }
 
-  return ret;
+  GFp_bn_mul_mont(r->d, ap, bp, n->d, n0, num);
+  r->top = num;
+  GFp_bn_correct_top(r);
+  return 1;
 }
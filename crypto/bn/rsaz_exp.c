@@ -0,0 +1,219 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* Constant-time modular exponentiation in radix 2**52 using the AVX-512 IFMA
+ * Almost Montgomery Multiplication (AMM) kernels in asm/rsaz-avx512.pl.
+ *
+ * Values are converted from the radix 2**64 Montgomery domain, with
+ * R = 2**(64*num), to the radix 2**52 domain, with R' = 2**(52*digits), by
+ * multiplying them by R'/R = 2**(52*digits - 64*num). Intermediate values are
+ * only reduced to [0, 2*n) by the AMM kernels; the result is fully reduced at
+ * the end. */
+
+#include "rsaz_exp.h"
+
+#if defined(RSAZ_AVX512_ENABLED)
+
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+
+#include <GFp/cpu.h>
+
+#include "../internal.h"
+#include "../limbs/limbs.h"
+
+
+#define RSAZ_DIGIT_BITS 52
+#define RSAZ_DIGIT_MASK ((((BN_ULONG)1) << RSAZ_DIGIT_BITS) - 1)
+
+/* The maximum number of (padded) digits, for 2048-bit moduli. */
+#define RSAZ_MAX_DIGITS 40
+#define RSAZ_MAX_LIMBS 32
+
+#define RSAZ_WINDOW 5
+#define RSAZ_TABLE_SIZE (1 << RSAZ_WINDOW)
+
+/* Implemented in asm/rsaz-avx512.pl. */
+void GFp_rsaz_amm52x20_avx512ifma(BN_ULONG res[], const BN_ULONG a[],
+                                  const BN_ULONG b[], const BN_ULONG m[],
+                                  BN_ULONG k0);
+void GFp_rsaz_amm52x30_avx512ifma(BN_ULONG res[], const BN_ULONG a[],
+                                  const BN_ULONG b[], const BN_ULONG m[],
+                                  BN_ULONG k0);
+void GFp_rsaz_amm52x40_avx512ifma(BN_ULONG res[], const BN_ULONG a[],
+                                  const BN_ULONG b[], const BN_ULONG m[],
+                                  BN_ULONG k0);
+
+typedef void (*AMM_FN)(BN_ULONG res[], const BN_ULONG a[], const BN_ULONG b[],
+                       const BN_ULONG m[], BN_ULONG k0);
+
+
+int GFp_rsaz_avx512_eligible(int num) {
+  /* AVX-512F (bit 16) and AVX-512 IFMA (bit 21) of CPUID leaf 7, EBX. The bits
+   * are cleared by |GFp_cpuid_setup| when the OS doesn't save the ZMM and
+   * opmask registers. */
+  static const uint32_t kAVX512FAndIFMA = (1u << 16) | (1u << 21);
+  if ((GFp_ia32cap_P[2] & kAVX512FAndIFMA) != kAVX512FAndIFMA) {
+    return 0;
+  }
+  return num == 16 || num == 24 || num == 32;
+}
+
+/* Converts the |num_limbs|-limb value |in| to |num_digits| 52-bit digits. The
+ * value must fit. */
+static void to_radix52(BN_ULONG out[], size_t num_digits, const BN_ULONG in[],
+                       size_t num_limbs) {
+  for (size_t i = 0; i < num_digits; ++i) {
+    size_t bit = i * RSAZ_DIGIT_BITS;
+    size_t limb = bit / BN_BITS2;
+    size_t shift = bit % BN_BITS2;
+    BN_ULONG digit = 0;
+    if (limb < num_limbs) {
+      digit = in[limb] >> shift;
+      if (shift > BN_BITS2 - RSAZ_DIGIT_BITS && limb + 1 < num_limbs) {
+        digit |= in[limb + 1] << (BN_BITS2 - shift);
+      }
+    }
+    out[i] = digit & RSAZ_DIGIT_MASK;
+  }
+}
+
+/* Converts the |num_digits| normalized 52-bit digits of |in| to |num_limbs|
+ * limbs. The value must fit. */
+static void from_radix52(BN_ULONG out[], size_t num_limbs,
+                         const BN_ULONG in[], size_t num_digits) {
+  memset(out, 0, num_limbs * sizeof(out[0]));
+  for (size_t i = 0; i < num_digits; ++i) {
+    size_t bit = i * RSAZ_DIGIT_BITS;
+    size_t limb = bit / BN_BITS2;
+    size_t shift = bit % BN_BITS2;
+    if (limb < num_limbs) {
+      out[limb] |= in[i] << shift;
+      if (shift > BN_BITS2 - RSAZ_DIGIT_BITS && limb + 1 < num_limbs) {
+        out[limb + 1] |= in[i] >> (BN_BITS2 - shift);
+      }
+    }
+  }
+}
+
+/* Copies entry |index| of |table| to |out| without leaking |index| through
+ * the memory access pattern. */
+static void gather(BN_ULONG out[], size_t num_padded,
+                   const BN_ULONG table[], size_t index) {
+  memset(out, 0, num_padded * sizeof(out[0]));
+  for (size_t i = 0; i < RSAZ_TABLE_SIZE; ++i) {
+    BN_ULONG mask = constant_time_eq_s(i, index);
+    for (size_t j = 0; j < num_padded; ++j) {
+      out[j] |= table[i * num_padded + j] & mask;
+    }
+  }
+}
+
+void GFp_rsaz_mod_exp_avx512(BN_ULONG r[], const BIGNUM *a_mont,
+                             const BIGNUM *p, size_t p_bits,
+                             const BIGNUM *one_mont, const BIGNUM *n,
+                             const BN_ULONG n0[/*BN_MONT_CTX_N0_LIMBS*/]) {
+  assert(GFp_rsaz_avx512_eligible(n->top));
+  assert(p_bits > 0);
+  assert(p_bits <= (size_t)INT_MAX);
+  assert(a_mont->top <= n->top);
+  assert(one_mont->top <= n->top);
+
+  const size_t num_limbs = (size_t)n->top;
+
+  AMM_FN amm;
+  size_t num_digits;
+  switch (num_limbs) {
+    case 16:
+      amm = GFp_rsaz_amm52x20_avx512ifma;
+      num_digits = 20;
+      break;
+    case 24:
+      amm = GFp_rsaz_amm52x30_avx512ifma;
+      num_digits = 30;
+      break;
+    default:
+      assert(num_limbs == 32);
+      amm = GFp_rsaz_amm52x40_avx512ifma;
+      num_digits = 40;
+      break;
+  }
+  /* The AMM kernels operate on whole zmm registers of eight digits. */
+  const size_t num_padded = (num_digits + 7) & ~(size_t)7;
+  const BN_ULONG k0 = n0[0] & RSAZ_DIGIT_MASK;
+
+  alignas(64) BN_ULONG table[RSAZ_TABLE_SIZE * RSAZ_MAX_DIGITS];
+  alignas(64) BN_ULONG m[RSAZ_MAX_DIGITS];
+  alignas(64) BN_ULONG acc[RSAZ_MAX_DIGITS];
+  alignas(64) BN_ULONG am[RSAZ_MAX_DIGITS];
+  BN_ULONG tmp[RSAZ_MAX_LIMBS];
+  BN_ULONG one[RSAZ_MAX_LIMBS];
+
+  memset(acc, 0, sizeof(acc));
+  memset(am, 0, sizeof(am));
+  memset(m, 0, sizeof(m));
+  to_radix52(m, num_digits, n->d, num_limbs);
+
+  /* Convert a*R and R to a*R' and R' by multiplying them by R'/R. */
+  const size_t shift = num_digits * RSAZ_DIGIT_BITS - num_limbs * BN_BITS2;
+
+  memset(tmp, 0, sizeof(tmp));
+  memcpy(tmp, a_mont->d, (size_t)a_mont->top * sizeof(tmp[0]));
+  memset(one, 0, sizeof(one));
+  memcpy(one, one_mont->d, (size_t)one_mont->top * sizeof(one[0]));
+  for (size_t i = 0; i < shift; ++i) {
+    LIMBS_shl_mod(tmp, tmp, n->d, num_limbs);
+    LIMBS_shl_mod(one, one, n->d, num_limbs);
+  }
+  to_radix52(am, num_digits, tmp, num_limbs);
+  to_radix52(acc, num_digits, one, num_limbs);
+
+  /* table[i] = a**i * R'. */
+  memset(table, 0, sizeof(table));
+  memcpy(&table[0 * num_padded], acc, num_padded * sizeof(acc[0]));
+  memcpy(&table[1 * num_padded], am, num_padded * sizeof(am[0]));
+  for (size_t i = 2; i < RSAZ_TABLE_SIZE; ++i) {
+    amm(&table[i * num_padded], &table[(i - 1) * num_padded], am, m, k0);
+  }
+
+  /* Scan the exponent one window at a time starting from the most significant
+   * bits, the same way |GFp_BN_mod_exp_mont_consttime| does. */
+  int bits = (int)p_bits - 1;
+  size_t wvalue = 0;
+  for (int i = bits % RSAZ_WINDOW; i >= 0; i--, bits--) {
+    wvalue = (wvalue << 1) + (size_t)GFp_BN_is_bit_set(p, bits);
+  }
+  gather(acc, num_padded, table, wvalue);
+
+  while (bits >= 0) {
+    wvalue = 0;
+    for (int i = 0; i < RSAZ_WINDOW; i++, bits--) {
+      amm(acc, acc, acc, m, k0);
+      wvalue = (wvalue << 1) + (size_t)GFp_BN_is_bit_set(p, bits);
+    }
+    gather(am, num_padded, table, wvalue);
+    amm(acc, acc, am, m, k0);
+  }
+
+  /* Convert out of the Montgomery domain. The result is at most |n|. */
+  memset(am, 0, sizeof(am));
+  am[0] = 1;
+  amm(acc, acc, am, m, k0);
+
+  from_radix52(r, num_limbs, acc, num_digits);
+  LIMBS_reduce_once(r, n->d, num_limbs);
+}
+
+#endif
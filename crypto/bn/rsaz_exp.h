@@ -0,0 +1,42 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+#ifndef RING_RSAZ_EXP_H
+#define RING_RSAZ_EXP_H
+
+#include <GFp/bn.h>
+
+#if defined(OPENSSL_X86_64) && !defined(OPENSSL_NO_ASM)
+#define RSAZ_AVX512_ENABLED
+
+/* GFp_rsaz_avx512_eligible returns one if |GFp_rsaz_mod_exp_avx512| can be
+ * used for a modulus of |num| limbs on this CPU, and zero otherwise. Only the
+ * 1024, 1536 and 2048 bit moduli of the CRT halves of RSA-2048, RSA-3072 and
+ * RSA-4096 are supported, and the CPU must support AVX-512F and AVX-512 IFMA.
+ */
+int GFp_rsaz_avx512_eligible(int num);
+
+/* GFp_rsaz_mod_exp_avx512 sets |r| to |a_mont|**|p| (mod |n|), fully reduced
+ * and *not* Montgomery-encoded, in constant time with respect to |a_mont| and
+ * |p|. |r| has |n->top| limbs. The arguments are the same as for
+ * |GFp_BN_mod_exp_mont_consttime| and |GFp_rsaz_avx512_eligible(n->top)| must
+ * be true. |r| may alias |a_mont->d|. */
+void GFp_rsaz_mod_exp_avx512(BN_ULONG r[], const BIGNUM *a_mont,
+                             const BIGNUM *p, size_t p_bits,
+                             const BIGNUM *one_mont, const BIGNUM *n,
+                             const BN_ULONG n0[/*BN_MONT_CTX_N0_LIMBS*/]);
+
+#endif
+
+#endif /* RING_RSAZ_EXP_H */
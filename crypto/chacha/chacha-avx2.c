@@ -0,0 +1,149 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* One ChaCha20 block for each of eight unrelated counter-and-nonce inputs,
+ * using AVX2. Lane |j| of each of the sixteen YMM registers holds one word of
+ * the state of the |j|th block.
+ *
+ * The assembly language code only does consecutive blocks under a single
+ * nonce. chacha20-poly1305@openssh.com instead needs the first block under a
+ * different nonce, the sequence number, for the packet length and Poly1305
+ * key of every packet, and this lets a burst of packets share the work. */
+
+#include <GFp/base.h>
+
+#include <assert.h>
+#include <string.h>
+
+#include <GFp/cpu.h>
+
+#include "../internal.h"
+
+
+#if defined(OPENSSL_X86_64) && !defined(OPENSSL_NO_ASM) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define CHACHA20_AVX2
+#endif
+
+
+/* Prototypes to avoid -Wmissing-prototypes warnings. */
+int GFp_ChaCha20_avx2_capable(void);
+void GFp_ChaCha20_blocks_x8_avx2(uint8_t out[8][64], const uint32_t key[8],
+                                 const uint32_t counters[8][4]);
+
+
+#if defined(CHACHA20_AVX2)
+
+#include <immintrin.h>
+
+#define AVX2 __attribute__((target("avx2")))
+
+int GFp_ChaCha20_avx2_capable(void) {
+  return (GFp_ia32cap_P[2] & (1u << 5)) != 0;
+}
+
+AVX2 static inline __m256i rotl(__m256i x, int n) {
+  return _mm256_or_si256(_mm256_slli_epi32(x, n),
+                         _mm256_srli_epi32(x, 32 - n));
+}
+
+/* Rotations by multiples of eight are byte shuffles. */
+AVX2 static inline __m256i rotl_bytes(__m256i x, __m256i shuffle) {
+  return _mm256_shuffle_epi8(x, shuffle);
+}
+
+#define QUARTERROUND(a, b, c, d)                               \
+  do {                                                         \
+    x[a] = _mm256_add_epi32(x[a], x[b]);                       \
+    x[d] = rotl_bytes(_mm256_xor_si256(x[d], x[a]), rot16);    \
+    x[c] = _mm256_add_epi32(x[c], x[d]);                       \
+    x[b] = rotl(_mm256_xor_si256(x[b], x[c]), 12);             \
+    x[a] = _mm256_add_epi32(x[a], x[b]);                       \
+    x[d] = rotl_bytes(_mm256_xor_si256(x[d], x[a]), rot8);     \
+    x[c] = _mm256_add_epi32(x[c], x[d]);                       \
+    x[b] = rotl(_mm256_xor_si256(x[b], x[c]), 7);              \
+  } while (0)
+
+/* Writes to |out[j]| the ChaCha20 block for |key| and |counters[j]|, where
+ * the counter is in the same form as for |GFp_ChaCha20_ctr32|: the 32-bit
+ * block counter followed by the three words of the nonce. */
+AVX2 void GFp_ChaCha20_blocks_x8_avx2(uint8_t out[8][64],
+                                      const uint32_t key[8],
+                                      const uint32_t counters[8][4]) {
+  static const uint32_t kSigma[4] = {
+    0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+  };
+  const __m256i rot16 = _mm256_set_epi8(
+      13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+      13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+  const __m256i rot8 = _mm256_set_epi8(
+      14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3,
+      14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3);
+
+  __m256i input[16];
+  for (size_t i = 0; i < 4; ++i) {
+    input[i] = _mm256_set1_epi32((int)kSigma[i]);
+  }
+  for (size_t i = 0; i < 8; ++i) {
+    input[4 + i] = _mm256_set1_epi32((int)key[i]);
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    input[12 + i] = _mm256_set_epi32(
+        (int)counters[7][i], (int)counters[6][i], (int)counters[5][i],
+        (int)counters[4][i], (int)counters[3][i], (int)counters[2][i],
+        (int)counters[1][i], (int)counters[0][i]);
+  }
+
+  __m256i x[16];
+  for (size_t i = 0; i < 16; ++i) {
+    x[i] = input[i];
+  }
+  for (size_t i = 0; i < 10; ++i) {
+    QUARTERROUND(0, 4, 8, 12);
+    QUARTERROUND(1, 5, 9, 13);
+    QUARTERROUND(2, 6, 10, 14);
+    QUARTERROUND(3, 7, 11, 15);
+    QUARTERROUND(0, 5, 10, 15);
+    QUARTERROUND(1, 6, 11, 12);
+    QUARTERROUND(2, 7, 8, 13);
+    QUARTERROUND(3, 4, 9, 14);
+  }
+
+  alignas(32) uint32_t words[16][8];
+  for (size_t i = 0; i < 16; ++i) {
+    _mm256_store_si256((__m256i *)words[i], _mm256_add_epi32(x[i], input[i]));
+  }
+  /* x86-64 is little-endian, so each word can be copied as it is. */
+  for (size_t j = 0; j < 8; ++j) {
+    for (size_t i = 0; i < 16; ++i) {
+      memcpy(&out[j][4 * i], &words[i][j], 4);
+    }
+  }
+}
+
+#else
+
+int GFp_ChaCha20_avx2_capable(void) {
+  return 0;
+}
+
+void GFp_ChaCha20_blocks_x8_avx2(uint8_t out[8][64], const uint32_t key[8],
+                                 const uint32_t counters[8][4]) {
+  (void)out;
+  (void)key;
+  (void)counters;
+  assert(0);
+}
+
+#endif
@@ -53,6 +53,7 @@
 #include <GFp/mem.h>
 
 #include "internal.h"
+#include "../aes/internal.h"
 #include "../internal.h"
 #include "../modes/internal.h"
 
@@ -68,6 +69,11 @@
  * -Wmissing-prototypes warnings. */
 int GFp_aes_gcm_init(void *ctx_buf, size_t ctx_buf_len, const uint8_t *key,
                      size_t key_len);
+int GFp_aes_gcm_init_compact(void *ctx_buf, size_t ctx_buf_len,
+                             const uint8_t *key, size_t key_len);
+int GFp_aes_gcm_expand_compact(void *ctx_buf, size_t ctx_buf_len,
+                               const void *compact_ctx_buf,
+                               size_t compact_ctx_buf_len);
 int GFp_aes_gcm_open(const void *ctx_buf, uint8_t *out, size_t in_out_len,
                      uint8_t tag_out[EVP_AEAD_AES_GCM_TAG_LEN],
                      const uint8_t nonce[EVP_AEAD_AES_GCM_NONCE_LEN],
@@ -76,6 +82,18 @@ int GFp_aes_gcm_seal(const void *ctx_buf, uint8_t *in_out, size_t in_out_len,
                      uint8_t tag_out[EVP_AEAD_AES_GCM_TAG_LEN],
                      const uint8_t nonce[EVP_AEAD_AES_GCM_NONCE_LEN],
                      const uint8_t *ad, size_t ad_len);
+int GFp_aes_gcm_stream_init(void *stream_buf, size_t stream_buf_len,
+                            const void *ctx_buf,
+                            const uint8_t nonce[EVP_AEAD_AES_GCM_NONCE_LEN]);
+void GFp_aes_gcm_stream_reset(void *stream_buf,
+                              const uint8_t nonce[EVP_AEAD_AES_GCM_NONCE_LEN]);
+int GFp_aes_gcm_stream_aad(void *stream_buf, const uint8_t *ad, size_t ad_len);
+int GFp_aes_gcm_stream_seal(void *stream_buf, uint8_t *in_out,
+                            size_t in_out_len);
+int GFp_aes_gcm_stream_open(void *stream_buf, uint8_t *in_out,
+                            size_t in_out_len);
+void GFp_aes_gcm_stream_tag(void *stream_buf,
+                            uint8_t tag_out[EVP_AEAD_AES_GCM_TAG_LEN]);
 int GFp_has_aes_hardware(void);
 
 
@@ -131,10 +149,6 @@ void GFp_aes_hw_ctr32_encrypt_blocks(const uint8_t *in, uint8_t *out,
                                      const uint8_t ivec[16]);
 #endif
 
-static void aes_ctr32_encrypt_blocks(const uint8_t *in, uint8_t *out,
-                                     size_t len, const AES_KEY *key,
-                                     const uint8_t ivec[16]);
-
 #if defined(VPAES)
 /* On platforms where VPAES gets defined (just above), then these functions are
  * provided by asm. */
@@ -179,7 +193,7 @@ static aes_set_key_f aes_set_key(void) {
   }
 #endif
 
-  return GFp_AES_set_encrypt_key;
+  return GFp_aes_nohw_set_encrypt_key;
 }
 
 static aes_block_f aes_block(void) {
@@ -209,7 +223,7 @@ static aes_block_f aes_block(void) {
   }
 #endif
 
-  return GFp_AES_encrypt;
+  return GFp_aes_nohw_encrypt;
 }
 
 static aes_ctr_f aes_ctr(void) {
@@ -233,7 +247,7 @@ static aes_ctr_f aes_ctr(void) {
   }
 #endif
 
-  return aes_ctr32_encrypt_blocks;
+  return GFp_aes_nohw_ctr32_encrypt_blocks;
 }
 
 #if defined(AESNI)
@@ -242,30 +256,6 @@ static char aesni_capable(void) {
 }
 #endif
 
-static void aes_ctr32_encrypt_blocks(const uint8_t *in, uint8_t *out,
-                                     size_t blocks, const AES_KEY *key,
-                                     const uint8_t ivec[16]) {
-  alignas(16) uint8_t counter_plaintext[16];
-  memcpy(counter_plaintext, ivec, 16);
-  uint32_t counter = from_be_u32_ptr(&counter_plaintext[12]);
-
-  aes_block_f block = aes_block();
-
-  for (size_t current_block = 0; current_block < blocks; ++current_block) {
-    alignas(16) uint8_t counter_ciphertext[16];
-    block(counter_plaintext, counter_ciphertext, key);
-    for (size_t i = 0; i < 16; ++i) {
-      out[i] = in[i] ^ counter_ciphertext[i];
-    }
-    /* The caller must ensure the counter won't wrap around. */
-    ++counter;
-    assert(counter != 0);
-    to_be_u32_ptr(&counter_plaintext[12], counter);
-    out += 16;
-    in += 16;
-  }
-}
-
 int GFp_aes_gcm_init(void *ctx_buf, size_t ctx_buf_len, const uint8_t *key,
                      size_t key_len) {
   alignas(16) AES_KEY ks;
@@ -283,6 +273,41 @@ int GFp_aes_gcm_init(void *ctx_buf, size_t ctx_buf_len, const uint8_t *key,
   return 1;
 }
 
+/* A compact context is only the key schedule; the serialized GHASH table is
+ * left out to save space and is recomputed by |GFp_aes_gcm_expand_compact|
+ * when the key is used. */
+int GFp_aes_gcm_init_compact(void *ctx_buf, size_t ctx_buf_len,
+                             const uint8_t *key, size_t key_len) {
+  alignas(16) AES_KEY ks;
+  assert(ctx_buf_len >= sizeof(ks));
+  if (ctx_buf_len < sizeof(ks)) {
+    return 0;
+  }
+
+  (void)(aes_set_key())(key, (unsigned)key_len * 8, &ks);
+  memcpy(ctx_buf, &ks, sizeof(ks));
+  return 1;
+}
+
+/* Writes the full context of the compact context |compact_ctx_buf|, as
+ * |GFp_aes_gcm_init| would have, to |ctx_buf|. */
+int GFp_aes_gcm_expand_compact(void *ctx_buf, size_t ctx_buf_len,
+                               const void *compact_ctx_buf,
+                               size_t compact_ctx_buf_len) {
+  alignas(16) AES_KEY ks;
+  assert(ctx_buf_len >= sizeof(ks) + GCM128_SERIALIZED_LEN);
+  assert(compact_ctx_buf_len >= sizeof(ks));
+  if (ctx_buf_len < sizeof(ks) + GCM128_SERIALIZED_LEN ||
+      compact_ctx_buf_len < sizeof(ks)) {
+    return 0;
+  }
+
+  memcpy(&ks, compact_ctx_buf, sizeof(ks));
+  GFp_gcm128_init_serialized((uint8_t *)ctx_buf + sizeof(ks), &ks, aes_block());
+  memcpy(ctx_buf, &ks, sizeof(ks));
+  return 1;
+}
+
 static int gfp_aes_gcm_init_and_aad(GCM128_CONTEXT *gcm, AES_KEY *ks,
                                     const void *ctx_buf, const uint8_t nonce[],
                                     const uint8_t ad[], size_t ad_len) {
@@ -347,6 +372,78 @@ int GFp_aes_gcm_open(const void *ctx_buf, uint8_t *out, size_t in_out_len,
   return 1;
 }
 
+/* aes_gcm_stream is the state of a seal or open operation whose AD and input
+ * are given in pieces, e.g. when they are scattered across several buffers.
+ * It lives in a 16-byte-aligned buffer of |AES_GCM_STREAM_BUF_LEN| bytes
+ * provided by the caller. It doesn't contain any pointers into itself, so the
+ * caller may move the buffer between calls. */
+typedef struct {
+  GCM128_CONTEXT gcm;
+  alignas(16) AES_KEY ks;
+} aes_gcm_stream;
+
+/* Keep this in sync with |STREAM_BUF_ELEMS| in src/aead/aes_gcm.rs. */
+#define AES_GCM_STREAM_BUF_LEN (GCM128_SERIALIZED_LEN + 384)
+
+OPENSSL_COMPILE_ASSERT(sizeof(aes_gcm_stream) <= AES_GCM_STREAM_BUF_LEN,
+                       AES_GCM_STREAM_BUF_LEN_too_small);
+
+static aes_gcm_stream *aes_gcm_stream_from_buf(void *stream_buf) {
+  assert(((uintptr_t)stream_buf & 15) == 0);
+  return stream_buf;
+}
+
+int GFp_aes_gcm_stream_init(void *stream_buf, size_t stream_buf_len,
+                            const void *ctx_buf,
+                            const uint8_t nonce[EVP_AEAD_AES_GCM_NONCE_LEN]) {
+  /* On x86-64 the Rust code always makes room for the larger table of the
+   * VAES code, even when it isn't compiled in. */
+  assert(stream_buf_len >= AES_GCM_STREAM_BUF_LEN);
+  if (stream_buf_len < sizeof(aes_gcm_stream)) {
+    return 0;
+  }
+  aes_gcm_stream *stream = aes_gcm_stream_from_buf(stream_buf);
+  return gfp_aes_gcm_init_and_aad(&stream->gcm, &stream->ks, ctx_buf, nonce,
+                                  NULL, 0);
+}
+
+/* GFp_aes_gcm_stream_reset starts a new operation with the same key as the
+ * one that |stream_buf| was initialized for, without copying or setting up the
+ * key again. */
+void GFp_aes_gcm_stream_reset(void *stream_buf,
+                              const uint8_t nonce[EVP_AEAD_AES_GCM_NONCE_LEN]) {
+  aes_gcm_stream *stream = aes_gcm_stream_from_buf(stream_buf);
+  GFp_gcm128_reset(&stream->gcm, &stream->ks, nonce);
+}
+
+int GFp_aes_gcm_stream_aad(void *stream_buf, const uint8_t *ad,
+                           size_t ad_len) {
+  assert(ad != NULL || ad_len == 0);
+  aes_gcm_stream *stream = aes_gcm_stream_from_buf(stream_buf);
+  return GFp_gcm128_aad(&stream->gcm, ad, ad_len);
+}
+
+int GFp_aes_gcm_stream_seal(void *stream_buf, uint8_t *in_out,
+                            size_t in_out_len) {
+  assert(in_out != NULL || in_out_len == 0);
+  aes_gcm_stream *stream = aes_gcm_stream_from_buf(stream_buf);
+  return GFp_gcm128_encrypt_ctr32(&stream->gcm, &stream->ks, in_out, in_out,
+                                  in_out_len, aes_ctr());
+}
+
+int GFp_aes_gcm_stream_open(void *stream_buf, uint8_t *in_out,
+                            size_t in_out_len) {
+  assert(in_out != NULL || in_out_len == 0);
+  aes_gcm_stream *stream = aes_gcm_stream_from_buf(stream_buf);
+  return GFp_gcm128_decrypt_ctr32(&stream->gcm, &stream->ks, in_out, in_out,
+                                  in_out_len, aes_ctr());
+}
+
+void GFp_aes_gcm_stream_tag(void *stream_buf,
+                            uint8_t tag_out[EVP_AEAD_AES_GCM_TAG_LEN]) {
+  aes_gcm_stream *stream = aes_gcm_stream_from_buf(stream_buf);
+  GFp_gcm128_tag(&stream->gcm, tag_out);
+}
 
 int GFp_has_aes_hardware(void) {
 #if defined(AESNI)
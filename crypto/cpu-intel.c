@@ -57,7 +57,8 @@
 #include <GFp/cpu.h>
 
 
-#if !defined(OPENSSL_NO_ASM) && (defined(OPENSSL_X86) || defined(OPENSSL_X86_64))
+#if !defined(OPENSSL_NO_ASM) && !defined(OPENSSL_STATIC_IA32CAP) && \
+    (defined(OPENSSL_X86) || defined(OPENSSL_X86_64))
 
 #include <inttypes.h>
 
@@ -135,9 +136,11 @@ void GFp_cpuid_setup(void) {
 
 
   uint32_t extended_features = 0;
+  uint32_t extended_features_ecx = 0;
   if (num_ids >= 7) {
     OPENSSL_cpuid(&eax, &ebx, &ecx, &edx, 7);
     extended_features = ebx;
+    extended_features_ecx = ecx;
   }
 
   /* Determine the number of cores sharing an L1 data cache to adjust the
@@ -189,12 +192,25 @@ void GFp_cpuid_setup(void) {
     ecx &= ~(1 << 28); /* AVX */
     ecx &= ~(1 << 12); /* FMA */
     extended_features &= ~(1 << 5); /* AVX2 */
+    extended_features_ecx &= ~(1u << 9); /* VAES */
+    extended_features_ecx &= ~(1u << 10); /* VPCLMULQDQ */
+  }
+  /* The opmask registers and the upper halves of the ZMM registers must also
+   * be saved by the OS for AVX-512 to be used. */
+  if ((xcr0 & 0xe6) != 0xe6) {
+    extended_features &= ~(1u << 16); /* AVX512F */
+    extended_features &= ~(1u << 17); /* AVX512DQ */
+    extended_features &= ~(1u << 21); /* AVX512IFMA */
+    extended_features &= ~(1u << 28); /* AVX512CD */
+    extended_features &= ~(1u << 30); /* AVX512BW */
+    extended_features &= ~(1u << 31); /* AVX512VL */
   }
 
   GFp_ia32cap_P[0] = edx;
   GFp_ia32cap_P[1] = ecx;
   GFp_ia32cap_P[2] = extended_features;
-  GFp_ia32cap_P[3] = 0;
+  GFp_ia32cap_P[3] = extended_features_ecx;
 }
 
-#endif  /* !OPENSSL_NO_ASM && (OPENSSL_X86 || OPENSSL_X86_64) */
+#endif  /* !OPENSSL_NO_ASM && !OPENSSL_STATIC_IA32CAP &&
+          (OPENSSL_X86 || OPENSSL_X86_64) */
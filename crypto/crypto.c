@@ -42,6 +42,16 @@
 
 
 #if defined(OPENSSL_X86) || defined(OPENSSL_X86_64)
+#if defined(OPENSSL_STATIC_IA32CAP)
+/* The features that the target is compiled for; see |static_cpu_defines| in
+ * build.rs. |GFp_cpuid_setup| isn't used. */
+uint32_t GFp_ia32cap_P[4] = {
+  OPENSSL_STATIC_IA32CAP_0,
+  OPENSSL_STATIC_IA32CAP_1,
+  OPENSSL_STATIC_IA32CAP_2,
+  OPENSSL_STATIC_IA32CAP_3,
+};
+#else
 /* This value must be explicitly initialised to zero in order to work around a
  * bug in libtool or the linker on OS X.
  *
@@ -50,6 +60,7 @@
  * initialising it to zero, it becomes a "data symbol", which isn't so
  * affected. */
 uint32_t GFp_ia32cap_P[4] = {0};
+#endif
 #elif defined(OPENSSL_ARM) || defined(OPENSSL_AARCH64)
 
 #include <GFp/arm_arch.h>
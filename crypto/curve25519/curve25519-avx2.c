@@ -0,0 +1,438 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* Edwards25519 point arithmetic using AVX2, in the style of "Accelerating
+ * Ed25519 Signature Verification with Data Parallelism" and of the AVX2
+ * backend of curve25519-dalek.
+ *
+ * A point (X:Y:Z:T) in extended coordinates is kept in one |fe4|, which holds
+ * the four coordinates in the four 64-bit lanes of each of its vectors. The
+ * point formulas of "Twisted Edwards Curves Revisited" by Hisil, Wong, Carter
+ * and Dawson are arranged so that each point addition and each doubling is
+ * two four-way multiplications plus some lane shuffling.
+ *
+ * Each limb of a field element is stored *unsigned* in a 64-bit lane, using
+ * the same radix 2^25.5 as |fe|. After every operation the limbs are reduced
+ * so they are at most a little more than 2^26 (even limbs) or 2^25 (odd
+ * limbs), which is what |fe4_mul| and |fe4_sub| require of their inputs. */
+
+#include "internal.h"
+
+#if defined(CURVE25519_AVX2)
+
+#include <immintrin.h>
+#include <string.h>
+
+#include <GFp/cpu.h>
+
+
+#define AVX2 __attribute__((target("avx2")))
+
+/* The 64-bit lane |i| of a vector is selected by |LANES(l0, l1, l2, l3)|
+ * from lane |li| of the source, for |_mm256_permute4x64_epi64|. */
+#define LANES(l0, l1, l2, l3) ((l0) | ((l1) << 2) | ((l2) << 4) | ((l3) << 6))
+
+/* The 64-bit lanes whose bit is set in |lane_mask| are taken from the second
+ * operand of |_mm256_blend_epi32|. */
+#define BLEND_LANES(m)                                                   \
+  ((((m) & 1) ? 0x03 : 0) | (((m) & 2) ? 0x0c : 0) | (((m) & 4) ? 0x30 : 0) | \
+   (((m) & 8) ? 0xc0 : 0))
+
+typedef struct {
+  __m256i v[10];
+} fe4;
+
+#define FE4_PERMUTE(h, f, imm)                                  \
+  do {                                                          \
+    size_t i_;                                                  \
+    for (i_ = 0; i_ < 10; ++i_) {                               \
+      (h)->v[i_] = _mm256_permute4x64_epi64((f)->v[i_], (imm)); \
+    }                                                           \
+  } while (0)
+
+#define FE4_BLEND(h, f, g, lane_mask)                                   \
+  do {                                                                  \
+    size_t i_;                                                          \
+    for (i_ = 0; i_ < 10; ++i_) {                                       \
+      (h)->v[i_] = _mm256_blend_epi32((f)->v[i_], (g)->v[i_],           \
+                                      BLEND_LANES(lane_mask));          \
+    }                                                                   \
+  } while (0)
+
+static const int kLimbBits[10] = {26, 25, 26, 25, 26, 25, 26, 25, 26, 25};
+
+/* 4p, limb by limb, for making limbs non-negative when packing. */
+static const int64_t k4P[10] = {
+    0xfffffb4, 0x7fffffc, 0xffffffc, 0x7fffffc, 0xffffffc,
+    0x7fffffc, 0xffffffc, 0x7fffffc, 0xffffffc, 0x7fffffc,
+};
+
+/* 2p, limb by limb, which is added to the minuend by |fe4_sub|. */
+static const int64_t k2P[10] = {
+    0x7ffffda, 0x3fffffe, 0x7fffffe, 0x3fffffe, 0x7fffffe,
+    0x3fffffe, 0x7fffffe, 0x3fffffe, 0x7fffffe, 0x3fffffe,
+};
+
+static const fe kOne = {1, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+static const fe kZero = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+AVX2 static __m256i mul19(__m256i x) {
+  return _mm256_add_epi64(
+      x, _mm256_add_epi64(_mm256_slli_epi64(x, 1), _mm256_slli_epi64(x, 4)));
+}
+
+AVX2 static __m256i limb_mask(size_t i) {
+  return _mm256_set1_epi64x((INT64_C(1) << kLimbBits[i]) - 1);
+}
+
+/* Carries each limb into the next one, all at once. This reduces limbs of up
+ * to 2^29 or so. */
+AVX2 static void fe4_carry(fe4 *h) {
+  __m256i c[10];
+  size_t i;
+  for (i = 0; i < 10; ++i) {
+    c[i] = _mm256_srli_epi64(h->v[i], kLimbBits[i]);
+    h->v[i] = _mm256_and_si256(h->v[i], limb_mask(i));
+  }
+  for (i = 1; i < 10; ++i) {
+    h->v[i] = _mm256_add_epi64(h->v[i], c[i - 1]);
+  }
+  h->v[0] = _mm256_add_epi64(h->v[0], mul19(c[9]));
+}
+
+/* Carries limb |i| into limb |i + 1|, or into limb 0 for |i == 9|. */
+AVX2 static void fe4_carry_one(fe4 *h, size_t i) {
+  __m256i c = _mm256_srli_epi64(h->v[i], kLimbBits[i]);
+  h->v[i] = _mm256_and_si256(h->v[i], limb_mask(i));
+  if (i == 9) {
+    h->v[0] = _mm256_add_epi64(h->v[0], mul19(c));
+  } else {
+    h->v[i + 1] = _mm256_add_epi64(h->v[i + 1], c);
+  }
+}
+
+AVX2 static void fe4_add(fe4 *h, const fe4 *f, const fe4 *g) {
+  size_t i;
+  for (i = 0; i < 10; ++i) {
+    h->v[i] = _mm256_add_epi64(f->v[i], g->v[i]);
+  }
+  fe4_carry(h);
+}
+
+/* h = f + 2p - g. */
+AVX2 static void fe4_sub(fe4 *h, const fe4 *f, const fe4 *g) {
+  size_t i;
+  for (i = 0; i < 10; ++i) {
+    h->v[i] = _mm256_sub_epi64(
+        _mm256_add_epi64(f->v[i], _mm256_set1_epi64x(k2P[i])), g->v[i]);
+  }
+  fe4_carry(h);
+}
+
+/* This is |GFp_fe_mul| done four times at once with |_mm256_mul_epu32|. Every
+ * product is at most 2^26 * 19 * 2^26.01, so the sum of ten of them can't
+ * overflow 64 bits. */
+AVX2 static void fe4_mul(fe4 *h, const fe4 *f, const fe4 *g) {
+  __m256i f2[10];
+  __m256i g19[10];
+  __m256i t[10];
+  size_t i;
+  size_t j;
+
+  for (i = 0; i < 10; ++i) {
+    f2[i] = _mm256_add_epi64(f->v[i], f->v[i]);
+    g19[i] = mul19(g->v[i]);
+    t[i] = _mm256_setzero_si256();
+  }
+
+  for (i = 0; i < 10; ++i) {
+    for (j = 0; j < 10; ++j) {
+      __m256i fi = ((i & j & 1) != 0) ? f2[i] : f->v[i];
+      __m256i gj = (i + j >= 10) ? g19[j] : g->v[j];
+      size_t k = (i + j) % 10;
+      t[k] = _mm256_add_epi64(t[k], _mm256_mul_epu32(fi, gj));
+    }
+  }
+
+  memcpy(h->v, t, sizeof(t));
+  fe4_carry_one(h, 0);
+  fe4_carry_one(h, 4);
+  fe4_carry_one(h, 1);
+  fe4_carry_one(h, 5);
+  fe4_carry_one(h, 2);
+  fe4_carry_one(h, 6);
+  fe4_carry_one(h, 3);
+  fe4_carry_one(h, 7);
+  fe4_carry_one(h, 4);
+  fe4_carry_one(h, 8);
+  fe4_carry_one(h, 9);
+  fe4_carry_one(h, 0);
+}
+
+/* Sets lane |i| of |h| to |coeffs[i] * f[i]|, where |coeffs[i]| is -1, 1 or
+ * 2 and |f[i]| is bounded as described for |fe|. */
+AVX2 static void fe4_pack(fe4 *h, const int32_t *const f[4],
+                          const int64_t coeffs[4]) {
+  size_t i;
+  for (i = 0; i < 10; ++i) {
+    int64_t l[4];
+    size_t lane;
+    for (lane = 0; lane < 4; ++lane) {
+      l[lane] = k4P[i] + coeffs[lane] * (int64_t)f[lane][i];
+    }
+    h->v[i] = _mm256_set_epi64x(l[3], l[2], l[1], l[0]);
+  }
+  fe4_carry(h);
+}
+
+/* Sets |out| to lane |lane| of |f|, carried like the output of
+ * |GFp_fe_mul|. */
+static void fe4_unpack_lane(fe out, uint64_t limbs[10][4], size_t lane) {
+  int64_t h[10];
+  int64_t carry;
+  size_t i;
+  for (i = 0; i < 10; ++i) {
+    h[i] = (int64_t)limbs[i][lane];
+  }
+
+#define CARRY(i, j, bits, mul)                                 \
+  carry = (h[i] + (INT64_C(1) << ((bits) - 1))) >> (bits);     \
+  h[j] += carry * (mul);                                       \
+  h[i] -= carry * (INT64_C(1) << (bits));
+
+  CARRY(0, 1, 26, 1)
+  CARRY(4, 5, 26, 1)
+  CARRY(1, 2, 25, 1)
+  CARRY(5, 6, 25, 1)
+  CARRY(2, 3, 26, 1)
+  CARRY(6, 7, 26, 1)
+  CARRY(3, 4, 25, 1)
+  CARRY(7, 8, 25, 1)
+  CARRY(4, 5, 26, 1)
+  CARRY(8, 9, 26, 1)
+  CARRY(9, 0, 25, 19)
+  CARRY(0, 1, 26, 1)
+
+#undef CARRY
+
+  for (i = 0; i < 10; ++i) {
+    out[i] = (int32_t)h[i];
+  }
+}
+
+AVX2 static void fe4_unpack(fe out[4], const fe4 *f) {
+  uint64_t limbs[10][4];
+  size_t i;
+  for (i = 0; i < 10; ++i) {
+    _mm256_storeu_si256((__m256i *)limbs[i], f->v[i]);
+  }
+  for (i = 0; i < 4; ++i) {
+    fe4_unpack_lane(out[i], limbs, i);
+  }
+}
+
+/* (X:Y:Z:T) = (0:1:1:0). */
+AVX2 static void point4_0(fe4 *p) {
+  const int32_t *const f[4] = {kZero, kOne, kOne, kZero};
+  static const int64_t coeffs[4] = {1, 1, 1, 1};
+  fe4_pack(p, f, coeffs);
+}
+
+/* Sets |q| to the cached form (Y-X, Y+X, 2Z, 2dT) of |c|, or of -|c| if
+ * |negate| is non-zero. */
+AVX2 static void point4_from_cached(fe4 *q, const ge_cached *c, int negate) {
+  static const int64_t kCoeffs[4] = {1, 1, 2, 1};
+  static const int64_t kNegCoeffs[4] = {1, 1, 2, -1};
+  if (negate) {
+    const int32_t *const f[4] = {c->YplusX, c->YminusX, c->Z, c->T2d};
+    fe4_pack(q, f, kNegCoeffs);
+  } else {
+    const int32_t *const f[4] = {c->YminusX, c->YplusX, c->Z, c->T2d};
+    fe4_pack(q, f, kCoeffs);
+  }
+}
+
+/* Like |point4_from_cached|, for a point with Z = 1. */
+AVX2 static void point4_from_precomp(fe4 *q, const ge_precomp *c, int negate) {
+  static const int64_t kCoeffs[4] = {1, 1, 2, 1};
+  static const int64_t kNegCoeffs[4] = {1, 1, 2, -1};
+  if (negate) {
+    const int32_t *const f[4] = {c->yplusx, c->yminusx, kOne, c->xy2d};
+    fe4_pack(q, f, kNegCoeffs);
+  } else {
+    const int32_t *const f[4] = {c->yminusx, c->yplusx, kOne, c->xy2d};
+    fe4_pack(q, f, kCoeffs);
+  }
+}
+
+/* Given (E, H, G, F) in |ds|, sets |p| to (E*F, G*H, F*G, E*H), which is the
+ * last step of both the addition and the doubling formulas. */
+AVX2 static void point4_finish(fe4 *p, const fe4 *ds) {
+  fe4 lhs;
+  fe4 rhs;
+  FE4_PERMUTE(&lhs, ds, LANES(0, 2, 3, 0)); /* (E, G, F, E) */
+  FE4_PERMUTE(&rhs, ds, LANES(3, 1, 2, 1)); /* (F, H, G, H) */
+  fe4_mul(p, &lhs, &rhs);
+}
+
+/* p = p + q, where |q| is in cached form. This is add-2008-hwcd-3. */
+AVX2 static void point4_add(fe4 *p, const fe4 *q) {
+  fe4 swapped;
+  fe4 d;
+  fe4 s;
+  fe4 m;
+  fe4 ds;
+
+  /* (Y1-X1, Y1+X1, Z1, T1). */
+  FE4_PERMUTE(&swapped, p, LANES(1, 0, 2, 3));
+  fe4_sub(&d, &swapped, p);
+  fe4_add(&s, &swapped, p);
+  FE4_BLEND(p, p, &d, 1);
+  FE4_BLEND(p, p, &s, 2);
+
+  /* (A, B, D, C). */
+  fe4_mul(&m, p, q);
+
+  /* (E, -E, -F, F) and (H, H, G, G). */
+  FE4_PERMUTE(&swapped, &m, LANES(1, 0, 3, 2));
+  fe4_sub(&d, &swapped, &m);
+  fe4_add(&s, &m, &swapped);
+
+  FE4_BLEND(&ds, &s, &d, 1 | 8); /* (E, H, G, F) */
+  point4_finish(p, &ds);
+}
+
+/* p = 2 * p. This is dbl-2008-hwcd. */
+AVX2 static void point4_dbl(fe4 *p) {
+  static const fe4 kZero4; /* All zero. */
+  fe4 t;
+  fe4 u;
+  fe4 sq;
+  fe4 p1;
+  fe4 p2;
+  fe4 ds;
+
+  /* (X1, Y1, Z1, X1+Y1). */
+  FE4_PERMUTE(&t, p, LANES(1, 0, 2, 3));
+  fe4_add(&u, p, &t);
+  FE4_PERMUTE(&u, &u, LANES(0, 0, 0, 0));
+  FE4_BLEND(&t, p, &u, 8);
+
+  /* (A, B, Z1^2, (X1+Y1)^2). */
+  fe4_mul(&sq, &t, &t);
+
+  /* (A+B, A+B, 2*Z1^2+A, A). */
+  FE4_PERMUTE(&t, &sq, LANES(1, 0, 2, 3));
+  fe4_add(&t, &sq, &t);
+  FE4_BLEND(&t, &t, &kZero4, 8);
+  FE4_PERMUTE(&u, &sq, LANES(0, 0, 0, 0));
+  FE4_BLEND(&u, &kZero4, &u, 4 | 8);
+  fe4_add(&p2, &t, &u);
+
+  /* ((X1+Y1)^2, 0, B, B). */
+  FE4_PERMUTE(&u, &sq, LANES(3, 1, 1, 1));
+  FE4_BLEND(&p1, &kZero4, &u, 1 | 4 | 8);
+
+  /* (E, H, F, G), rearranged to (E, H, G, F). */
+  fe4_sub(&u, &p1, &p2);
+  FE4_PERMUTE(&ds, &u, LANES(0, 1, 3, 2));
+  point4_finish(p, &ds);
+}
+
+int GFp_curve25519_avx2_capable(void) {
+  return (GFp_ia32cap_P[2] & (1u << 5)) != 0;
+}
+
+AVX2 void GFp_ge_multi_scalarmult_vartime_avx2(ge_p2 *r,
+                                               const signed char *aslide,
+                                               const ge_cached *Ai, size_t num,
+                                               const signed char *bslide,
+                                               const ge_precomp Bi[8]) {
+  fe4 p;
+  fe4 q;
+  fe coords[4];
+  size_t j;
+  int i;
+
+  point4_0(&p);
+
+  for (i = 255; i >= 0; --i) {
+    int nonzero = bslide[i] != 0;
+    for (j = 0; j < num; ++j) {
+      nonzero |= aslide[256 * j + (size_t)i] != 0;
+    }
+    if (nonzero) {
+      break;
+    }
+  }
+
+  for (; i >= 0; --i) {
+    point4_dbl(&p);
+
+    for (j = 0; j < num; ++j) {
+      signed char a = aslide[256 * j + (size_t)i];
+      if (a > 0) {
+        point4_from_cached(&q, &Ai[8 * j + (size_t)(a / 2)], 0);
+        point4_add(&p, &q);
+      } else if (a < 0) {
+        point4_from_cached(&q, &Ai[8 * j + (size_t)(-a / 2)], 1);
+        point4_add(&p, &q);
+      }
+    }
+
+    if (bslide[i] > 0) {
+      point4_from_precomp(&q, &Bi[bslide[i] / 2], 0);
+      point4_add(&p, &q);
+    } else if (bslide[i] < 0) {
+      point4_from_precomp(&q, &Bi[(-bslide[i]) / 2], 1);
+      point4_add(&p, &q);
+    }
+  }
+
+  fe4_unpack(coords, &p);
+  memcpy(r->X, coords[0], sizeof(fe));
+  memcpy(r->Y, coords[1], sizeof(fe));
+  memcpy(r->Z, coords[2], sizeof(fe));
+}
+
+AVX2 void GFp_x25519_ge_scalarmult_base_avx2(ge_p3 *h, const ge_precomp t[64]) {
+  fe4 p;
+  fe4 q;
+  fe coords[4];
+  size_t i;
+
+  point4_0(&p);
+  for (i = 1; i < 64; i += 2) {
+    point4_from_precomp(&q, &t[i], 0);
+    point4_add(&p, &q);
+  }
+
+  point4_dbl(&p);
+  point4_dbl(&p);
+  point4_dbl(&p);
+  point4_dbl(&p);
+
+  for (i = 0; i < 64; i += 2) {
+    point4_from_precomp(&q, &t[i], 0);
+    point4_add(&p, &q);
+  }
+
+  fe4_unpack(coords, &p);
+  memcpy(h->X, coords[0], sizeof(fe));
+  memcpy(h->Y, coords[1], sizeof(fe));
+  memcpy(h->Z, coords[2], sizeof(fe));
+  memcpy(h->T, coords[3], sizeof(fe));
+}
+
+#endif
@@ -19,6 +19,7 @@
  *
  * The field functions are shared by Ed25519 and X25519 where possible. */
 
+#include <assert.h>
 #include <string.h>
 
 #include <GFp/cpu.h>
@@ -30,13 +31,17 @@
 
 
 /* Prevent -Wmissing-prototypes warnings. */
-void GFp_curve25519_scalar_mask(uint8_t a[32]);
 void GFp_fe_invert(fe out, const fe z);
 uint8_t GFp_fe_isnegative(const fe f);
 void GFp_fe_mul(fe h, const fe f, const fe g);
 void GFp_fe_tobytes(uint8_t *s, const fe h);
 void GFp_ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
-                                      const ge_p3 *A, const uint8_t *b);
+                                      const ge_cached Ai[8],
+                                      const uint8_t *b);
+void GFp_ge_multi_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
+                                     const ge_cached Ai[][8], size_t num,
+                                     const uint8_t *b);
+void GFp_ge_p3_odd_multiples(ge_cached Ai[8], const ge_p3 *A);
 int GFp_x25519_ge_frombytes_vartime(ge_p3 *h, const uint8_t *s);
 void GFp_x25519_ge_scalarmult_base(ge_p3 *h, const uint8_t a[32]);
 void GFp_x25519_sc_muladd(uint8_t *s, const uint8_t *a, const uint8_t *b,
@@ -3490,6 +3495,17 @@ void GFp_x25519_ge_scalarmult_base(ge_p3 *h, const uint8_t *a) {
   e[63] += carry;
   /* each e[i] is between -8 and 8 */
 
+#if defined(CURVE25519_AVX2)
+  if (GFp_curve25519_avx2_capable()) {
+    ge_precomp selected[64];
+    for (i = 0; i < 64; ++i) {
+      table_select(&selected[i], i / 2, e[i]);
+    }
+    GFp_x25519_ge_scalarmult_base_avx2(h, selected);
+    return;
+  }
+#endif
+
   ge_p3_0(h);
   for (i = 1; i < 64; i += 2) {
     table_select(&t, i / 2, e[i]);
@@ -3616,52 +3632,53 @@ static const ge_precomp Bi[8] = {
     },
 };
 
-/* r = a * A + b * B
- * where a = a[0]+256*a[1]+...+256^31 a[31].
- * and b = b[0]+256*b[1]+...+256^31 b[31].
- * B is the Ed25519 base point (x,4/5) with x positive. */
-void GFp_ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
-                                      const ge_p3 *A, const uint8_t *b) {
-  signed char aslide[256];
-  signed char bslide[256];
-  ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
+/* Ai = A,3A,5A,7A,9A,11A,13A,15A, the table that
+ * |GFp_ge_double_scalarmult_vartime| and |GFp_ge_multi_scalarmult_vartime|
+ * take for A. */
+void GFp_ge_p3_odd_multiples(ge_cached Ai[8], const ge_p3 *A) {
   ge_p1p1 t;
   ge_p3 u;
   ge_p3 A2;
   int i;
 
-  slide(aslide, a);
-  slide(bslide, b);
-
   x25519_ge_p3_to_cached(&Ai[0], A);
   ge_p3_dbl(&t, A);
   x25519_ge_p1p1_to_p3(&A2, &t);
-  x25519_ge_add(&t, &A2, &Ai[0]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[1], &u);
-  x25519_ge_add(&t, &A2, &Ai[1]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[2], &u);
-  x25519_ge_add(&t, &A2, &Ai[2]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[3], &u);
-  x25519_ge_add(&t, &A2, &Ai[3]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[4], &u);
-  x25519_ge_add(&t, &A2, &Ai[4]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[5], &u);
-  x25519_ge_add(&t, &A2, &Ai[5]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[6], &u);
-  x25519_ge_add(&t, &A2, &Ai[6]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[7], &u);
+  for (i = 1; i < 8; ++i) {
+    x25519_ge_add(&t, &A2, &Ai[i - 1]);
+    x25519_ge_p1p1_to_p3(&u, &t);
+    x25519_ge_p3_to_cached(&Ai[i], &u);
+  }
+}
+
+/* r = the sum of the |num| points with the tables |Ai[8 * j]|...|Ai[8 * j + 7]|
+ * (see |GFp_ge_p3_odd_multiples|) multiplied by the sliding window
+ * representations |aslide[256 * j]|...|aslide[256 * j + 255]| (see |slide|),
+ * plus B multiplied by |bslide|. */
+static void ge_multi_scalarmult_slide_vartime(ge_p2 *r,
+                                              const signed char *aslide,
+                                              const ge_cached *Ai, size_t num,
+                                              const signed char *bslide) {
+  ge_p1p1 t;
+  ge_p3 u;
+  size_t j;
+  int i;
+
+#if defined(CURVE25519_AVX2)
+  if (GFp_curve25519_avx2_capable()) {
+    GFp_ge_multi_scalarmult_vartime_avx2(r, aslide, Ai, num, bslide, Bi);
+    return;
+  }
+#endif
 
   ge_p2_0(r);
 
   for (i = 255; i >= 0; --i) {
-    if (aslide[i] || bslide[i]) {
+    int nonzero = bslide[i] != 0;
+    for (j = 0; j < num; ++j) {
+      nonzero |= aslide[256 * j + (size_t)i] != 0;
+    }
+    if (nonzero) {
       break;
     }
   }
@@ -3669,12 +3686,15 @@ void GFp_ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
   for (; i >= 0; --i) {
     ge_p2_dbl(&t, r);
 
-    if (aslide[i] > 0) {
-      x25519_ge_p1p1_to_p3(&u, &t);
-      x25519_ge_add(&t, &u, &Ai[aslide[i] / 2]);
-    } else if (aslide[i] < 0) {
-      x25519_ge_p1p1_to_p3(&u, &t);
-      x25519_ge_sub(&t, &u, &Ai[(-aslide[i]) / 2]);
+    for (j = 0; j < num; ++j) {
+      signed char a = aslide[256 * j + (size_t)i];
+      if (a > 0) {
+        x25519_ge_p1p1_to_p3(&u, &t);
+        x25519_ge_add(&t, &u, &Ai[8 * j + (size_t)(a / 2)]);
+      } else if (a < 0) {
+        x25519_ge_p1p1_to_p3(&u, &t);
+        x25519_ge_sub(&t, &u, &Ai[8 * j + (size_t)(-a / 2)]);
+      }
     }
 
     if (bslide[i] > 0) {
@@ -3689,6 +3709,60 @@ void GFp_ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
   }
 }
 
+/* r = a * A + b * B
+ * where a = a[0]+256*a[1]+...+256^31 a[31].
+ * and b = b[0]+256*b[1]+...+256^31 b[31].
+ * B is the Ed25519 base point (x,4/5) with x positive.
+ * Ai is the table of A computed by |GFp_ge_p3_odd_multiples|. */
+void GFp_ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
+                                      const ge_cached Ai[8],
+                                      const uint8_t *b) {
+  signed char aslide[256];
+  signed char bslide[256];
+
+  slide(aslide, a);
+  slide(bslide, b);
+
+  ge_multi_scalarmult_slide_vartime(r, aslide, Ai, 1, bslide);
+}
+
+/* Keep in sync with |MULTI_SCALARMULT_MAX_POINTS| in ed25519.rs. */
+#define GE_MULTI_SCALARMULT_MAX_POINTS 32
+
+/* r = 8 * (a[0] * A[0] + ... + a[num - 1] * A[num - 1] + b * B)
+ * where each scalar is encoded like those of
+ * |GFp_ge_double_scalarmult_vartime| and occupies 32 bytes of |a|, B is the
+ * Ed25519 base point, and Ai[j] is the table of A[j] computed by
+ * |GFp_ge_p3_odd_multiples|. The doublings are shared between all the points
+ * (Straus's method), which is what makes batch verification of signatures
+ * faster than verifying them one at a time. The final multiplication by the
+ * cofactor removes any small-order component of the sum.
+ *
+ * |num| must be at most |GE_MULTI_SCALARMULT_MAX_POINTS|. */
+void GFp_ge_multi_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
+                                     const ge_cached Ai[][8], size_t num,
+                                     const uint8_t *b) {
+  signed char aslide[GE_MULTI_SCALARMULT_MAX_POINTS][256];
+  signed char bslide[256];
+  ge_p1p1 t;
+  size_t j;
+  int i;
+
+  assert(num <= GE_MULTI_SCALARMULT_MAX_POINTS);
+
+  for (j = 0; j < num; ++j) {
+    slide(aslide[j], &a[32 * j]);
+  }
+  slide(bslide, b);
+
+  ge_multi_scalarmult_slide_vartime(r, &aslide[0][0], &Ai[0][0], num, bslide);
+
+  for (i = 0; i < 3; ++i) {
+    ge_p2_dbl(&t, r);
+    x25519_ge_p1p1_to_p2(r, &t);
+  }
+}
+
 /* The set of scalars is \Z/l
  * where l = 2^252 + 27742317777372353535851937790883648493. */
 
@@ -4725,3 +4799,77 @@ void GFp_x25519_public_from_private(uint8_t out_public_value[32],
 }
 
 #endif  /* BORINGSSL_X25519_X86_64 */
+
+
+/* The batch functions do up to |X25519_BATCH_MAX| operations at once. Keep
+ * this in sync with |BATCH_MAX| in src/ec/mod.rs. */
+#define X25519_BATCH_MAX 8
+
+/* Prototypes to avoid -Wmissing-prototypes warnings. */
+void GFp_x25519_scalar_mult_batch(uint8_t out[][32],
+                                  const uint8_t scalars[][32],
+                                  const uint8_t points[][32], size_t num);
+void GFp_x25519_public_from_private_batch(uint8_t out[][32],
+                                          const uint8_t private_keys[][32],
+                                          size_t num);
+
+#if defined(CURVE25519_IFMA)
+/* The eight-lane IFMA ladder takes the same time however many of its lanes
+ * are used, so it's only used for batches of at least this many. */
+#define X25519_IFMA_BATCH_MIN 2
+
+static void x25519_scalar_mult_ifma(uint8_t out[][32],
+                                    const uint8_t scalars[][32],
+                                    const uint8_t points[][32], size_t num) {
+  uint8_t out8[8][32];
+  uint8_t scalars8[8][32];
+  uint8_t points8[8][32];
+  /* The unused lanes compute zero times zero. */
+  memset(scalars8, 0, sizeof(scalars8));
+  memset(points8, 0, sizeof(points8));
+  memcpy(scalars8, scalars, num * 32);
+  memcpy(points8, points, num * 32);
+  GFp_x25519_scalar_mult_ifma_x8(out8, (const uint8_t(*)[32])scalars8,
+                                 (const uint8_t(*)[32])points8);
+  memcpy(out, out8, num * 32);
+}
+#endif
+
+/* Does |GFp_x25519_scalar_mult| for each of |num| scalars and points, where
+ * |num| is at most |X25519_BATCH_MAX|. */
+void GFp_x25519_scalar_mult_batch(uint8_t out[][32],
+                                  const uint8_t scalars[][32],
+                                  const uint8_t points[][32], size_t num) {
+  assert(num <= X25519_BATCH_MAX);
+#if defined(CURVE25519_IFMA)
+  if (num >= X25519_IFMA_BATCH_MIN && GFp_x25519_ifma_capable()) {
+    x25519_scalar_mult_ifma(out, scalars, points, num);
+    return;
+  }
+#endif
+  size_t i;
+  for (i = 0; i < num; ++i) {
+    GFp_x25519_scalar_mult(out[i], scalars[i], points[i]);
+  }
+}
+
+/* Does |GFp_x25519_public_from_private| for each of |num| private keys, where
+ * |num| is at most |X25519_BATCH_MAX|. */
+void GFp_x25519_public_from_private_batch(uint8_t out[][32],
+                                          const uint8_t private_keys[][32],
+                                          size_t num) {
+  assert(num <= X25519_BATCH_MAX);
+#if defined(CURVE25519_IFMA)
+  if (num >= X25519_IFMA_BATCH_MIN && GFp_x25519_ifma_capable()) {
+    static const uint8_t kBasePoints[8][32] = {
+        {9}, {9}, {9}, {9}, {9}, {9}, {9}, {9},
+    };
+    x25519_scalar_mult_ifma(out, private_keys, kBasePoints, num);
+    return;
+  }
+#endif
+  size_t i;
+  for (i = 0; i < num; ++i) {
+    GFp_x25519_public_from_private(out[i], private_keys[i]);
+  }
+}
@@ -101,6 +101,49 @@ typedef struct {
   fe T2d;
 } ge_cached;
 
+void GFp_curve25519_scalar_mask(uint8_t a[32]);
+
+
+#if defined(OPENSSL_X86_64) && !defined(OPENSSL_NO_ASM) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define CURVE25519_AVX2
+
+/* GFp_curve25519_avx2_capable returns one if the functions in
+ * curve25519-avx2.c can be used on this CPU, and zero otherwise. */
+int GFp_curve25519_avx2_capable(void);
+
+/* GFp_ge_multi_scalarmult_vartime_avx2 sets |r| to the sum of the |num|
+ * points with the tables |Ai[8 * j]|...|Ai[8 * j + 7]| multiplied by the
+ * sliding window representations |aslide[256 * j]|...|aslide[256 * j + 255]|,
+ * plus the base point, with the table |Bi|, multiplied by |bslide|. */
+void GFp_ge_multi_scalarmult_vartime_avx2(ge_p2 *r, const signed char *aslide,
+                                          const ge_cached *Ai, size_t num,
+                                          const signed char *bslide,
+                                          const ge_precomp Bi[8]);
+
+/* GFp_x25519_ge_scalarmult_base_avx2 finishes |GFp_x25519_ge_scalarmult_base|
+ * given the 64 table entries |t| that it selected for the signed radix-16
+ * digits of the scalar. */
+void GFp_x25519_ge_scalarmult_base_avx2(ge_p3 *h, const ge_precomp t[64]);
+#endif
+
+
+#if defined(OPENSSL_X86_64) && !defined(OPENSSL_NO_ASM) &&              \
+    ((defined(__clang__) && __clang_major__ >= 6) ||                     \
+     (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 8))
+#define CURVE25519_IFMA
+
+/* GFp_x25519_ifma_capable returns one if the functions in x25519-avx512.c
+ * can be used on this CPU, and zero otherwise. */
+int GFp_x25519_ifma_capable(void);
+
+/* GFp_x25519_scalar_mult_ifma_x8 does |GFp_x25519_scalar_mult| for eight
+ * independent scalars and points at once. */
+void GFp_x25519_scalar_mult_ifma_x8(uint8_t out[8][32],
+                                    const uint8_t scalars[8][32],
+                                    const uint8_t points[8][32]);
+#endif
+
 
 #if defined(__cplusplus)
 }  /* extern C */
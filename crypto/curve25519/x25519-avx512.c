@@ -0,0 +1,396 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* X25519 using the AVX-512 IFMA instructions, eight scalar multiplications at
+ * a time.
+ *
+ * A field element is five limbs in radix 2^51, and an |fe8| holds eight
+ * field elements, one in each 64-bit lane of its five ZMM vectors.
+ * |vpmadd52luq| and |vpmadd52huq| only use the low 52 bits of the limbs they
+ * multiply, so every operation leaves each limb less than 2^52. The eight
+ * Montgomery ladders run in lockstep, in the same order as
+ * |x25519_scalar_mult_generic| in curve25519.c, and each lane swaps its
+ * points according to the bits of its own scalar.
+ *
+ * The batch functions in curve25519.c decide when to use this. */
+
+#include "internal.h"
+
+#if defined(CURVE25519_IFMA)
+
+#include <immintrin.h>
+#include <string.h>
+
+#include <GFp/cpu.h>
+
+
+#define IFMA __attribute__((target("avx512f,avx512ifma")))
+
+#define MASK51 UINT64_C(0x7ffffffffffff)
+
+typedef struct {
+  __m512i v[5];
+} fe8;
+
+/* 2p, limb by limb, which is added to the minuend by |fe8_sub|. */
+static const uint64_t k2P[5] = {
+    UINT64_C(0xfffffffffffda), UINT64_C(0xffffffffffffe),
+    UINT64_C(0xffffffffffffe), UINT64_C(0xffffffffffffe),
+    UINT64_C(0xffffffffffffe),
+};
+
+static uint64_t load_u64_le(const uint8_t in[8]) {
+  uint64_t r;
+  memcpy(&r, in, sizeof(r));
+  return r;
+}
+
+static void store_u64_le(uint8_t out[8], uint64_t v) {
+  memcpy(out, &v, sizeof(v));
+}
+
+int GFp_x25519_ifma_capable(void) {
+  /* AVX512F (bit 16) and AVX512IFMA (bit 21) of CPUID leaf 7, EBX. */
+  static const uint32_t kAVX512FAndIFMA = (1u << 16) | (1u << 21);
+  return (GFp_ia32cap_P[2] & kAVX512FAndIFMA) == kAVX512FAndIFMA;
+}
+
+IFMA static __m512i mul19(__m512i x) {
+  return _mm512_add_epi64(
+      x, _mm512_add_epi64(_mm512_slli_epi64(x, 1), _mm512_slli_epi64(x, 4)));
+}
+
+/* Carries each limb into the next one, all at once. Limbs of up to 2^63 are
+ * reduced to less than 2^52. */
+IFMA static void fe8_carry(fe8 *h) {
+  const __m512i mask = _mm512_set1_epi64(MASK51);
+  __m512i c[5];
+  size_t i;
+  for (i = 0; i < 5; ++i) {
+    c[i] = _mm512_srli_epi64(h->v[i], 51);
+    h->v[i] = _mm512_and_si512(h->v[i], mask);
+  }
+  for (i = 1; i < 5; ++i) {
+    h->v[i] = _mm512_add_epi64(h->v[i], c[i - 1]);
+  }
+  h->v[0] = _mm512_add_epi64(h->v[0], mul19(c[4]));
+}
+
+IFMA static void fe8_add(fe8 *h, const fe8 *f, const fe8 *g) {
+  size_t i;
+  for (i = 0; i < 5; ++i) {
+    h->v[i] = _mm512_add_epi64(f->v[i], g->v[i]);
+  }
+  fe8_carry(h);
+}
+
+/* h = f + 2p - g. Every limb of |2p| is larger than any limb of |g|. */
+IFMA static void fe8_sub(fe8 *h, const fe8 *f, const fe8 *g) {
+  size_t i;
+  for (i = 0; i < 5; ++i) {
+    h->v[i] = _mm512_sub_epi64(
+        _mm512_add_epi64(f->v[i], _mm512_set1_epi64((int64_t)k2P[i])),
+        g->v[i]);
+  }
+  fe8_carry(h);
+}
+
+/* Sets |h| to the sum of |lo[k] + 2 * hi[k]| times 2^(51 * k). |lo[k]| holds
+ * the low 52 bits of the limb products that belong at 2^(51 * k), and
+ * |hi[k]| holds the high 52 bits of the products that belong at
+ * 2^(51 * (k - 1)), i.e. at 2^(51 * k + 1). Every |lo[k]| and |hi[k]| must be
+ * less than 2^55 so that the sums can't overflow. */
+IFMA static void fe8_combine(fe8 *h, const __m512i lo[10],
+                             const __m512i hi[10]) {
+  __m512i t[10];
+  size_t k;
+  for (k = 0; k < 10; ++k) {
+    t[k] = _mm512_add_epi64(lo[k], _mm512_add_epi64(hi[k], hi[k]));
+  }
+  for (k = 0; k < 5; ++k) {
+    h->v[k] = _mm512_add_epi64(t[k], mul19(t[k + 5]));
+  }
+  fe8_carry(h);
+}
+
+IFMA static void fe8_mul(fe8 *h, const fe8 *f, const fe8 *g) {
+  __m512i lo[10];
+  __m512i hi[10];
+  size_t i;
+  size_t j;
+  for (i = 0; i < 10; ++i) {
+    lo[i] = _mm512_setzero_si512();
+    hi[i] = _mm512_setzero_si512();
+  }
+  for (i = 0; i < 5; ++i) {
+    for (j = 0; j < 5; ++j) {
+      lo[i + j] = _mm512_madd52lo_epu64(lo[i + j], f->v[i], g->v[j]);
+      hi[i + j + 1] = _mm512_madd52hi_epu64(hi[i + j + 1], f->v[i], g->v[j]);
+    }
+  }
+  fe8_combine(h, lo, hi);
+}
+
+/* The products of different limbs are summed once and doubled, instead of
+ * being multiplied twice. */
+IFMA static void fe8_sq(fe8 *h, const fe8 *f) {
+  __m512i lo[10];
+  __m512i hi[10];
+  size_t i;
+  size_t j;
+  for (i = 0; i < 10; ++i) {
+    lo[i] = _mm512_setzero_si512();
+    hi[i] = _mm512_setzero_si512();
+  }
+  for (i = 0; i < 5; ++i) {
+    for (j = i + 1; j < 5; ++j) {
+      lo[i + j] = _mm512_madd52lo_epu64(lo[i + j], f->v[i], f->v[j]);
+      hi[i + j + 1] = _mm512_madd52hi_epu64(hi[i + j + 1], f->v[i], f->v[j]);
+    }
+  }
+  for (i = 0; i < 10; ++i) {
+    lo[i] = _mm512_add_epi64(lo[i], lo[i]);
+    hi[i] = _mm512_add_epi64(hi[i], hi[i]);
+  }
+  for (i = 0; i < 5; ++i) {
+    lo[2 * i] = _mm512_madd52lo_epu64(lo[2 * i], f->v[i], f->v[i]);
+    hi[2 * i + 1] = _mm512_madd52hi_epu64(hi[2 * i + 1], f->v[i], f->v[i]);
+  }
+  fe8_combine(h, lo, hi);
+}
+
+/* h = f^(2^n), for n >= 1. */
+IFMA static void fe8_sq_n(fe8 *h, const fe8 *f, int n) {
+  int i;
+  fe8_sq(h, f);
+  for (i = 1; i < n; ++i) {
+    fe8_sq(h, h);
+  }
+}
+
+IFMA static void fe8_mul121666(fe8 *h, const fe8 *f) {
+  const __m512i k121666 = _mm512_set1_epi64(121666);
+  __m512i lo[10];
+  __m512i hi[10];
+  size_t i;
+  for (i = 0; i < 10; ++i) {
+    lo[i] = _mm512_setzero_si512();
+    hi[i] = _mm512_setzero_si512();
+  }
+  for (i = 0; i < 5; ++i) {
+    lo[i] = _mm512_madd52lo_epu64(lo[i], f->v[i], k121666);
+    hi[i + 1] = _mm512_madd52hi_epu64(hi[i + 1], f->v[i], k121666);
+  }
+  fe8_combine(h, lo, hi);
+}
+
+/* Swaps |f| and |g| in the lanes where |mask| is all ones, and leaves them
+ * alone in the lanes where it is zero. */
+IFMA static void fe8_cswap(fe8 *f, fe8 *g, __m512i mask) {
+  size_t i;
+  for (i = 0; i < 5; ++i) {
+    __m512i t = _mm512_and_si512(_mm512_xor_si512(f->v[i], g->v[i]), mask);
+    f->v[i] = _mm512_xor_si512(f->v[i], t);
+    g->v[i] = _mm512_xor_si512(g->v[i], t);
+  }
+}
+
+/* This is the same addition chain as |GFp_fe_invert|. */
+IFMA static void fe8_invert(fe8 *out, const fe8 *z) {
+  fe8 t0;
+  fe8 t1;
+  fe8 t2;
+  fe8 t3;
+
+  fe8_sq(&t0, z);
+  fe8_sq_n(&t1, &t0, 2);
+  fe8_mul(&t1, z, &t1);
+  fe8_mul(&t0, &t0, &t1);
+  fe8_sq(&t2, &t0);
+  fe8_mul(&t1, &t1, &t2);
+  fe8_sq_n(&t2, &t1, 5);
+  fe8_mul(&t1, &t2, &t1);
+  fe8_sq_n(&t2, &t1, 10);
+  fe8_mul(&t2, &t2, &t1);
+  fe8_sq_n(&t3, &t2, 20);
+  fe8_mul(&t2, &t3, &t2);
+  fe8_sq_n(&t2, &t2, 10);
+  fe8_mul(&t1, &t2, &t1);
+  fe8_sq_n(&t2, &t1, 50);
+  fe8_mul(&t2, &t2, &t1);
+  fe8_sq_n(&t3, &t2, 100);
+  fe8_mul(&t2, &t3, &t2);
+  fe8_sq_n(&t2, &t2, 50);
+  fe8_mul(&t1, &t2, &t1);
+  fe8_sq_n(&t1, &t1, 5);
+  fe8_mul(out, &t1, &t0);
+}
+
+IFMA static void fe8_small(fe8 *h, int64_t n) {
+  size_t i;
+  h->v[0] = _mm512_set1_epi64(n);
+  for (i = 1; i < 5; ++i) {
+    h->v[i] = _mm512_setzero_si512();
+  }
+}
+
+/* Sets lane |lane| of |h| to |in[lane]|, ignoring its top bit. */
+IFMA static void fe8_frombytes(fe8 *h, const uint8_t in[8][32]) {
+  uint64_t limbs[5][8];
+  size_t lane;
+  size_t i;
+  for (lane = 0; lane < 8; ++lane) {
+    uint64_t w0 = load_u64_le(in[lane]);
+    uint64_t w1 = load_u64_le(in[lane] + 8);
+    uint64_t w2 = load_u64_le(in[lane] + 16);
+    uint64_t w3 = load_u64_le(in[lane] + 24);
+    limbs[0][lane] = w0 & MASK51;
+    limbs[1][lane] = ((w0 >> 51) | (w1 << 13)) & MASK51;
+    limbs[2][lane] = ((w1 >> 38) | (w2 << 26)) & MASK51;
+    limbs[3][lane] = ((w2 >> 25) | (w3 << 39)) & MASK51;
+    limbs[4][lane] = (w3 >> 12) & MASK51;
+  }
+  for (i = 0; i < 5; ++i) {
+    h->v[i] = _mm512_loadu_si512(limbs[i]);
+  }
+}
+
+static void fe51_carry(uint64_t t[5]) {
+  t[1] += t[0] >> 51;
+  t[0] &= MASK51;
+  t[2] += t[1] >> 51;
+  t[1] &= MASK51;
+  t[3] += t[2] >> 51;
+  t[2] &= MASK51;
+  t[4] += t[3] >> 51;
+  t[3] &= MASK51;
+  t[0] += 19 * (t[4] >> 51);
+  t[4] &= MASK51;
+}
+
+/* Sets |out| to the canonical encoding of the field element |in|, whose
+ * limbs are each less than 2^52. This is |fcontract| of curve25519-donna-c64;
+ * it doesn't branch on |in|. */
+static void fe51_tobytes(uint8_t out[32], const uint64_t in[5]) {
+  uint64_t t[5];
+  memcpy(t, in, sizeof(t));
+
+  fe51_carry(t);
+  fe51_carry(t);
+  /* Now |t| is between 0 and 2^255 - 1, and either less than p or one of
+   * p, ..., 2^255 - 1. Adding 19 and then 2^255 - 19 makes the carry out of
+   * the top limb be one in exactly the second case, and dropping it
+   * subtracts p. */
+  t[0] += 19;
+  fe51_carry(t);
+  t[0] += (MASK51 + 1) - 19;
+  t[1] += MASK51;
+  t[2] += MASK51;
+  t[3] += MASK51;
+  t[4] += MASK51;
+  t[1] += t[0] >> 51;
+  t[0] &= MASK51;
+  t[2] += t[1] >> 51;
+  t[1] &= MASK51;
+  t[3] += t[2] >> 51;
+  t[2] &= MASK51;
+  t[4] += t[3] >> 51;
+  t[3] &= MASK51;
+  t[4] &= MASK51;
+
+  store_u64_le(out, t[0] | (t[1] << 51));
+  store_u64_le(out + 8, (t[1] >> 13) | (t[2] << 38));
+  store_u64_le(out + 16, (t[2] >> 26) | (t[3] << 25));
+  store_u64_le(out + 24, (t[3] >> 39) | (t[4] << 12));
+}
+
+IFMA void GFp_x25519_scalar_mult_ifma_x8(uint8_t out[8][32],
+                                         const uint8_t scalars[8][32],
+                                         const uint8_t points[8][32]) {
+  fe8 x1, x2, z2, x3, z3, tmp0, tmp1;
+  /* Lane |lane| of |e[i]| is word |i| of the masked scalar |lane|. */
+  __m512i e[4];
+  uint64_t words[4][8];
+  uint64_t limbs[5][8];
+  size_t lane;
+  size_t i;
+
+  for (lane = 0; lane < 8; ++lane) {
+    uint8_t masked[32];
+    memcpy(masked, scalars[lane], 32);
+    GFp_curve25519_scalar_mask(masked);
+    for (i = 0; i < 4; ++i) {
+      words[i][lane] = load_u64_le(masked + 8 * i);
+    }
+  }
+  for (i = 0; i < 4; ++i) {
+    e[i] = _mm512_loadu_si512(words[i]);
+  }
+
+  fe8_frombytes(&x1, points);
+  fe8_small(&x2, 1);
+  fe8_small(&z2, 0);
+  x3 = x1;
+  fe8_small(&z3, 1);
+
+  const __m512i one = _mm512_set1_epi64(1);
+  __m512i swap = _mm512_setzero_si512();
+  int pos;
+  for (pos = 254; pos >= 0; --pos) {
+    __m512i b = _mm512_and_si512(
+        _mm512_srl_epi64(e[pos / 64], _mm_cvtsi32_si128(pos % 64)), one);
+    swap = _mm512_xor_si512(swap, b);
+    __m512i mask = _mm512_sub_epi64(_mm512_setzero_si512(), swap);
+    fe8_cswap(&x2, &x3, mask);
+    fe8_cswap(&z2, &z3, mask);
+    swap = b;
+    fe8_sub(&tmp0, &x3, &z3);
+    fe8_sub(&tmp1, &x2, &z2);
+    fe8_add(&x2, &x2, &z2);
+    fe8_add(&z2, &x3, &z3);
+    fe8_mul(&z3, &tmp0, &x2);
+    fe8_mul(&z2, &z2, &tmp1);
+    fe8_sq(&tmp0, &tmp1);
+    fe8_sq(&tmp1, &x2);
+    fe8_add(&x3, &z3, &z2);
+    fe8_sub(&z2, &z3, &z2);
+    fe8_mul(&x2, &tmp1, &tmp0);
+    fe8_sub(&tmp1, &tmp1, &tmp0);
+    fe8_sq(&z2, &z2);
+    fe8_mul121666(&z3, &tmp1);
+    fe8_sq(&x3, &x3);
+    fe8_add(&tmp0, &tmp0, &z3);
+    fe8_mul(&z3, &x1, &z2);
+    fe8_mul(&z2, &tmp1, &tmp0);
+  }
+  __m512i mask = _mm512_sub_epi64(_mm512_setzero_si512(), swap);
+  fe8_cswap(&x2, &x3, mask);
+  fe8_cswap(&z2, &z3, mask);
+
+  fe8_invert(&z2, &z2);
+  fe8_mul(&x2, &x2, &z2);
+
+  for (i = 0; i < 5; ++i) {
+    _mm512_storeu_si512(limbs[i], x2.v[i]);
+  }
+  for (lane = 0; lane < 8; ++lane) {
+    uint64_t h[5];
+    for (i = 0; i < 5; ++i) {
+      h[i] = limbs[i][lane];
+    }
+    fe51_tobytes(out[lane], h);
+  }
+}
+
+#endif
@@ -0,0 +1,479 @@
+#!/usr/bin/env perl
+
+# Copyright 2016 Brian Smith.
+#
+# Permission to use, copy, modify, and/or distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+# SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+# OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+# CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+# Montgomery multiplication and squaring modulo the P-384 field prime
+# q = 2**384 - 2**128 - 2**96 + 2**32 - 1, for CPUs with BMI2 and ADX.
+#
+# The whole 6-limb operand and accumulator are kept in registers. Each of the
+# six rounds of the (CIOS) Montgomery multiplication is one row of MULX
+# products summed with two independent carry chains (ADCX for the low halves,
+# ADOX for the high halves), followed by one such row for the reduction. The
+# Montgomery factor -q**-1 mod 2**64 is 2**32 + 1, so the per-round reduction
+# multiplier is computed with a shift and an add.
+#
+# The squaring computes each of the 15 cross products a[i]*a[j], i < j, once,
+# doubles their sum and adds the six squares a[i]**2, so it needs 21 MULX
+# instead of 36 for the 12-limb square. Six reduction rows then fold the low
+# half of the square into the high half.
+#
+# The callers in gfp_p384.c check GFp_ia32cap_P for BMI2 and ADX before
+# calling these functions.
+
+$flavour = shift;
+$output  = shift;
+if ($flavour =~ /\./) { $output = $flavour; undef $flavour; }
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\"";
+*STDOUT=*OUT;
+
+$code.=<<___;
+.text
+
+# The P-384 field prime.
+.align 64
+.Lp384_q:
+.quad 0x00000000ffffffff, 0xffffffff00000000, 0xfffffffffffffffe
+.quad 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff
+___
+
+{
+my ($r_ptr,$a_ptr,$b_org,$b_ptr)=("%rdi","%rsi","%rdx","%rbx");
+my ($lo,$hi,$zero)=("%rax","%rbp","%rcx");
+
+# One row: acc[0..$n+1] += %rdx * src[$first..$first+$n-1]. The sum must fit
+# in acc[0..$n+1].
+sub mulx_row {
+my ($src,$first,$n,@acc)=@_;
+my $row=<<___;
+	xor	$zero, $zero
+___
+for (my $j=0; $j<$n; $j++) {
+	my $k = $first + $j;
+	my $s = $src =~ /^\./ ? "$src+8*$k(%rip)" : "8*$k($src)";
+	$row.=<<___;
+	mulx	$s, $lo, $hi
+	adcx	$lo, $acc[$j]
+	adox	$hi, $acc[$j+1]
+___
+}
+$row.=<<___;
+	adcx	$zero, $acc[$n]
+	adox	$zero, $acc[$n+1]
+	adcx	$zero, $acc[$n+1]
+___
+return $row;
+}
+
+# acc += m * q, where m = acc[0] * (2**32 + 1) mod 2**64, so that acc[0]
+# becomes zero.
+sub reduce_row {
+my @acc=@_;
+my $row=<<___;
+
+	mov	$acc[0], %rdx
+	shl	\$32, %rdx
+	add	$acc[0], %rdx
+___
+$row.=mulx_row(".Lp384_q",0,6,@acc);
+return $row;
+}
+
+# Saves the callee-saved registers and reserves |$frame| bytes of stack.
+sub prologue {
+my ($label,$frame)=@_;
+my $code=<<___;
+.cfi_startproc
+	push	%rbp
+.cfi_push	%rbp
+	push	%rbx
+.cfi_push	%rbx
+	push	%r12
+.cfi_push	%r12
+	push	%r13
+.cfi_push	%r13
+	push	%r14
+.cfi_push	%r14
+	push	%r15
+.cfi_push	%r15
+___
+$code.=<<___	if ($frame);
+	sub	\$$frame, %rsp
+.cfi_adjust_cfa_offset	$frame
+___
+$code.=<<___;
+.L${label}_body:
+___
+return $code;
+}
+
+sub epilogue {
+my ($label,$frame)=@_;
+my $code=<<___;
+
+	mov	$frame+8*0(%rsp), %r15
+.cfi_restore	%r15
+	mov	$frame+8*1(%rsp), %r14
+.cfi_restore	%r14
+	mov	$frame+8*2(%rsp), %r13
+.cfi_restore	%r13
+	mov	$frame+8*3(%rsp), %r12
+.cfi_restore	%r12
+	mov	$frame+8*4(%rsp), %rbx
+.cfi_restore	%rbx
+	mov	$frame+8*5(%rsp), %rbp
+.cfi_restore	%rbp
+	lea	$frame+8*6(%rsp), %rsp
+.cfi_adjust_cfa_offset	-@{[$frame+8*6]}
+.L${label}_epilogue:
+	ret
+.cfi_endproc
+___
+return $code;
+}
+
+# r = acc mod q, where acc is acc[0..5] plus the carry bit acc[6] and is less
+# than 2q.
+sub sub_q_and_store {
+my @acc=@_;
+my @t=($lo,$hi,$zero,"%rdx",$b_ptr,$a_ptr);
+return <<___;
+
+	# Subtract q once if acc >= q.
+	mov	$acc[0], $t[0]
+	mov	$acc[1], $t[1]
+	mov	$acc[2], $t[2]
+	mov	$acc[3], $t[3]
+	mov	$acc[4], $t[4]
+	mov	$acc[5], $t[5]
+	sub	.Lp384_q+8*0(%rip), $t[0]
+	sbb	.Lp384_q+8*1(%rip), $t[1]
+	sbb	.Lp384_q+8*2(%rip), $t[2]
+	sbb	.Lp384_q+8*3(%rip), $t[3]
+	sbb	.Lp384_q+8*4(%rip), $t[4]
+	sbb	.Lp384_q+8*5(%rip), $t[5]
+	sbb	\$0, $acc[6]
+
+	cmovc	$acc[0], $t[0]
+	cmovc	$acc[1], $t[1]
+	cmovc	$acc[2], $t[2]
+	cmovc	$acc[3], $t[3]
+	cmovc	$acc[4], $t[4]
+	cmovc	$acc[5], $t[5]
+
+	mov	$t[0], 8*0($r_ptr)
+	mov	$t[1], 8*1($r_ptr)
+	mov	$t[2], 8*2($r_ptr)
+	mov	$t[3], 8*3($r_ptr)
+	mov	$t[4], 8*4($r_ptr)
+	mov	$t[5], 8*5($r_ptr)
+___
+}
+
+# r = a * b * 2**-384 (mod q).
+sub mul_mont_body {
+my @acc=map("%r$_",(8..15));
+my $body=prologue("mul",0);
+$body.=<<___;
+	mov	$b_org, $b_ptr
+
+	xor	$acc[0], $acc[0]
+	xor	$acc[1], $acc[1]
+	xor	$acc[2], $acc[2]
+	xor	$acc[3], $acc[3]
+	xor	$acc[4], $acc[4]
+	xor	$acc[5], $acc[5]
+	xor	$acc[6], $acc[6]
+	xor	$acc[7], $acc[7]
+___
+for (my $i=0; $i<6; $i++) {
+	$body.=<<___;
+
+	# acc += a * b[$i]
+	mov	8*$i($b_ptr), %rdx
+___
+	$body.=mulx_row($a_ptr,0,6,@acc);
+	$body.=reduce_row(@acc);
+	push(@acc,shift(@acc));
+}
+# The result is less than 2q.
+$body.=sub_q_and_store(@acc);
+$body.=epilogue("mul",0);
+return $body;
+}
+
+# r = a * a * 2**-384 (mod q). The 12-limb square t is built in a 96-byte
+# frame at the bottom of the stack.
+sub sqr_mont_body {
+my $body=prologue("sqr",8*12);
+
+# The cross products. Row $i adds a[$i] * a[$i+1..5] to t[2*$i+1..$i+7]. Each
+# limb is kept in a register from the first row that touches it until the row
+# after which no other row does, and then it is stored.
+my @free=map("%r$_",(8..15));
+push(@free,$b_ptr);
+my %t;
+for (my $i=0; $i<5; $i++) {
+	for (my $k=2*$i+1; $k<=$i+7; $k++) {
+		next if (defined($t{$k}));
+		$t{$k}=shift(@free);
+		$body.=<<___;
+	xor	$t{$k}, $t{$k}
+___
+	}
+	$body.=<<___;
+
+	# t[@{[2*$i+1]}..@{[$i+7]}] += a[$i] * a[@{[$i+1]}..5]
+	mov	8*$i($a_ptr), %rdx
+___
+	$body.=mulx_row($a_ptr,$i+1,5-$i,map($t{$_},(2*$i+1..$i+7)));
+	my @done=(2*$i+1,2*$i+2);
+	push(@done,(2*$i+3..11)) if ($i==4);
+	foreach my $k (@done) {
+		$body.=<<___;
+	mov	$t{$k}, 8*$k(%rsp)
+___
+		push(@free,$t{$k});
+		delete($t{$k});
+	}
+}
+
+# t = 2 * t + sum(a[i]**2 * 2**(128*i)). The doubling is one carry chain
+# (ADCX) and the addition of the squares is the other (ADOX). The low half of
+# t stays in acc[0..5] for the reduction; the high half goes back to the stack.
+my @acc=map("%r$_",(8..15));
+$body.=<<___;
+
+	# t = 2 * t + a[0..5]**2, where t[0] is zero.
+	xor	$zero, $zero
+	mov	8*0($a_ptr), %rdx
+	mulx	%rdx, $acc[0], $hi
+	mov	8*1(%rsp), $acc[1]
+	adcx	$acc[1], $acc[1]
+	adox	$hi, $acc[1]
+___
+for (my $i=1; $i<6; $i++) {
+	my ($x,$y)=$i<3 ? ($acc[2*$i],$acc[2*$i+1]) : ($b_ptr,$acc[7]);
+	$body.=<<___;
+	mov	8*@{[2*$i]}(%rsp), $x
+	mov	8*@{[2*$i+1]}(%rsp), $y
+	mov	8*$i($a_ptr), %rdx
+	mulx	%rdx, $lo, $hi
+	adcx	$x, $x
+	adcx	$y, $y
+	adox	$lo, $x
+	adox	$hi, $y
+___
+	$body.=<<___	if ($i>=3);
+	mov	$x, 8*@{[2*$i]}(%rsp)
+	mov	$y, 8*@{[2*$i+1]}(%rsp)
+___
+}
+$body.=<<___;
+	xor	$acc[6], $acc[6]
+	xor	$acc[7], $acc[7]
+___
+for (my $i=0; $i<6; $i++) {
+	$body.=reduce_row(@acc);
+	push(@acc,shift(@acc));
+}
+# acc[0..6] is (t[0..5] + m * q) / 2**384 < q + 1 for some m < 2**384, and
+# t[6..11] < q because a < q, so the sum is less than 2q + 1. It can only be
+# 2q if it is zero mod q, i.e. if a and so the sum are zero.
+$body.=<<___;
+
+	# acc += t[6..11]
+	add	8*6(%rsp), $acc[0]
+	adc	8*7(%rsp), $acc[1]
+	adc	8*8(%rsp), $acc[2]
+	adc	8*9(%rsp), $acc[3]
+	adc	8*10(%rsp), $acc[4]
+	adc	8*11(%rsp), $acc[5]
+	adc	\$0, $acc[6]
+___
+$body.=sub_q_and_store(@acc);
+$body.=epilogue("sqr",8*12);
+return $body;
+}
+
+$code.=<<___;
+
+################################################################################
+# void GFp_p384_elem_mul_montx(
+#   uint64_t r[6],
+#   const uint64_t a[6],
+#   const uint64_t b[6]);
+
+.globl	GFp_p384_elem_mul_montx
+.type	GFp_p384_elem_mul_montx,\@function,3
+.align	32
+GFp_p384_elem_mul_montx:
+___
+$code.=mul_mont_body();
+$code.=<<___;
+.size	GFp_p384_elem_mul_montx,.-GFp_p384_elem_mul_montx
+
+################################################################################
+# void GFp_p384_elem_sqr_montx(
+#   uint64_t r[6],
+#   const uint64_t a[6]);
+
+.globl	GFp_p384_elem_sqr_montx
+.type	GFp_p384_elem_sqr_montx,\@function,2
+.align	32
+GFp_p384_elem_sqr_montx:
+___
+$code.=sqr_mont_body();
+$code.=<<___;
+.size	GFp_p384_elem_sqr_montx,.-GFp_p384_elem_sqr_montx
+___
+}
+
+# EXCEPTION_DISPOSITION handler (EXCEPTION_RECORD *rec,ULONG64 frame,
+#		CONTEXT *context,DISPATCHER_CONTEXT *disp)
+#
+# HandlerData[] is the body label, the epilogue label and the size of the
+# stack frame below the saved registers.
+if ($win64) {
+$rec="%rcx";
+$frame="%rdx";
+$context="%r8";
+$disp="%r9";
+
+$code.=<<___;
+.extern	__imp_RtlVirtualUnwind
+.type	p384_handler,\@abi-omnipotent
+.align	16
+p384_handler:
+	push	%rsi
+	push	%rdi
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	pushfq
+	sub	\$64,%rsp
+
+	mov	120($context),%rax	# pull context->Rax
+	mov	248($context),%rbx	# pull context->Rip
+
+	mov	8($disp),%rsi		# disp->ImageBase
+	mov	56($disp),%r11		# disp->HandlerData
+
+	mov	0(%r11),%r10d		# HandlerData[0]
+	lea	(%rsi,%r10),%r10	# body label
+	cmp	%r10,%rbx		# context->Rip<body label
+	jb	.Lcommon_seh_tail
+
+	mov	152($context),%rax	# pull context->Rsp
+
+	mov	4(%r11),%r10d		# HandlerData[1]
+	lea	(%rsi,%r10),%r10	# epilogue label
+	cmp	%r10,%rbx		# context->Rip>=epilogue label
+	jae	.Lcommon_seh_tail
+
+	mov	8(%r11),%r10d		# HandlerData[2]
+	lea	48(%rax,%r10),%rax	# pull the stack pointer before the pushes
+
+	mov	-8(%rax),%rbp
+	mov	-16(%rax),%rbx
+	mov	-24(%rax),%r12
+	mov	-32(%rax),%r13
+	mov	-40(%rax),%r14
+	mov	-48(%rax),%r15
+	mov	%rbx,144($context)	# restore context->Rbx
+	mov	%rbp,160($context)	# restore context->Rbp
+	mov	%r12,216($context)	# restore context->R12
+	mov	%r13,224($context)	# restore context->R13
+	mov	%r14,232($context)	# restore context->R14
+	mov	%r15,240($context)	# restore context->R15
+
+.Lcommon_seh_tail:
+	mov	8(%rax),%rdi
+	mov	16(%rax),%rsi
+	mov	%rax,152($context)	# restore context->Rsp
+	mov	%rsi,168($context)	# restore context->Rsi
+	mov	%rdi,176($context)	# restore context->Rdi
+
+	mov	40($disp),%rdi		# disp->ContextRecord
+	mov	$context,%rsi		# context
+	mov	\$154,%ecx		# sizeof(CONTEXT)
+	.long	0xa548f3fc		# cld; rep movsq
+
+	mov	$disp,%rsi
+	xor	%rcx,%rcx		# arg1, UNW_FLAG_NHANDLER
+	mov	8(%rsi),%rdx		# arg2, disp->ImageBase
+	mov	0(%rsi),%r8		# arg3, disp->ControlPc
+	mov	16(%rsi),%r9		# arg4, disp->FunctionEntry
+	mov	40(%rsi),%r10		# disp->ContextRecord
+	lea	56(%rsi),%r11		# &disp->HandlerData
+	lea	24(%rsi),%r12		# &disp->EstablisherFrame
+	mov	%r10,32(%rsp)		# arg5
+	mov	%r11,40(%rsp)		# arg6
+	mov	%r12,48(%rsp)		# arg7
+	mov	%rcx,56(%rsp)		# arg8, (NULL)
+	call	*__imp_RtlVirtualUnwind(%rip)
+
+	mov	\$1,%eax		# ExceptionContinueSearch
+	add	\$64,%rsp
+	popfq
+	pop	%r15
+	pop	%r14
+	pop	%r13
+	pop	%r12
+	pop	%rbp
+	pop	%rbx
+	pop	%rdi
+	pop	%rsi
+	ret
+.size	p384_handler,.-p384_handler
+
+.section	.pdata
+.align	4
+	.rva	.LSEH_begin_GFp_p384_elem_mul_montx
+	.rva	.LSEH_end_GFp_p384_elem_mul_montx
+	.rva	.LSEH_info_GFp_p384_elem_mul_montx
+
+	.rva	.LSEH_begin_GFp_p384_elem_sqr_montx
+	.rva	.LSEH_end_GFp_p384_elem_sqr_montx
+	.rva	.LSEH_info_GFp_p384_elem_sqr_montx
+
+.section	.xdata
+.align	8
+.LSEH_info_GFp_p384_elem_mul_montx:
+	.byte	9,0,0,0
+	.rva	p384_handler
+	.rva	.Lmul_body,.Lmul_epilogue	# HandlerData[]
+	.long	0,0
+.LSEH_info_GFp_p384_elem_sqr_montx:
+	.byte	9,0,0,0
+	.rva	p384_handler
+	.rva	.Lsqr_body,.Lsqr_epilogue	# HandlerData[]
+	.long	8*12,0
+___
+}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT;
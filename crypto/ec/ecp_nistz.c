@@ -53,3 +53,52 @@ void gfp_little_endian_bytes_from_scalar(uint8_t str[], size_t str_len,
     str[i] = 0;
   }
 }
+
+static unsigned scalar_bit_vartime(const BN_ULONG scalar[], size_t num_limbs,
+                                   size_t bit) {
+  size_t limb = bit / BN_BITS2;
+  if (limb >= num_limbs) {
+    return 0;
+  }
+  return (unsigned)(scalar[limb] >> (bit % BN_BITS2)) & 1;
+}
+
+/* This is the "modified wNAF" recoding from BoringSSL's |ec_compute_wNAF|.
+ * The most significant window is allowed to use a positive digit instead of
+ * a negative one so that the recoding never needs more than one extra digit
+ * beyond the bit length of |scalar|. */
+void gfp_wnaf_from_scalar_vartime(int8_t out[], size_t out_len,
+                                  const BN_ULONG scalar[], size_t num_limbs,
+                                  unsigned w) {
+  assert(w >= 1);
+  assert(w <= 6);
+  assert(out_len == (num_limbs * BN_BITS2) + 1);
+
+  const size_t bits = out_len - 1;
+  const int bit = 1 << w;
+  const int next_bit = bit << 1;
+  const int mask = next_bit - 1;
+
+  int window_val = (int)(scalar[0] & (BN_ULONG)mask);
+  for (size_t j = 0; j < out_len; ++j) {
+    assert(0 <= window_val && window_val <= next_bit);
+    int digit = 0;
+    if (window_val & 1) {
+      if (window_val & bit) {
+        digit = window_val - next_bit;
+        if (j + w + 1 >= bits) {
+          /* No more bits will be shifted into |window_val|, so a positive
+           * digit shortens the representation. */
+          digit = window_val & (mask >> 1);
+        }
+      } else {
+        digit = window_val;
+      }
+      window_val -= digit;
+    }
+    out[j] = (int8_t)digit;
+    window_val >>= 1;
+    window_val += bit * (int)scalar_bit_vartime(scalar, num_limbs, j + w + 1);
+  }
+  assert(window_val == 0);
+}
@@ -125,6 +125,18 @@ void gfp_little_endian_bytes_from_scalar(uint8_t str[], size_t str_len,
                                          const BN_ULONG scalar[],
                                          size_t num_limbs);
 
+/* Computes the width-(|w| + 1) non-adjacent form of |scalar|, which has
+ * |num_limbs| limbs, writing one signed digit per bit position into |out|,
+ * least significant digit first. Every nonzero digit is odd and in the range
+ * (-2**w, 2**w). |out_len| must be exactly one more than the number of bits
+ * in |scalar|.
+ *
+ * This is *not* constant-time; it must only be used for public scalars, e.g.
+ * in signature verification. */
+void gfp_wnaf_from_scalar_vartime(int8_t out[], size_t out_len,
+                                  const BN_ULONG scalar[], size_t num_limbs,
+                                  unsigned w);
+
 
 #if defined(__cplusplus)
 }
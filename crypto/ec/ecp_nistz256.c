@@ -44,6 +44,20 @@ void GFp_nistz256_point_mul_base(P256_POINT *r,
 void GFp_nistz256_point_mul(P256_POINT *r, const BN_ULONG p_scalar[P256_LIMBS],
                             const BN_ULONG p_x[P256_LIMBS],
                             const BN_ULONG p_y[P256_LIMBS]);
+void GFp_nistz256_twin_mult_vartime(P256_POINT *r,
+                                    const BN_ULONG g_scalar[P256_LIMBS],
+                                    const BN_ULONG p_scalar[P256_LIMBS],
+                                    const BN_ULONG p_x[P256_LIMBS],
+                                    const BN_ULONG p_y[P256_LIMBS]);
+void GFp_nistz256_point_odd_multiples_vartime(P256_POINT table[],
+                                              size_t table_len,
+                                              const BN_ULONG p_x[P256_LIMBS],
+                                              const BN_ULONG p_y[P256_LIMBS]);
+void GFp_nistz256_twin_mult_table_vartime(P256_POINT *r,
+                                          const BN_ULONG g_scalar[P256_LIMBS],
+                                          const BN_ULONG p_scalar[P256_LIMBS],
+                                          const P256_POINT p_table[],
+                                          unsigned p_window_size);
 
 
 /* Functions implemented in assembly */
@@ -253,3 +267,106 @@ void GFp_nistz256_point_mul_base(P256_POINT *r,
 
   memcpy(r, &p.p, sizeof(p.p));
 }
+
+/* Sets |table[i]| to (2*i + 1)*P for each of the |table_len| entries, where P
+ * is the (Montgomery-encoded) affine point (|p_x|, |p_y|). This is *not*
+ * constant-time. */
+void GFp_nistz256_point_odd_multiples_vartime(P256_POINT table[],
+                                              size_t table_len,
+                                              const BN_ULONG p_x[P256_LIMBS],
+                                              const BN_ULONG p_y[P256_LIMBS]) {
+  assert(table_len > 0);
+  memcpy(table[0].X, p_x, P256_LIMBS * BN_BYTES);
+  memcpy(table[0].Y, p_y, P256_LIMBS * BN_BYTES);
+  memcpy(table[0].Z, ONE, P256_LIMBS * BN_BYTES);
+  alignas(32) P256_POINT doubled;
+  GFp_nistz256_point_double(&doubled, &table[0]);
+  for (size_t i = 1; i < table_len; ++i) {
+    GFp_nistz256_point_add(&table[i], &table[i - 1], &doubled);
+  }
+}
+
+/* r = g_scalar*G + p_scalar*P, where G is the generator.
+ *
+ * Unlike the functions above, this is *not* constant-time; it must only be
+ * used when both scalars and the point are public, i.e. for signature
+ * verification. The two multiplications are interleaved (Straus-Shamir) so
+ * that they share a single chain of doublings. The odd multiples of G are
+ * taken from the first row of |GFp_nistz256_precomputed|, which holds 1*G
+ * through 64*G, so only the odd multiples of P need to be computed here. */
+void GFp_nistz256_twin_mult_vartime(P256_POINT *r,
+                                    const BN_ULONG g_scalar[P256_LIMBS],
+                                    const BN_ULONG p_scalar[P256_LIMBS],
+                                    const BN_ULONG p_x[P256_LIMBS],
+                                    const BN_ULONG p_y[P256_LIMBS]) {
+  static const unsigned kPWindowSize = 4;
+
+  alignas(32) P256_POINT p_table[1 << (4 /* kPWindowSize */ - 1)];
+  GFp_nistz256_point_odd_multiples_vartime(
+      p_table, sizeof(p_table) / sizeof(p_table[0]), p_x, p_y);
+  GFp_nistz256_twin_mult_table_vartime(r, g_scalar, p_scalar, p_table,
+                                       kPWindowSize);
+}
+
+/* Like |GFp_nistz256_twin_mult_vartime|, but P is given as the table of its
+ * odd multiples computed by |GFp_nistz256_point_odd_multiples_vartime|, with
+ * 2**(|p_window_size| - 1) entries. This allows the table to be reused for
+ * many multiplications with the same P. */
+void GFp_nistz256_twin_mult_table_vartime(P256_POINT *r,
+                                          const BN_ULONG g_scalar[P256_LIMBS],
+                                          const BN_ULONG p_scalar[P256_LIMBS],
+                                          const P256_POINT p_table[],
+                                          unsigned p_window_size) {
+  /* Digits are odd and in (-2**w, 2**w). The G digits are at most 63 so that
+   * every odd multiple is in the first row of the precomputed table. */
+  static const unsigned kGWindowSize = 6;
+
+  int8_t g_wnaf[(P256_LIMBS * BN_BITS2) + 1];
+  int8_t p_wnaf[(P256_LIMBS * BN_BITS2) + 1];
+  gfp_wnaf_from_scalar_vartime(g_wnaf, sizeof(g_wnaf), g_scalar, P256_LIMBS,
+                               kGWindowSize);
+  gfp_wnaf_from_scalar_vartime(p_wnaf, sizeof(p_wnaf), p_scalar, P256_LIMBS,
+                               p_window_size);
+
+  const P256_POINT_AFFINE *g_table =
+      (const P256_POINT_AFFINE *)GFp_nistz256_precomputed[0];
+
+  alignas(32) P256_POINT h;
+  memset(r, 0, sizeof(*r));
+  int r_is_infinity = 1;
+
+  for (size_t i = sizeof(g_wnaf); i-- > 0; ) {
+    if (!r_is_infinity) {
+      GFp_nistz256_point_double(r, r);
+    }
+
+    int g_digit = g_wnaf[i];
+    if (g_digit != 0) {
+      const P256_POINT_AFFINE *g = &g_table[(g_digit < 0 ? -g_digit : g_digit) -
+                                            1];
+      memcpy(h.X, g->X, sizeof(h.X));
+      if (g_digit < 0) {
+        GFp_nistz256_neg(h.Y, g->Y);
+      } else {
+        memcpy(h.Y, g->Y, sizeof(h.Y));
+      }
+      memcpy(h.Z, ONE, sizeof(h.Z));
+      GFp_nistz256_point_add(r, r, &h);
+      r_is_infinity = 0;
+    }
+
+    int p_digit = p_wnaf[i];
+    if (p_digit != 0) {
+      const P256_POINT *p = &p_table[(p_digit < 0 ? -p_digit : p_digit) >> 1];
+      memcpy(h.X, p->X, sizeof(h.X));
+      if (p_digit < 0) {
+        GFp_nistz256_neg(h.Y, p->Y);
+      } else {
+        memcpy(h.Y, p->Y, sizeof(h.Y));
+      }
+      memcpy(h.Z, p->Z, sizeof(h.Z));
+      GFp_nistz256_point_add(r, r, &h);
+      r_is_infinity = 0;
+    }
+  }
+}
@@ -27,6 +27,22 @@
 void GFp_nistz384_point_mul(P384_POINT *r, const BN_ULONG p_scalar[P384_LIMBS],
                             const BN_ULONG p_x[P384_LIMBS],
                             const BN_ULONG p_y[P384_LIMBS]);
+void GFp_nistz384_point_mul_base(P384_POINT *r,
+                                 const BN_ULONG g_scalar[P384_LIMBS]);
+void GFp_nistz384_twin_mult_vartime(P384_POINT *r,
+                                    const BN_ULONG g_scalar[P384_LIMBS],
+                                    const BN_ULONG p_scalar[P384_LIMBS],
+                                    const BN_ULONG p_x[P384_LIMBS],
+                                    const BN_ULONG p_y[P384_LIMBS]);
+void GFp_nistz384_point_odd_multiples_vartime(P384_POINT table[],
+                                              size_t table_len,
+                                              const BN_ULONG p_x[P384_LIMBS],
+                                              const BN_ULONG p_y[P384_LIMBS]);
+void GFp_nistz384_twin_mult_table_vartime(P384_POINT *r,
+                                          const BN_ULONG g_scalar[P384_LIMBS],
+                                          const BN_ULONG p_scalar[P384_LIMBS],
+                                          const P384_POINT p_table[],
+                                          unsigned p_window_size);
 
 
 static BN_ULONG is_zero(const BN_ULONG a[P384_LIMBS]) {
@@ -259,3 +275,173 @@ void GFp_nistz384_point_mul(P384_POINT *r, const BN_ULONG p_scalar[P384_LIMBS],
   wvalue = (wvalue << 1) & kMask;
   add_precomputed_w5(r, wvalue, table);
 }
+
+/* Precomputed tables for the default generator */
+#include "ecp_nistz384_table.inl"
+
+/* r = g_scalar*G, where G is the generator.
+ *
+ * Every window of the recoded scalar has its own precomputed subtable, so no
+ * doublings are needed; the result is just the sum of one (constant-time
+ * selected) entry from each of the 77 subtables. */
+void GFp_nistz384_point_mul_base(P384_POINT *r,
+                                 const BN_ULONG g_scalar[P384_LIMBS]) {
+  static const unsigned kWindowSize = 5;
+  static const unsigned kMask = (1 << (5 /* kWindowSize */ + 1)) - 1;
+
+  uint8_t p_str[(P384_LIMBS * BN_BYTES) + 1];
+  gfp_little_endian_bytes_from_scalar(p_str, sizeof(p_str) / sizeof(p_str[0]),
+                                      g_scalar, P384_LIMBS);
+
+  typedef union {
+    P384_POINT p;
+    P384_POINT_AFFINE a;
+  } P384_POINT_UNION;
+
+  alignas(64) P384_POINT_UNION p;
+  alignas(64) P384_POINT_UNION t;
+
+  /* First window */
+  unsigned index = kWindowSize;
+
+  unsigned raw_wvalue;
+  BN_ULONG recoded_is_negative;
+  unsigned recoded;
+
+  raw_wvalue = (p_str[0] << 1) & kMask;
+
+  booth_recode(&recoded_is_negative, &recoded, raw_wvalue, kWindowSize);
+  gfp_p384_point_select_affine_w5(&p.a, GFp_nistz384_precomputed[0], recoded);
+  GFp_p384_elem_neg(p.p.Z, p.a.Y);
+  copy_conditional(p.a.Y, p.p.Z, recoded_is_negative);
+
+  memcpy(p.p.Z, ONE, sizeof(ONE));
+  /* If |recoded| is zero then the selected point is the point at infinity,
+   * and p.p.X is zero. */
+  copy_conditional(p.p.Z, p.p.X, constant_time_is_zero_s(recoded));
+
+  for (size_t i = 1; i < 77; ++i) {
+    unsigned off = (index - 1) / 8;
+    raw_wvalue = p_str[off] | p_str[off + 1] << 8;
+    raw_wvalue = (raw_wvalue >> ((index - 1) % 8)) & kMask;
+    index += kWindowSize;
+
+    booth_recode(&recoded_is_negative, &recoded, raw_wvalue, kWindowSize);
+    gfp_p384_point_select_affine_w5(&t.a, GFp_nistz384_precomputed[i],
+                                    recoded);
+    GFp_p384_elem_neg(t.p.Z, t.a.Y);
+    copy_conditional(t.a.Y, t.p.Z, recoded_is_negative);
+
+    memcpy(t.p.Z, ONE, sizeof(ONE));
+    copy_conditional(t.p.Z, t.p.X, constant_time_is_zero_s(recoded));
+
+    GFp_nistz384_point_add(&p.p, &p.p, &t.p);
+  }
+
+  memcpy(r, &p.p, sizeof(p.p));
+}
+
+/* Sets |table[i]| to (2*i + 1)*P for each of the |table_len| entries, where P
+ * is the (Montgomery-encoded) affine point (|p_x|, |p_y|). This is *not*
+ * constant-time. */
+void GFp_nistz384_point_odd_multiples_vartime(P384_POINT table[],
+                                              size_t table_len,
+                                              const BN_ULONG p_x[P384_LIMBS],
+                                              const BN_ULONG p_y[P384_LIMBS]) {
+  assert(table_len > 0);
+  memcpy(table[0].X, p_x, P384_LIMBS * BN_BYTES);
+  memcpy(table[0].Y, p_y, P384_LIMBS * BN_BYTES);
+  memcpy(table[0].Z, ONE, P384_LIMBS * BN_BYTES);
+  alignas(64) P384_POINT doubled;
+  GFp_nistz384_point_double(&doubled, &table[0]);
+  for (size_t i = 1; i < table_len; ++i) {
+    GFp_nistz384_point_add(&table[i], &table[i - 1], &doubled);
+  }
+}
+
+static void add_odd_multiple_vartime(P384_POINT *r, int digit,
+                                     const P384_POINT table[]) {
+  const P384_POINT *p = &table[(digit < 0 ? -digit : digit) >> 1];
+  alignas(64) P384_POINT h;
+  memcpy(h.X, p->X, sizeof(h.X));
+  if (digit < 0) {
+    GFp_p384_elem_neg(h.Y, p->Y);
+  } else {
+    memcpy(h.Y, p->Y, sizeof(h.Y));
+  }
+  memcpy(h.Z, p->Z, sizeof(h.Z));
+  GFp_nistz384_point_add(r, r, &h);
+}
+
+/* r = g_scalar*G + p_scalar*P, where G is the generator.
+ *
+ * Unlike the functions above, this is *not* constant-time; it must only be
+ * used when both scalars and the point are public, i.e. for signature
+ * verification. The two multiplications are interleaved (Straus-Shamir) so
+ * that they share a single chain of doublings. */
+void GFp_nistz384_twin_mult_vartime(P384_POINT *r,
+                                    const BN_ULONG g_scalar[P384_LIMBS],
+                                    const BN_ULONG p_scalar[P384_LIMBS],
+                                    const BN_ULONG p_x[P384_LIMBS],
+                                    const BN_ULONG p_y[P384_LIMBS]) {
+  static const unsigned kPWindowSize = 4;
+
+  alignas(64) P384_POINT p_table[1 << (4 /* kPWindowSize */ - 1)];
+  GFp_nistz384_point_odd_multiples_vartime(
+      p_table, sizeof(p_table) / sizeof(p_table[0]), p_x, p_y);
+  GFp_nistz384_twin_mult_table_vartime(r, g_scalar, p_scalar, p_table,
+                                       kPWindowSize);
+}
+
+/* Like |GFp_nistz384_twin_mult_vartime|, but P is given as the table of its
+ * odd multiples computed by |GFp_nistz384_point_odd_multiples_vartime|, with
+ * 2**(|p_window_size| - 1) entries. This allows the table to be reused for
+ * many multiplications with the same P. */
+void GFp_nistz384_twin_mult_table_vartime(P384_POINT *r,
+                                          const BN_ULONG g_scalar[P384_LIMBS],
+                                          const BN_ULONG p_scalar[P384_LIMBS],
+                                          const P384_POINT p_table[],
+                                          unsigned p_window_size) {
+  /* Digits are odd and in (-2**w, 2**w). */
+  static const unsigned kGWindowSize = 4;
+
+  /* The generator, Montgomery-encoded. */
+  static const BN_ULONG G_X[P384_LIMBS] = {
+    TOBN(0x3dd07566, 0x49c0b528), TOBN(0x20e378e2, 0xa0d6ce38),
+    TOBN(0x879c3afc, 0x541b4d6e), TOBN(0x64548684, 0x59a30eff),
+    TOBN(0x812ff723, 0x614ede2b), TOBN(0x4d3aadc2, 0x299e1513),
+  };
+  static const BN_ULONG G_Y[P384_LIMBS] = {
+    TOBN(0x23043dad, 0x4b03a4fe), TOBN(0xa1bfa8bf, 0x7bb4a9ac),
+    TOBN(0x8bade756, 0x2e83b050), TOBN(0xc6c35219, 0x68f4ffd9),
+    TOBN(0xdd800226, 0x3969a840), TOBN(0x2b78abc2, 0x5a15c5e9),
+  };
+
+  int8_t g_wnaf[(P384_LIMBS * BN_BITS2) + 1];
+  int8_t p_wnaf[(P384_LIMBS * BN_BITS2) + 1];
+  gfp_wnaf_from_scalar_vartime(g_wnaf, sizeof(g_wnaf), g_scalar, P384_LIMBS,
+                               kGWindowSize);
+  gfp_wnaf_from_scalar_vartime(p_wnaf, sizeof(p_wnaf), p_scalar, P384_LIMBS,
+                               p_window_size);
+
+  alignas(64) P384_POINT g_table[1 << (4 /* kGWindowSize */ - 1)];
+  GFp_nistz384_point_odd_multiples_vartime(
+      g_table, sizeof(g_table) / sizeof(g_table[0]), G_X, G_Y);
+
+  memset(r, 0, sizeof(*r));
+  int r_is_infinity = 1;
+
+  for (size_t i = sizeof(g_wnaf); i-- > 0; ) {
+    if (!r_is_infinity) {
+      GFp_nistz384_point_double(r, r);
+    }
+    if (g_wnaf[i] != 0) {
+      add_odd_multiple_vartime(r, g_wnaf[i], g_table);
+      r_is_infinity = 0;
+    }
+    if (p_wnaf[i] != 0) {
+      add_odd_multiple_vartime(r, p_wnaf[i], p_table);
+      r_is_infinity = 0;
+    }
+  }
+}
@@ -16,6 +16,8 @@
 
 #include <string.h>
 
+#include <GFp/cpu.h>
+
 #include "ecp_nistz384.h"
 #include "../bn/internal.h"
 #include "../internal.h"
@@ -37,6 +39,7 @@ void GFp_p384_elem_add(Elem r, const Elem a, const Elem b);
 void GFp_p384_elem_sub(Elem r, const Elem a, const Elem b);
 void GFp_p384_elem_div_by_2(Elem r, const Elem a);
 void GFp_p384_elem_mul_mont(Elem r, const Elem a, const Elem b);
+void GFp_p384_elem_sqr_mont(Elem r, const Elem a);
 void GFp_p384_elem_neg(Elem r, const Elem a);
 void GFp_p384_scalar_inv_to_mont(ScalarMont r, const Scalar a);
 void GFp_p384_scalar_mul_mont(ScalarMont r, const ScalarMont a,
@@ -173,7 +176,26 @@ static void elem_div_by_2(Elem r, const Elem a) {
   copy_conditional(r, adjusted, is_odd);
 }
 
+#if defined(OPENSSL_X86_64) && !defined(OPENSSL_NO_ASM)
+#define P384_ELEM_MONTX
+
+/* Implemented in p384-x86_64.pl. These require BMI2 (MULX) and ADX. */
+void GFp_p384_elem_mul_montx(Elem r, const Elem a, const Elem b);
+void GFp_p384_elem_sqr_montx(Elem r, const Elem a);
+
+static inline int elem_montx_capable(void) {
+  static const uint32_t kBMI2AndADX = (1u << 8) | (1u << 19);
+  return (GFp_ia32cap_P[2] & kBMI2AndADX) == kBMI2AndADX;
+}
+#endif
+
 static inline void elem_mul_mont(Elem r, const Elem a, const Elem b) {
+#if defined(P384_ELEM_MONTX)
+  if (elem_montx_capable()) {
+    GFp_p384_elem_mul_montx(r, a, b);
+    return;
+  }
+#endif
   static const BN_ULONG Q_N0[] = {
     BN_MONT_CTX_N0(0x1, 0x1)
   };
@@ -193,6 +215,12 @@ static INLINE_IF_POSSIBLE void elem_mul_by_3(Elem r, const Elem a) {
 }
 
 static inline void elem_sqr_mont(Elem r, const Elem a) {
+#if defined(P384_ELEM_MONTX)
+  if (elem_montx_capable()) {
+    GFp_p384_elem_sqr_montx(r, a);
+    return;
+  }
+#endif
   /* XXX: Inefficient. TODO: Add a dedicated squaring routine. */
   elem_mul_mont(r, a, a);
 }
@@ -213,6 +241,10 @@ void GFp_p384_elem_mul_mont(Elem r, const Elem a, const Elem b) {
   elem_mul_mont(r, a, b);
 }
 
+void GFp_p384_elem_sqr_mont(Elem r, const Elem a) {
+  elem_sqr_mont(r, a);
+}
+
 void GFp_p384_elem_neg(Elem r, const Elem a) {
   Limb is_zero = LIMBS_are_zero(a, P384_LIMBS);
   Carry borrow = limbs_sub(r, Q, a, P384_LIMBS);
@@ -258,5 +290,24 @@ static void gfp_p384_point_select_w5(P384_POINT *out,
   memcpy(out->Z, z, sizeof(z));
 }
 
+static void gfp_p384_point_select_affine_w5(
+    P384_POINT_AFFINE *out, const BN_ULONG table[16 * 2 * P384_LIMBS],
+    size_t index) {
+  Elem x; memset(x, 0, sizeof(x));
+  Elem y; memset(y, 0, sizeof(y));
+
+  for (size_t i = 0; i < 16; ++i) {
+    Limb mask = constant_time_eq_s(index, i + 1);
+    const BN_ULONG *row = &table[i * 2 * P384_LIMBS];
+    for (size_t j = 0; j < P384_LIMBS; ++j) {
+      x[j] |= row[j] & mask;
+      y[j] |= row[P384_LIMBS + j] & mask;
+    }
+  }
+
+  memcpy(out->X, x, sizeof(x));
+  memcpy(out->Y, y, sizeof(y));
+}
+
 
 #include "ecp_nistz384.inl"
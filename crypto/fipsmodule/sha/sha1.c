@@ -0,0 +1,244 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* Accelerated SHA-1 block functions for x86-64. The portable implementation
+ * is in src/digest/sha1.rs, which calls |GFp_sha1_block_data_order_simd|
+ * first and only hashes the blocks itself if that returns zero.
+ *
+ * The SHA extensions (SHA-NI) are used when available; otherwise the message
+ * schedule is computed four words at a time with SSSE3 and only the rounds
+ * are done with scalar instructions. There is no AArch64 code: it could not
+ * be tested, so AArch64 uses the portable implementation. */
+
+#include <GFp/base.h>
+
+#include <GFp/cpu.h>
+
+#include "../../internal.h"
+
+
+#if defined(OPENSSL_X86_64) && !defined(OPENSSL_NO_ASM) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define SHA1_X86_64
+#endif
+
+/* Prototypes to avoid -Wmissing-prototypes warnings. */
+int GFp_sha1_block_data_order_simd(uint32_t state[5], const uint8_t *in,
+                                   size_t num);
+
+
+#define K_00_19 0x5a827999u
+#define K_20_39 0x6ed9eba1u
+#define K_40_59 0x8f1bbcdcu
+#define K_60_79 0xca62c1d6u
+
+
+#if defined(SHA1_X86_64)
+
+#include <immintrin.h>
+
+#define SHANI __attribute__((target("sha,sse4.1")))
+#define SSSE3 __attribute__((target("ssse3")))
+
+static int sha1_shani_capable(void) {
+  /* SHA (bit 29) of CPUID leaf 7, EBX. The SSE4.1 (bit 19) and SSSE3 (bit 9)
+   * of leaf 1, ECX are also required for the shuffles and lane extraction. */
+  static const uint32_t kSSSE3AndSSE41 = (1u << 9) | (1u << 19);
+  return (GFp_ia32cap_P[2] & (1u << 29)) != 0 &&
+         (GFp_ia32cap_P[1] & kSSSE3AndSSE41) == kSSSE3AndSSE41;
+}
+
+static int sha1_ssse3_capable(void) {
+  return (GFp_ia32cap_P[1] & (1u << 9)) != 0;
+}
+
+/* Computes the next four message words from the previous sixteen, which are
+ * in |w[(i + 0) % 4]| through |w[(i + 3) % 4]|, replacing the oldest four. */
+#define SHANI_SCHEDULE(w, i)                                               \
+  ((w)[(i) % 4] = _mm_sha1msg2_epu32(                                      \
+       _mm_xor_si128(_mm_sha1msg1_epu32((w)[(i) % 4], (w)[((i) + 1) % 4]), \
+                     (w)[((i) + 2) % 4]),                                  \
+       (w)[((i) + 3) % 4]))
+
+/* Does rounds 4*i through 4*i + 3 using the round function |f|, which must be
+ * a constant. |prev| is the value of |abcd| before the previous four rounds,
+ * from which the value of E for these rounds is derived. */
+#define SHANI_ROUNDS4(abcd, prev, e, w, i, f)            \
+  do {                                                   \
+    if ((i) >= 4) {                                      \
+      SHANI_SCHEDULE(w, i);                              \
+    }                                                    \
+    (e) = _mm_sha1nexte_epu32((prev), (w)[(i) % 4]);     \
+    (prev) = (abcd);                                     \
+    (abcd) = _mm_sha1rnds4_epu32((abcd), (e), (f));      \
+  } while (0)
+
+SHANI static void sha1_block_data_order_shani(uint32_t state[5],
+                                              const uint8_t *in, size_t num) {
+  const __m128i byte_swap =
+      _mm_set_epi64x(0x0001020304050607, 0x08090a0b0c0d0e0f);
+
+  /* SHA1RNDS4 wants A in the most significant lane and E on its own in the
+   * most significant lane of another register. */
+  __m128i abcd =
+      _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)state), 0x1b);
+  __m128i e = _mm_set_epi32((int)state[4], 0, 0, 0);
+
+  for (; num > 0; --num, in += 64) {
+    const __m128i abcd_save = abcd;
+    const __m128i e_save = e;
+
+    __m128i w[4];
+    for (size_t i = 0; i < 4; ++i) {
+      w[i] = _mm_shuffle_epi8(
+          _mm_loadu_si128((const __m128i *)(in + 16 * i)), byte_swap);
+    }
+
+    __m128i prev = abcd;
+    e = _mm_add_epi32(e, w[0]);
+    abcd = _mm_sha1rnds4_epu32(abcd, e, 0);
+    for (size_t i = 1; i < 5; ++i) {
+      SHANI_ROUNDS4(abcd, prev, e, w, i, 0);
+    }
+    for (size_t i = 5; i < 10; ++i) {
+      SHANI_ROUNDS4(abcd, prev, e, w, i, 1);
+    }
+    for (size_t i = 10; i < 15; ++i) {
+      SHANI_ROUNDS4(abcd, prev, e, w, i, 2);
+    }
+    for (size_t i = 15; i < 20; ++i) {
+      SHANI_ROUNDS4(abcd, prev, e, w, i, 3);
+    }
+
+    e = _mm_sha1nexte_epu32(prev, e_save);
+    abcd = _mm_add_epi32(abcd, abcd_save);
+  }
+
+  _mm_storeu_si128((__m128i *)state, _mm_shuffle_epi32(abcd, 0x1b));
+  state[4] = (uint32_t)_mm_extract_epi32(e, 3);
+}
+
+static inline uint32_t rotl32(uint32_t x, int n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+SSSE3 static inline __m128i rotl32x4_1(__m128i x) {
+  return _mm_or_si128(_mm_slli_epi32(x, 1), _mm_srli_epi32(x, 31));
+}
+
+#define SHA1_ROUND(a, b, c, d, e, f, wk) \
+  do {                                   \
+    (e) += rotl32((a), 5) + (f) + (wk);  \
+    (b) = rotl32((b), 30);               \
+  } while (0)
+
+#define SHA1_CH(b, c, d) ((((c) ^ (d)) & (b)) ^ (d))
+#define SHA1_PARITY(b, c, d) ((b) ^ (c) ^ (d))
+#define SHA1_MAJ(b, c, d) (((b) & (c)) | (((b) | (c)) & (d)))
+
+/* Does five rounds, after which the roles of the working variables are back
+ * where they started. */
+#define SHA1_ROUNDS5(F, wk, t)                               \
+  do {                                                       \
+    SHA1_ROUND(a, b, c, d, e, F(b, c, d), (wk)[(t) + 0]);    \
+    SHA1_ROUND(e, a, b, c, d, F(a, b, c), (wk)[(t) + 1]);    \
+    SHA1_ROUND(d, e, a, b, c, F(e, a, b), (wk)[(t) + 2]);    \
+    SHA1_ROUND(c, d, e, a, b, F(d, e, a), (wk)[(t) + 3]);    \
+    SHA1_ROUND(b, c, d, e, a, F(c, d, e), (wk)[(t) + 4]);    \
+  } while (0)
+
+SSSE3 static void sha1_block_data_order_ssse3(uint32_t state[5],
+                                              const uint8_t *in, size_t num) {
+  const __m128i byte_swap =
+      _mm_set_epi64x(0x0c0d0e0f08090a0b, 0x0405060700010203);
+
+  for (; num > 0; --num, in += 64) {
+    /* W[t] + K[t] for all 80 rounds. */
+    alignas(16) uint32_t wk[80];
+    __m128i w[20];
+
+    for (size_t i = 0; i < 4; ++i) {
+      w[i] = _mm_shuffle_epi8(
+          _mm_loadu_si128((const __m128i *)(in + 16 * i)), byte_swap);
+    }
+    /* W[t] = ROTL1(W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16]). The W[t-3] term of
+     * the last lane of each vector is W[t], from the first lane of the same
+     * vector, so it is left out at first and patched in afterwards. */
+    for (size_t i = 4; i < 20; ++i) {
+      __m128i x =
+          _mm_xor_si128(w[i - 4], _mm_alignr_epi8(w[i - 3], w[i - 4], 8));
+      x = _mm_xor_si128(x, w[i - 2]);
+      x = _mm_xor_si128(x, _mm_srli_si128(w[i - 1], 4));
+      x = rotl32x4_1(x);
+      w[i] = _mm_xor_si128(x, rotl32x4_1(_mm_slli_si128(x, 12)));
+    }
+    for (size_t i = 0; i < 20; ++i) {
+      static const uint32_t kK[4] = {K_00_19, K_20_39, K_40_59, K_60_79};
+      __m128i wk_i = _mm_add_epi32(w[i], _mm_set1_epi32((int)kK[i / 5]));
+      _mm_store_si128((__m128i *)&wk[4 * i], wk_i);
+    }
+
+    uint32_t a = state[0];
+    uint32_t b = state[1];
+    uint32_t c = state[2];
+    uint32_t d = state[3];
+    uint32_t e = state[4];
+
+    for (size_t t = 0; t < 20; t += 5) {
+      SHA1_ROUNDS5(SHA1_CH, wk, t);
+    }
+    for (size_t t = 20; t < 40; t += 5) {
+      SHA1_ROUNDS5(SHA1_PARITY, wk, t);
+    }
+    for (size_t t = 40; t < 60; t += 5) {
+      SHA1_ROUNDS5(SHA1_MAJ, wk, t);
+    }
+    for (size_t t = 60; t < 80; t += 5) {
+      SHA1_ROUNDS5(SHA1_PARITY, wk, t);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+  }
+}
+
+/* Hashes |num| blocks and returns one if the CPU supports SHA-NI or SSSE3;
+ * otherwise returns zero without doing anything. */
+int GFp_sha1_block_data_order_simd(uint32_t state[5], const uint8_t *in,
+                                   size_t num) {
+  if (sha1_shani_capable()) {
+    sha1_block_data_order_shani(state, in, num);
+    return 1;
+  }
+  if (sha1_ssse3_capable()) {
+    sha1_block_data_order_ssse3(state, in, num);
+    return 1;
+  }
+  return 0;
+}
+
+#else
+
+int GFp_sha1_block_data_order_simd(uint32_t state[5], const uint8_t *in,
+                                   size_t num) {
+  (void)state;
+  (void)in;
+  (void)num;
+  return 0;
+}
+
+#endif
@@ -0,0 +1,226 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* The SHA-256 block function for eight unrelated messages at once, using
+ * AVX2. Lane |j| of each YMM register holds one word of the state or of the
+ * message schedule of the |j|th message.
+ *
+ * The assembly language code hashes one message at a time, and the rounds of
+ * a single message are a long chain of dependent operations. Hashing eight
+ * messages side by side is much faster when there are that many to hash,
+ * e.g. for |digest::digest_batch| and for the output blocks of PBKDF2. */
+
+#include <GFp/base.h>
+
+#include <assert.h>
+
+#include <GFp/cpu.h>
+
+#include "../../internal.h"
+
+
+#if defined(OPENSSL_X86_64) && !defined(OPENSSL_NO_ASM) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define SHA256_AVX2
+#endif
+
+
+/* Prototypes to avoid -Wmissing-prototypes warnings. */
+int GFp_sha256_x8_avx2_capable(void);
+void GFp_sha256_block_data_order_x8_avx2(uint32_t *const states[8],
+                                         const uint8_t *const data[8],
+                                         size_t num);
+
+
+#if defined(SHA256_AVX2)
+
+#include <immintrin.h>
+
+#define AVX2 __attribute__((target("avx2")))
+
+/* On CPUs with the SHA extensions, the single-message assembly language code
+ * uses them and is faster than eight AVX2 lanes. */
+int GFp_sha256_x8_avx2_capable(void) {
+  return (GFp_ia32cap_P[2] & (1u << 5)) != 0 &&
+         (GFp_ia32cap_P[2] & (1u << 29)) == 0;
+}
+
+static const uint32_t kK[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+  0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+  0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+  0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+  0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+  0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+  0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+  0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+  0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+AVX2 static inline __m256i rotr(__m256i x, int n) {
+  return _mm256_or_si256(_mm256_srli_epi32(x, n),
+                         _mm256_slli_epi32(x, 32 - n));
+}
+
+AVX2 static inline __m256i Sigma0(__m256i x) {
+  return _mm256_xor_si256(_mm256_xor_si256(rotr(x, 2), rotr(x, 13)),
+                          rotr(x, 22));
+}
+
+AVX2 static inline __m256i Sigma1(__m256i x) {
+  return _mm256_xor_si256(_mm256_xor_si256(rotr(x, 6), rotr(x, 11)),
+                          rotr(x, 25));
+}
+
+AVX2 static inline __m256i sigma0(__m256i x) {
+  return _mm256_xor_si256(_mm256_xor_si256(rotr(x, 7), rotr(x, 18)),
+                          _mm256_srli_epi32(x, 3));
+}
+
+AVX2 static inline __m256i sigma1(__m256i x) {
+  return _mm256_xor_si256(_mm256_xor_si256(rotr(x, 17), rotr(x, 19)),
+                          _mm256_srli_epi32(x, 10));
+}
+
+AVX2 static inline __m256i Ch(__m256i x, __m256i y, __m256i z) {
+  return _mm256_xor_si256(_mm256_and_si256(x, y), _mm256_andnot_si256(x, z));
+}
+
+AVX2 static inline __m256i Maj(__m256i x, __m256i y, __m256i z) {
+  return _mm256_xor_si256(_mm256_and_si256(x, y),
+                          _mm256_and_si256(z, _mm256_xor_si256(x, y)));
+}
+
+/* Transposes the 8x8 matrix of 32-bit words whose rows are |r|, so that
+ * word |i| of row |j| becomes word |j| of row |i|. */
+AVX2 static inline void transpose(__m256i r[8]) {
+  __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+  __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+  __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+  __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+  __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+  __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+  __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+  __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+  __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+  __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+  __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+  __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+  __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+  __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+  __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+  __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+  r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+  r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+  r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+  r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+  r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+  r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+  r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+  r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+/* Sets |w[i]| to the big-endian word |first + i| of the current block of
+ * each of the messages |data|. */
+AVX2 static inline void load_words(__m256i w[8], const uint8_t *const data[8],
+                                   size_t offset, size_t first) {
+  const __m256i bswap = _mm256_set_epi8(
+      12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+      12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  for (size_t j = 0; j < 8; ++j) {
+    w[j] = _mm256_loadu_si256(
+        (const __m256i *)(data[j] + offset + (4 * first)));
+  }
+  transpose(w);
+  for (size_t i = 0; i < 8; ++i) {
+    w[i] = _mm256_shuffle_epi8(w[i], bswap);
+  }
+}
+
+/* Hashes |num| blocks of each of the eight messages |data| into the
+ * corresponding element of |states|, like |GFp_sha256_block_data_order| does
+ * for one message. The elements of |states| must not alias each other, but
+ * the elements of |data| may. */
+AVX2 void GFp_sha256_block_data_order_x8_avx2(uint32_t *const states[8],
+                                              const uint8_t *const data[8],
+                                              size_t num) {
+  __m256i s[8];
+  for (size_t j = 0; j < 8; ++j) {
+    s[j] = _mm256_loadu_si256((const __m256i *)states[j]);
+  }
+  transpose(s);
+
+  for (size_t offset = 0; offset < num * 64; offset += 64) {
+    __m256i w[16];
+    load_words(&w[0], data, offset, 0);
+    load_words(&w[8], data, offset, 8);
+
+    __m256i a = s[0], b = s[1], c = s[2], d = s[3];
+    __m256i e = s[4], f = s[5], g = s[6], h = s[7];
+    for (size_t i = 0; i < 64; ++i) {
+      if (i >= 16) {
+        w[i & 15] = _mm256_add_epi32(
+            _mm256_add_epi32(w[i & 15], sigma0(w[(i + 1) & 15])),
+            _mm256_add_epi32(w[(i + 9) & 15], sigma1(w[(i + 14) & 15])));
+      }
+      __m256i t1 = _mm256_add_epi32(
+          _mm256_add_epi32(h, Sigma1(e)),
+          _mm256_add_epi32(
+              _mm256_add_epi32(Ch(e, f, g), w[i & 15]),
+              _mm256_set1_epi32((int)kK[i])));
+      __m256i t2 = _mm256_add_epi32(Sigma0(a), Maj(a, b, c));
+      h = g;
+      g = f;
+      f = e;
+      e = _mm256_add_epi32(d, t1);
+      d = c;
+      c = b;
+      b = a;
+      a = _mm256_add_epi32(t1, t2);
+    }
+
+    s[0] = _mm256_add_epi32(s[0], a);
+    s[1] = _mm256_add_epi32(s[1], b);
+    s[2] = _mm256_add_epi32(s[2], c);
+    s[3] = _mm256_add_epi32(s[3], d);
+    s[4] = _mm256_add_epi32(s[4], e);
+    s[5] = _mm256_add_epi32(s[5], f);
+    s[6] = _mm256_add_epi32(s[6], g);
+    s[7] = _mm256_add_epi32(s[7], h);
+  }
+
+  transpose(s);
+  for (size_t j = 0; j < 8; ++j) {
+    _mm256_storeu_si256((__m256i *)states[j], s[j]);
+  }
+}
+
+#else
+
+int GFp_sha256_x8_avx2_capable(void) {
+  return 0;
+}
+
+void GFp_sha256_block_data_order_x8_avx2(uint32_t *const states[8],
+                                         const uint8_t *const data[8],
+                                         size_t num) {
+  (void)states;
+  (void)data;
+  (void)num;
+  assert(0);
+}
+
+#endif
@@ -0,0 +1,319 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* Constant-time modular inversion for odd moduli using the "divstep"
+ * algorithm from "Fast constant-time gcd computation and modular inversion"
+ * by Daniel J. Bernstein and Bo-Yin Yang, structured like the implementation
+ * in libsecp256k1: the divsteps are done in batches of |INV_WORD_BITS| on the
+ * low word of |f| and |g| only, and each batch's transition matrix is then
+ * applied to the full-width |f|, |g|, |d|, and |e|.
+ *
+ * The work done depends only on |num_limbs|, never on the values. */
+
+#include "limbs.h"
+
+#include "../internal.h"
+
+
+/* Multi-word values are stored as little-endian arrays of signed words. All
+ * words but the top one are in [0, 2**INV_WORD_BITS); the top word carries the
+ * sign. The products of the transition matrix entries and the words must fit
+ * in |InvDoubleWord|.
+ *
+ * Right shifts of negative values are implementation-defined in C, but every
+ * compiler we support does a sign-extending shift, which this relies on. */
+#if defined(OPENSSL_64_BIT) && !defined(_MSC_VER)
+typedef int64_t InvWord;
+typedef uint64_t InvUWord;
+typedef int128_t InvDoubleWord;
+#define INV_WORD_BITS 62
+#else
+typedef int32_t InvWord;
+typedef uint32_t InvUWord;
+typedef int64_t InvDoubleWord;
+#define INV_WORD_BITS 30
+#endif
+
+#define INV_UWORD_BITS (sizeof(InvUWord) * 8)
+#define INV_WORD_MASK ((InvUWord)(-1) >> (INV_UWORD_BITS - INV_WORD_BITS))
+
+/* Enough for the largest RSA modulus, 8192 bits, and the sign. Keep in sync
+ * with |MAX_LIMBS| in src/rsa/bigint.rs. */
+#define INV_MAX_BITS 8192
+#define INV_MAX_WORDS ((INV_MAX_BITS + 2) / INV_WORD_BITS + 2)
+
+typedef struct {
+  InvWord u, v, q, r;
+} InvMatrix;
+
+/* Prototypes to avoid -Wmissing-prototypes warnings. */
+Limb LIMBS_mod_inverse_consttime(Limb r[], const Limb a[], const Limb m[],
+                                 size_t num_limbs);
+
+
+static inline InvUWord inv_mask_if_negative(InvUWord x) {
+  return (InvUWord)0 - (x >> (INV_UWORD_BITS - 1));
+}
+
+/* Does |INV_WORD_BITS| divsteps on the low words |f0| and |g0| of |f| and
+ * |g|, starting with |eta| == -delta. Returns the new |eta| and sets |*t| so
+ * that the new |f| and |g| are (u*f + v*g) / 2**INV_WORD_BITS and
+ * (q*f + r*g) / 2**INV_WORD_BITS. Each divstep is:
+ *
+ *    if (delta > 0 && g is odd) {
+ *      (delta, f, g) = (1 - delta, g, (g - f) / 2);
+ *    } else {
+ *      (delta, f, g) = (1 + delta, f, (g + (g mod 2) * f) / 2);
+ *    } */
+static InvUWord inv_divsteps(InvUWord eta, InvUWord f0, InvUWord g0,
+                             InvMatrix *t) {
+  /* The matrix is scaled by 2**i after i steps, so that it stays integral.
+   * Then |u| + |v| <= 2**i and |q| + |r| <= 2**i. */
+  InvUWord u = 1, v = 0, q = 0, r = 1;
+  InvUWord f = f0, g = g0;
+  for (size_t i = 0; i < INV_WORD_BITS; ++i) {
+    InvUWord c1 = inv_mask_if_negative(eta);
+    InvUWord c2 = (InvUWord)0 - (g & 1);
+    /* Add f, or -f if delta > 0, to g if g is odd. */
+    InvUWord x = (f ^ c1) - c1;
+    InvUWord y = (u ^ c1) - c1;
+    InvUWord z = (v ^ c1) - c1;
+    g += x & c2;
+    q += y & c2;
+    r += z & c2;
+    /* If delta > 0 and g was odd then f = the old g and delta = 1 - delta,
+     * otherwise delta = delta + 1. */
+    c1 &= c2;
+    eta = (eta ^ c1) - (c1 + 1);
+    f += g & c1;
+    u += q & c1;
+    v += r & c1;
+    g >>= 1;
+    u <<= 1;
+    v <<= 1;
+  }
+  t->u = (InvWord)u;
+  t->v = (InvWord)v;
+  t->q = (InvWord)q;
+  t->r = (InvWord)r;
+  return eta;
+}
+
+/* [f, g] = t * [f, g] / 2**INV_WORD_BITS, which is exact. */
+static void inv_update_fg(InvWord f[], InvWord g[], size_t len,
+                          const InvMatrix *t) {
+  InvDoubleWord cf = (InvDoubleWord)t->u * f[0] + (InvDoubleWord)t->v * g[0];
+  InvDoubleWord cg = (InvDoubleWord)t->q * f[0] + (InvDoubleWord)t->r * g[0];
+  assert(((InvUWord)cf & INV_WORD_MASK) == 0);
+  assert(((InvUWord)cg & INV_WORD_MASK) == 0);
+  cf >>= INV_WORD_BITS;
+  cg >>= INV_WORD_BITS;
+  for (size_t i = 1; i < len; ++i) {
+    cf += (InvDoubleWord)t->u * f[i] + (InvDoubleWord)t->v * g[i];
+    cg += (InvDoubleWord)t->q * f[i] + (InvDoubleWord)t->r * g[i];
+    f[i - 1] = (InvWord)((InvUWord)cf & INV_WORD_MASK);
+    g[i - 1] = (InvWord)((InvUWord)cg & INV_WORD_MASK);
+    cf >>= INV_WORD_BITS;
+    cg >>= INV_WORD_BITS;
+  }
+  f[len - 1] = (InvWord)cf;
+  g[len - 1] = (InvWord)cg;
+}
+
+/* [d, e] = t * [d, e] / 2**INV_WORD_BITS (mod m), keeping |d| and |e| in the
+ * range (-2*m, m). |m_inv| is m**-1 (mod 2**INV_WORD_BITS). */
+static void inv_update_de(InvWord d[], InvWord e[], const InvWord m[],
+                          InvUWord m_inv, size_t len, const InvMatrix *t) {
+  InvUWord sd = inv_mask_if_negative((InvUWord)d[len - 1]);
+  InvUWord se = inv_mask_if_negative((InvUWord)e[len - 1]);
+  /* Add the multiples of |m| needed to keep the results in range when |d| or
+   * |e| is negative, and then the multiples that make the low word of the
+   * results zero so that the division is exact. */
+  InvWord md = (InvWord)(((InvUWord)t->u & sd) + ((InvUWord)t->v & se));
+  InvWord me = (InvWord)(((InvUWord)t->q & sd) + ((InvUWord)t->r & se));
+  InvDoubleWord cd = (InvDoubleWord)t->u * d[0] + (InvDoubleWord)t->v * e[0];
+  InvDoubleWord ce = (InvDoubleWord)t->q * d[0] + (InvDoubleWord)t->r * e[0];
+  md -= (InvWord)((m_inv * (InvUWord)cd + (InvUWord)md) & INV_WORD_MASK);
+  me -= (InvWord)((m_inv * (InvUWord)ce + (InvUWord)me) & INV_WORD_MASK);
+  cd += (InvDoubleWord)m[0] * md;
+  ce += (InvDoubleWord)m[0] * me;
+  assert(((InvUWord)cd & INV_WORD_MASK) == 0);
+  assert(((InvUWord)ce & INV_WORD_MASK) == 0);
+  cd >>= INV_WORD_BITS;
+  ce >>= INV_WORD_BITS;
+  for (size_t i = 1; i < len; ++i) {
+    cd += (InvDoubleWord)t->u * d[i] + (InvDoubleWord)t->v * e[i] +
+          (InvDoubleWord)m[i] * md;
+    ce += (InvDoubleWord)t->q * d[i] + (InvDoubleWord)t->r * e[i] +
+          (InvDoubleWord)m[i] * me;
+    d[i - 1] = (InvWord)((InvUWord)cd & INV_WORD_MASK);
+    e[i - 1] = (InvWord)((InvUWord)ce & INV_WORD_MASK);
+    cd >>= INV_WORD_BITS;
+    ce >>= INV_WORD_BITS;
+  }
+  d[len - 1] = (InvWord)cd;
+  e[len - 1] = (InvWord)ce;
+}
+
+/* Brings the words of |a| back into [0, 2**INV_WORD_BITS), except the top
+ * one. */
+static void inv_propagate_carries(InvWord a[], size_t len) {
+  for (size_t i = 0; i < len - 1; ++i) {
+    a[i + 1] += a[i] >> INV_WORD_BITS;
+    a[i] = (InvWord)((InvUWord)a[i] & INV_WORD_MASK);
+  }
+}
+
+/* Maps |d| in (-2*m, m) to |d| * sign (mod m) in [0, m), where |sign_mask| is
+ * all ones for a sign of -1 and zero for a sign of 1. */
+static void inv_normalize(InvWord d[], const InvWord m[], size_t len,
+                          InvUWord sign_mask) {
+  InvUWord add = inv_mask_if_negative((InvUWord)d[len - 1]);
+  for (size_t i = 0; i < len; ++i) {
+    d[i] += (InvWord)((InvUWord)m[i] & add);
+  }
+  for (size_t i = 0; i < len; ++i) {
+    d[i] = (InvWord)((((InvUWord)d[i]) ^ sign_mask) - sign_mask);
+  }
+  inv_propagate_carries(d, len);
+  add = inv_mask_if_negative((InvUWord)d[len - 1]);
+  for (size_t i = 0; i < len; ++i) {
+    d[i] += (InvWord)((InvUWord)m[i] & add);
+  }
+  inv_propagate_carries(d, len);
+}
+
+static void inv_from_limbs(InvWord r[], size_t len, const Limb a[],
+                           size_t num_limbs) {
+  size_t limb_index = 0;
+  size_t bit_index = 0;
+  for (size_t i = 0; i < len; ++i) {
+    InvUWord word = 0;
+    size_t word_bits = 0;
+    while (word_bits < INV_WORD_BITS && limb_index < num_limbs) {
+      size_t n = LIMB_BITS - bit_index;
+      if (n > INV_WORD_BITS - word_bits) {
+        n = INV_WORD_BITS - word_bits;
+      }
+      InvUWord bits = (InvUWord)(a[limb_index] >> bit_index);
+      word |= (bits & (INV_WORD_MASK >> (INV_WORD_BITS - n))) << word_bits;
+      word_bits += n;
+      bit_index += n;
+      if (bit_index == LIMB_BITS) {
+        bit_index = 0;
+        ++limb_index;
+      }
+    }
+    r[i] = (InvWord)word;
+  }
+}
+
+/* |a| must be in [0, 2**(num_limbs * LIMB_BITS)). */
+static void inv_to_limbs(Limb r[], size_t num_limbs, const InvWord a[],
+                         size_t len) {
+  size_t word_index = 0;
+  size_t bit_index = 0;
+  for (size_t i = 0; i < num_limbs; ++i) {
+    Limb limb = 0;
+    size_t limb_bits = 0;
+    while (limb_bits < LIMB_BITS && word_index < len) {
+      size_t n = INV_WORD_BITS - bit_index;
+      if (n > LIMB_BITS - limb_bits) {
+        n = LIMB_BITS - limb_bits;
+      }
+      Limb bits = (Limb)((InvUWord)a[word_index] >> bit_index);
+      if (n < LIMB_BITS) {
+        bits &= ((Limb)1 << n) - 1;
+      }
+      limb |= bits << limb_bits;
+      limb_bits += n;
+      bit_index += n;
+      if (bit_index == INV_WORD_BITS) {
+        bit_index = 0;
+        ++word_index;
+      }
+    }
+    r[i] = limb;
+  }
+}
+
+/* Sets |r| to |a|**-1 (mod |m|) and returns 0xfff..f if |a| is invertible;
+ * otherwise sets |r| to an unspecified value and returns zero. |m| must be odd
+ * and |a| must be less than |m|. |r| may alias |a|. */
+Limb LIMBS_mod_inverse_consttime(Limb r[], const Limb a[], const Limb m[],
+                                 size_t num_limbs) {
+  assert(num_limbs >= 1);
+  assert(m[0] & 1);
+  size_t bits = num_limbs * LIMB_BITS;
+  if (bits > INV_MAX_BITS) {
+    return 0;
+  }
+  /* Room for values in (-2**(bits + 1), 2**(bits + 1)) plus the slack that
+   * |inv_update_de| needs in the top word. */
+  size_t len = (bits + 2) / INV_WORD_BITS + 2;
+
+  InvWord f[INV_MAX_WORDS];
+  InvWord g[INV_MAX_WORDS];
+  InvWord d[INV_MAX_WORDS];
+  InvWord e[INV_MAX_WORDS];
+  InvWord m_words[INV_MAX_WORDS];
+  inv_from_limbs(m_words, len, m, num_limbs);
+  inv_from_limbs(f, len, m, num_limbs);
+  inv_from_limbs(g, len, a, num_limbs);
+  for (size_t i = 0; i < len; ++i) {
+    d[i] = 0;
+    e[i] = 0;
+  }
+  e[0] = 1;
+
+  /* m_inv = m**-1 (mod 2**INV_WORD_BITS), by Newton's method; each
+   * iteration doubles the number of correct low bits, starting with 3. */
+  InvUWord m_inv = (InvUWord)m_words[0];
+  for (size_t i = 0; i < 5; ++i) {
+    m_inv *= 2 - (InvUWord)m_words[0] * m_inv;
+  }
+  assert((((InvUWord)m_words[0] * m_inv) & INV_WORD_MASK) == 1);
+
+  /* Theorem 11.2 of the paper bounds the number of divsteps needed for
+   * inputs of |bits| bits. */
+  size_t divsteps =
+      bits < 46 ? (49 * bits + 80) / 17 : (49 * bits + 57) / 17;
+  size_t rounds = (divsteps + INV_WORD_BITS - 1) / INV_WORD_BITS;
+
+  InvUWord eta = (InvUWord)-1; /* delta == 1 */
+  for (size_t i = 0; i < rounds; ++i) {
+    InvMatrix t;
+    eta = inv_divsteps(eta, (InvUWord)f[0], (InvUWord)g[0], &t);
+    inv_update_de(d, e, m_words, m_inv, len, &t);
+    inv_update_fg(f, g, len, &t);
+  }
+
+  /* Now g == 0 and f == ±gcd(a, m), and d == a**-1 * f (mod m) if a is
+   * invertible. f == 1 is {1, 0, ..., 0} and f == -1 is {mask, ..., mask, -1}
+   * in this representation. */
+  size_t is_one = constant_time_eq_s((size_t)f[0], 1);
+  size_t is_minus_one = constant_time_eq_s((size_t)f[0], INV_WORD_MASK);
+  for (size_t i = 1; i < len - 1; ++i) {
+    is_one &= constant_time_is_zero_s((size_t)f[i]);
+    is_minus_one &= constant_time_eq_s((size_t)f[i], INV_WORD_MASK);
+  }
+  is_one &= constant_time_is_zero_s((size_t)f[len - 1]);
+  is_minus_one &= constant_time_eq_s((size_t)f[len - 1], (size_t)-1);
+
+  inv_normalize(d, m_words, len,
+                inv_mask_if_negative((InvUWord)f[len - 1]));
+  inv_to_limbs(r, num_limbs, d, len);
+
+  return (Limb)(is_one | is_minus_one);
+}
@@ -0,0 +1,225 @@
+/* Copyright 2017 Brian Smith.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+ * OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
+
+/* AES-GCM using the 512-bit VAES and VPCLMULQDQ instructions, sixteen blocks
+ * at a time: four blocks in each of four ZMM registers.
+ *
+ * GHASH is computed in the byte-reflected representation of "Intel
+ * Carry-Less Multiplication Instruction and its Usage for Computing the GCM
+ * Mode" by Gueron and Kounavis: each block is byte-swapped, multiplied
+ * schoolbook-style, shifted left by one bit and then reduced. The sixteen
+ * products of each iteration, the first block's including |Xi|, are each
+ * multiplied by the matching power of H from |GFp_gcm_init_vaes_avx512| and
+ * summed before a single reduction. */
+
+#include "internal.h"
+
+#if defined(GCM_VAES_AVX512)
+
+#include <immintrin.h>
+
+#include <GFp/cpu.h>
+#include <GFp/type_check.h>
+
+
+#define PCLMUL __attribute__((target("pclmul,ssse3")))
+#define VAES_AVX512 \
+  __attribute__((target("aes,pclmul,avx512f,avx512bw,vaes,vpclmulqdq")))
+
+/* The number of bytes done in each iteration of the main loop. */
+#define VAES_AVX512_STRIDE (16 * 16)
+
+OPENSSL_COMPILE_ASSERT(GCM128_HTABLE_LEN == 16 + 16,
+                       GCM128_HTABLE_LEN_too_small_for_vaes_avx512);
+
+int GFp_gcm_vaes_avx512_capable(void) {
+  /* AVX512F (bit 16) and AVX512BW (bit 30) of CPUID leaf 7, EBX, and VAES
+   * (bit 9) and VPCLMULQDQ (bit 10) of leaf 7, ECX. */
+  static const uint32_t kAVX512FAndBW = (1u << 16) | (1u << 30);
+  static const uint32_t kVAESAndVPCLMULQDQ = (1u << 9) | (1u << 10);
+  return (GFp_ia32cap_P[2] & kAVX512FAndBW) == kAVX512FAndBW &&
+         (GFp_ia32cap_P[3] & kVAESAndVPCLMULQDQ) == kVAESAndVPCLMULQDQ;
+}
+
+PCLMUL static inline __m128i byte_swap(__m128i x) {
+  return _mm_shuffle_epi8(
+      x, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+/* Returns the reduction of the product whose low, middle and high 128-bit
+ * pieces are |lo|, |mid| and |hi|, i.e. lo + mid * x^64 + hi * x^128 before
+ * the one-bit shift. */
+PCLMUL static inline __m128i gf128_reduce(__m128i lo, __m128i mid,
+                                          __m128i hi) {
+  lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+  hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+  /* Shift [hi:lo] left by one bit. */
+  __m128i lo_carry = _mm_srli_epi32(lo, 31);
+  __m128i hi_carry = _mm_srli_epi32(hi, 31);
+  lo = _mm_slli_epi32(lo, 1);
+  hi = _mm_slli_epi32(hi, 1);
+  hi = _mm_or_si128(hi, _mm_slli_si128(hi_carry, 4));
+  hi = _mm_or_si128(hi, _mm_srli_si128(lo_carry, 12));
+  lo = _mm_or_si128(lo, _mm_slli_si128(lo_carry, 4));
+
+  /* Reduce modulo x^128 + x^7 + x^2 + x + 1. */
+  __m128i t = _mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30));
+  t = _mm_xor_si128(t, _mm_slli_epi32(lo, 25));
+  __m128i t_hi = _mm_srli_si128(t, 4);
+  lo = _mm_xor_si128(lo, _mm_slli_si128(t, 12));
+  __m128i u = _mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2));
+  u = _mm_xor_si128(u, _mm_srli_epi32(lo, 7));
+  u = _mm_xor_si128(u, t_hi);
+  lo = _mm_xor_si128(lo, u);
+  return _mm_xor_si128(hi, lo);
+}
+
+PCLMUL static __m128i gf128_mul(__m128i a, __m128i b) {
+  __m128i mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x01),
+                              _mm_clmulepi64_si128(a, b, 0x10));
+  return gf128_reduce(_mm_clmulepi64_si128(a, b, 0x00), mid,
+                      _mm_clmulepi64_si128(a, b, 0x11));
+}
+
+PCLMUL void GFp_gcm_init_vaes_avx512(u128 Htable_wide[16],
+                                     const uint64_t H[2]) {
+  /* The byte-reflected H has the first half of H in its high 64 bits. */
+  const __m128i h = _mm_set_epi64x((long long)H[0], (long long)H[1]);
+  __m128i h_i = h;
+  for (size_t i = 1; i <= 16; ++i) {
+    _mm_storeu_si128((__m128i *)&Htable_wide[16 - i], h_i);
+    h_i = gf128_mul(h_i, h);
+  }
+}
+
+VAES_AVX512 static inline __m128i fold512(__m512i v) {
+  __m256i t = _mm256_xor_si256(_mm512_castsi512_si256(v),
+                               _mm512_extracti64x4_epi64(v, 1));
+  return _mm_xor_si128(_mm256_castsi256_si128(t),
+                       _mm256_extracti128_si256(t, 1));
+}
+
+VAES_AVX512 static size_t aes_gcm_vaes_avx512(
+    const uint8_t *in, uint8_t *out, size_t len, const AES_KEY *key,
+    uint8_t Yi[16], uint8_t Xi[16], const u128 Htable_wide[16], int encrypt) {
+  if (len < VAES_AVX512_STRIDE) {
+    return 0;
+  }
+
+  const __m512i bswap = _mm512_broadcast_i32x4(
+      _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+
+  /* |key| was set up by |GFp_aesni_set_encrypt_key|, which stores the number
+   * of rounds before the last one in |key->rounds|. */
+  const size_t rounds = key->rounds;
+  __m512i rk[AES_MAXNR + 1];
+  for (size_t i = 0; i <= rounds + 1; ++i) {
+    rk[i] = _mm512_broadcast_i32x4(
+        _mm_loadu_si128((const __m128i *)&key->rd_key[4 * i]));
+  }
+
+  __m512i h[4];
+  for (size_t j = 0; j < 4; ++j) {
+    h[j] = _mm512_loadu_si512(&Htable_wide[4 * j]);
+  }
+
+  /* The counter blocks are kept byte-swapped so that the 32-bit counter is
+   * in the low 32-bit lane of each block. */
+  __m512i ctr =
+      _mm512_shuffle_epi8(_mm512_broadcast_i32x4(_mm_loadu_si128(
+                              (const __m128i *)Yi)), bswap);
+  ctr = _mm512_add_epi32(ctr, _mm512_set_epi32(0, 0, 0, 3, 0, 0, 0, 2, 0, 0,
+                                               0, 1, 0, 0, 0, 0));
+  const __m512i four = _mm512_set_epi32(0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4,
+                                        0, 0, 0, 4);
+
+  __m128i x = byte_swap(_mm_loadu_si128((const __m128i *)Xi));
+
+  size_t bulk = 0;
+  while (len >= VAES_AVX512_STRIDE) {
+    __m512i b[4];
+    for (size_t j = 0; j < 4; ++j) {
+      b[j] = _mm512_xor_si512(_mm512_shuffle_epi8(ctr, bswap), rk[0]);
+      ctr = _mm512_add_epi32(ctr, four);
+    }
+    for (size_t r = 1; r <= rounds; ++r) {
+      for (size_t j = 0; j < 4; ++j) {
+        b[j] = _mm512_aesenc_epi128(b[j], rk[r]);
+      }
+    }
+    for (size_t j = 0; j < 4; ++j) {
+      b[j] = _mm512_aesenclast_epi128(b[j], rk[rounds + 1]);
+    }
+
+    /* All of the input is read before any output is written, since |out|
+     * may be a little before |in| in the same buffer. */
+    __m512i c[4];
+    for (size_t j = 0; j < 4; ++j) {
+      c[j] = _mm512_loadu_si512(in + 64 * j);
+      b[j] = _mm512_xor_si512(b[j], c[j]);
+    }
+    for (size_t j = 0; j < 4; ++j) {
+      _mm512_storeu_si512(out + 64 * j, b[j]);
+      if (encrypt) {
+        c[j] = b[j];
+      }
+    }
+
+    c[0] = _mm512_xor_si512(
+        _mm512_shuffle_epi8(c[0], bswap),
+        _mm512_inserti32x4(_mm512_setzero_si512(), x, 0));
+    __m512i lo = _mm512_setzero_si512();
+    __m512i mid = _mm512_setzero_si512();
+    __m512i hi = _mm512_setzero_si512();
+    for (size_t j = 0; j < 4; ++j) {
+      __m512i a = j == 0 ? c[0] : _mm512_shuffle_epi8(c[j], bswap);
+      lo = _mm512_xor_si512(lo, _mm512_clmulepi64_epi128(a, h[j], 0x00));
+      mid = _mm512_xor_si512(mid, _mm512_clmulepi64_epi128(a, h[j], 0x01));
+      mid = _mm512_xor_si512(mid, _mm512_clmulepi64_epi128(a, h[j], 0x10));
+      hi = _mm512_xor_si512(hi, _mm512_clmulepi64_epi128(a, h[j], 0x11));
+    }
+    x = gf128_reduce(fold512(lo), fold512(mid), fold512(hi));
+
+    in += VAES_AVX512_STRIDE;
+    out += VAES_AVX512_STRIDE;
+    len -= VAES_AVX512_STRIDE;
+    bulk += VAES_AVX512_STRIDE;
+  }
+
+  _mm_storeu_si128((__m128i *)Xi, byte_swap(x));
+  to_be_u32_ptr(Yi + 12,
+                (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(ctr)));
+  return bulk;
+}
+
+VAES_AVX512 size_t GFp_aes_gcm_encrypt_vaes_avx512(
+    const uint8_t *in, uint8_t *out, size_t len, const AES_KEY *key,
+    uint8_t Yi[16], uint8_t Xi[16], const u128 Htable_wide[16]) {
+  return aes_gcm_vaes_avx512(in, out, len, key, Yi, Xi, Htable_wide, 1);
+}
+
+VAES_AVX512 size_t GFp_aes_gcm_decrypt_vaes_avx512(
+    const uint8_t *in, uint8_t *out, size_t len, const AES_KEY *key,
+    uint8_t Yi[16], uint8_t Xi[16], const u128 Htable_wide[16]) {
+  return aes_gcm_vaes_avx512(in, out, len, key, Yi, Xi, Htable_wide, 0);
+}
+
+#elif defined(OPENSSL_X86_64)
+
+int GFp_gcm_vaes_avx512_capable(void) {
+  return 0;
+}
+
+#endif
@@ -67,206 +67,218 @@
 #endif
 
 
-#define PACK(s) ((size_t)(s) << (sizeof(size_t) * 8 - 16))
-#define REDUCE1BIT(V)                                                  \
-  do {                                                                 \
-    if (sizeof(size_t) == 8) {                                         \
-      uint64_t T = UINT64_C(0xe100000000000000) & (0 - (V.lo & 1)); \
-      V.lo = (V.hi << 63) | (V.lo >> 1);                               \
-      V.hi = (V.hi >> 1) ^ T;                                          \
-    } else {                                                           \
-      uint32_t T = 0xe1000000U & (0 - (uint32_t)(V.lo & 1));           \
-      V.lo = (V.hi << 63) | (V.lo >> 1);                               \
-      V.hi = (V.hi >> 1) ^ ((uint64_t)T << 32);                        \
-    }                                                                  \
-  } while (0)
-
 // kSizeTWithoutLower4Bits is a mask that can be used to zero the lower four
 // bits of a |size_t|.
 static const size_t kSizeTWithoutLower4Bits = (size_t) -16;
 
-static void gcm_init_4bit(u128 Htable[16], const uint64_t H[2]) {
-  u128 V;
-
-  Htable[0].hi = 0;
-  Htable[0].lo = 0;
-  V.hi = H[0];
-  V.lo = H[1];
-
-  Htable[8] = V;
-  REDUCE1BIT(V);
-  Htable[4] = V;
-  REDUCE1BIT(V);
-  Htable[2] = V;
-  REDUCE1BIT(V);
-  Htable[1] = V;
-  Htable[3].hi = V.hi ^ Htable[2].hi, Htable[3].lo = V.lo ^ Htable[2].lo;
-  V = Htable[4];
-  Htable[5].hi = V.hi ^ Htable[1].hi, Htable[5].lo = V.lo ^ Htable[1].lo;
-  Htable[6].hi = V.hi ^ Htable[2].hi, Htable[6].lo = V.lo ^ Htable[2].lo;
-  Htable[7].hi = V.hi ^ Htable[3].hi, Htable[7].lo = V.lo ^ Htable[3].lo;
-  V = Htable[8];
-  Htable[9].hi = V.hi ^ Htable[1].hi, Htable[9].lo = V.lo ^ Htable[1].lo;
-  Htable[10].hi = V.hi ^ Htable[2].hi, Htable[10].lo = V.lo ^ Htable[2].lo;
-  Htable[11].hi = V.hi ^ Htable[3].hi, Htable[11].lo = V.lo ^ Htable[3].lo;
-  Htable[12].hi = V.hi ^ Htable[4].hi, Htable[12].lo = V.lo ^ Htable[4].lo;
-  Htable[13].hi = V.hi ^ Htable[5].hi, Htable[13].lo = V.lo ^ Htable[5].lo;
-  Htable[14].hi = V.hi ^ Htable[6].hi, Htable[14].lo = V.lo ^ Htable[6].lo;
-  Htable[15].hi = V.hi ^ Htable[7].hi, Htable[15].lo = V.lo ^ Htable[7].lo;
-
-#if defined(GHASH_ASM) && defined(OPENSSL_ARM)
-  /* ARM assembler expects specific dword order in Htable. */
-  {
-    int j;
-
-    for (j = 0; j < 16; ++j) {
-      V = Htable[j];
-#if OPENSSL_ENDIAN == OPENSSL_LITTLE_ENDIAN
-      Htable[j].hi = V.lo;
-      Htable[j].lo = V.hi;
-#elif OPENSSL_ENDIAN == OPENSSL_BIG_ENDIAN
-      Htable[j].hi = V.lo << 32 | V.lo >> 32;
-      Htable[j].lo = V.hi << 32 | V.hi >> 32;
-#else
-#error "OPENSSL_ENDIAN not set."
-#endif
-    }
-  }
-#endif
+/* The generic GHASH implementation.
+ *
+ * This is used when there is no carry-less multiplication instruction. Unlike
+ * the traditional 4-bit table implementation, it doesn't index any memory with
+ * secret data; the carry-less products are computed with ordinary integer
+ * multiplications of masked operands, as in BearSSL's |ghash_ctmul64|. It
+ * assumes that the CPU's integer multiplier runs in constant time, which is
+ * true of all the targets *ring* supports except some very old ARM cores. */
+
+#if defined(OPENSSL_64_BIT) && !defined(_MSC_VER)
+
+/* gcm_mul64_nohw sets |*out_lo| and |*out_hi| to the low and high halves of
+ * the carry-less product of |a| and |b|. */
+static void gcm_mul64_nohw(uint64_t *out_lo, uint64_t *out_hi, uint64_t a,
+                           uint64_t b) {
+  /* Keeping only every fourth bit of each operand means at most 15 terms can
+   * accumulate in any bit position of the integer product, so the carries
+   * never reach the next position of the same residue class mod 4. That holds
+   * for |a|'s top 60 bits; the bottom four bits of |a| are multiplied in
+   * separately. */
+  uint64_t a0 = a & UINT64_C(0x1111111111111110);
+  uint64_t a1 = a & UINT64_C(0x2222222222222220);
+  uint64_t a2 = a & UINT64_C(0x4444444444444440);
+  uint64_t a3 = a & UINT64_C(0x8888888888888880);
+
+  uint64_t b0 = b & UINT64_C(0x1111111111111111);
+  uint64_t b1 = b & UINT64_C(0x2222222222222222);
+  uint64_t b2 = b & UINT64_C(0x4444444444444444);
+  uint64_t b3 = b & UINT64_C(0x8888888888888888);
+
+  uint128_t c0 = (a0 * (uint128_t)b0) ^ (a1 * (uint128_t)b3) ^
+                 (a2 * (uint128_t)b2) ^ (a3 * (uint128_t)b1);
+  uint128_t c1 = (a0 * (uint128_t)b1) ^ (a1 * (uint128_t)b0) ^
+                 (a2 * (uint128_t)b3) ^ (a3 * (uint128_t)b2);
+  uint128_t c2 = (a0 * (uint128_t)b2) ^ (a1 * (uint128_t)b1) ^
+                 (a2 * (uint128_t)b0) ^ (a3 * (uint128_t)b3);
+  uint128_t c3 = (a0 * (uint128_t)b3) ^ (a1 * (uint128_t)b2) ^
+                 (a2 * (uint128_t)b1) ^ (a3 * (uint128_t)b0);
+
+  uint64_t a0_mask = UINT64_C(0) - (a & 1);
+  uint64_t a1_mask = UINT64_C(0) - ((a >> 1) & 1);
+  uint64_t a2_mask = UINT64_C(0) - ((a >> 2) & 1);
+  uint64_t a3_mask = UINT64_C(0) - ((a >> 3) & 1);
+  uint128_t extra = (uint128_t)(a0_mask & b) ^
+                    ((uint128_t)(a1_mask & b) << 1) ^
+                    ((uint128_t)(a2_mask & b) << 2) ^
+                    ((uint128_t)(a3_mask & b) << 3);
+
+  *out_lo = (((uint64_t)c0) & UINT64_C(0x1111111111111111)) ^
+            (((uint64_t)c1) & UINT64_C(0x2222222222222222)) ^
+            (((uint64_t)c2) & UINT64_C(0x4444444444444444)) ^
+            (((uint64_t)c3) & UINT64_C(0x8888888888888888)) ^
+            ((uint64_t)extra);
+  *out_hi = (((uint64_t)(c0 >> 64)) & UINT64_C(0x1111111111111111)) ^
+            (((uint64_t)(c1 >> 64)) & UINT64_C(0x2222222222222222)) ^
+            (((uint64_t)(c2 >> 64)) & UINT64_C(0x4444444444444444)) ^
+            (((uint64_t)(c3 >> 64)) & UINT64_C(0x8888888888888888)) ^
+            ((uint64_t)(extra >> 64));
 }
 
-#if !defined(GHASH_ASM) || defined(OPENSSL_AARCH64) || defined(OPENSSL_PPC64LE)
-static const size_t rem_4bit[16] = {
-    PACK(0x0000), PACK(0x1C20), PACK(0x3840), PACK(0x2460),
-    PACK(0x7080), PACK(0x6CA0), PACK(0x48C0), PACK(0x54E0),
-    PACK(0xE100), PACK(0xFD20), PACK(0xD940), PACK(0xC560),
-    PACK(0x9180), PACK(0x8DA0), PACK(0xA9C0), PACK(0xB5E0)};
-
-static void GFp_gcm_gmult_4bit(uint8_t Xi[16], const u128 Htable[16]) {
-  u128 Z;
-  int cnt = 15;
-  size_t rem, nlo, nhi;
-
-  nlo = Xi[15];
-  nhi = nlo >> 4;
-  nlo &= 0xf;
-
-  Z.hi = Htable[nlo].hi;
-  Z.lo = Htable[nlo].lo;
-
-  while (1) {
-    rem = (size_t)Z.lo & 0xf;
-    Z.lo = (Z.hi << 60) | (Z.lo >> 4);
-    Z.hi = (Z.hi >> 4);
-    if (sizeof(size_t) == 8) {
-      Z.hi ^= rem_4bit[rem];
-    } else {
-      Z.hi ^= (uint64_t)rem_4bit[rem] << 32;
-    }
+#else
 
-    Z.hi ^= Htable[nhi].hi;
-    Z.lo ^= Htable[nhi].lo;
+/* gcm_mul32_nohw returns the carry-less product of |a| and |b|. */
+static uint64_t gcm_mul32_nohw(uint32_t a, uint32_t b) {
+  /* At most eight terms accumulate in any bit position, so there is no need to
+   * treat the bottom bits of |a| specially as |gcm_mul64_nohw| does above. */
+  uint32_t a0 = a & 0x11111111;
+  uint32_t a1 = a & 0x22222222;
+  uint32_t a2 = a & 0x44444444;
+  uint32_t a3 = a & 0x88888888;
+
+  uint32_t b0 = b & 0x11111111;
+  uint32_t b1 = b & 0x22222222;
+  uint32_t b2 = b & 0x44444444;
+  uint32_t b3 = b & 0x88888888;
+
+  uint64_t c0 = (a0 * (uint64_t)b0) ^ (a1 * (uint64_t)b3) ^
+                (a2 * (uint64_t)b2) ^ (a3 * (uint64_t)b1);
+  uint64_t c1 = (a0 * (uint64_t)b1) ^ (a1 * (uint64_t)b0) ^
+                (a2 * (uint64_t)b3) ^ (a3 * (uint64_t)b2);
+  uint64_t c2 = (a0 * (uint64_t)b2) ^ (a1 * (uint64_t)b1) ^
+                (a2 * (uint64_t)b0) ^ (a3 * (uint64_t)b3);
+  uint64_t c3 = (a0 * (uint64_t)b3) ^ (a1 * (uint64_t)b2) ^
+                (a2 * (uint64_t)b1) ^ (a3 * (uint64_t)b0);
+
+  return (c0 & UINT64_C(0x1111111111111111)) |
+         (c1 & UINT64_C(0x2222222222222222)) |
+         (c2 & UINT64_C(0x4444444444444444)) |
+         (c3 & UINT64_C(0x8888888888888888));
+}
 
-    if (--cnt < 0) {
-      break;
-    }
+static void gcm_mul64_nohw(uint64_t *out_lo, uint64_t *out_hi, uint64_t a,
+                           uint64_t b) {
+  uint32_t a0 = (uint32_t)a;
+  uint32_t a1 = (uint32_t)(a >> 32);
+  uint32_t b0 = (uint32_t)b;
+  uint32_t b1 = (uint32_t)(b >> 32);
+  /* Karatsuba multiplication. */
+  uint64_t lo = gcm_mul32_nohw(a0, b0);
+  uint64_t hi = gcm_mul32_nohw(a1, b1);
+  uint64_t mid = gcm_mul32_nohw(a0 ^ a1, b0 ^ b1) ^ lo ^ hi;
+  *out_lo = lo ^ (mid << 32);
+  *out_hi = hi ^ (mid >> 32);
+}
 
-    nlo = Xi[cnt];
-    nhi = nlo >> 4;
-    nlo &= 0xf;
-
-    rem = (size_t)Z.lo & 0xf;
-    Z.lo = (Z.hi << 60) | (Z.lo >> 4);
-    Z.hi = (Z.hi >> 4);
-    if (sizeof(size_t) == 8) {
-      Z.hi ^= rem_4bit[rem];
-    } else {
-      Z.hi ^= (uint64_t)rem_4bit[rem] << 32;
-    }
+#endif
 
-    Z.hi ^= Htable[nlo].hi;
-    Z.lo ^= Htable[nlo].lo;
-  }
+static void gcm_init_nohw(u128 Htable[16], const uint64_t H[2]) {
+  /* GHASH is computed in terms of POLYVAL (RFC 8452), which avoids the shift
+   * by one that the bit-reflected GHASH multiplication would otherwise need
+   * after each product. Following Appendix A of RFC 8452, that means
+   * multiplying H by x, as |GFp_gcm_init_clmul| also does. Only |Htable[0]| is
+   * used. */
+  Htable[0].lo = H[1];
+  Htable[0].hi = H[0];
 
-  to_be_u64_ptr(Xi, Z.hi);
-  to_be_u64_ptr(Xi + 8, Z.lo);
-}
+  uint64_t carry = UINT64_C(0) - (Htable[0].hi >> 63);
 
-/* Streamed gcm_mult_4bit, see GFp_gcm128_[en|de]crypt for
- * details... Compiler-generated code doesn't seem to give any
- * performance improvement, at least not on x86[_64]. It's here
- * mostly as reference and a placeholder for possible future
- * non-trivial optimization[s]... */
-static void GFp_gcm_ghash_4bit(uint8_t Xi[16], const u128 Htable[16],
-                               const uint8_t *inp, size_t len) {
-  u128 Z;
-  int cnt;
-  size_t rem, nlo, nhi;
-
-  do {
-    cnt = 15;
-    nlo = Xi[15];
-    nlo ^= inp[15];
-    nhi = nlo >> 4;
-    nlo &= 0xf;
-
-    Z.hi = Htable[nlo].hi;
-    Z.lo = Htable[nlo].lo;
-
-    while (1) {
-      rem = (size_t)Z.lo & 0xf;
-      Z.lo = (Z.hi << 60) | (Z.lo >> 4);
-      Z.hi = (Z.hi >> 4);
-      if (sizeof(size_t) == 8) {
-        Z.hi ^= rem_4bit[rem];
-      } else {
-        Z.hi ^= (uint64_t)rem_4bit[rem] << 32;
-      }
+  Htable[0].hi <<= 1;
+  Htable[0].hi |= Htable[0].lo >> 63;
+  Htable[0].lo <<= 1;
 
-      Z.hi ^= Htable[nhi].hi;
-      Z.lo ^= Htable[nhi].lo;
+  /* The reduction polynomial is 1 + x^121 + x^126 + x^127 + x^128, so
+   * conditionally add 0xc200...0001. */
+  Htable[0].lo ^= carry & 1;
+  Htable[0].hi ^= carry & UINT64_C(0xc200000000000000);
+}
 
-      if (--cnt < 0) {
-        break;
-      }
+/* gcm_polyval_nohw sets |Xi| to |Xi| * |H| * x^-128, where |Xi[0]| holds the
+ * low half of the POLYVAL field element. */
+static void gcm_polyval_nohw(uint64_t Xi[2], const u128 *H) {
+  /* Karatsuba multiplication of |Xi| and |H| into |r0|..|r3|. */
+  uint64_t r0, r1;
+  gcm_mul64_nohw(&r0, &r1, Xi[0], H->lo);
+  uint64_t r2, r3;
+  gcm_mul64_nohw(&r2, &r3, Xi[1], H->hi);
+  uint64_t mid0, mid1;
+  gcm_mul64_nohw(&mid0, &mid1, Xi[0] ^ Xi[1], H->hi ^ H->lo);
+  mid0 ^= r0 ^ r2;
+  mid1 ^= r1 ^ r3;
+  r2 ^= mid1;
+  r1 ^= mid0;
+
+  /* Multiply the 256-bit product by x^-128 and reduce. |r2| and |r3| are
+   * already in position; |r0| and |r1| are multiplied by
+   * x^-128 = x^-7 + x^-2 + x^-1 + 1. The bits that the negative powers shift
+   * out past x^0 are folded back into |r1| first so that only one reduction is
+   * needed. */
+  r1 ^= (r0 << 63) ^ (r0 << 62) ^ (r0 << 57);
+
+  /* 1 */
+  r2 ^= r0;
+  r3 ^= r1;
+
+  /* x^-1 */
+  r2 ^= r0 >> 1;
+  r2 ^= r1 << 63;
+  r3 ^= r1 >> 1;
+
+  /* x^-2 */
+  r2 ^= r0 >> 2;
+  r2 ^= r1 << 62;
+  r3 ^= r1 >> 2;
+
+  /* x^-7 */
+  r2 ^= r0 >> 7;
+  r2 ^= r1 << 57;
+  r3 ^= r1 >> 7;
+
+  Xi[0] = r2;
+  Xi[1] = r3;
+}
 
-      nlo = Xi[cnt];
-      nlo ^= inp[cnt];
-      nhi = nlo >> 4;
-      nlo &= 0xf;
-
-      rem = (size_t)Z.lo & 0xf;
-      Z.lo = (Z.hi << 60) | (Z.lo >> 4);
-      Z.hi = (Z.hi >> 4);
-      if (sizeof(size_t) == 8) {
-        Z.hi ^= rem_4bit[rem];
-      } else {
-        Z.hi ^= (uint64_t)rem_4bit[rem] << 32;
-      }
+static void gcm_gmult_nohw(uint8_t Xi[16], const u128 Htable[16]) {
+  /* Reversing the byte order of GHASH's big-endian element gives POLYVAL's
+   * little-endian one. */
+  uint64_t swapped[2];
+  swapped[0] = from_be_u64_ptr(Xi + 8);
+  swapped[1] = from_be_u64_ptr(Xi);
+  gcm_polyval_nohw(swapped, &Htable[0]);
+  to_be_u64_ptr(Xi, swapped[1]);
+  to_be_u64_ptr(Xi + 8, swapped[0]);
+}
 
-      Z.hi ^= Htable[nlo].hi;
-      Z.lo ^= Htable[nlo].lo;
-    }
+static void gcm_ghash_nohw(uint8_t Xi[16], const u128 Htable[16],
+                           const uint8_t *inp, size_t len) {
+  uint64_t swapped[2];
+  swapped[0] = from_be_u64_ptr(Xi + 8);
+  swapped[1] = from_be_u64_ptr(Xi);
+
+  while (len >= 16) {
+    swapped[0] ^= from_be_u64_ptr(inp + 8);
+    swapped[1] ^= from_be_u64_ptr(inp);
+    gcm_polyval_nohw(swapped, &Htable[0]);
+    inp += 16;
+    len -= 16;
+  }
 
-    Xi[0] = from_be_u64(Z.hi);
-    Xi[1] = from_be_u64(Z.lo);
-  } while (inp += 16, len -= 16);
+  to_be_u64_ptr(Xi, swapped[1]);
+  to_be_u64_ptr(Xi + 8, swapped[0]);
 }
-#else /* GHASH_ASM */
-void GFp_gcm_gmult_4bit(uint8_t Xi[16], const u128 Htable[16]);
-void GFp_gcm_ghash_4bit(uint8_t Xi[16], const u128 Htable[16],
-                        const uint8_t *inp, size_t len);
-#endif
 
-#define GCM_MUL(ctx, Xi) GFp_gcm_gmult_4bit(ctx->Xi, ctx->Htable)
-#if defined(GHASH_ASM)
-#define GHASH(ctx, in, len) \
-    GFp_gcm_ghash_4bit((ctx)->Xi, (ctx)->Htable, in, len)
+#define GCM_MUL(ctx, Xi) gcm_gmult_nohw(ctx->Xi, ctx->Htable)
+#define GHASH(ctx, in, len) gcm_ghash_nohw((ctx)->Xi, (ctx)->Htable, in, len)
 /* GHASH_CHUNK is "stride parameter" missioned to mitigate cache
  * trashing effect. In other words idea is to hash data while it's
  * still in L1 cache after encryption pass... */
 #define GHASH_CHUNK (3 * 1024)
-#endif
 
 
 #if defined(GHASH_ASM)
@@ -294,13 +306,18 @@ size_t GFp_aesni_gcm_encrypt(const uint8_t *in, uint8_t *out, size_t len,
                              const void *key, uint8_t ivec[16], uint8_t Xi[16]);
 size_t GFp_aesni_gcm_decrypt(const uint8_t *in, uint8_t *out, size_t len,
                              const void *key, uint8_t ivec[16], uint8_t Xi[16]);
+
+#if defined(GCM_VAES_AVX512)
+/* The powers of H for |GFp_aes_gcm_encrypt_vaes_avx512| were computed along
+ * with the AVX table; see |gcm128_init_htable|. */
+static int vaes_avx512_gcm_enabled(GCM128_CONTEXT *ctx, aes_ctr_f stream) {
+  return aesni_gcm_enabled(ctx, stream) && GFp_gcm_vaes_avx512_capable();
+}
+#endif
 #endif
 
 #if defined(OPENSSL_X86)
 #define GHASH_ASM_X86
-void GFp_gcm_gmult_4bit_mmx(uint8_t Xi[16], const u128 Htable[16]);
-void GFp_gcm_ghash_4bit_mmx(uint8_t Xi[16], const u128 Htable[16],
-                            const uint8_t *inp, size_t len);
 #endif
 
 #elif defined(OPENSSL_ARM) || defined(OPENSSL_AARCH64)
@@ -339,11 +356,9 @@ void GFp_gcm_ghash_p8(uint64_t Xi[2], const u128 Htable[16], const uint8_t *inp,
 #ifdef GCM_FUNCREF_4BIT
 #undef GCM_MUL
 #define GCM_MUL(ctx, Xi) (*gcm_gmult_p)(ctx->Xi, ctx->Htable)
-#ifdef GHASH
 #undef GHASH
 #define GHASH(ctx, in, len) (*gcm_ghash_p)(ctx->Xi, ctx->Htable, in, len)
 #endif
-#endif
 
 static void gcm128_init_htable(u128 Htable[GCM128_HTABLE_LEN],
                                const uint64_t H[2]);
@@ -361,6 +376,7 @@ void GFp_gcm128_init_serialized(
   H[1] = from_be_u64_ptr(H_be + 8);
 
   alignas(16) u128 Htable[GCM128_HTABLE_LEN];
+  memset(Htable, 0, sizeof(Htable));
   gcm128_init_htable(Htable, H);
 
   OPENSSL_COMPILE_ASSERT(sizeof(Htable) == GCM128_SERIALIZED_LEN,
@@ -378,6 +394,11 @@ static void gcm128_init_htable(u128 Htable[GCM128_HTABLE_LEN],
 #if defined(GHASH_ASM_X86_64)
     if (((GFp_ia32cap_P[1] >> 22) & 0x41) == 0x41) { /* AVX+MOVBE */
       GFp_gcm_init_avx(Htable, H);
+#if defined(GCM_VAES_AVX512)
+      if (GFp_gcm_vaes_avx512_capable()) {
+        GFp_gcm_init_vaes_avx512(&Htable[16], H);
+      }
+#endif
       return;
     }
 #endif
@@ -404,7 +425,7 @@ static void gcm128_init_htable(u128 Htable[GCM128_HTABLE_LEN],
   }
 #endif
 
-  gcm_init_4bit(Htable, H);
+  gcm_init_nohw(Htable, H);
 }
 
 static void gcm128_init_gmult_ghash(GCM128_CONTEXT *ctx) {
@@ -446,27 +467,15 @@ static void gcm128_init_gmult_ghash(GCM128_CONTEXT *ctx) {
   }
 #endif
 
-#if defined(GHASH_ASM_X86)
-  ctx->gmult = GFp_gcm_gmult_4bit_mmx;
-  ctx->ghash = GFp_gcm_ghash_4bit_mmx;
-#else
-  ctx->gmult = GFp_gcm_gmult_4bit;
-  ctx->ghash = GFp_gcm_ghash_4bit;
-#endif
+  ctx->gmult = gcm_gmult_nohw;
+  ctx->ghash = gcm_ghash_nohw;
 }
 
 void GFp_gcm128_init(GCM128_CONTEXT *ctx, const AES_KEY *key,
                         aes_block_f block,
                         const uint8_t serialized_ctx[GCM128_SERIALIZED_LEN],
                         const uint8_t *iv) {
-  uint32_t ctr = 1;
-
   memset(ctx, 0, sizeof(*ctx));
-  memcpy(ctx->Yi, iv, 12);
-  to_be_u32_ptr(ctx->Yi + 12, ctr);
-  (block)(ctx->Yi, ctx->EK0, key);
-  ++ctr;
-  to_be_u32_ptr(ctx->Yi + 12, ctr);
 
   OPENSSL_COMPILE_ASSERT(sizeof(ctx->Htable) == GCM128_SERIALIZED_LEN,
                          GCM128_SERIALIZED_LEN_is_wrong);
@@ -474,55 +483,127 @@ void GFp_gcm128_init(GCM128_CONTEXT *ctx, const AES_KEY *key,
   memcpy(ctx->Htable, serialized_ctx, GCM128_SERIALIZED_LEN);
   ctx->block = block;
   gcm128_init_gmult_ghash(ctx);
+
+  GFp_gcm128_reset(ctx, key, iv);
+}
+
+void GFp_gcm128_reset(GCM128_CONTEXT *ctx, const AES_KEY *key,
+                      const uint8_t *iv) {
+  uint32_t ctr = 1;
+
+  memcpy(ctx->Yi, iv, 12);
+  to_be_u32_ptr(ctx->Yi + 12, ctr);
+  (ctx->block)(ctx->Yi, ctx->EK0, key);
+  ++ctr;
+  to_be_u32_ptr(ctx->Yi + 12, ctr);
+
+  memset(ctx->EKi, 0, sizeof(ctx->EKi));
+  memset(&ctx->len, 0, sizeof(ctx->len));
+  memset(ctx->Xi, 0, sizeof(ctx->Xi));
+  ctx->mres = 0;
+  ctx->ares = 0;
 }
 
 int GFp_gcm128_aad(GCM128_CONTEXT *ctx, const uint8_t *aad, size_t len) {
-  assert(ctx->len.u[0] == 0);
   assert(ctx->len.u[1] == 0);
+  assert(ctx->mres == 0);
 
 #ifdef GCM_FUNCREF_4BIT
   gcm128_gmult_f gcm_gmult_p = ctx->gmult;
 #endif
 
-  ctx->len.u[0] = len;
-  if (ctx->len.u[0] > (UINT64_C(1) << 61)) {
+  uint64_t alen = ctx->len.u[0] + len;
+  if (alen > (UINT64_C(1) << 61) || alen < len) {
     return 0;
   }
+  ctx->len.u[0] = alen;
+
+  /* Finish the block that a previous call left partially hashed. */
+  unsigned n = ctx->ares;
+  if (n != 0) {
+    while (n != 0 && len > 0) {
+      ctx->Xi[n] ^= *aad;
+      ++aad;
+      --len;
+      n = (n + 1) % 16;
+    }
+    if (n != 0) {
+      ctx->ares = n;
+      return 1;
+    }
+    GCM_MUL(ctx, Xi);
+  }
 
-  if (len > 0) {
-    for (;;) {
-      for (size_t i = 0; i < 16 && i < len; ++i) {
-        ctx->Xi[i] ^= aad[i];
-      }
-      GCM_MUL(ctx, Xi);
-      if (len <= 16) {
-        break;
-      }
-      aad += 16;
-      len -= 16;
+  while (len >= 16) {
+    for (size_t i = 0; i < 16; ++i) {
+      ctx->Xi[i] ^= aad[i];
     }
+    GCM_MUL(ctx, Xi);
+    aad += 16;
+    len -= 16;
   }
 
+  /* The multiplication for a trailing partial block is deferred until the
+   * next call, the first call to encrypt or decrypt, or |GFp_gcm128_tag|,
+   * since more AAD may follow. */
+  for (size_t i = 0; i < len; ++i) {
+    ctx->Xi[i] ^= aad[i];
+  }
+  ctx->ares = (unsigned)len;
+
   return 1;
 }
 
 int GFp_gcm128_encrypt_ctr32(GCM128_CONTEXT *ctx, const AES_KEY *key,
                                 const uint8_t *in, uint8_t *out, size_t len,
                                 aes_ctr_f stream) {
-  assert(ctx->len.u[1] == 0);
-
   unsigned int ctr;
 #ifdef GCM_FUNCREF_4BIT
   gcm128_gmult_f gcm_gmult_p = ctx->gmult;
-#ifdef GHASH
   gcm128_ghash_f gcm_ghash_p = ctx->ghash;
-#endif
 #endif
 
-  ctx->len.u[1] = len;
-  if (ctx->len.u[1] > ((UINT64_C(1) << 36) - 32)) {
+  uint64_t mlen = ctx->len.u[1] + len;
+  if (mlen > ((UINT64_C(1) << 36) - 32) || mlen < len) {
     return 0;
   }
+  ctx->len.u[1] = mlen;
+
+  if (ctx->ares != 0) {
+    /* Finish hashing the AAD. */
+    GCM_MUL(ctx, Xi);
+    ctx->ares = 0;
+  }
+
+  /* Use up the remainder of the key stream block that a previous call left
+   * partially used. */
+  unsigned n = ctx->mres;
+  if (n != 0) {
+    while (n != 0 && len > 0) {
+      uint8_t c = *in ^ ctx->EKi[n];
+      ctx->Xi[n] ^= c;
+      *out = c;
+      ++in;
+      ++out;
+      --len;
+      n = (n + 1) % 16;
+    }
+    if (n != 0) {
+      ctx->mres = n;
+      return 1;
+    }
+    GCM_MUL(ctx, Xi);
+  }
+
+#if defined(GCM_VAES_AVX512)
+  if (vaes_avx512_gcm_enabled(ctx, stream)) {
+    size_t bulk = GFp_aes_gcm_encrypt_vaes_avx512(in, out, len, key, ctx->Yi,
+                                                  ctx->Xi, &ctx->Htable[16]);
+    in += bulk;
+    out += bulk;
+    len -= bulk;
+  }
+#endif
 
 #if defined(AESNI_GCM)
   if (aesni_gcm_enabled(ctx, stream)) {
@@ -537,7 +618,6 @@ int GFp_gcm128_encrypt_ctr32(GCM128_CONTEXT *ctx, const AES_KEY *key,
 
   ctr = from_be_u32_ptr(ctx->Yi + 12);
 
-#if defined(GHASH)
   while (len >= GHASH_CHUNK) {
     (*stream)(in, out, GHASH_CHUNK / 16, key, ctx->Yi);
     ctr += GHASH_CHUNK / 16;
@@ -547,7 +627,6 @@ int GFp_gcm128_encrypt_ctr32(GCM128_CONTEXT *ctx, const AES_KEY *key,
     in += GHASH_CHUNK;
     len -= GHASH_CHUNK;
   }
-#endif
   size_t i = len & kSizeTWithoutLower4Bits;
   if (i != 0) {
     size_t j = i / 16;
@@ -557,51 +636,75 @@ int GFp_gcm128_encrypt_ctr32(GCM128_CONTEXT *ctx, const AES_KEY *key,
     to_be_u32_ptr(ctx->Yi + 12, ctr);
     in += i;
     len -= i;
-#if defined(GHASH)
     GHASH(ctx, out, i);
     out += i;
-#else
-    while (j--) {
-      for (i = 0; i < 16; ++i) {
-        ctx->Xi[i] ^= out[i];
-      }
-      GCM_MUL(ctx, Xi);
-      out += 16;
-    }
-#endif
   }
   if (len) {
     (*ctx->block)(ctx->Yi, ctx->EKi, key);
     ++ctr;
     to_be_u32_ptr(ctx->Yi + 12, ctr);
-    size_t n = 0;
     while (len--) {
       ctx->Xi[n] ^= out[n] = in[n] ^ ctx->EKi[n];
       ++n;
     }
-    GCM_MUL(ctx, Xi);
   }
 
+  /* As in |GFp_gcm128_aad|, the multiplication for a trailing partial block
+   * is deferred. */
+  ctx->mres = n;
   return 1;
 }
 
 int GFp_gcm128_decrypt_ctr32(GCM128_CONTEXT *ctx, const AES_KEY *key,
                                 const uint8_t *in, uint8_t *out, size_t len,
                                 aes_ctr_f stream) {
-  assert(ctx->len.u[1] == 0);
-
   unsigned int ctr;
 #ifdef GCM_FUNCREF_4BIT
   gcm128_gmult_f gcm_gmult_p = ctx->gmult;
-#ifdef GHASH
   gcm128_ghash_f gcm_ghash_p = ctx->ghash;
-#endif
 #endif
 
-  ctx->len.u[1] = len;
-  if (ctx->len.u[1] > ((UINT64_C(1) << 36) - 32)) {
+  uint64_t mlen = ctx->len.u[1] + len;
+  if (mlen > ((UINT64_C(1) << 36) - 32) || mlen < len) {
     return 0;
   }
+  ctx->len.u[1] = mlen;
+
+  if (ctx->ares != 0) {
+    /* Finish hashing the AAD. */
+    GCM_MUL(ctx, Xi);
+    ctx->ares = 0;
+  }
+
+  /* Use up the remainder of the key stream block that a previous call left
+   * partially used. */
+  unsigned n = ctx->mres;
+  if (n != 0) {
+    while (n != 0 && len > 0) {
+      uint8_t c = *in;
+      ctx->Xi[n] ^= c;
+      *out = c ^ ctx->EKi[n];
+      ++in;
+      ++out;
+      --len;
+      n = (n + 1) % 16;
+    }
+    if (n != 0) {
+      ctx->mres = n;
+      return 1;
+    }
+    GCM_MUL(ctx, Xi);
+  }
+
+#if defined(GCM_VAES_AVX512)
+  if (vaes_avx512_gcm_enabled(ctx, stream)) {
+    size_t bulk = GFp_aes_gcm_decrypt_vaes_avx512(in, out, len, key, ctx->Yi,
+                                                  ctx->Xi, &ctx->Htable[16]);
+    in += bulk;
+    out += bulk;
+    len -= bulk;
+  }
+#endif
 
 #if defined(AESNI_GCM)
   if (aesni_gcm_enabled(ctx, stream)) {
@@ -616,7 +719,6 @@ int GFp_gcm128_decrypt_ctr32(GCM128_CONTEXT *ctx, const AES_KEY *key,
 
   ctr = from_be_u32_ptr(ctx->Yi + 12);
 
-#if defined(GHASH)
   while (len >= GHASH_CHUNK) {
     GHASH(ctx, in, GHASH_CHUNK);
     (*stream)(in, out, GHASH_CHUNK / 16, key, ctx->Yi);
@@ -626,25 +728,11 @@ int GFp_gcm128_decrypt_ctr32(GCM128_CONTEXT *ctx, const AES_KEY *key,
     in += GHASH_CHUNK;
     len -= GHASH_CHUNK;
   }
-#endif
   size_t i = len & kSizeTWithoutLower4Bits;
   if (i != 0) {
     size_t j = i / 16;
 
-#if defined(GHASH)
     GHASH(ctx, in, i);
-#else
-    while (j--) {
-      size_t k;
-      for (k = 0; k < 16; ++k) {
-        ctx->Xi[k] ^= in[k];
-      }
-      GCM_MUL(ctx, Xi);
-      in += 16;
-    }
-    j = i / 16;
-    in -= i;
-#endif
     (*stream)(in, out, j, key, ctx->Yi);
     ctr += (unsigned int)j;
     to_be_u32_ptr(ctx->Yi + 12, ctr);
@@ -656,16 +744,15 @@ int GFp_gcm128_decrypt_ctr32(GCM128_CONTEXT *ctx, const AES_KEY *key,
     (*ctx->block)(ctx->Yi, ctx->EKi, key);
     ++ctr;
     to_be_u32_ptr(ctx->Yi + 12, ctr);
-    size_t n = 0;
     while (len--) {
       uint8_t c = in[n];
       ctx->Xi[n] ^= c;
       out[n] = c ^ ctx->EKi[n];
       ++n;
     }
-    GCM_MUL(ctx, Xi);
   }
 
+  ctx->mres = n;
   return 1;
 }
 
@@ -676,6 +763,10 @@ void GFp_gcm128_tag(GCM128_CONTEXT *ctx, uint8_t tag[16]) {
   gcm128_gmult_f gcm_gmult_p = ctx->gmult;
 #endif
 
+  if (ctx->mres != 0 || ctx->ares != 0) {
+    GCM_MUL(ctx, Xi);
+  }
+
   uint8_t a_c_len[16];
   to_be_u64_ptr(a_c_len, alen);
   to_be_u64_ptr(a_c_len + 8, clen);
@@ -70,7 +70,19 @@ typedef void (*gcm128_gmult_f)(uint8_t Xi[16], const u128 Htable[16]);
 typedef void (*gcm128_ghash_f)(uint8_t Xi[16], const u128 Htable[16],
                                const uint8_t *inp, size_t len);
 
+#if defined(OPENSSL_X86_64) && !defined(OPENSSL_NO_ASM) &&              \
+    ((defined(__clang__) && __clang_major__ >= 6) ||                     \
+     (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 8))
+#define GCM_VAES_AVX512
+#endif
+
+#if defined(GCM_VAES_AVX512)
+/* The first 16 entries are the table of the CLMUL or AVX code. They are
+ * followed by H^16, H^15, ..., H^1 for the VAES code in gcm-avx512.c. */
+#define GCM128_HTABLE_LEN (16 + 16)
+#else
 #define GCM128_HTABLE_LEN 16
+#endif
 
 #define GCM128_SERIALIZED_LEN (GCM128_HTABLE_LEN * 16)
 
@@ -97,6 +109,11 @@ struct gcm128_context {
   gcm128_gmult_f gmult;
   gcm128_ghash_f ghash;
   aes_block_f block;
+
+  /* The number of bytes of the last block of the AAD (|ares|) or of the
+   * message (|mres|) that have been accumulated into |Xi| but not yet
+   * multiplied by H. */
+  unsigned mres, ares;
 };
 
 #if defined(OPENSSL_X86) || defined(OPENSSL_X86_64)
@@ -105,6 +122,34 @@ struct gcm128_context {
 int GFp_gcm_clmul_enabled(void);
 #endif
 
+#if defined(OPENSSL_X86_64)
+/* GFp_gcm_vaes_avx512_capable returns one if the CPU supports the VAES and
+ * VPCLMULQDQ instructions on ZMM registers, and zero otherwise. It always
+ * returns zero when |GCM_VAES_AVX512| isn't defined, because the compiler
+ * can't build the functions below. */
+int GFp_gcm_vaes_avx512_capable(void);
+#endif
+
+#if defined(GCM_VAES_AVX512)
+/* GFp_gcm_init_vaes_avx512 sets |Htable_wide| to H^16, H^15, ..., H^1, where
+ * |H| is in the same form as for |GFp_gcm_init_avx|. */
+void GFp_gcm_init_vaes_avx512(u128 Htable_wide[16], const uint64_t H[2]);
+
+/* GFp_aes_gcm_encrypt_vaes_avx512 and GFp_aes_gcm_decrypt_vaes_avx512 are
+ * like |GFp_aesni_gcm_encrypt| and |GFp_aesni_gcm_decrypt|: they process as
+ * many whole 256-byte pieces of the input as they can, updating the counter in
+ * |Yi| and the hash in |Xi|, and return the number of bytes processed. |key|
+ * must have been set up by |GFp_aesni_set_encrypt_key|. */
+size_t GFp_aes_gcm_encrypt_vaes_avx512(const uint8_t *in, uint8_t *out,
+                                       size_t len, const AES_KEY *key,
+                                       uint8_t Yi[16], uint8_t Xi[16],
+                                       const u128 Htable_wide[16]);
+size_t GFp_aes_gcm_decrypt_vaes_avx512(const uint8_t *in, uint8_t *out,
+                                       size_t len, const AES_KEY *key,
+                                       uint8_t Yi[16], uint8_t Xi[16],
+                                       const u128 Htable_wide[16]);
+#endif
+
 
 /* CTR. */
 
@@ -130,16 +175,25 @@ OPENSSL_EXPORT void GFp_gcm128_init(
     GCM128_CONTEXT *ctx, const AES_KEY *key, aes_block_f block,
     const uint8_t serialized_ctx[GCM128_SERIALIZED_LEN], const uint8_t *iv);
 
-/* GFp_gcm128_aad sets the authenticated data for an instance of GCM. This must
- * be called before and data is encrypted. It returns one on success and zero
- * otherwise. */
+/* GFp_gcm128_reset prepares |ctx|, which must have been initialized with
+ * |GFp_gcm128_init| using the same |key|, for a new message with the nonce
+ * |iv|. This is cheaper than |GFp_gcm128_init| because the precomputed table
+ * and the choice of implementation are kept. */
+OPENSSL_EXPORT void GFp_gcm128_reset(GCM128_CONTEXT *ctx, const AES_KEY *key,
+                                     const uint8_t *iv);
+
+/* GFp_gcm128_aad adds |len| bytes to the authenticated data for an instance of
+ * GCM. It may be called any number of times, but only before any data is
+ * encrypted or decrypted. It returns one on success and zero otherwise. */
 OPENSSL_EXPORT int GFp_gcm128_aad(GCM128_CONTEXT *ctx, const uint8_t *aad,
                                   size_t len);
 
 /* GFp_gcm128_encrypt_ctr32 encrypts |len| bytes from |in| to |out| using a CTR
  * function that only handles the bottom 32 bits of the nonce, like
  * |GFp_ctr128_encrypt_ctr32|. The |key| must be the same key that was passed
- * to |GFp_gcm128_init|. It returns one on success and zero otherwise. */
+ * to |GFp_gcm128_init|. It may be called any number of times to encrypt a
+ * message in pieces, which need not be multiples of the block size. It returns
+ * one on success and zero otherwise. */
 OPENSSL_EXPORT int GFp_gcm128_encrypt_ctr32(GCM128_CONTEXT *ctx,
                                             const AES_KEY *key,
                                             const uint8_t *in, uint8_t *out,
@@ -148,7 +202,8 @@ OPENSSL_EXPORT int GFp_gcm128_encrypt_ctr32(GCM128_CONTEXT *ctx,
 /* GFp_gcm128_decrypt_ctr32 decrypts |len| bytes from |in| to |out| using a CTR
  * function that only handles the bottom 32 bits of the nonce, like
  * |GFp_ctr128_encrypt_ctr32|. The |key| must be the same key that was passed
- * to |GFp_gcm128_init|. It returns one on success and zero otherwise. */
+ * to |GFp_gcm128_init|. Like |GFp_gcm128_encrypt_ctr32|, it may be called any
+ * number of times. It returns one on success and zero otherwise. */
 OPENSSL_EXPORT int GFp_gcm128_decrypt_ctr32(GCM128_CONTEXT *ctx,
                                             const AES_KEY *key,
                                             const uint8_t *in, uint8_t *out,
@@ -152,14 +152,7 @@ extern "C" {
 #endif
 
 
-/* Allocation and freeing. */
-
-/* GFp_BN_init initialises a stack allocated |BIGNUM|. */
-OPENSSL_EXPORT void GFp_BN_init(BIGNUM *bn);
-
-/* GFp_BN_free frees the data referenced by |bn| and, if |bn| was originally
- * allocated on the heap, frees |bn| also. */
-OPENSSL_EXPORT void GFp_BN_free(BIGNUM *bn);
+/* Copying. */
 
 /* GFp_BN_copy sets |dest| equal to |src| and returns one on success or zero on
  * failure. */
@@ -188,13 +181,6 @@ OPENSSL_EXPORT void GFp_bn_correct_top(BIGNUM *bn);
 OPENSSL_EXPORT int GFp_bn_wexpand(BIGNUM *bn, size_t words);
 
 
-/* Simple arithmetic */
-
-/* GFp_BN_mul_no_alias sets |r| = |a| * |b|, where |r| must not be the same pointer
- * as |a| or |b|. Returns one on success and zero otherwise. */
-OPENSSL_EXPORT int GFp_BN_mul_no_alias(BIGNUM *r, const BIGNUM *a, const BIGNUM *b);
-
-
 /* Comparison functions */
 
 /* GFp_BN_is_odd returns one if |bn| is odd and zero otherwise. */
@@ -245,7 +231,6 @@ struct bignum_st {
   int flags; /* bitmask of BN_FLG_* values */
 };
 
-#define BN_FLG_MALLOCED 0x01
 #define BN_FLG_STATIC_DATA 0x02
 
 
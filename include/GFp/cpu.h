@@ -86,7 +86,8 @@ extern "C" {
  *     Bit 11 is used to indicate AMD XOP support, not SDBG
  *   Index 2:
  *     EBX for CPUID where EAX = 7
- *   Index 3 is set to zero.
+ *   Index 3:
+ *     ECX for CPUID where EAX = 7
  *
  * Note: the CPUID bits are pre-adjusted for the OSXSAVE bit and the YMM and XMM
  * bits in XCR0, so it is not necessary to check those. */
@@ -95,7 +96,10 @@ extern uint32_t GFp_ia32cap_P[4];
 
 #if defined(OPENSSL_ARM) || defined(OPENSSL_AARCH64)
 
-#if defined(OPENSSL_APPLE)
+/* Builds with the |static_cpu_features| feature define
+ * |OPENSSL_STATIC_ARMCAP| and the |OPENSSL_STATIC_ARMCAP_*| features that the
+ * target is compiled for; see build.rs. */
+#if defined(OPENSSL_APPLE) && !defined(OPENSSL_STATIC_ARMCAP)
 /* iOS builds use the static ARM configuration. */
 #define OPENSSL_STATIC_ARMCAP
 
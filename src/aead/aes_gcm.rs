@@ -22,8 +22,14 @@ use {aead, bssl, c, error, polyfill};
 pub static AES_128_GCM: aead::Algorithm = aead::Algorithm {
     key_len: AES_128_KEY_LEN,
     init: aes_gcm_init,
+    ctx_buf_len: AES_KEY_CTX_BUF_LEN,
+    init_compact: aes_gcm_init_compact,
+    compact_ctx_buf_len: AES_KEY_BUF_LEN,
     seal: aes_gcm_seal,
     open: aes_gcm_open,
+    seal_vectored: aes_gcm_seal_vectored,
+    open_vectored: aes_gcm_open_vectored,
+    seal_batch: aes_gcm_seal_batch,
     id: aead::AlgorithmID::AES_128_GCM,
 };
 
@@ -35,65 +41,241 @@ pub static AES_128_GCM: aead::Algorithm = aead::Algorithm {
 pub static AES_256_GCM: aead::Algorithm = aead::Algorithm {
     key_len: AES_256_KEY_LEN,
     init: aes_gcm_init,
+    ctx_buf_len: AES_KEY_CTX_BUF_LEN,
+    init_compact: aes_gcm_init_compact,
+    compact_ctx_buf_len: AES_KEY_BUF_LEN,
     seal: aes_gcm_seal,
     open: aes_gcm_open,
+    seal_vectored: aes_gcm_seal_vectored,
+    open_vectored: aes_gcm_open_vectored,
+    seal_batch: aes_gcm_seal_batch,
     id: aead::AlgorithmID::AES_256_GCM,
 };
 
-fn aes_gcm_init(ctx_buf: &mut [u8], key: &[u8])
-                -> Result<(), error::Unspecified> {
+pub(crate) fn aes_gcm_init(ctx_buf: &mut [u8], key: &[u8])
+                           -> Result<(), error::Unspecified> {
     bssl::map_result(unsafe {
         GFp_aes_gcm_init(ctx_buf.as_mut_ptr(), ctx_buf.len(), key.as_ptr(),
                          key.len())
     })
 }
 
-fn aes_gcm_seal(ctx: &[u64; aead::KEY_CTX_BUF_ELEMS],
-                nonce: &[u8; aead::NONCE_LEN], ad: &[u8], in_out: &mut [u8],
-                tag: &mut [u8; aead::TAG_LEN])
-                -> Result<(), error::Unspecified> {
-    let ctx = polyfill::slice::u64_as_u8(ctx);
+// A compact key is only the AES key schedule. The GHASH table is recomputed
+// from it by `with_full_ctx` for each operation.
+fn aes_gcm_init_compact(ctx_buf: &mut [u8], key: &[u8])
+                        -> Result<(), error::Unspecified> {
     bssl::map_result(unsafe {
-        GFp_aes_gcm_seal(ctx.as_ptr(), in_out.as_mut_ptr(), in_out.len(), tag,
-                         nonce, ad.as_ptr(), ad.len())
+        GFp_aes_gcm_init_compact(ctx_buf.as_mut_ptr(), ctx_buf.len(),
+                                 key.as_ptr(), key.len())
     })
 }
 
-fn aes_gcm_open(ctx: &[u64; aead::KEY_CTX_BUF_ELEMS],
-                nonce: &[u8; aead::NONCE_LEN], ad: &[u8], in_prefix_len: usize,
-                in_out: &mut [u8], tag_out: &mut [u8; aead::TAG_LEN])
-                -> Result<(), error::Unspecified> {
-    let ctx = polyfill::slice::u64_as_u8(ctx);
-    bssl::map_result(unsafe {
-        GFp_aes_gcm_open(ctx.as_ptr(), in_out.as_mut_ptr(),
-                         in_out.len() - in_prefix_len, tag_out, nonce,
-                         in_out[in_prefix_len..].as_ptr(), ad.as_ptr(),
-                         ad.len())
+// Calls `f` with the serialized key schedule and GHASH table of `ctx`,
+// expanding `ctx` into a temporary buffer first if it is a compact key.
+fn with_full_ctx<F, R>(ctx: &[u64], f: F) -> Result<R, error::Unspecified>
+        where F: FnOnce(&[u8]) -> Result<R, error::Unspecified> {
+    if ctx.len() >= AES_KEY_CTX_BUF_ELEMS {
+        return f(polyfill::slice::u64_as_u8(ctx));
+    }
+    let mut full = [0u64; AES_KEY_CTX_BUF_ELEMS];
+    {
+        let compact = polyfill::slice::u64_as_u8(ctx);
+        let full = polyfill::slice::u64_as_u8_mut(&mut full);
+        bssl::map_result(unsafe {
+            GFp_aes_gcm_expand_compact(full.as_mut_ptr(), full.len(),
+                                       compact.as_ptr(), compact.len())
+        })?;
+    }
+    f(polyfill::slice::u64_as_u8(&full))
+}
+
+pub(crate) fn aes_gcm_seal(ctx: &[u64],
+                           nonce: &[u8; aead::NONCE_LEN], ad: &[u8],
+                           in_out: &mut [u8], tag: &mut [u8; aead::TAG_LEN])
+                           -> Result<(), error::Unspecified> {
+    with_full_ctx(ctx, |ctx| {
+        bssl::map_result(unsafe {
+            GFp_aes_gcm_seal(ctx.as_ptr(), in_out.as_mut_ptr(), in_out.len(),
+                             tag, nonce, ad.as_ptr(), ad.len())
+        })
     })
 }
 
+pub(crate) fn aes_gcm_open(ctx: &[u64],
+                           nonce: &[u8; aead::NONCE_LEN], ad: &[u8],
+                           in_prefix_len: usize, in_out: &mut [u8],
+                           tag_out: &mut [u8; aead::TAG_LEN])
+                           -> Result<(), error::Unspecified> {
+    with_full_ctx(ctx, |ctx| {
+        bssl::map_result(unsafe {
+            GFp_aes_gcm_open(ctx.as_ptr(), in_out.as_mut_ptr(),
+                             in_out.len() - in_prefix_len, tag_out, nonce,
+                             in_out[in_prefix_len..].as_ptr(), ad.as_ptr(),
+                             ad.len())
+        })
+    })
+}
+
+fn aes_gcm_seal_vectored(ctx: &[u64],
+                         nonce: &[u8; aead::NONCE_LEN], ad: &[&[u8]],
+                         in_out: &mut [&mut [u8]],
+                         tag_out: &mut [u8; aead::TAG_LEN])
+                         -> Result<(), error::Unspecified> {
+    let mut stream = Stream::begin(ctx, nonce, ad)?;
+    for segment in in_out.iter_mut() {
+        stream.seal(segment)?;
+    }
+    stream.finish(tag_out);
+    Ok(())
+}
+
+fn aes_gcm_open_vectored(ctx: &[u64],
+                         nonce: &[u8; aead::NONCE_LEN], ad: &[&[u8]],
+                         in_out: &mut [&mut [u8]],
+                         tag_out: &mut [u8; aead::TAG_LEN])
+                         -> Result<(), error::Unspecified> {
+    let mut stream = Stream::begin(ctx, nonce, ad)?;
+    for segment in in_out.iter_mut() {
+        stream.open(segment)?;
+    }
+    stream.finish(tag_out);
+    Ok(())
+}
+
+// The key schedule and the GHASH table are set up once for the whole batch;
+// each record after the first only needs `GFp_aes_gcm_stream_reset`.
+fn aes_gcm_seal_batch(ctx: &[u64],
+                      records: &mut [aead::BatchRecord],
+                      out_suffix_capacity: usize)
+                      -> Result<(), error::Unspecified> {
+    let (first, rest) = match records.split_first_mut() {
+        Some(split) => split,
+        None => { return Ok(()); },
+    };
+    let mut stream = {
+        let nonce = slice_as_array_ref!(first.0, aead::NONCE_LEN)?;
+        Stream::begin(ctx, nonce, &[first.1])?
+    };
+    seal_record(&mut stream, first.2, out_suffix_capacity)?;
+    for record in rest {
+        let nonce = slice_as_array_ref!(record.0, aead::NONCE_LEN)?;
+        stream.restart(nonce, &[record.1])?;
+        seal_record(&mut stream, record.2, out_suffix_capacity)?;
+    }
+    Ok(())
+}
+
+fn seal_record(stream: &mut Stream, in_out: &mut [u8],
+               out_suffix_capacity: usize) -> Result<(), error::Unspecified> {
+    let in_out_len = in_out.len() - out_suffix_capacity;
+    let (in_out, tag_out) = in_out.split_at_mut(in_out_len);
+    let tag_out = slice_as_array_ref_mut!(&mut tag_out[..aead::TAG_LEN],
+                                          aead::TAG_LEN)?;
+    stream.seal(in_out)?;
+    stream.finish(tag_out);
+    Ok(())
+}
+
+/// The state of a vectored or batched operation, i.e. `aes_gcm_stream` in
+/// e_aes.c. The alignment that `aes_gcm_stream` needs is part of the type, and
+/// the C code keeps no pointers into the buffer, so a `Stream` can be moved
+/// freely.
+#[repr(C, align(16))]
+struct Stream {
+    buf: [u64; STREAM_BUF_ELEMS],
+}
+
+impl Stream {
+    fn begin(ctx: &[u64],
+             nonce: &[u8; aead::NONCE_LEN], ad: &[&[u8]])
+             -> Result<Stream, error::Unspecified> {
+        let mut stream = Stream { buf: [0; STREAM_BUF_ELEMS] };
+        with_full_ctx(ctx, |ctx| {
+            bssl::map_result(unsafe {
+                GFp_aes_gcm_stream_init(stream.as_mut_ptr(),
+                                        STREAM_BUF_ELEMS * 8, ctx.as_ptr(),
+                                        nonce)
+            })
+        })?;
+        stream.aad(ad)?;
+        Ok(stream)
+    }
+
+    /// Starts a new operation with the same key.
+    fn restart(&mut self, nonce: &[u8; aead::NONCE_LEN], ad: &[&[u8]])
+               -> Result<(), error::Unspecified> {
+        unsafe { GFp_aes_gcm_stream_reset(self.as_mut_ptr(), nonce) }
+        self.aad(ad)
+    }
+
+    fn aad(&mut self, ad: &[&[u8]]) -> Result<(), error::Unspecified> {
+        for ad in ad {
+            bssl::map_result(unsafe {
+                GFp_aes_gcm_stream_aad(self.as_mut_ptr(), ad.as_ptr(),
+                                       ad.len())
+            })?;
+        }
+        Ok(())
+    }
+
+    fn seal(&mut self, in_out: &mut [u8]) -> Result<(), error::Unspecified> {
+        bssl::map_result(unsafe {
+            GFp_aes_gcm_stream_seal(self.as_mut_ptr(), in_out.as_mut_ptr(),
+                                    in_out.len())
+        })
+    }
+
+    fn open(&mut self, in_out: &mut [u8]) -> Result<(), error::Unspecified> {
+        bssl::map_result(unsafe {
+            GFp_aes_gcm_stream_open(self.as_mut_ptr(), in_out.as_mut_ptr(),
+                                    in_out.len())
+        })
+    }
 
-const AES_128_KEY_LEN: usize = 128 / 8;
-const AES_256_KEY_LEN: usize = 32; // 256 / 8
+    fn finish(&mut self, tag_out: &mut [u8; aead::TAG_LEN]) {
+        unsafe { GFp_aes_gcm_stream_tag(self.as_mut_ptr(), tag_out) }
+    }
+
+    fn as_mut_ptr(&mut self) -> *mut u8 { self.buf.as_mut_ptr() as *mut u8 }
+}
+
+pub(crate) const AES_128_KEY_LEN: usize = 128 / 8;
+pub(crate) const AES_256_KEY_LEN: usize = 32; // 256 / 8
 
 pub const AES_KEY_CTX_BUF_LEN: usize = AES_KEY_BUF_LEN + GCM128_SERIALIZED_LEN;
 
+pub(crate) const AES_KEY_CTX_BUF_ELEMS: usize = (AES_KEY_CTX_BUF_LEN + 7) / 8;
+
 // Keep this in sync with `AES_KEY` in aes.h.
 const AES_KEY_BUF_LEN: usize = (4 * 4 * (AES_MAX_ROUNDS + 1)) + 8;
 
 // Keep this in sync with `AES_MAXNR` in aes.h.
 const AES_MAX_ROUNDS: usize = 14;
 
-// Keep this in sync with `GCM128_SERIALIZED_LEN` in gcm.h.
+// Keep this in sync with `GCM128_SERIALIZED_LEN` in crypto/modes/internal.h.
+// On x86-64 the table is followed by the powers of H for the VAES code.
 // TODO: test.
 // TODO: some implementations of GCM don't require the buffer to be this big.
 // We should shrink it down on those platforms since this is still huge.
+#[cfg(target_arch = "x86_64")]
+const GCM128_SERIALIZED_LEN: usize = (16 + 16) * 16;
+#[cfg(not(target_arch = "x86_64"))]
 const GCM128_SERIALIZED_LEN: usize = 16 * 16;
 
+// Keep this in sync with `AES_GCM_STREAM_BUF_LEN` in e_aes.c, which checks at
+// compile time that `aes_gcm_stream` fits.
+const STREAM_BUF_ELEMS: usize = (GCM128_SERIALIZED_LEN + 384) / 8;
+
 
 extern {
     fn GFp_aes_gcm_init(ctx_buf: *mut u8, ctx_buf_len: c::size_t,
                         key: *const u8, key_len: c::size_t) -> c::int;
+    fn GFp_aes_gcm_init_compact(ctx_buf: *mut u8, ctx_buf_len: c::size_t,
+                                key: *const u8, key_len: c::size_t)
+                                -> c::int;
+    fn GFp_aes_gcm_expand_compact(ctx_buf: *mut u8, ctx_buf_len: c::size_t,
+                                  compact_ctx_buf: *const u8,
+                                  compact_ctx_buf_len: c::size_t) -> c::int;
 
     fn GFp_aes_gcm_seal(ctx_buf: *const u8, in_out: *mut u8,
                         in_out_len: c::size_t,
@@ -106,6 +288,20 @@ extern {
                         tag_out: &mut [u8; aead::TAG_LEN],
                         nonce: &[u8; aead::NONCE_LEN], in_: *const u8,
                         ad: *const u8, ad_len: c::size_t) -> c::int;
+
+    fn GFp_aes_gcm_stream_init(stream_buf: *mut u8,
+                               stream_buf_len: c::size_t, ctx_buf: *const u8,
+                               nonce: &[u8; aead::NONCE_LEN]) -> c::int;
+    fn GFp_aes_gcm_stream_reset(stream_buf: *mut u8,
+                                nonce: &[u8; aead::NONCE_LEN]);
+    fn GFp_aes_gcm_stream_aad(stream_buf: *mut u8, ad: *const u8,
+                              ad_len: c::size_t) -> c::int;
+    fn GFp_aes_gcm_stream_seal(stream_buf: *mut u8, in_out: *mut u8,
+                               in_out_len: c::size_t) -> c::int;
+    fn GFp_aes_gcm_stream_open(stream_buf: *mut u8, in_out: *mut u8,
+                               in_out_len: c::size_t) -> c::int;
+    fn GFp_aes_gcm_stream_tag(stream_buf: *mut u8,
+                              tag_out: &mut [u8; aead::TAG_LEN]);
 }
 
 
@@ -116,6 +312,19 @@ mod tests {
 
     #[test]
     pub fn test_aes() {
+        test_aes_impl(GFp_AES_set_encrypt_key, GFp_AES_encrypt);
+    }
+
+    #[test]
+    pub fn test_aes_nohw() {
+        test_aes_impl(GFp_aes_nohw_set_encrypt_key, GFp_aes_nohw_encrypt);
+    }
+
+    fn test_aes_impl(
+            set_encrypt_key: unsafe extern fn(key: *const u8, bits: usize,
+                                              aes_key: *mut AES_KEY) -> c::int,
+            encrypt: unsafe extern fn(in_: *const u8, out: *mut u8,
+                                      key: *const AES_KEY)) {
         test::from_file("src/aead/aes_tests.txt", |section, test_case| {
             assert_eq!(section, "");
             let key = test_case.consume_bytes("Key");
@@ -131,24 +340,22 @@ mod tests {
                 rounds: 0,
             };
             let res = unsafe {
-                GFp_AES_set_encrypt_key(key.as_ptr(), key.len() * 8,
-                                        &mut aes_key)
+                set_encrypt_key(key.as_ptr(), key.len() * 8, &mut aes_key)
             };
-            assert_eq!(res, 0, "GFp_AES_set_encrypt_key failed.");
+            assert_eq!(res, 0, "Setting the encryption key failed.");
 
             // Test encryption into a separate buffer.
             let mut output_buf = [0u8; AES_BLOCK_SIZE];
             unsafe {
-                GFp_AES_encrypt(input.as_ptr(), output_buf.as_mut_ptr(),
-                                &aes_key);
+                encrypt(input.as_ptr(), output_buf.as_mut_ptr(), &aes_key);
             }
             assert_eq!(&output_buf[..], &expected_output[..]);
 
             // Test in-place encryption.
             output_buf.copy_from_slice(&input[..]);
             unsafe {
-                GFp_AES_encrypt(output_buf.as_ptr(), output_buf.as_mut_ptr(),
-                                &aes_key);
+                encrypt(output_buf.as_ptr(), output_buf.as_mut_ptr(),
+                        &aes_key);
             }
             assert_eq!(&output_buf[..], &expected_output[..]);
 
@@ -169,5 +376,9 @@ mod tests {
         fn GFp_AES_set_encrypt_key(key: *const u8, bits: usize,
                                    aes_key: *mut AES_KEY) -> c::int;
         fn GFp_AES_encrypt(in_: *const u8, out: *mut u8, key: *const AES_KEY);
+        fn GFp_aes_nohw_set_encrypt_key(key: *const u8, bits: usize,
+                                        aes_key: *mut AES_KEY) -> c::int;
+        fn GFp_aes_nohw_encrypt(in_: *const u8, out: *mut u8,
+                                key: *const AES_KEY);
     }
 }
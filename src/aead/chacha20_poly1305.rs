@@ -13,6 +13,7 @@
 // CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
 use {aead, chacha, error, poly1305, polyfill};
+use core;
 
 /// ChaCha20-Poly1305 as described in [RFC 7539].
 ///
@@ -22,8 +23,14 @@ use {aead, chacha, error, poly1305, polyfill};
 pub static CHACHA20_POLY1305: aead::Algorithm = aead::Algorithm {
     key_len: chacha::KEY_LEN_IN_BYTES,
     init: chacha20_poly1305_init,
+    ctx_buf_len: chacha::KEY_LEN_IN_BYTES,
+    init_compact: chacha20_poly1305_init,
+    compact_ctx_buf_len: chacha::KEY_LEN_IN_BYTES,
     seal: chacha20_poly1305_seal,
     open: chacha20_poly1305_open,
+    seal_vectored: chacha20_poly1305_seal_vectored,
+    open_vectored: chacha20_poly1305_open_vectored,
+    seal_batch: chacha20_poly1305_seal_batch,
     id: aead::AlgorithmID::CHACHA20_POLY1305,
 };
 
@@ -34,61 +41,364 @@ pub fn chacha20_poly1305_init(ctx_buf: &mut [u8], key: &[u8])
     Ok(())
 }
 
-fn chacha20_poly1305_seal(ctx: &[u64; aead::KEY_CTX_BUF_ELEMS],
-                          nonce: &[u8; aead::NONCE_LEN], ad: &[u8],
-                          in_out: &mut [u8], tag_out: &mut [u8; aead::TAG_LEN])
-                          -> Result<(), error::Unspecified> {
+// The data is encrypted/decrypted and authenticated in chunks of this many
+// bytes, so that each chunk is still in the L1 cache when the second of the two
+// operations on it is done; i.e. the record is read from and written to memory
+// once instead of twice. It must be a multiple of the ChaCha20 block length,
+// which is also a multiple of the Poly1305 block length.
+//
+// This is cache blocking, not a stitched kernel: the ChaCha20 and Poly1305
+// code still run one after the other on each chunk.
+const CHUNK_LEN: usize = 4 * 1024;
+
+pub(crate) fn chacha20_poly1305_seal(ctx: &[u64],
+                                     nonce: &[u8; aead::NONCE_LEN],
+                                     ad: &[u8], in_out: &mut [u8],
+                                     tag_out: &mut [u8; aead::TAG_LEN])
+                                     -> Result<(), error::Unspecified> {
     let chacha20_key = ctx_as_key(ctx)?;
-    let mut counter = chacha::make_counter(nonce, 1);
-    chacha::chacha20_xor_in_place(&chacha20_key, &counter, in_out);
-    counter[0] = 0;
-    aead_poly1305(tag_out, chacha20_key, &counter, ad, in_out);
+    let counter = chacha::make_counter(nonce, 0);
+    let mut poly1305 = aead_poly1305_begin(chacha20_key, &counter, &[ad]);
+    seal_chunks(chacha20_key, counter, 1, &mut poly1305, in_out);
+    aead_poly1305_finish(poly1305, ad.len(), in_out.len(), tag_out);
     Ok(())
 }
 
-fn chacha20_poly1305_open(ctx: &[u64; aead::KEY_CTX_BUF_ELEMS],
-                          nonce: &[u8; aead::NONCE_LEN], ad: &[u8],
-                          in_prefix_len: usize, in_out: &mut [u8],
-                          tag_out: &mut [u8; aead::TAG_LEN])
-                          -> Result<(), error::Unspecified> {
+// Encrypts `in_out` with the key stream for `counter`'s nonce starting at
+// block `block`, and authenticates the ciphertext with `poly1305`, one chunk
+// at a time.
+fn seal_chunks(chacha20_key: &chacha::Key, mut counter: chacha::Counter,
+               mut block: u32, poly1305: &mut poly1305::SigningContext,
+               in_out: &mut [u8]) {
+    for chunk in in_out.chunks_mut(CHUNK_LEN) {
+        counter[0] = block.to_le();
+        chacha::chacha20_xor_in_place(chacha20_key, &counter, chunk);
+        poly1305.update(chunk);
+        block = block.wrapping_add((CHUNK_LEN / chacha::BLOCK_LEN) as u32);
+    }
+}
+
+pub(crate) fn chacha20_poly1305_open(ctx: &[u64],
+                                     nonce: &[u8; aead::NONCE_LEN],
+                                     ad: &[u8], in_prefix_len: usize,
+                                     in_out: &mut [u8],
+                                     tag_out: &mut [u8; aead::TAG_LEN])
+                                     -> Result<(), error::Unspecified> {
     let chacha20_key = ctx_as_key(ctx)?;
     let mut counter = chacha::make_counter(nonce, 0);
-    {
-        let ciphertext = &in_out[in_prefix_len..];
-        aead_poly1305(tag_out, chacha20_key, &counter, ad, ciphertext);
+    let mut poly1305 = aead_poly1305_begin(chacha20_key, &counter, &[ad]);
+    let ciphertext_len = in_out.len() - in_prefix_len;
+    let mut block = 1u32;
+    let mut start = 0;
+    while start < ciphertext_len {
+        let len = core::cmp::min(CHUNK_LEN, ciphertext_len - start);
+        // The ciphertext of this chunk is at `chunk[in_prefix_len..]`, and
+        // the plaintext is written to `chunk[..len]`. Earlier chunks only
+        // wrote to `in_out[..start]`, so the ciphertext is still intact.
+        let chunk = &mut in_out[start..(start + in_prefix_len + len)];
+        poly1305.update(&chunk[in_prefix_len..]);
+        counter[0] = block.to_le();
+        chacha::chacha20_xor_overlapping(&chacha20_key, &counter, chunk,
+                                         in_prefix_len);
+        block = block.wrapping_add((CHUNK_LEN / chacha::BLOCK_LEN) as u32);
+        start += len;
+    }
+    aead_poly1305_finish(poly1305, ad.len(), ciphertext_len, tag_out);
+    Ok(())
+}
+
+fn chacha20_poly1305_seal_vectored(ctx: &[u64],
+                                   nonce: &[u8; aead::NONCE_LEN],
+                                   ad: &[&[u8]], in_out: &mut [&mut [u8]],
+                                   tag_out: &mut [u8; aead::TAG_LEN])
+                                   -> Result<(), error::Unspecified> {
+    let chacha20_key = ctx_as_key(ctx)?;
+    let counter = chacha::make_counter(nonce, 0);
+    let mut poly1305 = aead_poly1305_begin(chacha20_key, &counter, ad);
+    let mut key_stream = KeyStream::new(chacha20_key, nonce);
+    let mut ciphertext_len = 0;
+    for segment in in_out.iter_mut() {
+        for chunk in segment.chunks_mut(CHUNK_LEN) {
+            key_stream.xor_in_place(chunk);
+            poly1305.update(chunk);
+        }
+        ciphertext_len += segment.len();
+    }
+    aead_poly1305_finish(poly1305, ad_len(ad), ciphertext_len, tag_out);
+    Ok(())
+}
+
+fn chacha20_poly1305_open_vectored(ctx: &[u64],
+                                   nonce: &[u8; aead::NONCE_LEN],
+                                   ad: &[&[u8]], in_out: &mut [&mut [u8]],
+                                   tag_out: &mut [u8; aead::TAG_LEN])
+                                   -> Result<(), error::Unspecified> {
+    let chacha20_key = ctx_as_key(ctx)?;
+    let counter = chacha::make_counter(nonce, 0);
+    let mut poly1305 = aead_poly1305_begin(chacha20_key, &counter, ad);
+    let mut key_stream = KeyStream::new(chacha20_key, nonce);
+    let mut ciphertext_len = 0;
+    for segment in in_out.iter_mut() {
+        for chunk in segment.chunks_mut(CHUNK_LEN) {
+            poly1305.update(chunk);
+            key_stream.xor_in_place(chunk);
+        }
+        ciphertext_len += segment.len();
+    }
+    aead_poly1305_finish(poly1305, ad_len(ad), ciphertext_len, tag_out);
+    Ok(())
+}
+
+// The records are sealed in groups of `BATCH_LANES`. The key stream blocks
+// that every record of a group needs first, its Poly1305 key and the
+// beginning of its plaintext, are computed for the whole group at once by
+// `chacha::chacha20_blocks`, which does eight blocks with unrelated nonces in
+// parallel on x86-64 CPUs with AVX2. Only the part of each record after the
+// first `BATCH_SHARED_LEN` bytes, if any, is sealed on its own.
+fn chacha20_poly1305_seal_batch(ctx: &[u64],
+                                records: &mut [aead::BatchRecord],
+                                out_suffix_capacity: usize)
+                                -> Result<(), error::Unspecified> {
+    let chacha20_key = ctx_as_key(ctx)?;
+    for group in records.chunks_mut(BATCH_LANES) {
+        let mut counters = [[0u32; 4]; BATCH_LANES];
+        for (counter, record) in counters.iter_mut().zip(group.iter()) {
+            let nonce = slice_as_array_ref!(record.0, aead::NONCE_LEN)?;
+            *counter = chacha::make_counter(nonce, 0);
+        }
+        let counters = &mut counters[..group.len()];
+
+        // Block 0 of each key stream is the record's Poly1305 key.
+        let mut poly1305_key_blocks =
+            [[0u8; chacha::BLOCK_LEN]; BATCH_LANES];
+        let poly1305_key_blocks = &mut poly1305_key_blocks[..group.len()];
+        chacha::chacha20_blocks(chacha20_key, counters, poly1305_key_blocks);
+
+        let max_len = group.iter()
+            .map(|record| record.2.len() - out_suffix_capacity)
+            .max()
+            .unwrap_or(0);
+        let shared_len = core::cmp::min(max_len, BATCH_SHARED_LEN);
+        let mut blocks = [[0u8; chacha::BLOCK_LEN]; BATCH_LANES];
+        let blocks = &mut blocks[..group.len()];
+        for start in (0..shared_len).step_by(chacha::BLOCK_LEN) {
+            let block = 1 + (start / chacha::BLOCK_LEN) as u32;
+            for counter in counters.iter_mut() {
+                counter[0] = block.to_le();
+            }
+            chacha::chacha20_blocks(chacha20_key, counters, blocks);
+            for (record, block) in group.iter_mut().zip(blocks.iter()) {
+                let in_out_len = record.2.len() - out_suffix_capacity;
+                let start = core::cmp::min(start, in_out_len);
+                let end = core::cmp::min(start + chacha::BLOCK_LEN, in_out_len);
+                for (b, k) in record.2[start..end].iter_mut()
+                                                 .zip(block.iter()) {
+                    *b ^= *k;
+                }
+            }
+        }
+
+        for ((record, counter), poly1305_key_block) in
+                group.iter_mut().zip(counters.iter())
+                                .zip(poly1305_key_blocks.iter()) {
+            let in_out_len = record.2.len() - out_suffix_capacity;
+            let (in_out, tag_out) = record.2.split_at_mut(in_out_len);
+            let tag_out =
+                slice_as_array_ref_mut!(&mut tag_out[..aead::TAG_LEN],
+                                        aead::TAG_LEN)?;
+            let key = poly1305::Key::from_chacha_block(poly1305_key_block);
+            let mut poly1305 = aead_poly1305_begin_with_key(key, &[record.1]);
+            let (shared, rest) =
+                in_out.split_at_mut(core::cmp::min(in_out_len, shared_len));
+            poly1305.update(shared);
+            seal_chunks(chacha20_key, *counter,
+                        1 + (BATCH_SHARED_LEN / chacha::BLOCK_LEN) as u32,
+                        &mut poly1305, rest);
+            aead_poly1305_finish(poly1305, record.1.len(), in_out_len,
+                                 tag_out);
+        }
     }
-    counter[0] = 1;
-    chacha::chacha20_xor_overlapping(&chacha20_key, &counter, in_out,
-                                     in_prefix_len);
     Ok(())
 }
 
-fn ctx_as_key(ctx: &[u64; aead::KEY_CTX_BUF_ELEMS])
-              -> Result<&chacha::Key, error::Unspecified> {
+// The number of records whose key stream blocks are computed together by
+// `chacha20_poly1305_seal_batch`; i.e. the number of lanes of the widest
+// `chacha::chacha20_blocks` implementation.
+const BATCH_LANES: usize = 8;
+
+// The number of bytes at the start of each record that
+// `chacha20_poly1305_seal_batch` encrypts with key stream blocks computed
+// for the whole group. Past this, `GFp_ChaCha20_ctr32`, which is vectorized
+// across the consecutive blocks of a single record, is at least as fast. It
+// must be a multiple of the ChaCha20 block length.
+const BATCH_SHARED_LEN: usize = 4 * chacha::BLOCK_LEN;
+
+// The ChaCha20 key stream for a message that is encrypted or decrypted in
+// pieces whose lengths aren't necessarily multiples of the block length. The
+// unused part of the block at the end of one piece is used at the start of
+// the next one.
+struct KeyStream<'a> {
+    key: &'a chacha::Key,
+    counter: chacha::Counter,
+    block: [u8; chacha::BLOCK_LEN],
+    block_used: usize,
+}
+
+impl<'a> KeyStream<'a> {
+    fn new(key: &'a chacha::Key, nonce: &[u8; aead::NONCE_LEN])
+           -> KeyStream<'a> {
+        KeyStream {
+            key: key,
+            counter: chacha::make_counter(nonce, 1),
+            block: [0u8; chacha::BLOCK_LEN],
+            block_used: chacha::BLOCK_LEN,
+        }
+    }
+
+    fn xor_in_place(&mut self, in_out: &mut [u8]) {
+        let leftover = core::cmp::min(chacha::BLOCK_LEN - self.block_used,
+                                      in_out.len());
+        let (leftover_in_out, in_out) = in_out.split_at_mut(leftover);
+        for (b, k) in leftover_in_out.iter_mut()
+                                     .zip(&self.block[self.block_used..]) {
+            *b ^= *k;
+        }
+        self.block_used += leftover;
+
+        let whole_len = in_out.len() - (in_out.len() % chacha::BLOCK_LEN);
+        let (whole, partial) = in_out.split_at_mut(whole_len);
+        if !whole.is_empty() {
+            chacha::chacha20_xor_in_place(self.key, &self.counter, whole);
+            self.advance((whole_len / chacha::BLOCK_LEN) as u32);
+        }
+
+        if !partial.is_empty() {
+            self.block = [0u8; chacha::BLOCK_LEN];
+            chacha::chacha20_xor_in_place(self.key, &self.counter,
+                                          &mut self.block);
+            self.advance(1);
+            for (b, k) in partial.iter_mut().zip(&self.block[..]) {
+                *b ^= *k;
+            }
+            self.block_used = partial.len();
+        }
+    }
+
+    fn advance(&mut self, blocks: u32) {
+        self.counter[0] =
+            u32::from_le(self.counter[0]).wrapping_add(blocks).to_le();
+    }
+}
+
+fn ctx_as_key(ctx: &[u64]) -> Result<&chacha::Key, error::Unspecified> {
     slice_as_array_ref!(
         &polyfill::slice::u64_as_u32(ctx)[..(chacha::KEY_LEN_IN_BYTES / 4)],
         chacha::KEY_LEN_IN_BYTES / 4)
 }
 
-fn aead_poly1305(tag_out: &mut [u8; aead::TAG_LEN], chacha20_key: &chacha::Key,
-                 counter: &chacha::Counter, ad: &[u8], ciphertext: &[u8]) {
+// Returns a Poly1305 context keyed as described in RFC 7539 Section 2.6 that
+// has already authenticated the (padded) additional data, which is the
+// concatenation of the segments of `ad`.
+fn aead_poly1305_begin(chacha20_key: &chacha::Key, counter: &chacha::Counter,
+                       ad: &[&[u8]]) -> poly1305::SigningContext {
     debug_assert_eq!(counter[0], 0);
     let key = poly1305::Key::derive_using_chacha(chacha20_key, counter);
+    aead_poly1305_begin_with_key(key, ad)
+}
+
+// Like `aead_poly1305_begin`, for a Poly1305 key that has already been
+// computed.
+fn aead_poly1305_begin_with_key(key: poly1305::Key, ad: &[&[u8]])
+                                -> poly1305::SigningContext {
     let mut ctx = poly1305::SigningContext::from_key(key);
-    poly1305_update_padded_16(&mut ctx, ad);
-    poly1305_update_padded_16(&mut ctx, ciphertext);
+    for ad in ad {
+        ctx.update(ad);
+    }
+    let ad_len = ad_len(ad);
+    if ad_len % 16 != 0 {
+        static PADDING: [u8; 16] = [0u8; 16];
+        ctx.update(&PADDING[..PADDING.len() - (ad_len % 16)])
+    }
+    ctx
+}
+
+fn ad_len(ad: &[&[u8]]) -> usize {
+    ad.iter().fold(0, |acc, ad| acc + ad.len())
+}
+
+// Finishes the authentication of a ciphertext of `ciphertext_len` bytes
+// that has already been fed to `ctx`.
+fn aead_poly1305_finish(mut ctx: poly1305::SigningContext, ad_len: usize,
+                        ciphertext_len: usize,
+                        tag_out: &mut [u8; aead::TAG_LEN]) {
+    if ciphertext_len % 16 != 0 {
+        static PADDING: [u8; 16] = [0u8; 16];
+        ctx.update(&PADDING[..PADDING.len() - (ciphertext_len % 16)])
+    }
     let lengths =
-        [polyfill::u64_from_usize(ad.len()).to_le(),
-         polyfill::u64_from_usize(ciphertext.len()).to_le()];
+        [polyfill::u64_from_usize(ad_len).to_le(),
+         polyfill::u64_from_usize(ciphertext_len).to_le()];
     ctx.update(polyfill::slice::u64_as_u8(&lengths));
     ctx.sign(tag_out);
 }
 
-#[inline]
-fn poly1305_update_padded_16(ctx: &mut poly1305::SigningContext, data: &[u8]) {
-    ctx.update(data);
-    if data.len() % 16 != 0 {
-        static PADDING: [u8; 16] = [0u8; 16];
-        ctx.update(&PADDING[..PADDING.len() - (data.len() % 16)])
+#[cfg(test)]
+mod tests {
+    use {aead, chacha, polyfill};
+    use std::vec::Vec;
+    use super::*;
+
+    // The straightforward two-pass construction from RFC 7539 Section 2.8,
+    // which the chunked implementation must agree with.
+    fn seal_two_pass(key: &chacha::Key, nonce: &[u8; aead::NONCE_LEN],
+                     ad: &[u8], in_out: &mut [u8],
+                     tag_out: &mut [u8; aead::TAG_LEN]) {
+        let mut counter = chacha::make_counter(nonce, 1);
+        chacha::chacha20_xor_in_place(key, &counter, in_out);
+        counter[0] = 0;
+        let mut poly1305 = aead_poly1305_begin(key, &counter, &[ad]);
+        poly1305.update(in_out);
+        aead_poly1305_finish(poly1305, ad.len(), in_out.len(), tag_out);
+    }
+
+    #[test]
+    fn chacha20_poly1305_chunked_test() {
+        let mut ctx = [0u64; chacha::KEY_LEN_IN_BYTES / 8];
+        {
+            let ctx_bytes = polyfill::slice::u64_as_u8_mut(&mut ctx);
+            for (i, b) in ctx_bytes[..chacha::KEY_LEN_IN_BYTES].iter_mut()
+                    .enumerate() {
+                *b = i as u8;
+            }
+        }
+        let key = *ctx_as_key(&ctx).unwrap();
+        let nonce = [7u8; aead::NONCE_LEN];
+        let ad = [1u8, 2, 3];
+
+        for &len in &[0, 1, 63, 64, CHUNK_LEN - 1, CHUNK_LEN, CHUNK_LEN + 1,
+                      (3 * CHUNK_LEN) + 17] {
+            let plaintext = (0..len).map(|i| i as u8).collect::<Vec<_>>();
+
+            let mut expected = plaintext.clone();
+            let mut expected_tag = [0u8; aead::TAG_LEN];
+            seal_two_pass(&key, &nonce, &ad, &mut expected, &mut expected_tag);
+
+            let mut actual = plaintext.clone();
+            let mut actual_tag = [0u8; aead::TAG_LEN];
+            chacha20_poly1305_seal(&ctx, &nonce, &ad, &mut actual,
+                                   &mut actual_tag).unwrap();
+            assert_eq!(actual, expected);
+            assert_eq!(&actual_tag[..], &expected_tag[..]);
+
+            for &in_prefix_len in &[0, 1, 16, 259] {
+                let mut in_out = vec![0u8; in_prefix_len];
+                in_out.extend_from_slice(&expected);
+                let mut open_tag = [0u8; aead::TAG_LEN];
+                chacha20_poly1305_open(&ctx, &nonce, &ad, in_prefix_len,
+                                       &mut in_out, &mut open_tag).unwrap();
+                assert_eq!(&in_out[..len], &plaintext[..]);
+                assert_eq!(&open_tag[..], &expected_tag[..]);
+            }
+        }
     }
 }
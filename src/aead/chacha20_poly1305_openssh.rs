@@ -29,7 +29,7 @@
 //!    http://cvsweb.openbsd.org/cgi-bin/cvsweb/src/usr.bin/ssh/PROTOCOL.chacha20poly1305?annotate=HEAD
 //! [RFC 4253]: https://tools.ietf.org/html/rfc4253
 
-use {chacha, error, poly1305};
+use {chacha, constant_time, error, init, poly1305};
 
 /// A key for sealing packets.
 pub struct SealingKey {
@@ -111,25 +111,150 @@ impl OpeningKey {
                              ciphertext_in_plaintext_out: &'a mut [u8],
                              tag: &[u8; TAG_LEN])
                              -> Result<&'a [u8], error::Unspecified> {
-        let mut counter = make_counter(sequence_number);
-
-        // We must verify the tag before decrypting so that
-        // `ciphertext_in_plaintext_out` is unmodified if verification fails.
-        // This is beyond what we guarantee.
+        let counter = make_counter(sequence_number);
         let poly_key = poly1305::Key::derive_using_chacha(&self.key.k_2,
                                                           &counter);
-        poly1305::verify(poly_key, ciphertext_in_plaintext_out, tag)?;
+        open_in_place(&self.key.k_2, counter, poly_key,
+                      ciphertext_in_plaintext_out, tag)
+    }
+
+    /// Computes the keys of the `len` packets with the sequence numbers
+    /// `first_sequence_number`, `first_sequence_number + 1`, etc., wrapping
+    /// around after `u32::max_value()`.
+    ///
+    /// `len` must be at most `MAX_BURST_LEN`.
+    pub fn prepare_burst<'a>(&'a self, first_sequence_number: u32,
+                             len: usize)
+                             -> Result<OpeningBurst<'a>, error::Unspecified> {
+        if len > MAX_BURST_LEN {
+            return Err(error::Unspecified);
+        }
+        let mut counters = [[0u32; 4]; MAX_BURST_LEN];
+        for (i, counter) in counters[..len].iter_mut().enumerate() {
+            *counter =
+                make_counter(first_sequence_number.wrapping_add(i as u32));
+        }
+
+        let mut blocks = [[0u8; chacha::BLOCK_LEN]; MAX_BURST_LEN];
+        chacha::chacha20_blocks(&self.key.k_1, &counters[..len],
+                                &mut blocks[..len]);
+        let mut length_key_streams = [[0u8; PACKET_LENGTH_LEN]; MAX_BURST_LEN];
+        for (key_stream, block) in
+                length_key_streams[..len].iter_mut().zip(blocks.iter()) {
+            key_stream.copy_from_slice(&block[..PACKET_LENGTH_LEN]);
+        }
+
+        let mut poly1305_key_blocks = [[0u8; chacha::BLOCK_LEN]; MAX_BURST_LEN];
+        chacha::chacha20_blocks(&self.key.k_2, &counters[..len],
+                                &mut poly1305_key_blocks[..len]);
+
+        Ok(OpeningBurst {
+            key: self,
+            first_sequence_number,
+            len,
+            length_key_streams,
+            poly1305_key_blocks,
+        })
+    }
+}
+
+/// The maximum number of packets in an `OpeningBurst`.
+pub const MAX_BURST_LEN: usize = 8;
+
+/// The keys of several packets with consecutive sequence numbers, computed
+/// together by `OpeningKey::prepare_burst()`.
+///
+/// Each packet costs a ChaCha20 block under `K_1` for its length and another
+/// under `K_2` for its Poly1305 key, each with a different nonce. A burst
+/// computes these for all of its packets at once, in parallel where the CPU
+/// allows, which saves most of their cost for small packets. Bursts of
+/// `MAX_BURST_LEN` packets are the fastest.
+pub struct OpeningBurst<'a> {
+    key: &'a OpeningKey,
+    first_sequence_number: u32,
+    len: usize,
+    length_key_streams: [[u8; PACKET_LENGTH_LEN]; MAX_BURST_LEN],
+    poly1305_key_blocks: [[u8; chacha::BLOCK_LEN]; MAX_BURST_LEN],
+}
+
+impl<'a> OpeningBurst<'a> {
+    /// Like `OpeningKey::decrypt_packet_length()` for a packet of the burst.
+    ///
+    /// Fails if `sequence_number` isn't one of the burst's.
+    pub fn decrypt_packet_length(
+            &self, sequence_number: u32,
+            encrypted_packet_length: [u8; PACKET_LENGTH_LEN])
+            -> Result<[u8; PACKET_LENGTH_LEN], error::Unspecified> {
+        let i = self.index(sequence_number)?;
+        let mut packet_length = encrypted_packet_length;
+        for (b, k) in packet_length.iter_mut()
+                                   .zip(self.length_key_streams[i].iter()) {
+            *b ^= *k;
+        }
+        Ok(packet_length)
+    }
+
+    /// Like `OpeningKey::open_in_place()` for a packet of the burst.
+    ///
+    /// Fails if `sequence_number` isn't one of the burst's.
+    pub fn open_in_place<'b>(&self, sequence_number: u32,
+                             ciphertext_in_plaintext_out: &'b mut [u8],
+                             tag: &[u8; TAG_LEN])
+                             -> Result<&'b [u8], error::Unspecified> {
+        let i = self.index(sequence_number)?;
+        let poly_key =
+            poly1305::Key::from_chacha_block(&self.poly1305_key_blocks[i]);
+        open_in_place(&self.key.key.k_2, make_counter(sequence_number),
+                      poly_key, ciphertext_in_plaintext_out, tag)
+    }
 
-        let plaintext_in_ciphertext_out =
-            &mut ciphertext_in_plaintext_out[PACKET_LENGTH_LEN..];
-        counter[0] = 1;
-        chacha::chacha20_xor_in_place(&self.key.k_2, &counter,
-                                      plaintext_in_ciphertext_out);
+    fn index(&self, sequence_number: u32) -> Result<usize, error::Unspecified> {
+        let i = sequence_number.wrapping_sub(self.first_sequence_number);
+        if i as usize >= self.len {
+            return Err(error::Unspecified);
+        }
+        Ok(i as usize)
+    }
+}
 
-        Ok(plaintext_in_ciphertext_out)
+// Authenticates and decrypts the packet in a single pass, a chunk at a time,
+// so that each chunk is decrypted while it is still in the cache. If the tag
+// is wrong then the plaintext is zeroed, as in `aead::open_in_place()`.
+fn open_in_place<'a>(k_2: &chacha::Key, counter: chacha::Counter,
+                     poly_key: poly1305::Key,
+                     ciphertext_in_plaintext_out: &'a mut [u8],
+                     tag: &[u8; TAG_LEN])
+                     -> Result<&'a [u8], error::Unspecified> {
+    if ciphertext_in_plaintext_out.len() < PACKET_LENGTH_LEN {
+        return Err(error::Unspecified);
     }
+    let mut counter = counter;
+    let mut poly1305 = poly1305::SigningContext::from_key(poly_key);
+    let (encrypted_packet_length, plaintext_in_ciphertext_out) =
+        ciphertext_in_plaintext_out.split_at_mut(PACKET_LENGTH_LEN);
+    poly1305.update(encrypted_packet_length);
+
+    let mut block = 1u32;
+    for chunk in plaintext_in_ciphertext_out.chunks_mut(CHUNK_LEN) {
+        poly1305.update(chunk);
+        counter[0] = block.to_le();
+        chacha::chacha20_xor_in_place(k_2, &counter, chunk);
+        block = block.wrapping_add((CHUNK_LEN / chacha::BLOCK_LEN) as u32);
+    }
+
+    let mut calculated_tag = [0u8; TAG_LEN];
+    poly1305.sign(&mut calculated_tag);
+    if constant_time::verify_slices_are_equal(&calculated_tag, tag).is_err() {
+        for b in plaintext_in_ciphertext_out.iter_mut() {
+            *b = 0;
+        }
+        return Err(error::Unspecified);
+    }
+    Ok(plaintext_in_ciphertext_out)
 }
 
+const CHUNK_LEN: usize = 4 * 1024;
+
 struct Key {
     k_1: chacha::Key,
     k_2: chacha::Key,
@@ -137,6 +262,8 @@ struct Key {
 
 impl Key {
     pub fn new(key_material: &[u8; KEY_LEN]) -> Key {
+        init::init_once();
+
         // The first half becomes K_2 and the second half becomes K_1.
         Key {
             k_1: chacha::key_from_bytes(
@@ -169,3 +296,72 @@ pub const TAG_LEN: usize = poly1305::TAG_LEN;
 
 /// The length in bytes of the `packet_length` field in a SSH packet.
 pub const PACKET_LENGTH_LEN: usize = 4; // 32 bits
+
+#[cfg(test)]
+mod tests {
+    use {polyfill, std};
+    use super::*;
+
+    fn seal(key: &SealingKey, sequence_number: u32, payload_len: usize)
+            -> (std::vec::Vec<u8>, [u8; TAG_LEN], std::vec::Vec<u8>) {
+        let mut packet = std::vec::Vec::new();
+        packet.extend_from_slice(
+            &polyfill::slice::be_u8_from_u32(payload_len as u32));
+        packet.extend((0..payload_len).map(|i| (i as u32 ^ sequence_number)
+                                                  as u8));
+        let plaintext = packet.clone();
+        let mut tag = [0u8; TAG_LEN];
+        key.seal_in_place(sequence_number, &mut packet, &mut tag);
+        (packet, tag, plaintext)
+    }
+
+    #[test]
+    fn test_open_burst() {
+        let key_material = [0x42u8; KEY_LEN];
+        let s_key = SealingKey::new(&key_material);
+        let o_key = OpeningKey::new(&key_material);
+
+        for &(first, len) in &[(0, 0), (7, 1), (0xffff_fffc, 5),
+                               (0xffff_fffd, MAX_BURST_LEN)] {
+            let burst = o_key.prepare_burst(first, len).unwrap();
+            for i in 0..len {
+                let sequence_number = first.wrapping_add(i as u32);
+                let payload_len = [0, 1, 15, 16, 300, 10000][i % 6];
+                let (mut packet, mut tag, plaintext) =
+                    seal(&s_key, sequence_number, payload_len);
+
+                let encrypted_packet_length =
+                    *slice_as_array_ref!(&packet[..PACKET_LENGTH_LEN],
+                                         PACKET_LENGTH_LEN).unwrap();
+                let expected = o_key.decrypt_packet_length(
+                    sequence_number, encrypted_packet_length);
+                assert_eq!(burst.decrypt_packet_length(
+                               sequence_number, encrypted_packet_length),
+                           Ok(expected));
+                assert_eq!(&expected[..], &plaintext[..PACKET_LENGTH_LEN]);
+
+                let mut copy = packet.clone();
+                assert_eq!(o_key.open_in_place(sequence_number, &mut copy,
+                                               &tag),
+                           Ok(&plaintext[PACKET_LENGTH_LEN..]));
+                assert_eq!(burst.open_in_place(sequence_number, &mut packet,
+                                               &tag),
+                           Ok(&plaintext[PACKET_LENGTH_LEN..]));
+
+                tag[0] ^= 1;
+                let (mut packet, _, _) =
+                    seal(&s_key, sequence_number, payload_len);
+                assert!(burst.open_in_place(sequence_number, &mut packet,
+                                            &tag).is_err());
+                assert!(packet[PACKET_LENGTH_LEN..].iter().all(|b| *b == 0));
+            }
+
+            let outside = first.wrapping_add(len as u32);
+            assert!(burst.decrypt_packet_length(outside, [0; 4]).is_err());
+            let (mut packet, tag, _) = seal(&s_key, outside, 16);
+            assert!(burst.open_in_place(outside, &mut packet, &tag).is_err());
+        }
+
+        assert!(o_key.prepare_burst(0, MAX_BURST_LEN + 1).is_err());
+    }
+}
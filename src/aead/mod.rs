@@ -29,11 +29,30 @@ pub mod chacha20_poly1305_openssh;
 
 mod chacha20_poly1305;
 mod aes_gcm;
+mod stream;
+mod typed;
 
 use {constant_time, error, init, poly1305, polyfill};
 
 pub use self::chacha20_poly1305::CHACHA20_POLY1305;
 pub use self::aes_gcm::{AES_128_GCM, AES_256_GCM};
+pub use self::stream::{
+    NONCE_PREFIX_LEN,
+    OpeningStream,
+    SealingStream,
+    open_stream_chunk,
+    seal_stream_chunk,
+};
+pub use self::typed::{
+    Aes128Gcm,
+    Aes256Gcm,
+    ChaCha20Poly1305,
+    TypedAlgorithm,
+    TypedOpeningKey,
+    TypedSealingKey,
+    open_in_place_typed,
+    seal_in_place_typed,
+};
 
 /// A key for authenticating and decrypting (“opening”) AEAD-protected data.
 ///
@@ -59,7 +78,25 @@ impl OpeningKey {
     pub fn new(algorithm: &'static Algorithm, key_bytes: &[u8])
                -> Result<OpeningKey, error::Unspecified> {
         Ok(OpeningKey {
-            key: Key::new(algorithm, key_bytes)?,
+            key: Key::new(algorithm, key_bytes, false)?,
+        })
+    }
+
+    /// Create a new opening key that takes less memory than one made with
+    /// `new()`, at the cost of more work each time it is used.
+    ///
+    /// This is meant for keys that are kept for a long time but rarely used,
+    /// e.g. those of idle connections in a server with very many of them. An
+    /// AES-GCM key made this way stores only the AES key schedule, and the
+    /// GHASH key table is recomputed for every operation; for
+    /// ChaCha20-Poly1305 it is the same as `new()`. Without the `use_heap`
+    /// feature every key has room for the largest context anyway, so this is
+    /// also the same as `new()`.
+    #[inline]
+    pub fn new_compact(algorithm: &'static Algorithm, key_bytes: &[u8])
+                       -> Result<OpeningKey, error::Unspecified> {
+        Ok(OpeningKey {
+            key: Key::new(algorithm, key_bytes, true)?,
         })
     }
 
@@ -122,6 +159,35 @@ pub fn open_in_place<'a>(key: &OpeningKey, nonce: &[u8], ad: &[u8],
                          in_prefix_len: usize,
                          ciphertext_and_tag_modified_in_place: &'a mut [u8])
                          -> Result<&'a mut [u8], error::Unspecified> {
+    counted!(Open,
+             ciphertext_and_tag_modified_in_place.len()
+                .saturating_sub(in_prefix_len),
+             open_in_place_(key, nonce, ad, in_prefix_len,
+                            ciphertext_and_tag_modified_in_place))
+}
+
+fn open_in_place_<'a>(key: &OpeningKey, nonce: &[u8], ad: &[u8],
+                      in_prefix_len: usize,
+                      ciphertext_and_tag_modified_in_place: &'a mut [u8])
+                      -> Result<&'a mut [u8], error::Unspecified> {
+    open_in_place_with(nonce, in_prefix_len,
+                       ciphertext_and_tag_modified_in_place,
+                       |nonce, in_prefix_len, in_out, calculated_tag| {
+        (key.key.algorithm.open)(key.key.ctx_buf(), nonce, ad,
+                                 in_prefix_len, in_out, calculated_tag)
+    })
+}
+
+// The part of `open_in_place()` that doesn't depend on the algorithm. `open`
+// is called like `Algorithm::open`, without the key context. This is also
+// used by `typed::open_in_place()`, where `open` is a direct call.
+#[inline(always)]
+fn open_in_place_with<'a, F>(nonce: &[u8], in_prefix_len: usize,
+                             ciphertext_and_tag_modified_in_place: &'a mut [u8],
+                             open: F)
+                             -> Result<&'a mut [u8], error::Unspecified>
+        where F: FnOnce(&[u8; NONCE_LEN], usize, &mut [u8], &mut [u8; TAG_LEN])
+                        -> Result<(), error::Unspecified> {
     let nonce = slice_as_array_ref!(nonce, NONCE_LEN)?;
     let ciphertext_and_tag_len =
         ciphertext_and_tag_modified_in_place.len()
@@ -133,8 +199,7 @@ pub fn open_in_place<'a>(key: &OpeningKey, nonce: &[u8], ad: &[u8],
         ciphertext_and_tag_modified_in_place
             .split_at_mut(in_prefix_len + ciphertext_len);
     let mut calculated_tag = [0u8; TAG_LEN];
-    (key.key.algorithm.open)(&key.key.ctx_buf, nonce, &ad, in_prefix_len,
-                             in_out, &mut calculated_tag)?;
+    open(nonce, in_prefix_len, in_out, &mut calculated_tag)?;
     if constant_time::verify_slices_are_equal(&calculated_tag, received_tag)
             .is_err() {
         // Zero out the plaintext so that it isn't accidentally leaked or used
@@ -150,6 +215,46 @@ pub fn open_in_place<'a>(key: &OpeningKey, nonce: &[u8], ad: &[u8],
     Ok(&mut in_out[..ciphertext_len])
 }
 
+/// Authenticates and decrypts (“opens”) data that is scattered across
+/// multiple buffers, in place.
+///
+/// This is like `open_in_place()` except that the additional authenticated
+/// data is the concatenation of the segments of `ad`, the ciphertext is the
+/// concatenation of the segments of `in_out`, and the tag is given separately
+/// as `received_tag`, which must be exactly `key.algorithm().tag_len()` bytes
+/// long. The segments may be of any length, including zero; they are processed
+/// without first being copied into a contiguous buffer. The ciphertext is
+/// decrypted in place, without any shifting.
+///
+/// When `open_in_place_vectored()` returns `Err(..)`, the segments of `in_out`
+/// have been zeroed.
+pub fn open_in_place_vectored(key: &OpeningKey, nonce: &[u8], ad: &[&[u8]],
+                              in_out: &mut [&mut [u8]], received_tag: &[u8])
+                              -> Result<(), error::Unspecified> {
+    let nonce = slice_as_array_ref!(nonce, NONCE_LEN)?;
+    if received_tag.len() != TAG_LEN {
+        return Err(error::Unspecified);
+    }
+    let _ = total_len(ad.iter().map(|segment| segment.len()))?;
+    let ciphertext_len =
+        total_len(in_out.iter().map(|segment| segment.len()))?;
+    check_per_nonce_max_bytes(ciphertext_len)?;
+    let mut calculated_tag = [0u8; TAG_LEN];
+    (key.key.algorithm.open_vectored)(key.key.ctx_buf(), nonce, ad, in_out,
+                                      &mut calculated_tag)?;
+    if constant_time::verify_slices_are_equal(&calculated_tag, received_tag)
+            .is_err() {
+        // See the comment in `open_in_place()`.
+        for segment in in_out.iter_mut() {
+            for b in segment.iter_mut() {
+                *b = 0;
+            }
+        }
+        return Err(error::Unspecified);
+    }
+    Ok(())
+}
+
 /// A key for encrypting and signing (“sealing”) data.
 ///
 /// C analog: `EVP_AEAD_CTX` with direction `evp_aead_seal`.
@@ -170,7 +275,18 @@ impl SealingKey {
     pub fn new(algorithm: &'static Algorithm, key_bytes: &[u8])
                -> Result<SealingKey, error::Unspecified> {
         Ok(SealingKey {
-            key: Key::new(algorithm, key_bytes)?,
+            key: Key::new(algorithm, key_bytes, false)?,
+        })
+    }
+
+    /// Create a new sealing key that takes less memory than one made with
+    /// `new()`, at the cost of more work each time it is used. See
+    /// `OpeningKey::new_compact()`.
+    #[inline]
+    pub fn new_compact(algorithm: &'static Algorithm, key_bytes: &[u8])
+                       -> Result<SealingKey, error::Unspecified> {
+        Ok(SealingKey {
+            key: Key::new(algorithm, key_bytes, true)?,
         })
     }
 
@@ -205,7 +321,29 @@ impl SealingKey {
 pub fn seal_in_place(key: &SealingKey, nonce: &[u8], ad: &[u8],
                      in_out: &mut [u8], out_suffix_capacity: usize)
                      -> Result<usize, error::Unspecified> {
-    if out_suffix_capacity < key.key.algorithm.tag_len() {
+    counted!(Seal, in_out.len().saturating_sub(out_suffix_capacity),
+             seal_in_place_(key, nonce, ad, in_out, out_suffix_capacity))
+}
+
+fn seal_in_place_(key: &SealingKey, nonce: &[u8], ad: &[u8],
+                  in_out: &mut [u8], out_suffix_capacity: usize)
+                  -> Result<usize, error::Unspecified> {
+    seal_in_place_with(nonce, in_out, out_suffix_capacity,
+                       |nonce, in_out, tag_out| {
+        (key.key.algorithm.seal)(key.key.ctx_buf(), nonce, ad, in_out,
+                                 tag_out)
+    })
+}
+
+// The part of `seal_in_place()` that doesn't depend on the algorithm, like
+// `open_in_place_with()`.
+#[inline(always)]
+fn seal_in_place_with<F>(nonce: &[u8], in_out: &mut [u8],
+                         out_suffix_capacity: usize, seal: F)
+                         -> Result<usize, error::Unspecified>
+        where F: FnOnce(&[u8; NONCE_LEN], &mut [u8], &mut [u8; TAG_LEN])
+                        -> Result<(), error::Unspecified> {
+    if out_suffix_capacity < TAG_LEN {
         return Err(error::Unspecified);
     }
     let nonce = slice_as_array_ref!(nonce, NONCE_LEN)?;
@@ -214,39 +352,132 @@ pub fn seal_in_place(key: &SealingKey, nonce: &[u8], ad: &[u8],
     check_per_nonce_max_bytes(in_out_len)?;
     let (in_out, tag_out) = in_out.split_at_mut(in_out_len);
     let tag_out = slice_as_array_ref_mut!(tag_out, TAG_LEN)?;
-    (key.key.algorithm.seal)(&key.key.ctx_buf, nonce, ad, in_out, tag_out)?;
+    seal(nonce, in_out, tag_out)?;
     Ok(in_out_len + TAG_LEN)
 }
 
+/// Encrypts and signs (“seals”) data that is scattered across multiple
+/// buffers, in place.
+///
+/// This is like `seal_in_place()` except that the additional authenticated
+/// data is the concatenation of the segments of `ad`, the plaintext is the
+/// concatenation of the segments of `in_out`, and the tag is written to
+/// `tag_out`, which must be exactly `key.algorithm().tag_len()` bytes long.
+/// The segments may be of any length, including zero; they are processed
+/// without first being copied into a contiguous buffer. Each segment of
+/// `in_out` is overwritten with the corresponding part of the ciphertext.
+pub fn seal_in_place_vectored(key: &SealingKey, nonce: &[u8], ad: &[&[u8]],
+                              in_out: &mut [&mut [u8]], tag_out: &mut [u8])
+                              -> Result<(), error::Unspecified> {
+    let nonce = slice_as_array_ref!(nonce, NONCE_LEN)?;
+    let tag_out = slice_as_array_ref_mut!(tag_out, TAG_LEN)?;
+    let _ = total_len(ad.iter().map(|segment| segment.len()))?;
+    let in_out_len = total_len(in_out.iter().map(|segment| segment.len()))?;
+    check_per_nonce_max_bytes(in_out_len)?;
+    (key.key.algorithm.seal_vectored)(key.key.ctx_buf(), nonce, ad, in_out,
+                                      tag_out)
+}
+
+/// Encrypts and signs (“seals”) a batch of independent records in place,
+/// using the same key for all of them.
+///
+/// Each record is a `(nonce, ad, in_out)` tuple that is sealed exactly as
+/// `seal_in_place(key, nonce, ad, in_out, out_suffix_capacity)` would seal
+/// it; i.e. the output of each record is the first
+/// `in_out.len() - out_suffix_capacity + key.algorithm().tag_len()` bytes of
+/// its `in_out`.
+/// Sealing many small records this way is faster than calling
+/// `seal_in_place()` for each of them because the per-key setup is only done
+/// once for the whole batch.
+///
+/// Every record is checked before any of them is sealed, so when
+/// `seal_in_place_batch()` returns `Err(..)` none of the records have been
+/// modified.
+pub fn seal_in_place_batch<'a>(key: &SealingKey,
+                               records: &mut [(&'a [u8], &'a [u8],
+                                               &'a mut [u8])],
+                               out_suffix_capacity: usize)
+                               -> Result<(), error::Unspecified> {
+    if out_suffix_capacity < key.key.algorithm.tag_len() {
+        return Err(error::Unspecified);
+    }
+    for &(nonce, _, ref in_out) in records.iter() {
+        if nonce.len() != NONCE_LEN {
+            return Err(error::Unspecified);
+        }
+        let in_out_len = in_out.len().checked_sub(out_suffix_capacity)
+                                     .ok_or(error::Unspecified)?;
+        check_per_nonce_max_bytes(in_out_len)?;
+    }
+    (key.key.algorithm.seal_batch)(key.key.ctx_buf(), records,
+                                   out_suffix_capacity)
+}
+
 /// `OpeningKey` and `SealingKey` are type-safety wrappers around `Key`, which
 /// does all the actual work via the C AEAD interface.
 ///
 /// C analog: `EVP_AEAD_CTX`
+#[allow(box_pointers)]
 struct Key {
-    ctx_buf: [u64; KEY_CTX_BUF_ELEMS],
+    ctx_buf: KeyCtxBuf,
     algorithm: &'static Algorithm,
 }
 
+// With the heap, each key's context is only as large as its algorithm needs,
+// so e.g. a ChaCha20-Poly1305 key doesn't pay for the AES-GCM tables.
+#[cfg(feature = "use_heap")]
+#[allow(box_pointers)]
+type KeyCtxBuf = std::boxed::Box<[u64]>;
+
+#[cfg(feature = "use_heap")]
+#[allow(box_pointers)]
+fn new_ctx_buf(len: usize) -> KeyCtxBuf {
+    vec![0; (len + 7) / 8].into_boxed_slice()
+}
+
+// Without the heap, every key has room for the largest context.
+#[cfg(not(feature = "use_heap"))]
+type KeyCtxBuf = [u64; KEY_CTX_BUF_ELEMS];
+
+#[cfg(not(feature = "use_heap"))]
+fn new_ctx_buf(len: usize) -> KeyCtxBuf {
+    debug_assert!(len <= KEY_CTX_BUF_LEN);
+    [0; KEY_CTX_BUF_ELEMS]
+}
+
+#[cfg(not(feature = "use_heap"))]
 const KEY_CTX_BUF_ELEMS: usize = (KEY_CTX_BUF_LEN + 7) / 8;
 
 // Keep this in sync with `aead_aes_gcm_ctx` in e_aes.c.
+#[cfg(not(feature = "use_heap"))]
 const KEY_CTX_BUF_LEN: usize = self::aes_gcm::AES_KEY_CTX_BUF_LEN;
 
 impl Key {
-    fn new(algorithm: &'static Algorithm, key_bytes: &[u8]) -> Result<Self, error::Unspecified> {
+    #[allow(box_pointers)]
+    fn new(algorithm: &'static Algorithm, key_bytes: &[u8], compact: bool)
+           -> Result<Self, error::Unspecified> {
         if key_bytes.len() != algorithm.key_len() {
             return Err(error::Unspecified);
         }
 
+        // A compact context would be stored in a full-sized buffer without
+        // the heap, which would save nothing.
+        let (ctx_buf_len, init) = if compact && cfg!(feature = "use_heap") {
+            (algorithm.compact_ctx_buf_len, algorithm.init_compact)
+        } else {
+            (algorithm.ctx_buf_len, algorithm.init)
+        };
+
         let mut r = Key {
             algorithm,
-            ctx_buf: [0; KEY_CTX_BUF_ELEMS],
+            ctx_buf: new_ctx_buf(ctx_buf_len),
         };
 
         init::init_once();
         {
-            let ctx_buf_bytes = polyfill::slice::u64_as_u8_mut(&mut r.ctx_buf);
-            (r.algorithm.init)(ctx_buf_bytes, key_bytes)?;
+            let ctx_buf_bytes =
+                polyfill::slice::u64_as_u8_mut(&mut r.ctx_buf[..]);
+            init(ctx_buf_bytes, key_bytes)?;
         }
 
         Ok(r)
@@ -255,6 +486,10 @@ impl Key {
     /// The key's AEAD algorithm.
     #[inline(always)]
     fn algorithm(&self) -> &'static Algorithm { self.algorithm }
+
+    #[allow(box_pointers)]
+    #[inline(always)]
+    fn ctx_buf(&self) -> &[u64] { &self.ctx_buf[..] }
 }
 
 /// An AEAD Algorithm.
@@ -265,14 +500,35 @@ impl Key {
 ///     [`crypto.cipher.AEAD`](https://golang.org/pkg/crypto/cipher/#AEAD)
 pub struct Algorithm {
     init: fn(ctx_buf: &mut [u8], key: &[u8]) -> Result<(), error::Unspecified>,
+    ctx_buf_len: usize,
+
+    // Like `init` and `ctx_buf_len`, for keys made by `new_compact()`. `seal`
+    // etc. tell the two kinds of key apart by the length of their context.
+    init_compact: fn(ctx_buf: &mut [u8], key: &[u8])
+                     -> Result<(), error::Unspecified>,
+    compact_ctx_buf_len: usize,
 
-    seal: fn(ctx: &[u64; KEY_CTX_BUF_ELEMS], nonce: &[u8; NONCE_LEN], ad: &[u8],
+    seal: fn(ctx: &[u64], nonce: &[u8; NONCE_LEN], ad: &[u8],
              in_out: &mut [u8], tag_out: &mut [u8; TAG_LEN])
              -> Result<(), error::Unspecified>,
-    open: fn(ctx: &[u64; KEY_CTX_BUF_ELEMS], nonce: &[u8; NONCE_LEN],
+    open: fn(ctx: &[u64], nonce: &[u8; NONCE_LEN],
              ad: &[u8], in_prefix_len: usize, in_out: &mut [u8],
              tag_out: &mut [u8; TAG_LEN]) -> Result<(), error::Unspecified>,
 
+    seal_vectored: fn(ctx: &[u64], nonce: &[u8; NONCE_LEN],
+                      ad: &[&[u8]], in_out: &mut [&mut [u8]],
+                      tag_out: &mut [u8; TAG_LEN])
+                      -> Result<(), error::Unspecified>,
+    open_vectored: fn(ctx: &[u64], nonce: &[u8; NONCE_LEN],
+                      ad: &[&[u8]], in_out: &mut [&mut [u8]],
+                      tag_out: &mut [u8; TAG_LEN])
+                      -> Result<(), error::Unspecified>,
+
+    // The records have already been checked by `seal_in_place_batch()`.
+    seal_batch: fn(ctx: &[u64],
+                   records: &mut [BatchRecord], out_suffix_capacity: usize)
+                   -> Result<(), error::Unspecified>,
+
     key_len: usize,
     id: AlgorithmID,
 }
@@ -319,6 +575,9 @@ impl PartialEq for Algorithm {
 
 impl Eq for Algorithm {}
 
+/// A `(nonce, ad, in_out)` record for `seal_in_place_batch()`.
+type BatchRecord<'a> = (&'a [u8], &'a [u8], &'a mut [u8]);
+
 /// The maximum length of a tag for the algorithms in this module.
 pub const MAX_TAG_LEN: usize = TAG_LEN;
 
@@ -338,3 +597,14 @@ fn check_per_nonce_max_bytes(in_out_len: usize)
     }
     Ok(())
 }
+
+/// The total length of the segments of a vectored input, or an error if it
+/// doesn't fit in a `usize`.
+fn total_len<I: Iterator<Item=usize>>(segment_lens: I)
+                                      -> Result<usize, error::Unspecified> {
+    let mut total = 0usize;
+    for len in segment_lens {
+        total = total.checked_add(len).ok_or(error::Unspecified)?;
+    }
+    Ok(total)
+}
@@ -0,0 +1,179 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// Streaming AEAD: the STREAM construction,
+// https://eprint.iacr.org/2015/189.
+
+use {aead, error, polyfill};
+
+/// The length of the nonce prefix of a `SealingStream` or `OpeningStream`.
+pub const NONCE_PREFIX_LEN: usize = aead::NONCE_LEN - 4 - 1;
+
+/// Seals the chunks of a message in order, using the [STREAM] construction.
+///
+/// A message that is too large to be sealed in one piece, e.g. a backup of
+/// many gigabytes, is split into chunks of any sizes the caller likes, and
+/// each chunk is sealed as its own AEAD record. The nonce of chunk `i` is
+/// `nonce_prefix||i||last`, where `nonce_prefix` is `NONCE_PREFIX_LEN` bytes
+/// chosen by the caller, `i` is the 32-bit big-endian index of the chunk, and
+/// `last` is 1 for the final chunk of the message and 0 for the others. This
+/// way chunks that are reordered, dropped, duplicated, or taken from another
+/// message, and messages that are truncated at a chunk boundary, are all
+/// detected.
+///
+/// The nonce prefix must never be used for two messages with the same key.
+/// Choosing it at random is fine for up to about 2**28 messages per key.
+///
+/// `SealingStream` and `OpeningStream` keep track of the chunk index for
+/// chunks that are processed in order. Since the chunks are independent of
+/// each other, they can also be processed in any order, e.g. by several
+/// threads sharing the key, using `seal_stream_chunk()` and
+/// `open_stream_chunk()` with explicit indexes.
+///
+/// [STREAM]: https://eprint.iacr.org/2015/189
+pub struct SealingStream<'a> {
+    key: &'a aead::SealingKey,
+    nonce_prefix: [u8; NONCE_PREFIX_LEN],
+    index: u32,
+}
+
+impl<'a> SealingStream<'a> {
+    /// Starts sealing a message using `key` and `nonce_prefix`.
+    pub fn new(key: &'a aead::SealingKey,
+               nonce_prefix: &[u8; NONCE_PREFIX_LEN]) -> SealingStream<'a> {
+        SealingStream { key, nonce_prefix: *nonce_prefix, index: 0 }
+    }
+
+    /// Seals the next chunk, which must not be the last one.
+    ///
+    /// `ad` and `in_out` are as for `aead::seal_in_place()`, which this is
+    /// otherwise like.
+    pub fn seal_chunk(&mut self, ad: &[u8], in_out: &mut [u8],
+                      out_suffix_capacity: usize)
+                      -> Result<usize, error::Unspecified> {
+        let next = next_index(self.index)?;
+        let r = seal_stream_chunk(self.key, &self.nonce_prefix, self.index,
+                                  false, ad, in_out, out_suffix_capacity)?;
+        self.index = next;
+        Ok(r)
+    }
+
+    /// Seals the last chunk, which may be empty, and finishes the message.
+    pub fn seal_last_chunk(self, ad: &[u8], in_out: &mut [u8],
+                           out_suffix_capacity: usize)
+                           -> Result<usize, error::Unspecified> {
+        seal_stream_chunk(self.key, &self.nonce_prefix, self.index, true, ad,
+                          in_out, out_suffix_capacity)
+    }
+}
+
+/// Opens the chunks of a message in order.
+///
+/// A message is only complete, and its plaintext only trustworthy as a whole,
+/// once `open_last_chunk()` has succeeded. If the input ends before then, it
+/// has been truncated.
+pub struct OpeningStream<'a> {
+    key: &'a aead::OpeningKey,
+    nonce_prefix: [u8; NONCE_PREFIX_LEN],
+    index: u32,
+}
+
+impl<'a> OpeningStream<'a> {
+    /// Starts opening a message that was sealed using `key` and
+    /// `nonce_prefix`.
+    pub fn new(key: &'a aead::OpeningKey,
+               nonce_prefix: &[u8; NONCE_PREFIX_LEN]) -> OpeningStream<'a> {
+        OpeningStream { key, nonce_prefix: *nonce_prefix, index: 0 }
+    }
+
+    /// Opens the next chunk, which must not be the last one.
+    ///
+    /// `ad`, `in_prefix_len` and `ciphertext_and_tag_modified_in_place` are
+    /// as for `aead::open_in_place()`, which this is otherwise like. When
+    /// this returns `Err(..)` the rest of the message must not be opened.
+    pub fn open_chunk<'b>(&mut self, ad: &[u8], in_prefix_len: usize,
+                          ciphertext_and_tag_modified_in_place: &'b mut [u8])
+                          -> Result<&'b mut [u8], error::Unspecified> {
+        let index = self.index;
+        self.index = next_index(index)?;
+        open_stream_chunk(self.key, &self.nonce_prefix, index, false, ad,
+                          in_prefix_len, ciphertext_and_tag_modified_in_place)
+    }
+
+    /// Opens the last chunk and finishes the message.
+    pub fn open_last_chunk<'b>(self, ad: &[u8], in_prefix_len: usize,
+                               ciphertext_and_tag_modified_in_place:
+                                   &'b mut [u8])
+                               -> Result<&'b mut [u8], error::Unspecified> {
+        open_stream_chunk(self.key, &self.nonce_prefix, self.index, true, ad,
+                          in_prefix_len, ciphertext_and_tag_modified_in_place)
+    }
+}
+
+/// Seals chunk `index` of the message with nonce prefix `nonce_prefix`;
+/// `last` must be true exactly when it is the message's final chunk.
+///
+/// The arguments are otherwise as for `aead::seal_in_place()`.
+pub fn seal_stream_chunk(key: &aead::SealingKey,
+                         nonce_prefix: &[u8; NONCE_PREFIX_LEN], index: u32,
+                         last: bool, ad: &[u8], in_out: &mut [u8],
+                         out_suffix_capacity: usize)
+                         -> Result<usize, error::Unspecified> {
+    let nonce = chunk_nonce(nonce_prefix, index, last);
+    aead::seal_in_place(key, &nonce, ad, in_out, out_suffix_capacity)
+}
+
+/// Opens chunk `index` of the message with nonce prefix `nonce_prefix`;
+/// `last` must be true exactly when it is the message's final chunk.
+///
+/// The arguments are otherwise as for `aead::open_in_place()`.
+pub fn open_stream_chunk<'a>(key: &aead::OpeningKey,
+                             nonce_prefix: &[u8; NONCE_PREFIX_LEN],
+                             index: u32, last: bool, ad: &[u8],
+                             in_prefix_len: usize,
+                             ciphertext_and_tag_modified_in_place:
+                                 &'a mut [u8])
+                             -> Result<&'a mut [u8], error::Unspecified> {
+    let nonce = chunk_nonce(nonce_prefix, index, last);
+    aead::open_in_place(key, &nonce, ad, in_prefix_len,
+                        ciphertext_and_tag_modified_in_place)
+}
+
+fn chunk_nonce(nonce_prefix: &[u8; NONCE_PREFIX_LEN], index: u32, last: bool)
+               -> [u8; aead::NONCE_LEN] {
+    let mut nonce = [0u8; aead::NONCE_LEN];
+    nonce[..NONCE_PREFIX_LEN].copy_from_slice(nonce_prefix);
+    nonce[NONCE_PREFIX_LEN..(NONCE_PREFIX_LEN + 4)]
+        .copy_from_slice(&polyfill::slice::be_u8_from_u32(index));
+    nonce[NONCE_PREFIX_LEN + 4] = last as u8;
+    nonce
+}
+
+// A message can't have more than 2**32 chunks, the last of which has index
+// `u32::max_value()`.
+fn next_index(index: u32) -> Result<u32, error::Unspecified> {
+    index.checked_add(1).ok_or(error::Unspecified)
+}
+
+#[cfg(test)]
+mod tests {
+    #[test]
+    fn test_chunk_nonce() {
+        let prefix = [1, 2, 3, 4, 5, 6, 7];
+        assert_eq!(super::chunk_nonce(&prefix, 0x0a0b0c0d, false),
+                   [1, 2, 3, 4, 5, 6, 7, 0x0a, 0x0b, 0x0c, 0x0d, 0]);
+        assert_eq!(super::chunk_nonce(&prefix, 0, true),
+                   [1, 2, 3, 4, 5, 6, 7, 0, 0, 0, 0, 1]);
+    }
+}
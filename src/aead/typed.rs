@@ -0,0 +1,331 @@
+// Copyright 2015-2016 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// AEAD algorithms chosen at compile time. The algorithm is a type instead of
+// a `&'static Algorithm`, so the algorithm's functions are called directly
+// instead of through function pointers, and each key holds exactly the
+// context its algorithm needs, inline, without the heap.
+
+use {aead, chacha, error, init, polyfill};
+use super::{aes_gcm, chacha20_poly1305, NONCE_LEN, TAG_LEN};
+
+/// An AEAD algorithm that is known at compile time: `Aes128Gcm`,
+/// `Aes256Gcm`, or `ChaCha20Poly1305`.
+///
+/// This trait is sealed; it is implemented only by those types.
+pub trait TypedAlgorithm: sealed::Algorithm {
+    /// The length of the key. Same as `aead::Algorithm::key_len()`.
+    const KEY_LEN: usize;
+
+    /// The length of a tag. Same as `aead::Algorithm::tag_len()`.
+    const TAG_LEN: usize = TAG_LEN;
+
+    /// The length of the nonces. Same as `aead::Algorithm::nonce_len()`.
+    const NONCE_LEN: usize = NONCE_LEN;
+
+    /// The equivalent `aead::Algorithm`.
+    fn algorithm() -> &'static aead::Algorithm;
+}
+
+mod sealed {
+    use error;
+    use super::super::{NONCE_LEN, TAG_LEN};
+
+    // These are like the fields of `aead::Algorithm`.
+    pub trait Algorithm {
+        /// The key context, which is always exactly as large as the
+        /// algorithm needs.
+        type KeyCtx;
+
+        fn new_ctx() -> Self::KeyCtx;
+        fn ctx(ctx: &Self::KeyCtx) -> &[u64];
+        fn ctx_mut(ctx: &mut Self::KeyCtx) -> &mut [u64];
+
+        fn init(ctx_buf: &mut [u8], key: &[u8])
+                -> Result<(), error::Unspecified>;
+
+        fn seal(ctx: &[u64], nonce: &[u8; NONCE_LEN], ad: &[u8],
+                in_out: &mut [u8], tag_out: &mut [u8; TAG_LEN])
+                -> Result<(), error::Unspecified>;
+
+        fn open(ctx: &[u64], nonce: &[u8; NONCE_LEN], ad: &[u8],
+                in_prefix_len: usize, in_out: &mut [u8],
+                tag_out: &mut [u8; TAG_LEN])
+                -> Result<(), error::Unspecified>;
+    }
+}
+
+macro_rules! typed_algorithm {
+    ( $name:ident, $dynamic:expr, $doc:expr, $key_len:expr,
+      $ctx_elems:expr, $init:path, $seal:path, $open:path ) => {
+        #[doc = $doc]
+        pub enum $name {}
+
+        impl TypedAlgorithm for $name {
+            const KEY_LEN: usize = $key_len;
+
+            #[inline(always)]
+            fn algorithm() -> &'static aead::Algorithm { &$dynamic }
+        }
+
+        impl sealed::Algorithm for $name {
+            type KeyCtx = [u64; $ctx_elems];
+
+            #[inline(always)]
+            fn new_ctx() -> Self::KeyCtx { [0; $ctx_elems] }
+
+            #[inline(always)]
+            fn ctx(ctx: &Self::KeyCtx) -> &[u64] { &ctx[..] }
+
+            #[inline(always)]
+            fn ctx_mut(ctx: &mut Self::KeyCtx) -> &mut [u64] { &mut ctx[..] }
+
+            #[inline(always)]
+            fn init(ctx_buf: &mut [u8], key: &[u8])
+                    -> Result<(), error::Unspecified> {
+                $init(ctx_buf, key)
+            }
+
+            #[inline(always)]
+            fn seal(ctx: &[u64], nonce: &[u8; NONCE_LEN], ad: &[u8],
+                    in_out: &mut [u8], tag_out: &mut [u8; TAG_LEN])
+                    -> Result<(), error::Unspecified> {
+                $seal(ctx, nonce, ad, in_out, tag_out)
+            }
+
+            #[inline(always)]
+            fn open(ctx: &[u64], nonce: &[u8; NONCE_LEN], ad: &[u8],
+                    in_prefix_len: usize, in_out: &mut [u8],
+                    tag_out: &mut [u8; TAG_LEN])
+                    -> Result<(), error::Unspecified> {
+                $open(ctx, nonce, ad, in_prefix_len, in_out, tag_out)
+            }
+        }
+    }
+}
+
+typed_algorithm!(Aes128Gcm, aead::AES_128_GCM,
+                 "AES-128 in GCM mode, like `aead::AES_128_GCM`.",
+                 aes_gcm::AES_128_KEY_LEN, aes_gcm::AES_KEY_CTX_BUF_ELEMS,
+                 aes_gcm::aes_gcm_init, aes_gcm::aes_gcm_seal,
+                 aes_gcm::aes_gcm_open);
+typed_algorithm!(Aes256Gcm, aead::AES_256_GCM,
+                 "AES-256 in GCM mode, like `aead::AES_256_GCM`.",
+                 aes_gcm::AES_256_KEY_LEN, aes_gcm::AES_KEY_CTX_BUF_ELEMS,
+                 aes_gcm::aes_gcm_init, aes_gcm::aes_gcm_seal,
+                 aes_gcm::aes_gcm_open);
+typed_algorithm!(ChaCha20Poly1305, aead::CHACHA20_POLY1305,
+                 "ChaCha20-Poly1305, like `aead::CHACHA20_POLY1305`.",
+                 chacha::KEY_LEN_IN_BYTES, chacha::KEY_LEN_IN_BYTES / 8,
+                 chacha20_poly1305::chacha20_poly1305_init,
+                 chacha20_poly1305::chacha20_poly1305_seal,
+                 chacha20_poly1305::chacha20_poly1305_open);
+
+/// A key for authenticating and decrypting (“opening”) AEAD-protected data
+/// with the algorithm `A`, e.g. `TypedOpeningKey<Aes128Gcm>`.
+///
+/// This is `OpeningKey` with the algorithm fixed at compile time. See
+/// `TypedSealingKey`.
+pub struct TypedOpeningKey<A: TypedAlgorithm> {
+    key: Key<A>,
+}
+
+impl<A: TypedAlgorithm> TypedOpeningKey<A> {
+    /// Create a new opening key.
+    ///
+    /// `key_bytes` must be exactly `A::KEY_LEN` bytes long.
+    #[inline]
+    pub fn new(key_bytes: &[u8])
+               -> Result<TypedOpeningKey<A>, error::Unspecified> {
+        Ok(TypedOpeningKey { key: Key::new(key_bytes)? })
+    }
+
+    /// The key's AEAD algorithm, i.e. `A::algorithm()`.
+    #[inline(always)]
+    pub fn algorithm(&self) -> &'static aead::Algorithm { A::algorithm() }
+}
+
+/// A key for encrypting and signing (“sealing”) data with the algorithm
+/// `A`, e.g. `TypedSealingKey<Aes128Gcm>`.
+///
+/// This is `SealingKey` with the algorithm fixed at compile time. The
+/// algorithm's functions are called directly instead of through the function
+/// pointers of an `Algorithm`, and the key holds exactly the context its
+/// algorithm needs, inline, without the heap. This matters most for short
+/// records, e.g. QUIC packets, where the indirection costs about as much as
+/// the cryptography itself.
+///
+/// # Examples
+///
+/// ```
+/// use ring::aead;
+///
+/// let key_bytes = [0u8; 16];
+/// let nonce = [0u8; 12];
+/// let s_key =
+///     aead::TypedSealingKey::<aead::Aes128Gcm>::new(&key_bytes).unwrap();
+/// let o_key =
+///     aead::TypedOpeningKey::<aead::Aes128Gcm>::new(&key_bytes).unwrap();
+///
+/// let mut in_out = *b"hello, world\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0";
+/// let out_len = aead::seal_in_place_typed(&s_key, &nonce, b"", &mut in_out,
+///                                         16).unwrap();
+/// assert_eq!(out_len, in_out.len());
+/// let plaintext = aead::open_in_place_typed(&o_key, &nonce, b"", 0,
+///                                           &mut in_out).unwrap();
+/// assert_eq!(&plaintext[..], &b"hello, world"[..]);
+/// ```
+pub struct TypedSealingKey<A: TypedAlgorithm> {
+    key: Key<A>,
+}
+
+impl<A: TypedAlgorithm> TypedSealingKey<A> {
+    /// Create a new sealing key.
+    ///
+    /// `key_bytes` must be exactly `A::KEY_LEN` bytes long.
+    #[inline]
+    pub fn new(key_bytes: &[u8])
+               -> Result<TypedSealingKey<A>, error::Unspecified> {
+        Ok(TypedSealingKey { key: Key::new(key_bytes)? })
+    }
+
+    /// The key's AEAD algorithm, i.e. `A::algorithm()`.
+    #[inline(always)]
+    pub fn algorithm(&self) -> &'static aead::Algorithm { A::algorithm() }
+}
+
+/// Authenticates and decrypts (“opens”) data in place, exactly like
+/// `open_in_place()`.
+#[inline]
+pub fn open_in_place_typed<'a, A: TypedAlgorithm>(
+        key: &TypedOpeningKey<A>, nonce: &[u8], ad: &[u8],
+        in_prefix_len: usize,
+        ciphertext_and_tag_modified_in_place: &'a mut [u8])
+        -> Result<&'a mut [u8], error::Unspecified> {
+    counted!(Open,
+             ciphertext_and_tag_modified_in_place.len()
+                .saturating_sub(in_prefix_len),
+             super::open_in_place_with(
+                nonce, in_prefix_len, ciphertext_and_tag_modified_in_place,
+                |nonce, in_prefix_len, in_out, calculated_tag| {
+                    A::open(A::ctx(&key.key.ctx), nonce, ad, in_prefix_len,
+                            in_out, calculated_tag)
+                }))
+}
+
+/// Encrypts and signs (“seals”) data in place, exactly like
+/// `seal_in_place()`.
+#[inline]
+pub fn seal_in_place_typed<A: TypedAlgorithm>(
+        key: &TypedSealingKey<A>, nonce: &[u8], ad: &[u8], in_out: &mut [u8],
+        out_suffix_capacity: usize) -> Result<usize, error::Unspecified> {
+    counted!(Seal, in_out.len().saturating_sub(out_suffix_capacity),
+             super::seal_in_place_with(
+                nonce, in_out, out_suffix_capacity,
+                |nonce, in_out, tag_out| {
+                    A::seal(A::ctx(&key.key.ctx), nonce, ad, in_out, tag_out)
+                }))
+}
+
+/// Like `aead::Key`, but the context is stored inline.
+struct Key<A: TypedAlgorithm> {
+    ctx: A::KeyCtx,
+}
+
+impl<A: TypedAlgorithm> Key<A> {
+    #[inline]
+    fn new(key_bytes: &[u8]) -> Result<Self, error::Unspecified> {
+        if key_bytes.len() != A::KEY_LEN {
+            return Err(error::Unspecified);
+        }
+        let mut r = Key { ctx: A::new_ctx() };
+        init::init_once();
+        {
+            let ctx_buf_bytes =
+                polyfill::slice::u64_as_u8_mut(A::ctx_mut(&mut r.ctx));
+            A::init(ctx_buf_bytes, key_bytes)?;
+        }
+        Ok(r)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use aead;
+    use std::vec::Vec;
+    use super::*;
+    use super::super::{NONCE_LEN, TAG_LEN};
+
+    // Checks that the typed API gives the same results as the dynamically-
+    // dispatched API, and that it rejects the same bad inputs.
+    fn test_typed<A: TypedAlgorithm>() {
+        let alg = A::algorithm();
+        assert_eq!(A::KEY_LEN, alg.key_len());
+        assert_eq!(A::TAG_LEN, alg.tag_len());
+        assert_eq!(A::NONCE_LEN, alg.nonce_len());
+
+        let key_bytes = (0..A::KEY_LEN).map(|i| i as u8).collect::<Vec<_>>();
+        assert!(TypedSealingKey::<A>::new(&key_bytes[1..]).is_err());
+        assert!(TypedOpeningKey::<A>::new(&key_bytes[1..]).is_err());
+        let s_key = TypedSealingKey::<A>::new(&key_bytes).unwrap();
+        let o_key = TypedOpeningKey::<A>::new(&key_bytes).unwrap();
+        assert!(s_key.algorithm() == alg);
+        assert!(o_key.algorithm() == alg);
+        let dynamic_s_key = aead::SealingKey::new(alg, &key_bytes).unwrap();
+
+        let nonce = [7u8; NONCE_LEN];
+        let ad = [1u8, 2, 3];
+        for &len in &[0, 1, 15, 16, 17, 63, 64, 65, 127, 128, 1000] {
+            let mut in_out = (0..len).map(|i| i as u8).collect::<Vec<_>>();
+            in_out.extend_from_slice(&[0u8; TAG_LEN]);
+            let mut expected = in_out.clone();
+            let expected_len =
+                aead::seal_in_place(&dynamic_s_key, &nonce, &ad,
+                                    &mut expected, TAG_LEN).unwrap();
+            let actual_len =
+                seal_in_place_typed(&s_key, &nonce, &ad, &mut in_out,
+                                    TAG_LEN).unwrap();
+            assert_eq!(actual_len, expected_len);
+            assert_eq!(in_out, expected);
+
+            assert!(seal_in_place_typed(&s_key, &nonce[1..], &ad,
+                                        &mut in_out, TAG_LEN).is_err());
+            assert!(seal_in_place_typed(&s_key, &nonce, &ad, &mut in_out,
+                                        TAG_LEN - 1).is_err());
+
+            {
+                let plaintext =
+                    open_in_place_typed(&o_key, &nonce, &ad, 0, &mut in_out)
+                        .unwrap();
+                assert_eq!(plaintext.len(), len);
+                for (i, b) in plaintext.iter().enumerate() {
+                    assert_eq!(*b, i as u8);
+                }
+            }
+
+            let mut bad_tag = expected.clone();
+            bad_tag[len] ^= 1;
+            assert!(open_in_place_typed(&o_key, &nonce, &ad, 0,
+                                        &mut bad_tag).is_err());
+            assert!(bad_tag[..len].iter().all(|b| *b == 0));
+        }
+    }
+
+    #[test]
+    fn typed_test() {
+        test_typed::<Aes128Gcm>();
+        test_typed::<Aes256Gcm>();
+        test_typed::<ChaCha20Poly1305>();
+    }
+}
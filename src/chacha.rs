@@ -65,6 +65,30 @@ pub fn chacha20_xor_inner(key: &Key, counter: &Counter, input: *const u8,
     }
 }
 
+/// Sets each element of `blocks` to the first block of the key stream for
+/// the matching element of `counters`, which may have unrelated nonces.
+pub fn chacha20_blocks(key: &Key, counters: &[Counter],
+                       blocks: &mut [[u8; BLOCK_LEN]]) {
+    assert_eq!(counters.len(), blocks.len());
+    for (counters, blocks) in counters.chunks(8).zip(blocks.chunks_mut(8)) {
+        #[cfg(target_arch = "x86_64")]
+        {
+            if counters.len() == 8 &&
+               unsafe { GFp_ChaCha20_avx2_capable() } == 1 {
+                unsafe {
+                    GFp_ChaCha20_blocks_x8_avx2(blocks.as_mut_ptr(), key,
+                                                counters.as_ptr());
+                }
+                continue;
+            }
+        }
+        for (counter, block) in counters.iter().zip(blocks.iter_mut()) {
+            *block = [0u8; BLOCK_LEN];
+            chacha20_xor_in_place(key, counter, block);
+        }
+    }
+}
+
 pub type Counter = [u32; 4];
 
 #[inline]
@@ -80,13 +104,22 @@ extern {
                           key: &Key, counter: &Counter);
 }
 
+#[cfg(target_arch = "x86_64")]
+extern {
+    fn GFp_ChaCha20_avx2_capable() -> c::int;
+    fn GFp_ChaCha20_blocks_x8_avx2(out: *mut [u8; BLOCK_LEN], key: &Key,
+                                   counters: *const Counter);
+}
+
 pub const KEY_LEN_IN_BYTES: usize = 256 / 8;
 
+pub const BLOCK_LEN: usize = 64;
+
 pub const NONCE_LEN: usize = 12; /* 96 bits */
 
 #[cfg(test)]
 mod tests {
-    use test;
+    use {std, test};
     use super::*;
     use super::GFp_ChaCha20_ctr32;
 
@@ -165,4 +198,24 @@ mod tests {
             }
         }
     }
+
+    #[test]
+    pub fn chacha20_blocks_test() {
+        let key = key_from_bytes(&[0x5a; KEY_LEN_IN_BYTES]);
+        for n in 0..20 {
+            let counters = (0..n).map(|i| {
+                let mut nonce = [0u8; NONCE_LEN];
+                nonce[NONCE_LEN - 1] = i as u8;
+                nonce[0] = 0x80 | (i as u8);
+                make_counter(&nonce, (i * 7) as u32)
+            }).collect::<std::vec::Vec<_>>();
+            let mut blocks = vec![[0u8; BLOCK_LEN]; n];
+            chacha20_blocks(&key, &counters, &mut blocks);
+            for (counter, block) in counters.iter().zip(blocks.iter()) {
+                let mut expected = [0u8; BLOCK_LEN];
+                chacha20_xor_in_place(&key, counter, &mut expected);
+                assert_eq!(&block[..], &expected[..]);
+            }
+        }
+    }
 }
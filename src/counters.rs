@@ -0,0 +1,361 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+//! Counters of the operations that *ring* does, for capacity planning.
+//!
+//! This module only exists when the `counters` feature is enabled. Without
+//! it, the operations aren't counted at all.
+//!
+//! Every call of `aead::seal_in_place`, `aead::open_in_place`,
+//! `signature::verify`, RSA signing, `agreement::agree_ephemeral`, and
+//! `digest::Context::finish` (and `digest::digest`) counts one call, its
+//! input length in bytes, and whether it failed. The counts are kept per
+//! thread, so counting doesn't contend between threads, and `snapshot()` adds
+//! up the counts of every thread, including the ones that have exited.
+//!
+//! Optionally, one call in every `sample_interval()` calls on each thread
+//! also measures how long the call took, in CPU cycles, into a histogram;
+//! see `set_sample_interval()`.
+
+use {core, polyfill};
+use core::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+use std;
+use std::sync::{Arc, Mutex};
+
+/// An operation that is counted.
+#[derive(Clone, Copy, Debug, Eq, PartialEq)]
+pub enum Operation {
+    /// `aead::seal_in_place`. The bytes are the plaintext.
+    Seal = 0,
+
+    /// `aead::open_in_place`. The bytes are the ciphertext.
+    Open = 1,
+
+    /// `signature::verify`. The bytes are the message.
+    Verify = 2,
+
+    /// `signature::RSASigningState::sign` and
+    /// `signature::RSASharedSigningState::sign`, and their `sign_concurrent`.
+    /// The bytes are the message.
+    RsaSign = 3,
+
+    /// `agreement::agree_ephemeral`. The bytes are the peer's public key.
+    Agree = 4,
+
+    /// `digest::Context::finish` and `digest::digest`. The bytes are the
+    /// digested data.
+    DigestFinish = 5,
+}
+
+/// Every `Operation`, in the order they are declared.
+pub static ALL_OPERATIONS: [Operation; OPERATIONS] = [
+    Operation::Seal,
+    Operation::Open,
+    Operation::Verify,
+    Operation::RsaSign,
+    Operation::Agree,
+    Operation::DigestFinish,
+];
+
+const OPERATIONS: usize = 6;
+
+/// The number of buckets in a cycle-count histogram. Bucket `i` counts the
+/// sampled calls that took from 2<sup>i</sup> up to 2<sup>i+1</sup> cycles;
+/// bucket zero also counts the ones that took no cycles and the last bucket
+/// also counts all the longer ones.
+pub const HISTOGRAM_LEN: usize = 32;
+
+/// Samples the duration of one in every `interval` calls on each thread, or
+/// none of them when `interval` is zero, which is the default.
+///
+/// The duration is in CPU cycles from the time stamp counter on x86 and
+/// x86-64, and in nanoseconds elsewhere.
+pub fn set_sample_interval(interval: usize) {
+    SAMPLE_INTERVAL.store(interval, Ordering::Relaxed);
+}
+
+/// The interval set by `set_sample_interval()`.
+pub fn sample_interval() -> usize { SAMPLE_INTERVAL.load(Ordering::Relaxed) }
+
+static SAMPLE_INTERVAL: AtomicUsize = AtomicUsize::new(0);
+
+/// The counts of one `Operation`.
+#[derive(Clone, Copy, Debug)]
+pub struct Stats {
+    calls: u64,
+    bytes: u64,
+    failures: u64,
+    cycles: [u64; HISTOGRAM_LEN],
+}
+
+impl Stats {
+    /// The number of calls.
+    #[inline]
+    pub fn calls(&self) -> u64 { self.calls }
+
+    /// The total input length of the calls.
+    #[inline]
+    pub fn bytes(&self) -> u64 { self.bytes }
+
+    /// The number of calls that returned an error.
+    #[inline]
+    pub fn failures(&self) -> u64 { self.failures }
+
+    /// The histogram of the durations of the sampled calls; see
+    /// `HISTOGRAM_LEN`.
+    #[inline]
+    pub fn cycles_histogram(&self) -> &[u64; HISTOGRAM_LEN] { &self.cycles }
+}
+
+/// The counts of every `Operation` at the time `snapshot()` was called.
+#[derive(Clone, Debug)]
+pub struct Snapshot {
+    stats: [Stats; OPERATIONS],
+}
+
+impl Snapshot {
+    /// The counts of `operation`.
+    #[inline]
+    pub fn get(&self, operation: Operation) -> &Stats {
+        &self.stats[operation as usize]
+    }
+}
+
+/// Adds up the counts of every thread.
+///
+/// The counts of threads that are still counting may be a few calls out of
+/// date for other threads, and the fields of an `Operation`'s `Stats` may
+/// not be from the same instant.
+pub fn snapshot() -> Snapshot {
+    let mut result = Snapshot {
+        stats: [Stats {
+            calls: 0,
+            bytes: 0,
+            failures: 0,
+            cycles: [0; HISTOGRAM_LEN],
+        }; OPERATIONS],
+    };
+    let threads = registry().lock().unwrap();
+    for thread in threads.iter() {
+        for (stats, counters) in result.stats.iter_mut()
+                                             .zip(thread.operations.iter()) {
+            stats.calls += counters.calls.load(Ordering::Relaxed);
+            stats.bytes += counters.bytes.load(Ordering::Relaxed);
+            stats.failures += counters.failures.load(Ordering::Relaxed);
+            for (a, b) in stats.cycles.iter_mut()
+                                      .zip(counters.cycles.iter()) {
+                *a += b.load(Ordering::Relaxed);
+            }
+        }
+    }
+    result
+}
+
+// Only the owning thread writes its counters, so they are updated with a
+// relaxed load and store instead of a (locked) read-modify-write; the
+// atomics only make `snapshot()`'s reads from other threads well-defined.
+#[derive(Default)]
+struct Counters {
+    calls: AtomicU64,
+    bytes: AtomicU64,
+    failures: AtomicU64,
+    cycles: [AtomicU64; HISTOGRAM_LEN],
+}
+
+#[inline]
+fn add(counter: &AtomicU64, value: u64) {
+    let sum = counter.load(Ordering::Relaxed).wrapping_add(value);
+    counter.store(sum, Ordering::Relaxed);
+}
+
+#[derive(Default)]
+struct ThreadCounters {
+    operations: [Counters; OPERATIONS],
+}
+
+thread_local! {
+    static THREAD_COUNTERS: Arc<ThreadCounters> = {
+        let counters = Arc::new(ThreadCounters::default());
+        registry().lock().unwrap().push(counters.clone());
+        counters
+    };
+}
+
+// The counters of every thread that has counted anything. They are never
+// removed, so that the counts of exited threads are kept.
+#[allow(box_pointers)]
+fn registry() -> &'static Mutex<std::vec::Vec<Arc<ThreadCounters>>> {
+    static INIT: std::sync::Once = std::sync::ONCE_INIT;
+    static mut REGISTRY:
+        *const Mutex<std::vec::Vec<Arc<ThreadCounters>>> = core::ptr::null();
+    INIT.call_once(|| unsafe {
+        REGISTRY = std::boxed::Box::into_raw(
+            std::boxed::Box::new(Mutex::new(std::vec::Vec::new())));
+    });
+    unsafe { &*REGISTRY }
+}
+
+/// The time stamp of the start of a call that is being sampled.
+#[doc(hidden)]
+pub struct Start(Option<u64>);
+
+/// Called by `counted!` before the call; don't use this directly.
+#[doc(hidden)]
+#[inline]
+pub fn start(operation: Operation) -> Start {
+    let interval = SAMPLE_INTERVAL.load(Ordering::Relaxed);
+    if interval == 0 {
+        return Start(None);
+    }
+    let sampled = THREAD_COUNTERS.with(|counters| {
+        let calls = counters.operations[operation as usize].calls
+            .load(Ordering::Relaxed);
+        calls % polyfill::u64_from_usize(interval) == 0
+    });
+    Start(if sampled { Some(now()) } else { None })
+}
+
+/// Called by `counted!` after the call; don't use this directly.
+#[doc(hidden)]
+#[inline]
+pub fn finish<L: Len>(operation: Operation, len: L, start: Start, ok: bool) {
+    let elapsed = start.0.map(|start| now().wrapping_sub(start));
+    THREAD_COUNTERS.with(|counters| {
+        let counters = &counters.operations[operation as usize];
+        add(&counters.calls, 1);
+        add(&counters.bytes, len.into_u64());
+        if !ok {
+            add(&counters.failures, 1);
+        }
+        if let Some(elapsed) = elapsed {
+            add(&counters.cycles[bucket(elapsed)], 1);
+        }
+    });
+}
+
+/// An input length; digests count theirs in a `u64`.
+#[doc(hidden)]
+pub trait Len {
+    /// The length.
+    fn into_u64(self) -> u64;
+}
+
+impl Len for usize {
+    #[inline]
+    fn into_u64(self) -> u64 { polyfill::u64_from_usize(self) }
+}
+
+impl Len for u64 {
+    #[inline]
+    fn into_u64(self) -> u64 { self }
+}
+
+fn bucket(elapsed: u64) -> usize {
+    let log2 = 63 - (elapsed | 1).leading_zeros() as usize;
+    core::cmp::min(log2, HISTOGRAM_LEN - 1)
+}
+
+#[cfg(target_arch = "x86_64")]
+#[inline]
+fn now() -> u64 { unsafe { core::arch::x86_64::_rdtsc() } }
+
+#[cfg(target_arch = "x86")]
+#[inline]
+fn now() -> u64 { unsafe { core::arch::x86::_rdtsc() } }
+
+#[cfg(not(any(target_arch = "x86", target_arch = "x86_64")))]
+fn now() -> u64 {
+    use std::time::Instant;
+    static INIT: std::sync::Once = std::sync::ONCE_INIT;
+    static mut EPOCH: Option<Instant> = None;
+    INIT.call_once(|| unsafe { EPOCH = Some(Instant::now()); });
+    let elapsed = unsafe { EPOCH.unwrap() }.elapsed();
+    elapsed.as_secs().wrapping_mul(1_000_000_000)
+        .wrapping_add(u64::from(elapsed.subsec_nanos()))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use {aead, digest};
+    use std;
+
+    #[test]
+    fn test_bucket() {
+        assert_eq!(bucket(0), 0);
+        assert_eq!(bucket(1), 0);
+        assert_eq!(bucket(2), 1);
+        assert_eq!(bucket(3), 1);
+        assert_eq!(bucket(1 << 20), 20);
+        assert_eq!(bucket((1 << 21) - 1), 20);
+        assert_eq!(bucket(core::u64::MAX), HISTOGRAM_LEN - 1);
+    }
+
+    // Other tests may count in parallel, so this only checks that the
+    // counts grew by at least the calls made here, on a new thread whose own
+    // counts are exactly known.
+    #[test]
+    fn test_counters() {
+        let before = snapshot();
+        std::thread::spawn(|| {
+            let key = aead::SealingKey::new(&aead::CHACHA20_POLY1305,
+                                            &[0; 32]).unwrap();
+            let nonce = [0; 12];
+            let mut in_out = [0u8; 100 + 16];
+            assert!(aead::seal_in_place(&key, &nonce, &[], &mut in_out, 16)
+                        .is_ok());
+            assert!(aead::seal_in_place(&key, &nonce, &[], &mut in_out, 8)
+                        .is_err());
+
+            let key = aead::OpeningKey::new(&aead::CHACHA20_POLY1305,
+                                            &[0; 32]).unwrap();
+            in_out[0] ^= 1;
+            assert!(aead::open_in_place(&key, &nonce, &[], 0, &mut in_out)
+                        .is_err());
+
+            let _ = digest::digest(&digest::SHA256, &[0; 1000]);
+
+            set_sample_interval(1);
+            let mut ctx = digest::Context::new(&digest::SHA256);
+            ctx.update(&[0; 100]);
+            let _ = ctx.finish();
+            set_sample_interval(0);
+
+            THREAD_COUNTERS.with(|counters| {
+                let seal = &counters.operations[Operation::Seal as usize];
+                assert_eq!(seal.calls.load(Ordering::Relaxed), 2);
+                assert_eq!(seal.bytes.load(Ordering::Relaxed), 100 + 108);
+                assert_eq!(seal.failures.load(Ordering::Relaxed), 1);
+                let open = &counters.operations[Operation::Open as usize];
+                assert_eq!(open.calls.load(Ordering::Relaxed), 1);
+                assert_eq!(open.bytes.load(Ordering::Relaxed), 116);
+                assert_eq!(open.failures.load(Ordering::Relaxed), 1);
+                let digest =
+                    &counters.operations[Operation::DigestFinish as usize];
+                assert_eq!(digest.calls.load(Ordering::Relaxed), 2);
+                assert_eq!(digest.bytes.load(Ordering::Relaxed), 1100);
+                let samples: u64 = digest.cycles.iter()
+                    .map(|count| count.load(Ordering::Relaxed)).sum();
+                assert_eq!(samples, 1);
+            });
+        }).join().unwrap();
+        let after = snapshot();
+        let seal_before = before.get(Operation::Seal);
+        let seal_after = after.get(Operation::Seal);
+        assert!(seal_after.calls() >= seal_before.calls() + 2);
+        assert!(seal_after.failures() >= seal_before.failures() + 1);
+        assert!(after.get(Operation::DigestFinish).bytes() >=
+                before.get(Operation::DigestFinish).bytes() + 1000);
+    }
+}
@@ -0,0 +1,555 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+//! The implementations that *ring* chooses for the CPU it is running on.
+//!
+//! *ring* detects the features of the CPU once, the first time they are
+//! needed, and then the C and assembly language code of each primitive uses
+//! the fastest implementation that the detected features allow. `backend()`
+//! reports which one that is for each `Primitive`.
+//!
+//! `limit()` and the `RING_CPU_TIER` environment variable make *ring* ignore
+//! the features of the CPU above a `Tier`, so that the implementations for
+//! less capable CPUs can be tested and benchmarked on a more capable one, or
+//! to avoid an implementation that misbehaves on some CPU. Either must take
+//! effect before the features are detected, i.e. before any key is
+//! constructed and before any digest is computed, because implementations
+//! that were already chosen can't be changed. `RING_CPU_TIER` is one of
+//! "baseline", "simd", "crypto-extensions", "avx", "avx2", and "avx512";
+//! other values are ignored. When both are set, the lower tier is used.
+//!
+//! On iOS, and with the `static_cpu_features` feature, the features are
+//! fixed when *ring* is compiled, so they can't be limited.
+
+// `apply_limit` and what it uses are dead when the features are fixed.
+#![cfg_attr(any(target_os = "ios", feature = "static_cpu_features"),
+            allow(dead_code))]
+
+use {error, init};
+use core;
+use core::sync::atomic::{AtomicUsize, Ordering};
+use std;
+
+/// A set of CPU features, each tier including the ones below it.
+///
+/// The tiers above `CryptoExtensions` only exist on x86 and x86-64, and on
+/// other architectures they are the same as `CryptoExtensions`.
+#[derive(Clone, Copy, Debug, Eq, Ord, PartialEq, PartialOrd)]
+pub enum Tier {
+    /// No optional features: only the instructions that every CPU of the
+    /// architecture has, e.g. SSE2 on x86-64.
+    Baseline = 0,
+
+    /// SSSE3 and SSE4 on x86 and x86-64; NEON on ARM and AArch64.
+    Simd = 1,
+
+    /// AES-NI, PCLMULQDQ, and the SHA extensions on x86 and x86-64; the
+    /// ARMv8 AES, PMULL, SHA-1, and SHA-256 instructions on ARM and AArch64.
+    CryptoExtensions = 2,
+
+    /// AVX, FMA, and MOVBE.
+    Avx = 3,
+
+    /// AVX2, BMI1, BMI2, and ADX.
+    Avx2 = 4,
+
+    /// AVX-512 (F, DQ, IFMA, CD, BW, and VL), VAES, and VPCLMULQDQ; i.e.
+    /// every feature that *ring* uses.
+    Avx512 = 5,
+}
+
+impl Tier {
+    fn from_env_value(value: &str) -> Option<Tier> {
+        match value {
+            "baseline" => Some(Tier::Baseline),
+            "simd" => Some(Tier::Simd),
+            "crypto-extensions" => Some(Tier::CryptoExtensions),
+            "avx" => Some(Tier::Avx),
+            "avx2" => Some(Tier::Avx2),
+            "avx512" => Some(Tier::Avx512),
+            _ => None,
+        }
+    }
+
+    fn from_index(index: usize) -> Tier {
+        match index {
+            0 => Tier::Baseline,
+            1 => Tier::Simd,
+            2 => Tier::CryptoExtensions,
+            3 => Tier::Avx,
+            4 => Tier::Avx2,
+            _ => Tier::Avx512,
+        }
+    }
+}
+
+/// Makes *ring* ignore the features of the CPU above `tier`.
+///
+/// This fails if the features have already been detected, and always when
+/// they are fixed at compile time. When it is called more than once, the
+/// lowest tier is used.
+pub fn limit(tier: Tier) -> Result<(), error::Unspecified> {
+    if cfg!(any(target_os = "ios", feature = "static_cpu_features")) {
+        return Err(error::Unspecified);
+    }
+    loop {
+        let current = LIMIT.load(Ordering::Acquire);
+        if current == DETECTED {
+            return Err(error::Unspecified);
+        }
+        let new = match current {
+            NO_LIMIT => tier as usize,
+            current => core::cmp::min(current, tier as usize),
+        };
+        if LIMIT.compare_exchange(current, new, Ordering::AcqRel,
+                                  Ordering::Acquire).is_ok() {
+            return Ok(());
+        }
+    }
+}
+
+static LIMIT: AtomicUsize = AtomicUsize::new(NO_LIMIT);
+const NO_LIMIT: usize = core::usize::MAX - 1;
+const DETECTED: usize = core::usize::MAX;
+
+/// Clears the detected features above the requested tier. This must only be
+/// called by `init::init_once`, right after the features are detected.
+pub(crate) fn apply_limit() {
+    let limit = LIMIT.swap(DETECTED, Ordering::AcqRel);
+    let from_env = std::env::var("RING_CPU_TIER").ok()
+        .and_then(|value| Tier::from_env_value(&value));
+    let tier = match (limit, from_env) {
+        (NO_LIMIT, None) => { return; },
+        (NO_LIMIT, Some(tier)) => tier,
+        (limit, None) => Tier::from_index(limit),
+        (limit, Some(tier)) =>
+            core::cmp::min(Tier::from_index(limit), tier),
+    };
+    for bits in &TIER_FEATURES[(tier as usize)..] {
+        for &feature in bits.iter() {
+            clear(feature);
+        }
+    }
+}
+
+/// A primitive with more than one implementation.
+#[derive(Clone, Copy, Debug, Eq, PartialEq)]
+pub enum Primitive {
+    /// The AES block cipher, in particular AES-CTR for AES-GCM.
+    Aes,
+
+    /// The GHASH function of AES-GCM. When it is "vaes-avx512" or
+    /// "aesni-avx", AES-GCM is computed with a combined AES-CTR and GHASH
+    /// kernel.
+    Ghash,
+
+    /// The ChaCha20 stream cipher.
+    ChaCha20,
+
+    /// The Poly1305 MAC.
+    Poly1305,
+
+    /// The SHA-1 block function.
+    Sha1,
+
+    /// The SHA-256 block function.
+    Sha256,
+
+    /// The SHA-384 and SHA-512 block function.
+    Sha512,
+
+    /// X25519 and the Edwards25519 point arithmetic of Ed25519.
+    Curve25519,
+
+    /// The P-256 field arithmetic.
+    P256,
+
+    /// The P-384 field arithmetic.
+    P384,
+
+    /// The Montgomery multiplication and exponentiation of RSA.
+    Rsa,
+}
+
+/// Every `Primitive`, in the order they are declared.
+pub static ALL_PRIMITIVES: [Primitive; 11] = [
+    Primitive::Aes,
+    Primitive::Ghash,
+    Primitive::ChaCha20,
+    Primitive::Poly1305,
+    Primitive::Sha1,
+    Primitive::Sha256,
+    Primitive::Sha512,
+    Primitive::Curve25519,
+    Primitive::P256,
+    Primitive::P384,
+    Primitive::Rsa,
+];
+
+/// The name of the implementation of `primitive` that *ring* uses on this
+/// CPU, e.g. "aesni" or "avx2". It is "generic" when no optional CPU
+/// features are used.
+///
+/// Some primitives only use the named implementation for inputs that are
+/// long enough, or for the key sizes it supports, and fall back to a less
+/// capable one otherwise; e.g. ChaCha20 only uses AVX2 for inputs longer
+/// than a few blocks and RSA's "avx512-ifma" implementation only is for
+/// 2048-, 3072-, and 4096-bit moduli.
+pub fn backend(primitive: Primitive) -> &'static str {
+    init::init_once();
+    arch::backend(primitive)
+}
+
+// A feature bit of the detected features: the index of its word in
+// `GFp_ia32cap_P`, or zero for `GFp_armcap_P`, and the bit mask.
+#[derive(Clone, Copy)]
+struct Feature(usize, u32);
+
+fn has(features: &[Feature]) -> bool {
+    features.iter().all(|&Feature(index, mask)| word(index) & mask == mask)
+}
+
+#[cfg(any(target_arch = "x86", target_arch = "x86_64"))]
+extern {
+    static mut GFp_ia32cap_P: [u32; 4];
+}
+
+#[cfg(any(target_arch = "x86", target_arch = "x86_64"))]
+fn word(index: usize) -> u32 { unsafe { GFp_ia32cap_P[index] } }
+
+#[cfg(any(target_arch = "x86", target_arch = "x86_64"))]
+fn clear(Feature(index, mask): Feature) {
+    unsafe { GFp_ia32cap_P[index] &= !mask; }
+}
+
+#[cfg(any(target_arch = "arm", target_arch = "aarch64"))]
+extern {
+    static mut GFp_armcap_P: u32;
+}
+
+#[cfg(any(target_arch = "arm", target_arch = "aarch64"))]
+fn word(_index: usize) -> u32 { unsafe { GFp_armcap_P } }
+
+#[cfg(any(target_arch = "arm", target_arch = "aarch64"))]
+fn clear(Feature(_index, mask): Feature) {
+    unsafe { GFp_armcap_P &= !mask; }
+}
+
+#[cfg(not(any(target_arch = "x86", target_arch = "x86_64",
+              target_arch = "arm", target_arch = "aarch64")))]
+fn word(_index: usize) -> u32 { 0 }
+
+#[cfg(not(any(target_arch = "x86", target_arch = "x86_64",
+              target_arch = "arm", target_arch = "aarch64")))]
+fn clear(_feature: Feature) {}
+
+// The features that each tier above `Tier::Baseline` adds to the one below
+// it, which `apply_limit` clears.
+const TIER_FEATURES: [&'static [Feature]; 5] = [
+    arch::SIMD,
+    arch::CRYPTO_EXTENSIONS,
+    arch::AVX,
+    arch::AVX2,
+    arch::AVX512,
+];
+
+#[cfg(any(target_arch = "x86", target_arch = "x86_64"))]
+mod arch {
+    #[cfg(target_arch = "x86_64")]
+    use c;
+    use super::{Feature, Primitive, has};
+
+    // The bits of `GFp_ia32cap_P`; see include/GFp/cpu.h.
+    const FXSR: Feature = Feature(0, 1 << 24);
+    const SSE2: Feature = Feature(0, 1 << 26);
+    const INTEL: Feature = Feature(0, 1 << 30);
+    const PCLMULQDQ: Feature = Feature(1, 1 << 1);
+    const SSSE3: Feature = Feature(1, 1 << 9);
+    const XOP: Feature = Feature(1, 1 << 11);
+    const FMA: Feature = Feature(1, 1 << 12);
+    const SSE41: Feature = Feature(1, 1 << 19);
+    const SSE42: Feature = Feature(1, 1 << 20);
+    const MOVBE: Feature = Feature(1, 1 << 22);
+    const AES: Feature = Feature(1, 1 << 25);
+    const AVX_: Feature = Feature(1, 1 << 28);
+    const BMI1: Feature = Feature(2, 1 << 3);
+    const AVX2_: Feature = Feature(2, 1 << 5);
+    const BMI2: Feature = Feature(2, 1 << 8);
+    const AVX512F: Feature = Feature(2, 1 << 16);
+    const AVX512DQ: Feature = Feature(2, 1 << 17);
+    const ADX: Feature = Feature(2, 1 << 19);
+    const AVX512IFMA: Feature = Feature(2, 1 << 21);
+    const AVX512CD: Feature = Feature(2, 1 << 28);
+    const SHA: Feature = Feature(2, 1 << 29);
+    const AVX512BW: Feature = Feature(2, 1 << 30);
+    const AVX512VL: Feature = Feature(2, 1 << 31);
+    const VAES: Feature = Feature(3, 1 << 9);
+    const VPCLMULQDQ: Feature = Feature(3, 1 << 10);
+
+    pub const SIMD: &'static [Feature] = &[SSSE3, SSE41, SSE42];
+    pub const CRYPTO_EXTENSIONS: &'static [Feature] = &[AES, PCLMULQDQ, SHA];
+    pub const AVX: &'static [Feature] = &[AVX_, FMA, XOP, MOVBE];
+    pub const AVX2: &'static [Feature] = &[AVX2_, BMI1, BMI2, ADX];
+    pub const AVX512: &'static [Feature] = &[
+        AVX512F, AVX512DQ, AVX512IFMA, AVX512CD, AVX512BW, AVX512VL, VAES,
+        VPCLMULQDQ,
+    ];
+
+    // These mirror the choices made in crypto/cipher/e_aes.c,
+    // crypto/modes/gcm.c, crypto/fipsmodule/sha/sha1.c, and the
+    // `GFp_ia32cap_P` tests at the start of the assembly language functions.
+    pub fn backend(primitive: Primitive) -> &'static str {
+        let x86_64 = cfg!(target_arch = "x86_64");
+        match primitive {
+            Primitive::Aes => {
+                if has(&[AES]) {
+                    "aesni"
+                } else if has(&[SSSE3]) {
+                    if x86_64 { "bsaes" } else { "vpaes" }
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::Ghash => {
+                if !has(&[FXSR, PCLMULQDQ]) {
+                    "generic"
+                } else if x86_64 && has(&[AVX_, MOVBE]) {
+                    if !has(&[AES]) {
+                        "avx"
+                    } else if vaes_avx512_capable() {
+                        "vaes-avx512"
+                    } else {
+                        "aesni-avx"
+                    }
+                } else {
+                    "clmul"
+                }
+            },
+            Primitive::ChaCha20 => {
+                if x86_64 && has(&[SSSE3, AVX2_]) {
+                    "avx2"
+                } else if has(&[SSSE3]) {
+                    "ssse3"
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::Poly1305 => {
+                if !x86_64 {
+                    if has(&[FXSR, SSE2]) { "sse2" } else { "generic" }
+                } else if has(&[AVX512F, AVX512IFMA]) {
+                    "avx512-ifma"
+                } else if has(&[AVX2_]) {
+                    "avx2"
+                } else if has(&[AVX_]) {
+                    "avx"
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::Sha1 => {
+                if !x86_64 {
+                    "generic"
+                } else if has(&[SHA, SSSE3, SSE41]) {
+                    "shaext"
+                } else if has(&[SSSE3]) {
+                    "ssse3"
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::Sha256 => {
+                if x86_64 {
+                    if has(&[SHA]) {
+                        "shaext"
+                    } else if has(&[BMI1, AVX2_, BMI2]) {
+                        "avx2"
+                    } else if has(&[INTEL, AVX_, SSSE3]) {
+                        "avx"
+                    } else if has(&[SSSE3]) {
+                        "ssse3"
+                    } else {
+                        "generic"
+                    }
+                } else if !has(&[FXSR]) {
+                    "generic"
+                } else if has(&[SHA]) {
+                    "shaext"
+                } else if has(&[INTEL, AVX_]) {
+                    "avx"
+                } else if has(&[SSSE3]) {
+                    "ssse3"
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::Sha512 => {
+                if !x86_64 {
+                    if has(&[SSE2]) { "sse2" } else { "generic" }
+                } else if has(&[BMI1, AVX2_, BMI2]) {
+                    "avx2"
+                } else if has(&[INTEL, AVX_, SSSE3]) {
+                    "avx"
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::Curve25519 => {
+                if x86_64 && has(&[AVX2_]) { "avx2" } else { "generic" }
+            },
+            Primitive::P256 | Primitive::P384 => {
+                if x86_64 && has(&[BMI2, ADX]) { "adx" } else { "generic" }
+            },
+            Primitive::Rsa => {
+                if !x86_64 {
+                    if has(&[SSE2]) { "sse2" } else { "generic" }
+                } else if has(&[AVX512F, AVX512IFMA]) {
+                    "avx512-ifma"
+                } else if has(&[BMI2, ADX]) {
+                    "adx"
+                } else {
+                    "generic"
+                }
+            },
+        }
+    }
+
+    #[cfg(target_arch = "x86_64")]
+    fn vaes_avx512_capable() -> bool {
+        unsafe { GFp_gcm_vaes_avx512_capable() == 1 }
+    }
+
+    #[cfg(target_arch = "x86")]
+    fn vaes_avx512_capable() -> bool { false }
+
+    #[cfg(target_arch = "x86_64")]
+    extern {
+        fn GFp_gcm_vaes_avx512_capable() -> c::int;
+    }
+}
+
+#[cfg(any(target_arch = "arm", target_arch = "aarch64"))]
+mod arch {
+    use super::{Feature, Primitive, has};
+
+    // The bits of `GFp_armcap_P`; see include/GFp/arm_arch.h.
+    const NEON: Feature = Feature(0, 1 << 0);
+    const AES: Feature = Feature(0, 1 << 2);
+    const SHA1: Feature = Feature(0, 1 << 3);
+    const SHA256: Feature = Feature(0, 1 << 4);
+    const PMULL: Feature = Feature(0, 1 << 5);
+
+    pub const SIMD: &'static [Feature] = &[NEON];
+    pub const CRYPTO_EXTENSIONS: &'static [Feature] =
+        &[AES, SHA1, SHA256, PMULL];
+    pub const AVX: &'static [Feature] = &[];
+    pub const AVX2: &'static [Feature] = &[];
+    pub const AVX512: &'static [Feature] = &[];
+
+    // These mirror the choices made in crypto/cipher/e_aes.c,
+    // crypto/modes/gcm.c, and the `GFp_armcap_P` tests at the start of the
+    // assembly language functions.
+    pub fn backend(primitive: Primitive) -> &'static str {
+        let arm = cfg!(target_arch = "arm");
+        match primitive {
+            Primitive::Aes => {
+                if has(&[AES]) {
+                    "armv8"
+                } else if arm && has(&[NEON]) {
+                    "bsaes"
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::Ghash => {
+                if has(&[PMULL]) {
+                    "pmull"
+                } else if arm && has(&[NEON]) {
+                    "neon"
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::ChaCha20 | Primitive::Poly1305 | Primitive::Sha512 => {
+                if has(&[NEON]) && (arm || primitive != Primitive::Sha512) {
+                    "neon"
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::Sha256 => {
+                if has(&[SHA256]) {
+                    "armv8"
+                } else if arm && has(&[NEON]) {
+                    "neon"
+                } else {
+                    "generic"
+                }
+            },
+            Primitive::Curve25519 | Primitive::Rsa => {
+                if arm && has(&[NEON]) { "neon" } else { "generic" }
+            },
+            Primitive::P256 | Primitive::P384 | Primitive::Sha1 => "generic",
+        }
+    }
+}
+
+#[cfg(not(any(target_arch = "x86", target_arch = "x86_64",
+              target_arch = "arm", target_arch = "aarch64")))]
+mod arch {
+    use super::{Feature, Primitive};
+
+    pub const SIMD: &'static [Feature] = &[];
+    pub const CRYPTO_EXTENSIONS: &'static [Feature] = &[];
+    pub const AVX: &'static [Feature] = &[];
+    pub const AVX2: &'static [Feature] = &[];
+    pub const AVX512: &'static [Feature] = &[];
+
+    pub fn backend(_primitive: Primitive) -> &'static str { "generic" }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_limit_after_detection() {
+        assert!(backend(Primitive::Aes).len() > 0);
+        assert!(limit(Tier::Avx512).is_err());
+        assert!(limit(Tier::Baseline).is_err());
+    }
+
+    #[test]
+    fn test_backends() {
+        for &primitive in ALL_PRIMITIVES.iter() {
+            let name = backend(primitive);
+            assert!(name.len() > 0);
+            assert!(name.bytes().all(|b| (b >= b'a' && b <= b'z') ||
+                                         (b >= b'0' && b <= b'9') ||
+                                         b == b'-'));
+        }
+    }
+
+    #[test]
+    fn test_tier_from_env_value() {
+        for &tier in [Tier::Baseline, Tier::Simd, Tier::CryptoExtensions,
+                      Tier::Avx, Tier::Avx2, Tier::Avx512].iter() {
+            assert_eq!(Tier::from_index(tier as usize), tier);
+        }
+        assert_eq!(Tier::from_env_value("crypto-extensions"),
+                   Some(Tier::CryptoExtensions));
+        assert_eq!(Tier::from_env_value("AVX2"), None);
+        assert_eq!(Tier::from_env_value(""), None);
+    }
+}
@@ -38,13 +38,22 @@ fn parity(x: W32, y: W32, z: W32) -> W32 { x ^ y ^ z }
 #[inline]
 fn maj(x: W32, y: W32, z: W32) -> W32 { (x & y) | (x & z) | (y & z) }
 
-/// The main purpose in retaining this is to support legacy protocols and OCSP,
-/// none of which need a fast SHA-1 implementation.
-/// This implementation therefore favors size and simplicity over speed.
-/// Unlike SHA-256, SHA-384, and SHA-512,
-/// there is no assembly language implementation.
+/// Uses the SHA-1 instructions of the CPU, or SSSE3, when available; see
+/// crypto/fipsmodule/sha/sha1.c. Otherwise falls back to the portable
+/// implementation below, which favors size and simplicity over speed.
 pub unsafe extern fn block_data_order(state: &mut State,
                                       data: *const u8, num: c::size_t) {
+    let done = {
+        let state = polyfill::slice::u64_as_u32_mut(state);
+        GFp_sha1_block_data_order_simd(state.as_mut_ptr(), data, num)
+    };
+    if done == 0 {
+        block_data_order_portable(state, data, num)
+    }
+}
+
+unsafe fn block_data_order_portable(state: &mut State, data: *const u8,
+                                    num: c::size_t) {
     let data = data as *const [u8; BLOCK_LEN];
     let blocks = core::slice::from_raw_parts(data, num);
     block_data_order_safe(state, blocks)
@@ -97,3 +106,34 @@ fn block_data_order_safe(state: &mut State, blocks: &[[u8; BLOCK_LEN]]) {
         state[4] = state[4] + e;
     }
 }
+
+extern {
+    fn GFp_sha1_block_data_order_simd(state: *mut u32, data: *const u8,
+                                      num: c::size_t) -> c::int;
+}
+
+#[cfg(test)]
+mod tests {
+    use {digest, init};
+    use super::*;
+
+    // The accelerated implementation, when there is one, must agree with the
+    // portable one, which the digest tests don't exercise on such CPUs.
+    #[test]
+    fn test_block_data_order_portable() {
+        init::init_once();
+        let mut input = [0u8; 7 * BLOCK_LEN];
+        for (i, b) in input.iter_mut().enumerate() {
+            *b = i as u8;
+        }
+        for num in 0..7 {
+            let mut expected = digest::SHA1.initial_state;
+            let mut actual = digest::SHA1.initial_state;
+            unsafe {
+                block_data_order(&mut expected, input.as_ptr(), num);
+                block_data_order_portable(&mut actual, input.as_ptr(), num);
+            }
+            assert_eq!(&expected[..], &actual[..]);
+        }
+    }
+}
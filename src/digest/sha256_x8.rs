@@ -0,0 +1,280 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+//! SHA-256 of up to `LANES` unrelated messages at once; see
+//! crypto/fipsmodule/sha/sha256-avx2.c.
+
+#[cfg(target_arch = "x86_64")]
+use {c, core};
+use super::State;
+#[cfg(feature = "use_heap")]
+use super::{Digest, MAX_BLOCK_LEN, SHA256};
+
+pub const LANES: usize = 8;
+
+/// Whether `block_data_order` is faster than hashing the messages one at a
+/// time with `SHA256.block_data_order`.
+#[cfg(target_arch = "x86_64")]
+pub fn capable() -> bool {
+    unsafe { GFp_sha256_x8_avx2_capable() == 1 }
+}
+
+#[cfg(not(target_arch = "x86_64"))]
+pub fn capable() -> bool { false }
+
+/// Hashes `num` blocks starting at each element of `data` into the
+/// corresponding element of `states`. The elements of `data` may be equal,
+/// e.g. to fill the lanes that aren't needed.
+#[cfg(target_arch = "x86_64")]
+pub unsafe fn block_data_order(states: &mut [State; LANES],
+                               data: &[*const u8; LANES], num: usize) {
+    let mut state_ptrs = [core::ptr::null_mut(); LANES];
+    for (ptr, state) in state_ptrs.iter_mut().zip(states.iter_mut()) {
+        *ptr = state.as_mut_ptr() as *mut u32;
+    }
+    GFp_sha256_block_data_order_x8_avx2(&state_ptrs, data, num);
+}
+
+#[cfg(not(target_arch = "x86_64"))]
+pub unsafe fn block_data_order(states: &mut [State; LANES],
+                               data: &[*const u8; LANES], num: usize) {
+    for (state, data) in states.iter_mut().zip(data.iter()) {
+        (super::SHA256.block_data_order)(state, *data, num);
+    }
+}
+
+/// Sets each element of `digests` to the SHA-256 digest of the corresponding
+/// element of `messages`.
+///
+/// Each lane hashes one message at a time. Whenever a lane finishes its
+/// message, the next message that hasn't been started yet is put into it, so
+/// that the lanes stay busy even when the messages have different lengths.
+#[cfg(feature = "use_heap")]
+pub fn digest_batch(messages: &[&[u8]], digests: &mut [Digest]) {
+    assert_eq!(messages.len(), digests.len());
+
+    let mut lanes: [Option<Lane>; LANES] =
+        [None, None, None, None, None, None, None, None];
+    let mut states = [SHA256.initial_state; LANES];
+    let mut next = 0;
+    loop {
+        for (lane, state) in lanes.iter_mut().zip(states.iter_mut()) {
+            if lane.is_none() && next < messages.len() {
+                *lane = Some(Lane::new(next, messages[next]));
+                *state = SHA256.initial_state;
+                next += 1;
+            }
+        }
+
+        let num = match lanes.iter().filter_map(|lane| lane.as_ref())
+                                    .map(|lane| lane.num_blocks())
+                                    .min() {
+            Some(num) => num,
+            None => break,
+        };
+
+        // The lanes that are empty hash the same data as an active one, into
+        // a state that isn't used.
+        let active = lanes.iter().filter_map(|lane| lane.as_ref())
+                                 .next().unwrap().data();
+        let mut data = [active; LANES];
+        for (data, lane) in data.iter_mut().zip(lanes.iter()) {
+            *data = lane.as_ref().map_or(active, |lane| lane.data());
+        }
+        unsafe {
+            block_data_order(&mut states, &data, num);
+        }
+
+        for (lane, state) in lanes.iter_mut().zip(states.iter()) {
+            let finished = match lane.as_mut() {
+                Some(lane) => {
+                    lane.advance(num);
+                    if lane.is_finished() {
+                        Some(lane.index)
+                    } else {
+                        None
+                    }
+                },
+                None => None,
+            };
+            if let Some(index) = finished {
+                digests[index] = Digest {
+                    algorithm: &SHA256,
+                    value: (SHA256.format_output)(state),
+                };
+                *lane = None;
+            }
+        }
+    }
+}
+
+// A message that is being hashed in one of the lanes: first its whole blocks,
+// straight from the message, then its padded final block or blocks.
+#[cfg(feature = "use_heap")]
+struct Lane<'a> {
+    index: usize,
+    blocks: &'a [u8],
+    padded: [u8; 2 * MAX_BLOCK_LEN],
+    padded_len: usize,
+    padded_used: usize,
+}
+
+#[cfg(feature = "use_heap")]
+impl<'a> Lane<'a> {
+    fn new(index: usize, message: &'a [u8]) -> Lane<'a> {
+        let block_len = SHA256.block_len;
+        let (blocks, remainder) =
+            message.split_at(message.len() - (message.len() % block_len));
+        let mut padded = [0u8; 2 * MAX_BLOCK_LEN];
+        let padded_len = super::pad(&SHA256, message.len(), remainder,
+                                    &mut padded);
+        Lane {
+            index: index,
+            blocks: blocks,
+            padded: padded,
+            padded_len: padded_len,
+            padded_used: 0,
+        }
+    }
+
+    // The number of blocks that can be hashed from `data()` on.
+    fn num_blocks(&self) -> usize {
+        if !self.blocks.is_empty() {
+            self.blocks.len() / SHA256.block_len
+        } else {
+            (self.padded_len - self.padded_used) / SHA256.block_len
+        }
+    }
+
+    fn data(&self) -> *const u8 {
+        if !self.blocks.is_empty() {
+            self.blocks.as_ptr()
+        } else {
+            self.padded[self.padded_used..].as_ptr()
+        }
+    }
+
+    fn advance(&mut self, num: usize) {
+        if !self.blocks.is_empty() {
+            self.blocks = &self.blocks[(num * SHA256.block_len)..];
+        } else {
+            self.padded_used += num * SHA256.block_len;
+        }
+    }
+
+    fn is_finished(&self) -> bool {
+        self.blocks.is_empty() && self.padded_used == self.padded_len
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+extern {
+    fn GFp_sha256_x8_avx2_capable() -> c::int;
+    fn GFp_sha256_block_data_order_x8_avx2(states: &[*mut u32; LANES],
+                                           data: &[*const u8; LANES],
+                                           num: c::size_t);
+}
+
+#[cfg(test)]
+mod tests {
+    use {core, std};
+    use super::*;
+    use super::super::{Context, FixedLengthContext, SHA256};
+
+    // `capable()` is false on CPUs with the SHA extensions, so this checks the
+    // kernel whenever it can run at all.
+    #[cfg(target_arch = "x86_64")]
+    fn can_run() -> bool {
+        extern {
+            static GFp_ia32cap_P: [u32; 4];
+        }
+        ::init::init_once();
+        unsafe { GFp_ia32cap_P[2] & (1 << 5) != 0 }
+    }
+
+    #[cfg(not(target_arch = "x86_64"))]
+    fn can_run() -> bool { true }
+
+    #[test]
+    fn test_block_data_order() {
+        if !can_run() {
+            return;
+        }
+        let block_len = SHA256.block_len;
+        let input = (0..(LANES * 3 * block_len)).map(|i| (i * 7) as u8)
+                                                .collect::<std::vec::Vec<_>>();
+        let mut states = [SHA256.initial_state; LANES];
+        for (i, state) in states.iter_mut().enumerate() {
+            state[0] ^= i as u64;
+        }
+        let mut expected = states;
+        let mut data = [core::ptr::null(); LANES];
+        for (i, data) in data.iter_mut().enumerate() {
+            // Lanes 6 and 7 hash the same data as lane 5.
+            *data = input[(core::cmp::min(i, 5) * 3 * block_len)..].as_ptr();
+        }
+        for (state, data) in expected.iter_mut().zip(data.iter()) {
+            unsafe { (SHA256.block_data_order)(state, *data, 3) };
+        }
+        unsafe { block_data_order(&mut states, &data, 3) };
+        assert_eq!(&states[..], &expected[..]);
+    }
+
+    #[test]
+    fn test_digest_many() {
+        if !can_run() {
+            return;
+        }
+        let mut prefix = Context::new(&SHA256);
+        prefix.update(&[0x5a; 64]);
+        let mut ctx = FixedLengthContext::new(&prefix, 32);
+        let suffixes = (0..(LANES + 3)).map(|i| [i as u8; 32])
+                                       .collect::<std::vec::Vec<_>>();
+        let suffixes = suffixes.iter().map(|suffix| &suffix[..])
+                                      .collect::<std::vec::Vec<_>>();
+        for len in 1..(suffixes.len() + 1) {
+            let mut digests = std::vec::Vec::new();
+            digests.resize(len, super::super::digest(&SHA256, b""));
+            ctx.digest_many_sha256_x8(&suffixes[..len], &mut digests);
+            for (suffix, digest) in suffixes.iter().zip(digests.iter()) {
+                let mut expected = prefix.clone();
+                expected.update(suffix);
+                assert_eq!(digest.as_ref(), expected.finish().as_ref());
+            }
+        }
+    }
+
+    #[cfg(feature = "use_heap")]
+    #[test]
+    fn test_digest_batch() {
+        if !can_run() {
+            return;
+        }
+        let input = (0..(5 * SHA256.block_len)).map(|i| i as u8)
+                                               .collect::<std::vec::Vec<_>>();
+        // Messages of every length up to five blocks, in an order that makes
+        // the lanes finish at different times.
+        let messages = (0..input.len()).map(|i| (i * 37) % input.len())
+                                       .map(|len| &input[..len])
+                                       .collect::<std::vec::Vec<_>>();
+        let mut digests = std::vec::Vec::new();
+        digests.resize(messages.len(), super::super::digest(&SHA256, b""));
+        digest_batch(&messages, &mut digests);
+        for (message, digest) in messages.iter().zip(digests.iter()) {
+            let mut ctx = Context::new(&SHA256);
+            ctx.update(message);
+            assert_eq!(digest.as_ref(), ctx.finish().as_ref());
+        }
+    }
+}
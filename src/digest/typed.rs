@@ -0,0 +1,347 @@
+// Copyright 2015-2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+// Digest algorithms chosen at compile time. The algorithm is a type instead
+// of a `&'static Algorithm`, so the block length and the length of the
+// padding are constants and the compression function is called directly.
+
+use {c, init, polyfill};
+use core::marker::PhantomData;
+use super::{Digest, State, Output, MAX_BLOCK_LEN};
+
+/// A digest algorithm that is known at compile time: `Sha1`, `Sha256`,
+/// `Sha384`, `Sha512`, or `Sha512_256`.
+///
+/// This trait is sealed; it is implemented only by those types.
+pub trait TypedAlgorithm: sealed::Algorithm {
+    /// The length of the digest, in bytes. Same as
+    /// `digest::Algorithm::output_len`.
+    const OUTPUT_LEN: usize;
+
+    /// The length of the chaining value, in bytes. Same as
+    /// `digest::Algorithm::chaining_len`.
+    const CHAINING_LEN: usize;
+
+    /// The length of a block, in bytes. Same as
+    /// `digest::Algorithm::block_len`.
+    const BLOCK_LEN: usize;
+
+    /// The equivalent `digest::Algorithm`.
+    fn algorithm() -> &'static super::Algorithm;
+}
+
+mod sealed {
+    use c;
+    use super::super::{State, Output};
+
+    pub trait Algorithm {
+        /// The length of the length in the padding.
+        const LEN_LEN: usize;
+
+        unsafe fn block_data_order(state: &mut State, data: *const u8,
+                                   num: c::size_t);
+
+        fn format_output(state: &State) -> Output;
+    }
+}
+
+macro_rules! typed_algorithm {
+    ( $name:ident, $dynamic:ident, $doc:expr, $output_len:expr,
+      $chaining_len:expr, $block_len:expr, $len_len:expr,
+      $block_data_order:path, $format_output:path ) => {
+        #[doc = $doc]
+        #[allow(non_camel_case_types)]
+        pub enum $name {}
+
+        impl TypedAlgorithm for $name {
+            const OUTPUT_LEN: usize = $output_len;
+            const CHAINING_LEN: usize = $chaining_len;
+            const BLOCK_LEN: usize = $block_len;
+
+            #[inline(always)]
+            fn algorithm() -> &'static super::Algorithm { &super::$dynamic }
+        }
+
+        impl sealed::Algorithm for $name {
+            const LEN_LEN: usize = $len_len;
+
+            #[inline(always)]
+            unsafe fn block_data_order(state: &mut State, data: *const u8,
+                                       num: c::size_t) {
+                $block_data_order(state, data, num)
+            }
+
+            #[inline(always)]
+            fn format_output(state: &State) -> Output { $format_output(state) }
+        }
+    }
+}
+
+typed_algorithm!(Sha1, SHA1, "SHA-1, like `digest::SHA1`. Deprecated.",
+                 super::sha1::OUTPUT_LEN, super::sha1::CHAINING_LEN,
+                 super::sha1::BLOCK_LEN, 64 / 8,
+                 super::sha1::block_data_order, super::sha256_format_output);
+typed_algorithm!(Sha256, SHA256, "SHA-256, like `digest::SHA256`.",
+                 super::SHA256_OUTPUT_LEN, super::SHA256_OUTPUT_LEN, 512 / 8,
+                 64 / 8, super::GFp_sha256_block_data_order,
+                 super::sha256_format_output);
+typed_algorithm!(Sha384, SHA384, "SHA-384, like `digest::SHA384`.",
+                 super::SHA384_OUTPUT_LEN, super::SHA512_OUTPUT_LEN,
+                 super::SHA512_BLOCK_LEN, super::SHA512_LEN_LEN,
+                 super::GFp_sha512_block_data_order,
+                 super::sha512_format_output);
+typed_algorithm!(Sha512, SHA512, "SHA-512, like `digest::SHA512`.",
+                 super::SHA512_OUTPUT_LEN, super::SHA512_OUTPUT_LEN,
+                 super::SHA512_BLOCK_LEN, super::SHA512_LEN_LEN,
+                 super::GFp_sha512_block_data_order,
+                 super::sha512_format_output);
+typed_algorithm!(Sha512_256, SHA512_256,
+                 "SHA-512/256, like `digest::SHA512_256`.",
+                 super::SHA512_256_OUTPUT_LEN, super::SHA512_OUTPUT_LEN,
+                 super::SHA512_BLOCK_LEN, super::SHA512_LEN_LEN,
+                 super::GFp_sha512_block_data_order,
+                 super::sha512_format_output);
+
+/// A context for multi-step (Init-Update-Finish) digest calculations using
+/// the algorithm `A`, e.g. `TypedContext<Sha256>`.
+///
+/// This is `Context` with the algorithm fixed at compile time. The block
+/// length and the length of the padding are constants and the compression
+/// function is called directly, so the compiler can specialize (and inline)
+/// all of the buffering and padding logic for each algorithm. This matters
+/// most for short messages, where that logic costs about as much as the
+/// compression function itself. The digests are ordinary `Digest` values.
+///
+/// # Examples
+///
+/// ```
+/// use ring::digest;
+///
+/// let one_shot = digest::digest_typed::<digest::Sha256>(b"hello, world");
+///
+/// let mut ctx = digest::TypedContext::<digest::Sha256>::new();
+/// ctx.update(b"hello");
+/// ctx.update(b", ");
+/// ctx.update(b"world");
+/// let multi_part = ctx.finish();
+///
+/// assert_eq!(one_shot.as_ref(), multi_part.as_ref());
+/// assert_eq!(multi_part.as_ref(),
+///            digest::digest(&digest::SHA256, b"hello, world").as_ref());
+/// ```
+pub struct TypedContext<A: TypedAlgorithm> {
+    state: State,
+
+    // See `digest::Context`.
+    completed_data_blocks: u64,
+
+    pending: [u8; MAX_BLOCK_LEN],
+    num_pending: usize,
+
+    algorithm: PhantomData<A>,
+}
+
+impl<A: TypedAlgorithm> TypedContext<A> {
+    /// Constructs a new context.
+    #[inline]
+    pub fn new() -> TypedContext<A> {
+        init::init_once();
+
+        TypedContext {
+            state: A::algorithm().initial_state,
+            completed_data_blocks: 0,
+            pending: [0u8; MAX_BLOCK_LEN],
+            num_pending: 0,
+            algorithm: PhantomData,
+        }
+    }
+
+    /// Updates the digest with all the data in `data`. See
+    /// `Context::update()`.
+    #[inline]
+    pub fn update(&mut self, data: &[u8]) {
+        if data.len() < A::BLOCK_LEN - self.num_pending {
+            self.pending[self.num_pending..(self.num_pending + data.len())]
+                .copy_from_slice(data);
+            self.num_pending += data.len();
+            return;
+        }
+
+        let mut remaining = data;
+        if self.num_pending > 0 {
+            let to_copy = A::BLOCK_LEN - self.num_pending;
+            self.pending[self.num_pending..A::BLOCK_LEN]
+                .copy_from_slice(&data[..to_copy]);
+            unsafe {
+                A::block_data_order(&mut self.state, self.pending.as_ptr(), 1);
+            }
+            self.completed_data_blocks =
+                self.completed_data_blocks.checked_add(1).unwrap();
+            remaining = &remaining[to_copy..];
+            self.num_pending = 0;
+        }
+
+        let num_blocks = remaining.len() / A::BLOCK_LEN;
+        let num_to_save_for_later = remaining.len() % A::BLOCK_LEN;
+        if num_blocks > 0 {
+            unsafe {
+                A::block_data_order(&mut self.state, remaining.as_ptr(),
+                                    num_blocks);
+            }
+            self.completed_data_blocks =
+                self.completed_data_blocks
+                    .checked_add(polyfill::u64_from_usize(num_blocks))
+                    .unwrap();
+        }
+        if num_to_save_for_later > 0 {
+            self.pending[..num_to_save_for_later]
+                .copy_from_slice(&remaining[(remaining.len() -
+                                             num_to_save_for_later)..]);
+            self.num_pending = num_to_save_for_later;
+        }
+    }
+
+    /// Finalizes the digest calculation and returns the digest value. See
+    /// `Context::finish()`.
+    #[inline]
+    pub fn finish(self) -> Digest {
+        counted!(DigestFinish,
+                 self.completed_data_blocks
+                     .saturating_mul(polyfill::u64_from_usize(A::BLOCK_LEN))
+                     .saturating_add(polyfill::u64_from_usize(
+                         self.num_pending)),
+                 infallible self.finish_())
+    }
+
+    fn finish_(mut self) -> Digest {
+        let data_len = self.completed_data_blocks
+            .checked_mul(polyfill::u64_from_usize(A::BLOCK_LEN)).unwrap()
+            .checked_add(polyfill::u64_from_usize(self.num_pending)).unwrap();
+        let remainder = &self.pending[..self.num_pending];
+        finish_padded::<A>(&mut self.state, remainder, data_len)
+    }
+}
+
+// The fields are all `Copy`, but `[u8; 128]` doesn't implement `Clone`; see
+// the `Clone` implementation of `digest::Context`.
+impl<A: TypedAlgorithm> Clone for TypedContext<A> {
+    fn clone(&self) -> TypedContext<A> {
+        TypedContext {
+            state: self.state,
+            completed_data_blocks: self.completed_data_blocks,
+            pending: self.pending,
+            num_pending: self.num_pending,
+            algorithm: PhantomData,
+        }
+    }
+}
+
+/// Returns the digest of `data` using the algorithm `A`. See `digest()`.
+#[inline]
+pub fn digest_typed<A: TypedAlgorithm>(data: &[u8]) -> Digest {
+    init::init_once();
+    counted!(DigestFinish, data.len(), infallible digest_::<A>(data))
+}
+
+// Like `digest::digest_one_shot`, the whole blocks are hashed directly from
+// `data`.
+fn digest_<A: TypedAlgorithm>(data: &[u8]) -> Digest {
+    let mut state = A::algorithm().initial_state;
+    let num_blocks = data.len() / A::BLOCK_LEN;
+    if num_blocks > 0 {
+        unsafe {
+            A::block_data_order(&mut state, data.as_ptr(), num_blocks);
+        }
+    }
+    let remainder = &data[(num_blocks * A::BLOCK_LEN)..];
+    finish_padded::<A>(&mut state, remainder,
+                       polyfill::u64_from_usize(data.len()))
+}
+
+// Hashes the final partial block `remainder` and the padding of a message of
+// `data_len` bytes, in one call to `block_data_order`.
+#[inline(always)]
+fn finish_padded<A: TypedAlgorithm>(state: &mut State, remainder: &[u8],
+                               data_len: u64) -> Digest {
+    debug_assert!(remainder.len() < A::BLOCK_LEN);
+    let mut padded = [0u8; 2 * MAX_BLOCK_LEN];
+    padded[..remainder.len()].copy_from_slice(remainder);
+    padded[remainder.len()] = 0x80;
+    let padded_len =
+        if remainder.len() + 1 > A::BLOCK_LEN - A::LEN_LEN {
+            2 * A::BLOCK_LEN
+        } else {
+            A::BLOCK_LEN
+        };
+
+    // Output the length, in bits, in big endian order.
+    let mut data_bits = data_len.checked_mul(8).unwrap();
+    for b in (&mut padded[(padded_len - 8)..padded_len]).into_iter().rev() {
+        *b = data_bits as u8;
+        data_bits /= 0x100;
+    }
+    unsafe {
+        A::block_data_order(state, padded.as_ptr(), padded_len / A::BLOCK_LEN);
+    }
+
+    Digest {
+        algorithm: A::algorithm(),
+        value: A::format_output(state),
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use digest;
+    use std::vec::Vec;
+    use super::*;
+
+    // Compares `TypedContext<A>` and `digest_typed::<A>()` to the
+    // dynamically-dispatched implementation for every message length up to
+    // two blocks, split at every point, which covers every way the padding
+    // can fall.
+    fn test_typed<A: TypedAlgorithm>() {
+        let alg = A::algorithm();
+        assert_eq!(A::OUTPUT_LEN, alg.output_len);
+        assert_eq!(A::CHAINING_LEN, alg.chaining_len);
+        assert_eq!(A::BLOCK_LEN, alg.block_len);
+        assert_eq!(<A as sealed::Algorithm>::LEN_LEN, alg.len_len);
+
+        let input = (0..((2 * A::BLOCK_LEN) + 1)).map(|i| i as u8)
+                                                 .collect::<Vec<_>>();
+        for len in 0..(input.len() + 1) {
+            let expected = digest::digest(alg, &input[..len]);
+
+            let actual = digest_typed::<A>(&input[..len]);
+            assert_eq!(actual.algorithm(), alg);
+            assert_eq!(actual.as_ref(), expected.as_ref());
+
+            for split in 0..(len + 1) {
+                let mut ctx = TypedContext::<A>::new();
+                ctx.update(&input[..split]);
+                ctx.update(&input[split..len]);
+                assert_eq!(ctx.finish().as_ref(), expected.as_ref());
+            }
+        }
+    }
+
+    #[test]
+    fn typed_test() {
+        test_typed::<Sha1>();
+        test_typed::<Sha256>();
+        test_typed::<Sha384>();
+        test_typed::<Sha512>();
+        test_typed::<Sha512_256>();
+    }
+}
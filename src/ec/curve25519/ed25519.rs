@@ -15,7 +15,7 @@
 //! EdDSA Signatures.
 
 use core;
-use {der, digest, error, pkcs8, private, rand, signature, signature_impl};
+use {c, der, digest, error, pkcs8, private, rand, signature, signature_impl};
 use super::ops::*;
 use untrusted;
 
@@ -169,6 +169,25 @@ impl<'a> Ed25519KeyPair {
 
     /// Returns the signature of the message `msg`.
     pub fn sign(&self, msg: &[u8]) -> signature::Signature {
+        self.sign_(&[], msg)
+    }
+
+    /// Returns the [Ed25519ph] signature, with an empty context, of the
+    /// message with SHA-512 digest `m_hash`. Such signatures must be verified
+    /// with `ED25519PH`; they aren't `ED25519` signatures of the message.
+    ///
+    /// [Ed25519ph]: https://tools.ietf.org/html/rfc8032#section-5.1
+    pub fn sign_prehashed(&self, m_hash: &digest::Digest)
+                          -> Result<signature::Signature, error::Unspecified> {
+        if m_hash.algorithm() != &digest::SHA512 {
+            return Err(error::Unspecified);
+        }
+        Ok(self.sign_(ED25519PH_DOM, m_hash.as_ref()))
+    }
+
+    // RFC 8032 Section 5.1.6, where `dom` is dom2(F, C), which is empty for
+    // Ed25519, and `msg` is PH(M).
+    fn sign_(&self, dom: &[u8], msg: &[u8]) -> signature::Signature {
         let mut signature_bytes = [0u8; SIGNATURE_LEN];
         { // Borrow `signature_bytes`.
             let (signature_r, signature_s) =
@@ -180,6 +199,7 @@ impl<'a> Ed25519KeyPair {
 
             let nonce = {
                 let mut ctx = digest::Context::new(&digest::SHA512);
+                ctx.update(dom);
                 ctx.update(&self.private_prefix);
                 ctx.update(msg);
                 ctx.finish()
@@ -191,7 +211,8 @@ impl<'a> Ed25519KeyPair {
                 GFp_x25519_ge_scalarmult_base(&mut r, &nonce);
             }
             *signature_r = r.into_encoded_point();
-            let hram_digest = eddsa_digest(signature_r, &self.public_key, msg);
+            let hram_digest =
+                eddsa_digest(dom, signature_r, &self.public_key, msg);
             let hram = digest_scalar(hram_digest);
             unsafe {
                 GFp_x25519_sc_muladd(signature_s, &hram, &self.private_scalar,
@@ -223,51 +244,346 @@ pub static ED25519: EdDSAParameters = EdDSAParameters {};
 impl signature::VerificationAlgorithm for EdDSAParameters {
     fn verify(&self, public_key: untrusted::Input, msg: untrusted::Input,
               signature: untrusted::Input) -> Result<(), error::Unspecified> {
+        Ed25519PublicKey::from_bytes(public_key)?.verify(msg, signature)
+    }
+}
+
+impl private::Private for EdDSAParameters {}
+
+/// Parameters for Ed25519ph signature verification.
+pub struct Ed25519phParameters;
+
+impl core::fmt::Debug for Ed25519phParameters {
+    fn fmt(&self, f: &mut core::fmt::Formatter) -> core::fmt::Result {
+        write!(f, "ring::signature::ED25519PH")
+    }
+}
+
+/// Verification of [Ed25519ph] signatures with an empty context, e.g. those
+/// made with `Ed25519KeyPair::sign_prehashed()`.
+///
+/// Ed25519ph signs the SHA-512 digest of the message, so unlike `ED25519` it
+/// implements `signature::PrehashedVerificationAlgorithm`. The signatures are
+/// not interchangeable with `ED25519` signatures, even for the same key.
+///
+/// [Ed25519ph]: https://tools.ietf.org/html/rfc8032#section-5.1
+pub static ED25519PH: Ed25519phParameters = Ed25519phParameters {};
+
+impl signature::VerificationAlgorithm for Ed25519phParameters {
+    fn verify(&self, public_key: untrusted::Input, msg: untrusted::Input,
+              signature: untrusted::Input) -> Result<(), error::Unspecified> {
+        let m_hash = digest::digest(&digest::SHA512, msg.as_slice_less_safe());
+        Ed25519PublicKey::from_bytes(public_key)?
+            .verify_prehashed(&m_hash, signature)
+    }
+}
+
+impl signature::PrehashedVerificationAlgorithm for Ed25519phParameters {
+    fn digest_alg(&self) -> &'static digest::Algorithm { &digest::SHA512 }
+
+    fn verify_digest(&self, public_key: untrusted::Input,
+                     m_hash: &digest::Digest, signature: untrusted::Input)
+                     -> Result<(), error::Unspecified> {
+        Ed25519PublicKey::from_bytes(public_key)?
+            .verify_prehashed(m_hash, signature)
+    }
+}
+
+impl private::Private for Ed25519phParameters {}
+
+// dom2(1, "") from RFC 8032 Section 5.1.
+const ED25519PH_DOM: &'static [u8] =
+    b"SigEd25519 no Ed25519 collisions\x01\x00";
+
+/// An Ed25519 public key that has been decoded, for verifying many signatures
+/// made with the same key.
+///
+/// `signature::verify` decompresses the public key, which requires a square
+/// root in the field, and computes a table of multiples of it for the scalar
+/// multiplication every time it is called; an `Ed25519PublicKey` does that
+/// work once.
+pub struct Ed25519PublicKey {
+    // RFC 8032 Section 5.1.7 calls the encoded form *A*; it is hashed along
+    // with the message.
+    encoded: PublicKey,
+
+    // The odd multiples of the decoded point -A, which is what
+    // `GFp_ge_double_scalarmult_vartime` needs.
+    minus_a: OddMultiples,
+}
+
+impl Ed25519PublicKey {
+    /// Decodes a public key encoded as described in [RFC 8032 Section 5.1.2],
+    /// the same encoding that `signature::verify` expects for `ED25519`.
+    ///
+    /// [RFC 8032 Section 5.1.2]:
+    ///     https://tools.ietf.org/html/rfc8032#section-5.1.2
+    pub fn from_bytes(public_key: untrusted::Input)
+                      -> Result<Ed25519PublicKey, error::Unspecified> {
         let public_key = public_key.as_slice_less_safe();
         let public_key = slice_as_array_ref!(public_key, ELEM_LEN)?;
 
-        let (signature_r, signature_s) =
-                signature.read_all(error::Unspecified, |input| {
-            let r = input.skip_and_get_input(ELEM_LEN)?;
-            let r = r.as_slice_less_safe();
-            // `r` is only used as a slice, so don't convert it to an array ref.
+        let mut minus_a = ExtPoint::from_encoded_point_vartime(public_key)?;
+        minus_a.invert_vartime();
 
-            let s = input.skip_and_get_input(SCALAR_LEN)?;
-            let s = s.as_slice_less_safe();
-            let s = slice_as_array_ref!(s, SCALAR_LEN).unwrap();
+        Ok(Ed25519PublicKey {
+            encoded: *public_key,
+            minus_a: minus_a.odd_multiples(),
+        })
+    }
 
-            Ok((r, s))
-        })?;
+    /// Returns a reference to the little-endian-encoded public key bytes.
+    pub fn as_bytes(&self) -> &[u8] { &self.encoded }
+
+    /// Verifies the signature `signature` of message `msg` with this key. The
+    /// result is the same as `signature::verify(&ED25519, ...)`'s with the
+    /// encoded form of this key.
+    pub fn verify(&self, msg: untrusted::Input, signature: untrusted::Input)
+                  -> Result<(), error::Unspecified> {
+        self.verify_(&[], msg.as_slice_less_safe(), signature)
+    }
 
-        // Ensure `s` is not too large.
-        if (signature_s[SCALAR_LEN - 1] & 0b11100000) != 0 {
+    /// Verifies the [Ed25519ph] signature `signature`, with an empty context,
+    /// of the message with SHA-512 digest `m_hash`. The result is the same as
+    /// `signature::verify_digest(&ED25519PH, ...)`'s with the encoded form of
+    /// this key.
+    ///
+    /// [Ed25519ph]: https://tools.ietf.org/html/rfc8032#section-5.1
+    pub fn verify_prehashed(&self, m_hash: &digest::Digest,
+                            signature: untrusted::Input)
+                            -> Result<(), error::Unspecified> {
+        if m_hash.algorithm() != &digest::SHA512 {
             return Err(error::Unspecified);
         }
+        self.verify_(ED25519PH_DOM, m_hash.as_ref(), signature)
+    }
 
-        let mut a = ExtPoint::from_encoded_point_vartime(public_key)?;
-        a.invert_vartime();
+    // RFC 8032 Section 5.1.7, with `dom` and `msg` as for
+    // `Ed25519KeyPair::sign_`.
+    fn verify_(&self, dom: &[u8], msg: &[u8], signature: untrusted::Input)
+               -> Result<(), error::Unspecified> {
+        let (signature_r, signature_s) = split_signature(signature)?;
 
-        let h_digest =
-            eddsa_digest(signature_r, public_key, msg.as_slice_less_safe());
+        let h_digest = eddsa_digest(dom, signature_r, &self.encoded, msg);
         let h = digest_scalar(h_digest);
 
         let mut r = Point::new_at_infinity();
         unsafe {
-            GFp_ge_double_scalarmult_vartime(&mut r, &h, &a, &signature_s)
+            GFp_ge_double_scalarmult_vartime(&mut r, &h, &self.minus_a,
+                                             &signature_s)
         };
         let r_check = r.into_encoded_point();
-        if signature_r != r_check {
+        if *signature_r != r_check {
+            return Err(error::Unspecified);
+        }
+        Ok(())
+    }
+
+    /// Verifies all the signatures in `batch` at once, which is faster than
+    /// verifying each of them with `verify`.
+    ///
+    /// The signatures are combined with random coefficients generated using
+    /// `rng`, so the work done for the doublings in the scalar multiplications
+    /// is shared between all of them. If any signature in the batch is invalid
+    /// then, except with negligible probability, an error is returned; use
+    /// `verify_batch_each` to find out which signatures are invalid.
+    ///
+    /// The batch is checked using the cofactored verification equation
+    /// [8][S]B = [8]R + [8][k]A of [RFC 8032 Section 5.1.7], while `verify`
+    /// checks [S]B = R + [k]A. They agree on every signature made by an
+    /// honest signer. Whenever R or the public key A has a small-order
+    /// component, `verify_batch` may accept a (public key, message,
+    /// signature) triple that `verify` rejects. Anybody can construct such a
+    /// public key or R without knowing any private key, so don't use
+    /// `verify_batch` where every verifier must reach the same decision as
+    /// `verify`.
+    ///
+    /// [RFC 8032 Section 5.1.7]:
+    ///     https://tools.ietf.org/html/rfc8032#section-5.1.7
+    pub fn verify_batch(batch: &[Ed25519BatchItem], rng: &rand::SecureRandom)
+                        -> Result<(), error::Unspecified> {
+        for chunk in batch.chunks(BATCH_CHUNK_LEN) {
+            verify_batch_chunk(chunk, rng)?;
+        }
+        Ok(())
+    }
+
+    /// Like `verify_batch`, but sets `results[i]` to the result of verifying
+    /// `batch[i]`.
+    ///
+    /// Each part of the batch that fails batch verification is verified again
+    /// one signature at a time with `verify`, so only the results of the
+    /// invalid signatures and of the signatures that share a part of the batch
+    /// with them are exactly those of `verify`. An error is returned if any
+    /// signature is invalid or if `results.len() != batch.len()`.
+    pub fn verify_batch_each(batch: &[Ed25519BatchItem],
+                             rng: &rand::SecureRandom,
+                             results: &mut [Result<(), error::Unspecified>])
+                             -> Result<(), error::Unspecified> {
+        if results.len() != batch.len() {
+            return Err(error::Unspecified);
+        }
+        let mut all_valid = true;
+        for (chunk, chunk_results) in batch.chunks(BATCH_CHUNK_LEN)
+                .zip(results.chunks_mut(BATCH_CHUNK_LEN)) {
+            if verify_batch_chunk(chunk, rng).is_ok() {
+                for result in chunk_results.iter_mut() {
+                    *result = Ok(());
+                }
+                continue;
+            }
+            for (item, result) in chunk.iter().zip(chunk_results.iter_mut()) {
+                *result = item.public_key.verify(item.msg, item.signature);
+                all_valid &= result.is_ok();
+            }
+        }
+        if !all_valid {
             return Err(error::Unspecified);
         }
         Ok(())
     }
 }
 
-impl private::Private for EdDSAParameters {}
+/// A signature to be verified as part of a batch with
+/// `Ed25519PublicKey::verify_batch`.
+pub struct Ed25519BatchItem<'a> {
+    /// The public key.
+    pub public_key: &'a Ed25519PublicKey,
+
+    /// The signed message.
+    pub msg: untrusted::Input<'a>,
+
+    /// The signature.
+    pub signature: untrusted::Input<'a>,
+}
+
+// Keep in sync with `GE_MULTI_SCALARMULT_MAX_POINTS` in curve25519.c. Each
+// signature contributes two points, A and R.
+const MULTI_SCALARMULT_MAX_POINTS: usize = 32;
+const BATCH_CHUNK_LEN: usize = MULTI_SCALARMULT_MAX_POINTS / 2;
+
+// The random coefficients are 128 bits.
+const BATCH_COEFFICIENT_LEN: usize = 16;
+
+// Checks that
+//
+//     [8]((z_0*S_0 + z_1*S_1 + ...)B - (z_0*k_0)A_0 - z_0 R_0 - ...) == 0
+//
+// for random z_i.
+fn verify_batch_chunk(chunk: &[Ed25519BatchItem], rng: &rand::SecureRandom)
+                      -> Result<(), error::Unspecified> {
+    debug_assert!(chunk.len() <= BATCH_CHUNK_LEN);
+
+    let mut coefficients = [0u8; BATCH_CHUNK_LEN * BATCH_COEFFICIENT_LEN];
+    let coefficients = &mut coefficients[..(chunk.len() *
+                                            BATCH_COEFFICIENT_LEN)];
+    rng.fill(coefficients)?;
+
+    let mut tables = [[CachedPoint::new_at_infinity(); ODD_MULTIPLES_LEN];
+                      MULTI_SCALARMULT_MAX_POINTS];
+    let mut scalars = [0u8; MULTI_SCALARMULT_MAX_POINTS * SCALAR_LEN];
+    let mut b_scalar = [0u8; SCALAR_LEN];
+    let zero = [0u8; SCALAR_LEN];
+
+    for (i, (item, z)) in chunk.iter()
+            .zip(coefficients.chunks(BATCH_COEFFICIENT_LEN)).enumerate() {
+        let (signature_r, signature_s) = split_signature(item.signature)?;
+
+        // `verify` compares the encoding of the computed R with the one in
+        // the signature, so it rejects any non-canonical encoding of R.
+        if !is_canonical_encoding(signature_r) {
+            return Err(error::Unspecified);
+        }
+        let mut minus_r = ExtPoint::from_encoded_point_vartime(signature_r)?;
+        minus_r.invert_vartime();
+
+        let h_digest = eddsa_digest(&[], signature_r, &item.public_key.encoded,
+                                    item.msg.as_slice_less_safe());
+        let h = digest_scalar(h_digest);
+
+        let mut z_scalar = [0u8; SCALAR_LEN];
+        z_scalar[..BATCH_COEFFICIENT_LEN].copy_from_slice(z);
+
+        let (a_scalar, r_scalar) =
+            scalars[(2 * i * SCALAR_LEN)..((2 * i + 2) * SCALAR_LEN)]
+                .split_at_mut(SCALAR_LEN);
+        let a_scalar = slice_as_array_ref_mut!(a_scalar, SCALAR_LEN)?;
+        let r_scalar = slice_as_array_ref_mut!(r_scalar, SCALAR_LEN)?;
+        let b_scalar_prev = b_scalar;
+        unsafe {
+            GFp_x25519_sc_muladd(a_scalar, &z_scalar, &h, &zero);
+            GFp_x25519_sc_muladd(&mut b_scalar, &z_scalar, signature_s,
+                                 &b_scalar_prev);
+        }
+        *r_scalar = z_scalar;
+
+        tables[2 * i] = item.public_key.minus_a;
+        tables[2 * i + 1] = minus_r.odd_multiples();
+    }
+
+    let mut r = Point::new_at_infinity();
+    unsafe {
+        GFp_ge_multi_scalarmult_vartime(&mut r, &scalars, &tables,
+                                        2 * chunk.len(), &b_scalar);
+    }
+    if r.into_encoded_point() != ENCODED_IDENTITY {
+        return Err(error::Unspecified);
+    }
+    Ok(())
+}
+
+// Returns whether `encoded` is the only encoding of the point it decodes to,
+// if any: the y coordinate must be fully reduced, and the sign of x must not
+// be set when x is zero.
+fn is_canonical_encoding(encoded: &EncodedPoint) -> bool {
+    let last = encoded[ELEM_LEN - 1];
+    let y_not_reduced = (last & 0x7f) == 0x7f &&
+                        encoded[1..(ELEM_LEN - 1)].iter().all(|b| *b == 0xff) &&
+                        encoded[0] >= 0xed;
+    // x is zero only for y = 1 and y = -1.
+    let y_is_one = encoded[0] == 0x01 &&
+                   encoded[1..(ELEM_LEN - 1)].iter().all(|b| *b == 0) &&
+                   (last & 0x7f) == 0;
+    let y_is_minus_one =
+        encoded[0] == 0xec &&
+        encoded[1..(ELEM_LEN - 1)].iter().all(|b| *b == 0xff) &&
+        (last & 0x7f) == 0x7f;
+    let negative_zero_x = (last & 0x80) != 0 && (y_is_one || y_is_minus_one);
+    !y_not_reduced && !negative_zero_x
+}
+
+const ENCODED_IDENTITY: EncodedPoint = [
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+];
+
+fn split_signature<'a>(signature: untrusted::Input<'a>)
+        -> Result<(&'a EncodedPoint, &'a Scalar), error::Unspecified> {
+    let (signature_r, signature_s) =
+            signature.read_all(error::Unspecified, |input| {
+        let r = input.skip_and_get_input(ELEM_LEN)?;
+        let r = r.as_slice_less_safe();
+        let r = slice_as_array_ref!(r, ELEM_LEN).unwrap();
+
+        let s = input.skip_and_get_input(SCALAR_LEN)?;
+        let s = s.as_slice_less_safe();
+        let s = slice_as_array_ref!(s, SCALAR_LEN).unwrap();
+
+        Ok((r, s))
+    })?;
+
+    // Ensure `s` is not too large.
+    if (signature_s[SCALAR_LEN - 1] & 0b11100000) != 0 {
+        return Err(error::Unspecified);
+    }
+
+    Ok((signature_r, signature_s))
+}
 
-fn eddsa_digest(signature_r: &[u8], public_key: &[u8], msg: &[u8])
-                -> digest::Digest {
+fn eddsa_digest(dom: &[u8], signature_r: &[u8], public_key: &[u8],
+                msg: &[u8]) -> digest::Digest {
     let mut ctx = digest::Context::new(&digest::SHA512);
+    ctx.update(dom);
     ctx.update(signature_r);
     ctx.update(public_key);
     ctx.update(msg);
@@ -286,7 +602,12 @@ fn digest_scalar(digest: digest::Digest) -> Scalar {
 extern  {
     fn GFp_curve25519_scalar_mask(a: &mut Scalar);
     fn GFp_ge_double_scalarmult_vartime(r: &mut Point, a_coeff: &Scalar,
-                                        a: &ExtPoint, b_coeff: &Scalar);
+                                        a: &OddMultiples, b_coeff: &Scalar);
+    fn GFp_ge_multi_scalarmult_vartime(
+        r: &mut Point,
+        a_coeffs: &[u8; MULTI_SCALARMULT_MAX_POINTS * SCALAR_LEN],
+        a: &[OddMultiples; MULTI_SCALARMULT_MAX_POINTS], num: c::size_t,
+        b_coeff: &Scalar);
     fn GFp_x25519_ge_scalarmult_base(h: &mut ExtPoint, a: &Seed);
     fn GFp_x25519_sc_muladd(s: &mut Scalar, a: &Scalar, b: &Scalar, c: &Scalar);
     fn GFp_x25519_sc_reduce(s: &mut UnreducedScalar);
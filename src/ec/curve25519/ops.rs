@@ -76,8 +76,43 @@ impl ExtPoint {
             self.t[i] = -self.t[i];
         }
     }
+
+    /// The table of the point's odd multiples that the variable-time scalar
+    /// multiplication functions use.
+    pub fn odd_multiples(&self) -> OddMultiples {
+        let mut table = [CachedPoint::new_at_infinity(); ODD_MULTIPLES_LEN];
+        unsafe {
+            GFp_ge_p3_odd_multiples(&mut table, self);
+        }
+        table
+    }
+}
+
+// Keep this in sync with `ge_cached` in curve25519/internal.h.
+#[derive(Clone, Copy)]
+#[repr(C)]
+pub struct CachedPoint {
+    y_plus_x: Elem,
+    y_minus_x: Elem,
+    z: Elem,
+    t2d: Elem,
 }
 
+impl CachedPoint {
+    pub fn new_at_infinity() -> Self {
+        CachedPoint {
+            y_plus_x: [0; ELEM_LIMBS],
+            y_minus_x: [0; ELEM_LIMBS],
+            z: [0; ELEM_LIMBS],
+            t2d: [0; ELEM_LIMBS],
+        }
+    }
+}
+
+// A, 3A, 5A, ..., 15A.
+pub type OddMultiples = [CachedPoint; ODD_MULTIPLES_LEN];
+pub const ODD_MULTIPLES_LEN: usize = 8;
+
 // Keep this in sync with `ge_p2` in curve25519/internal.h.
 #[repr(C)]
 pub struct Point {
@@ -126,6 +161,7 @@ extern {
     fn GFp_fe_isnegative(elem: &Elem) -> u8;
     fn GFp_fe_mul(h: &mut Elem, f: &Elem, g: &Elem);
     fn GFp_fe_tobytes(bytes: &mut EncodedPoint, elem: &Elem);
+    fn GFp_ge_p3_odd_multiples(table: &mut OddMultiples, a: &ExtPoint);
     fn GFp_x25519_ge_frombytes_vartime(h: &mut ExtPoint, s: &EncodedPoint)
                                        -> c::int;
 }
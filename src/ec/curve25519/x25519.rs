@@ -14,7 +14,7 @@
 
 //! X25519 Key agreement.
 
-use {agreement, constant_time, ec, error, rand};
+use {agreement, c, constant_time, ec, error, rand};
 use super::ops;
 use untrusted;
 
@@ -26,6 +26,7 @@ static CURVE25519: ec::Curve = ec::Curve {
     check_private_key_bytes: x25519_check_private_key_bytes,
     generate_private_key: x25519_generate_private_key,
     public_from_private: x25519_public_from_private,
+    public_from_private_batch: Some(x25519_public_from_private_batch),
 };
 
 /// X25519 (ECDH using Curve25519) as described in [RFC 7748].
@@ -40,6 +41,7 @@ pub static X25519: agreement::Algorithm = agreement::Algorithm {
     i: ec::AgreementAlgorithmImpl {
         curve: &CURVE25519,
         ecdh: x25519_ecdh,
+        ecdh_batch: Some(x25519_ecdh_batch),
     },
 };
 
@@ -72,6 +74,31 @@ fn x25519_public_from_private(public_out: &mut [u8],
     Ok(())
 }
 
+// On x86-64 CPUs with AVX-512 IFMA, `GFp_x25519_public_from_private_batch`
+// and `GFp_x25519_scalar_mult_batch` do up to eight scalar multiplications in
+// about the time it takes to do two of them one at a time.
+fn x25519_public_from_private_batch(public_out: &mut [&mut [u8]],
+                                    private_keys: &[&ec::PrivateKey])
+                                    -> Result<(), error::Unspecified> {
+    debug_assert_eq!(public_out.len(), private_keys.len());
+    let mut private_keys_in = [[0u8; PRIVATE_KEY_LEN]; ec::BATCH_MAX];
+    for (private_key_in, private_key) in
+            private_keys_in.iter_mut().zip(private_keys) {
+        private_key_in.copy_from_slice(&private_key.bytes[..PRIVATE_KEY_LEN]);
+    }
+    let mut public_keys = [[0u8; PUBLIC_KEY_LEN]; ec::BATCH_MAX];
+    unsafe {
+        GFp_x25519_public_from_private_batch(public_keys.as_mut_ptr(),
+                                             private_keys_in.as_ptr(),
+                                             private_keys.len());
+    }
+    for (out, public_key) in public_out.iter_mut().zip(&public_keys[..]) {
+        // `ec::compute_public_keys` checked the length of `out`.
+        out.copy_from_slice(public_key);
+    }
+    Ok(())
+}
+
 fn x25519_ecdh(out: &mut [u8], my_private_key: &ec::PrivateKey,
                peer_public_key: untrusted::Input)
                -> Result<(), error::Unspecified> {
@@ -99,6 +126,49 @@ fn x25519_ecdh(out: &mut [u8], my_private_key: &ec::PrivateKey,
     Ok(())
 }
 
+fn x25519_ecdh_batch(out: &mut [[u8; ec::ELEM_MAX_BYTES]],
+                     my_private_keys: &[&ec::PrivateKey],
+                     peer_public_keys: &[untrusted::Input],
+                     results: &mut [Result<(), error::Unspecified>]) {
+    let num = my_private_keys.len();
+    debug_assert_eq!(out.len(), num);
+    debug_assert_eq!(peer_public_keys.len(), num);
+    debug_assert_eq!(results.len(), num);
+
+    // A peer public key of the wrong length gets an error, and its lane
+    // computes zero times zero.
+    let mut scalars = [[0u8; PRIVATE_KEY_LEN]; ec::BATCH_MAX];
+    let mut points = [[0u8; PUBLIC_KEY_LEN]; ec::BATCH_MAX];
+    for i in 0..num {
+        let peer_public_key = peer_public_keys[i].as_slice_less_safe();
+        if peer_public_key.len() == PUBLIC_KEY_LEN {
+            scalars[i].copy_from_slice(
+                &my_private_keys[i].bytes[..PRIVATE_KEY_LEN]);
+            points[i].copy_from_slice(peer_public_key);
+            results[i] = Ok(());
+        } else {
+            results[i] = Err(error::Unspecified);
+        }
+    }
+
+    let mut shared_secrets = [[0u8; SHARED_SECRET_LEN]; ec::BATCH_MAX];
+    unsafe {
+        GFp_x25519_scalar_mult_batch(shared_secrets.as_mut_ptr(),
+                                     scalars.as_ptr(), points.as_ptr(), num);
+    }
+
+    let zeros: SharedSecret = [0; SHARED_SECRET_LEN];
+    for i in 0..num {
+        out[i][..SHARED_SECRET_LEN].copy_from_slice(&shared_secrets[i]);
+        if constant_time::verify_slices_are_equal(&shared_secrets[i], &zeros)
+                .is_ok() {
+            // All-zero output results when the input is a point of small
+            // order.
+            results[i] = Err(error::Unspecified);
+        }
+    }
+}
+
 const ELEM_AND_SCALAR_LEN: usize = ops::ELEM_LEN;
 
 // An X25519 private key as an unmasked scalar.
@@ -119,4 +189,59 @@ extern {
                                       private_key: &PrivateKey);
     fn GFp_x25519_scalar_mult(out: &mut ops::EncodedPoint, scalar: &ops::Scalar,
                               point: &ops::EncodedPoint);
+
+    fn GFp_x25519_public_from_private_batch(public_keys_out: *mut PublicKey,
+                                            private_keys: *const PrivateKey,
+                                            num: c::size_t);
+    fn GFp_x25519_scalar_mult_batch(out: *mut SharedSecret,
+                                    scalars: *const PrivateKey,
+                                    points: *const PublicKey, num: c::size_t);
+}
+
+#[cfg(test)]
+mod tests {
+    use {ec, rand};
+    use rand::SecureRandom;
+    use super::*;
+
+    // Compares the batch functions, which use the AVX-512 IFMA code when the
+    // CPU supports it, with doing the scalar multiplications one at a time,
+    // for random inputs and for points that aren't fully reduced.
+    #[test]
+    fn test_x25519_batch() {
+        let rng = rand::SystemRandom::new();
+        for i in 0..100 {
+            let num = 1 + (i % ec::BATCH_MAX);
+            let mut scalars = [[0u8; PRIVATE_KEY_LEN]; ec::BATCH_MAX];
+            let mut points = [[0u8; PUBLIC_KEY_LEN]; ec::BATCH_MAX];
+            for (scalar, point) in scalars.iter_mut().zip(points.iter_mut()) {
+                rng.fill(scalar).unwrap();
+                rng.fill(point).unwrap();
+            }
+            if i % 3 == 0 {
+                points[0] = [0xff; PUBLIC_KEY_LEN];
+            }
+
+            let mut out = [[0u8; SHARED_SECRET_LEN]; ec::BATCH_MAX];
+            let mut public_keys = [[0u8; PUBLIC_KEY_LEN]; ec::BATCH_MAX];
+            unsafe {
+                GFp_x25519_scalar_mult_batch(out.as_mut_ptr(), scalars.as_ptr(),
+                                             points.as_ptr(), num);
+                GFp_x25519_public_from_private_batch(public_keys.as_mut_ptr(),
+                                                     scalars.as_ptr(), num);
+            }
+            for j in 0..num {
+                let mut expected = [0u8; SHARED_SECRET_LEN];
+                let mut expected_public_key = [0u8; PUBLIC_KEY_LEN];
+                unsafe {
+                    GFp_x25519_scalar_mult(&mut expected, &scalars[j],
+                                           &points[j]);
+                    GFp_x25519_public_from_private(&mut expected_public_key,
+                                                   &scalars[j]);
+                }
+                assert_eq!(&expected[..], &out[j][..]);
+                assert_eq!(&expected_public_key[..], &public_keys[j][..]);
+            }
+        }
+    }
 }
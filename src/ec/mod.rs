@@ -22,6 +22,17 @@ pub struct AgreementAlgorithmImpl {
     pub ecdh: fn(out: &mut [u8], private_key: &PrivateKey,
                  peer_public_key: untrusted::Input)
                  -> Result<(), error::Unspecified>,
+
+    // Does `ecdh` for each of up to `BATCH_MAX` private keys and peer public
+    // keys at once, with `out[i]` (truncated to `curve.elem_and_scalar_len`)
+    // and `results[i]` getting what `ecdh` would have given for the `i`th.
+    // `None` when doing them one at a time is just as fast.
+    //
+    // Precondition: All the slices have the same length.
+    pub ecdh_batch: Option<fn(out: &mut [[u8; ELEM_MAX_BYTES]],
+                              private_keys: &[&PrivateKey],
+                              peer_public_keys: &[untrusted::Input],
+                              results: &mut [Result<(), error::Unspecified>])>,
 }
 
 impl PartialEq for AgreementAlgorithmImpl {
@@ -44,6 +55,14 @@ pub struct Curve {
 
     public_from_private: fn(public_out: &mut [u8], private_key: &PrivateKey)
                             -> Result<(), error::Unspecified>,
+
+    // Does `public_from_private` for each of up to `BATCH_MAX` private keys
+    // at once, or is `None` when doing them one at a time is just as fast.
+    //
+    // Precondition: `public_out.len() == private_keys.len()`.
+    public_from_private_batch:
+        Option<fn(public_out: &mut [&mut [u8]], private_keys: &[&PrivateKey])
+                  -> Result<(), error::Unspecified>>,
 }
 
 #[derive(Clone, Copy, PartialEq)]
@@ -98,6 +117,31 @@ impl<'a> PrivateKey {
     }
 }
 
+// Like `PrivateKey::compute_public_key` for each of up to `BATCH_MAX` private
+// keys for `curve`.
+pub fn compute_public_keys(curve: &Curve, private_keys: &[&PrivateKey],
+                           out: &mut [&mut [u8]])
+                           -> Result<(), error::Unspecified> {
+    if private_keys.len() > BATCH_MAX || out.len() != private_keys.len() ||
+       out.iter().any(|out| out.len() != curve.public_key_len) {
+        return Err(error::Unspecified);
+    }
+    match curve.public_from_private_batch {
+        Some(public_from_private_batch) =>
+            public_from_private_batch(out, private_keys),
+        None => {
+            for (out, private_key) in out.iter_mut().zip(private_keys) {
+                (curve.public_from_private)(out, private_key)?;
+            }
+            Ok(())
+        },
+    }
+}
+
+
+/// The most private keys that `AgreementAlgorithmImpl::ecdh_batch` and
+/// `Curve::public_from_private_batch` take at once.
+pub const BATCH_MAX: usize = 8;
 
 const ELEM_MAX_BITS: usize = 384;
 pub const ELEM_MAX_BYTES: usize = (ELEM_MAX_BITS + 7) / 8;
@@ -40,6 +40,7 @@ macro_rules! suite_b_curve {
             check_private_key_bytes: $check_private_key_bytes,
             generate_private_key: $generate_private_key,
             public_from_private: $public_from_private,
+            public_from_private_batch: None,
         };
 
         fn $check_private_key_bytes(bytes: &[u8])
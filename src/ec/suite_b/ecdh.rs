@@ -46,6 +46,7 @@ macro_rules! ecdh {
             i: ec::AgreementAlgorithmImpl {
                 curve: $curve,
                 ecdh: $ecdh,
+                ecdh_batch: None,
             },
         };
 
@@ -16,16 +16,27 @@
 
 use arithmetic::montgomery::*;
 use core;
-use {der, digest, ec, error, pkcs8, private, rand, signature};
-use super::verify_jacobian_point_is_on_the_curve;
+use {der, digest, ec, error, init, pkcs8, private, rand, signature,
+     signature_impl};
+use super::{verify_affine_point_is_on_the_curve,
+            verify_jacobian_point_is_on_the_curve};
 use super::ops::*;
+use super::private_key;
 use super::public_key::*;
 use untrusted;
 
+#[cfg(feature = "use_heap")]
+use {pool, std};
+
 /// An ECDSA signing algorithm.
 pub struct ECDSASigningAlgorithm {
     curve: &'static ec::Curve,
+    private_key_ops: &'static PrivateKeyOps,
+    private_scalar_ops: &'static PrivateScalarOps,
+    digest_alg: &'static digest::Algorithm,
     pkcs8_template: &'static pkcs8::Template,
+    format_rs: fn(ops: &'static ScalarOps, r: &Scalar, s: &Scalar,
+                  out: &mut [u8]) -> usize,
     id: ECDSASigningAlgorithmID
 }
 
@@ -84,9 +95,6 @@ impl signature::VerificationAlgorithm for ECDSAVerificationAlgorithm {
     // Guide to ECDSA Section 3.4.2: ECDSA Signature Verification.
     fn verify(&self, public_key: untrusted::Input, msg: untrusted::Input,
               signature: untrusted::Input) -> Result<(), error::Unspecified> {
-        let public_key_ops = self.ops.public_key_ops;
-        let scalar_ops = self.ops.scalar_ops;
-
         // NSA Guide Prerequisites:
         //
         //    Prior to accepting a verified digital signature as valid the
@@ -104,7 +112,149 @@ impl signature::VerificationAlgorithm for ECDSAVerificationAlgorithm {
         // can do. Prerequisite #2 is handled implicitly as the domain
         // parameters are hard-coded into the source. Prerequisite #3 is
         // handled by `parse_uncompressed_point`.
-        let peer_pub_key = parse_uncompressed_point(public_key_ops, public_key)?;
+
+        // NSA Guide Step 2: "Use the selected hash function to compute H =
+        // Hash(M)."
+        let m_hash = digest::digest(self.digest_alg, msg.as_slice_less_safe());
+        signature::PrehashedVerificationAlgorithm::verify_digest(
+            self, public_key, &m_hash, signature)
+    }
+}
+
+impl signature::PrehashedVerificationAlgorithm for ECDSAVerificationAlgorithm {
+    fn digest_alg(&self) -> &'static digest::Algorithm { self.digest_alg }
+
+    // The rest of `verify`, given H = Hash(M).
+    fn verify_digest(&self, public_key: untrusted::Input,
+                     m_hash: &digest::Digest, signature: untrusted::Input)
+                     -> Result<(), error::Unspecified> {
+        let peer_pub_key =
+            parse_uncompressed_point(self.ops.public_key_ops, public_key)?;
+
+        let (r, s, e) = self.parse_signature_digest(m_hash, signature)?;
+
+        // NSA Guide Step 4: "Compute w = s**−1 mod n, using the routine in
+        // Appendix B.1."
+        let w = self.ops.scalar_ops.scalar_inv_to_mont(&s);
+
+        self.verify_with_w(&r, &e, &w, |u1, u2| {
+            self.ops.twin_mul(u1, u2, &peer_pub_key)
+        })
+    }
+}
+
+impl ECDSAVerificationAlgorithm {
+    /// Verifies each (public key, message, signature) triple in `items`,
+    /// returning one result per item, in the same order; `result[i]` is what
+    /// `signature::verify(self, items[i].0, items[i].1, items[i].2)` would
+    /// return.
+    ///
+    /// This is faster than verifying each signature separately: the
+    /// inversions of `s` are shared across the batch using Montgomery's trick,
+    /// and a public key that occurs more than once in the same batch is only
+    /// parsed and validated once. An invalid item doesn't affect the results
+    /// for the other items.
+    #[cfg(feature = "use_heap")]
+    pub fn verify_batch(&self,
+                        items: &[(untrusted::Input, untrusted::Input,
+                                  untrusted::Input)])
+                        -> std::vec::Vec<Result<(), error::Unspecified>> {
+        init::init_once();
+
+        let mut results = std::vec::Vec::with_capacity(items.len());
+        for chunk in items.chunks(BATCH_MAX_LEN) {
+            self.verify_chunk(chunk, &mut results);
+        }
+        results
+    }
+
+    // Verifies at most `BATCH_MAX_LEN` items, appending the results to
+    // `results`. The chunking keeps all the intermediate values on the stack.
+    #[cfg(feature = "use_heap")]
+    fn verify_chunk(&self,
+                    items: &[(untrusted::Input, untrusted::Input,
+                              untrusted::Input)],
+                    results: &mut std::vec::Vec<
+                        Result<(), error::Unspecified>>) {
+        debug_assert!(items.len() <= BATCH_MAX_LEN);
+
+        // The distinct public keys seen so far in this chunk, and their parsed
+        // forms.
+        let mut keys = [untrusted::Input::from(&[]); BATCH_MAX_LEN];
+        let mut parsed_keys = [(Elem::zero(), Elem::zero()); BATCH_MAX_LEN];
+        let mut num_keys = 0;
+
+        // The items that got through parsing, indexed by their position in
+        // the chunk.
+        let mut pending = [None; BATCH_MAX_LEN];
+        let mut s = [Scalar::zero(); BATCH_MAX_LEN];
+        let mut num_pending = 0;
+
+        for (i, &(public_key, msg, signature)) in items.iter().enumerate() {
+            let key_index =
+                match keys[..num_keys].iter().position(|k| {
+                    k.as_slice_less_safe() == public_key.as_slice_less_safe()
+                }) {
+                    Some(key_index) => Ok(key_index),
+                    None => {
+                        parse_uncompressed_point(self.ops.public_key_ops,
+                                                 public_key).map(|parsed| {
+                            keys[num_keys] = public_key;
+                            parsed_keys[num_keys] = parsed;
+                            num_keys += 1;
+                            num_keys - 1
+                        })
+                    },
+                };
+            let parsed = key_index.and_then(|key_index| {
+                let (r, s, e) = self.parse_signature(msg, signature)?;
+                Ok((key_index, r, s, e))
+            });
+            if let Ok((key_index, r, s_i, e)) = parsed {
+                pending[i] = Some((key_index, r, e, num_pending));
+                s[num_pending] = s_i;
+                num_pending += 1;
+            }
+        }
+
+        // NSA Guide Step 4, for every pending item at once.
+        let mut w = [Scalar::zero(); BATCH_MAX_LEN];
+        self.ops.scalar_ops.scalars_inv_to_mont(&s[..num_pending],
+                                                &mut w[..num_pending]);
+
+        for pending in &pending[..items.len()] {
+            results.push(match *pending {
+                Some((key_index, ref r, ref e, w_index)) =>
+                    self.verify_with_w(r, e, &w[w_index], |u1, u2| {
+                        self.ops.twin_mul(u1, u2, &parsed_keys[key_index])
+                    }),
+                None => Err(error::Unspecified),
+            });
+        }
+    }
+
+    // Returns `(r, s, e)` where `r` and `s` are the components of `signature`
+    // and `e` is the digest of `msg` converted to a scalar.
+    fn parse_signature(&self, msg: untrusted::Input,
+                       signature: untrusted::Input)
+                       -> Result<(Scalar, Scalar, Scalar), error::Unspecified> {
+        // NSA Guide Step 2: "Use the selected hash function to compute H =
+        // Hash(M)."
+        let m_hash = digest::digest(self.digest_alg, msg.as_slice_less_safe());
+        self.parse_signature_digest(&m_hash, signature)
+    }
+
+    // Like `parse_signature`, given H = Hash(M).
+    fn parse_signature_digest(&self, m_hash: &digest::Digest,
+                              signature: untrusted::Input)
+                              -> Result<(Scalar, Scalar, Scalar),
+                                        error::Unspecified> {
+        if m_hash.algorithm() != self.digest_alg {
+            return Err(error::Unspecified);
+        }
+
+        let public_key_ops = self.ops.public_key_ops;
+        let scalar_ops = self.ops.scalar_ops;
 
         let (r, s) = signature.read_all(
             error::Unspecified, |input| (self.split_rs)(scalar_ops, input))?;
@@ -116,26 +266,30 @@ impl signature::VerificationAlgorithm for ECDSAVerificationAlgorithm {
         let s = scalar_parse_big_endian_variable(public_key_ops.common,
                                                  AllowZero::No, s)?;
 
-        // NSA Guide Step 2: "Use the selected hash function to compute H =
-        // Hash(M)."
         // NSA Guide Step 3: "Convert the bit string H to an integer e as
         // described in Appendix B.2."
-        let e = digest_scalar(scalar_ops, self.digest_alg, msg);
+        let e = digest_scalar(scalar_ops, m_hash);
 
-        // NSA Guide Step 4: "Compute w = s**−1 mod n, using the routine in
-        // Appendix B.1."
-        let w = scalar_ops.scalar_inv_to_mont(&s);
+        Ok((r, s, e))
+    }
+
+    // The remainder of the verification, given w = s**-1 mod n.
+    // `twin_mul(u1, u2)` must return u1*G + u2*Q for the public key Q.
+    fn verify_with_w<F>(&self, r: &Scalar, e: &Scalar, w: &Scalar<R>,
+                        twin_mul: F) -> Result<(), error::Unspecified>
+                        where F: FnOnce(&Scalar, &Scalar) -> Point {
+        let public_key_ops = self.ops.public_key_ops;
+        let scalar_ops = self.ops.scalar_ops;
 
         // NSA Guide Step 5: "Compute u1 = (e * w) mod n, and compute
         // u2 = (r * w) mod n."
-        let u1 = scalar_ops.scalar_product(&e, &w);
-        let u2 = scalar_ops.scalar_product(&r, &w);
+        let u1 = scalar_ops.scalar_product(e, w);
+        let u2 = scalar_ops.scalar_product(r, w);
 
         // NSA Guide Step 6: "Compute the elliptic curve point
         // R = (xR, yR) = u1*G + u2*Q, using EC scalar multiplication and EC
         // addition. If R is equal to the point at infinity, output INVALID."
-        let product =
-            twin_mul(self.ops.private_key_ops, &u1, &u2, &peer_pub_key);
+        let product = twin_mul(&u1, &u2);
 
         // Verify that the point we computed is on the curve; see
         // `verify_affine_point_is_on_the_curve_scaled` for details on why. It
@@ -161,7 +315,7 @@ impl signature::VerificationAlgorithm for ECDSAVerificationAlgorithm {
             let x = cops.elem_unencoded(x);
             ops.elem_equals(&r_jacobian, &x)
         }
-        let r = self.ops.scalar_as_elem(&r);
+        let r = self.ops.scalar_as_elem(r);
         if sig_r_equals_x(self.ops, &r, &x, &z2) {
             return Ok(());
         }
@@ -177,15 +331,107 @@ impl signature::VerificationAlgorithm for ECDSAVerificationAlgorithm {
     }
 }
 
+// The number of items that `verify_batch` processes at a time.
+#[cfg(feature = "use_heap")]
+const BATCH_MAX_LEN: usize = 16;
+
 impl private::Private for ECDSAVerificationAlgorithm {}
 
+/// An ECDSA public key that has been parsed and validated, for verifying many
+/// signatures made with the same key.
+///
+/// `signature::verify` parses the public key, checks that it is on the curve,
+/// and converts it to the internal representation every time it is called;
+/// an `ECDSAPublicKey` does that work once. Optionally, it also precomputes a
+/// table of multiples of the public key, so each verification only has to do
+/// the work that depends on the signature.
+pub struct ECDSAPublicKey {
+    alg: &'static ECDSAVerificationAlgorithm,
+    point: (Elem<R>, Elem<R>),
+
+    #[cfg(feature = "use_heap")]
+    table: Option<PointTable>,
+}
+
+impl ECDSAPublicKey {
+    /// Parses and validates `public_key`, which must be encoded the same way
+    /// as the `public_key` argument of `signature::verify` is for `alg`, i.e.
+    /// as an uncompressed point.
+    pub fn from_uncompressed(alg: &'static ECDSAVerificationAlgorithm,
+                             public_key: untrusted::Input)
+                             -> Result<ECDSAPublicKey, error::Unspecified> {
+        init::init_once();
+        let point = parse_uncompressed_point(alg.ops.public_key_ops,
+                                             public_key)?;
+        Ok(ECDSAPublicKey {
+            alg,
+            point,
+            #[cfg(feature = "use_heap")]
+            table: None,
+        })
+    }
+
+    /// Like `from_uncompressed`, but also precomputes a table of multiples of
+    /// the public key to speed up each verification. The table takes a
+    /// couple of kilobytes of memory and costs a small fraction of one
+    /// verification to compute, so it is worthwhile for keys that are used
+    /// more than a few times.
+    #[cfg(feature = "use_heap")]
+    pub fn from_uncompressed_with_table(
+            alg: &'static ECDSAVerificationAlgorithm,
+            public_key: untrusted::Input)
+            -> Result<ECDSAPublicKey, error::Unspecified> {
+        let mut key = ECDSAPublicKey::from_uncompressed(alg, public_key)?;
+        key.table = Some(alg.ops.point_odd_multiples(&key.point));
+        Ok(key)
+    }
+
+    /// The algorithm this key was prepared for.
+    pub fn algorithm(&self) -> &'static ECDSAVerificationAlgorithm { self.alg }
+
+    /// Verifies the signature `signature` of message `msg` with this key.
+    /// The result is the same as `signature::verify`'s with the algorithm and
+    /// encoded public key that this key was constructed from.
+    pub fn verify(&self, msg: untrusted::Input, signature: untrusted::Input)
+                  -> Result<(), error::Unspecified> {
+        let alg = self.alg;
+        let (r, s, e) = alg.parse_signature(msg, signature)?;
+        let w = alg.ops.scalar_ops.scalar_inv_to_mont(&s);
+        alg.verify_with_w(&r, &e, &w, |u1, u2| self.twin_mul(u1, u2))
+    }
+
+    /// Verifies the signature `signature` of the message with digest `m_hash`
+    /// with this key. See `signature::verify_digest`.
+    pub fn verify_digest(&self, m_hash: &digest::Digest,
+                         signature: untrusted::Input)
+                         -> Result<(), error::Unspecified> {
+        let alg = self.alg;
+        let (r, s, e) = alg.parse_signature_digest(m_hash, signature)?;
+        let w = alg.ops.scalar_ops.scalar_inv_to_mont(&s);
+        alg.verify_with_w(&r, &e, &w, |u1, u2| self.twin_mul(u1, u2))
+    }
+
+    #[cfg(feature = "use_heap")]
+    fn twin_mul(&self, u1: &Scalar, u2: &Scalar) -> Point {
+        match self.table {
+            Some(ref table) => self.alg.ops.twin_mul_table(u1, u2, table),
+            None => self.alg.ops.twin_mul(u1, u2, &self.point),
+        }
+    }
+
+    #[cfg(not(feature = "use_heap"))]
+    fn twin_mul(&self, u1: &Scalar, u2: &Scalar) -> Point {
+        self.alg.ops.twin_mul(u1, u2, &self.point)
+    }
+}
+
 /// An ECDSA key pair, used for signing.
-#[doc(hidden)]
 pub struct ECDSAKeyPair {
-    #[allow(dead_code)] // XXX: Temporary, since signing isn't implemented yet.
-    key_pair: ec::KeyPair,
+    // The private key, Montgomery-encoded (mod n).
+    d: Scalar<R>,
+
+    public_key: [u8; ec::PUBLIC_KEY_MAX_LEN],
 
-    #[allow(dead_code)] // XXX: Temporary, since signing isn't implemented yet.
     alg: &'static ECDSASigningAlgorithm,
 }
 
@@ -227,7 +473,7 @@ impl<'a> ECDSAKeyPair {
                       -> Result<ECDSAKeyPair, error::Unspecified> {
         let key_pair = ec::suite_b::key_pair_from_pkcs8(alg.curve,
             alg.pkcs8_template, input)?;
-        Ok(ECDSAKeyPair { key_pair, alg })
+        Ok(ECDSAKeyPair::new(alg, key_pair))
     }
 
     /// Constructs an ECDSA key pair directly from the big-endian-encoded
@@ -242,7 +488,272 @@ impl<'a> ECDSAKeyPair {
                       -> Result<ECDSAKeyPair, error::Unspecified> {
         let key_pair = ec::suite_b::key_pair_from_bytes(
             alg.curve, private_key, public_key)?;
-        Ok(ECDSAKeyPair { key_pair, alg })
+        Ok(ECDSAKeyPair::new(alg, key_pair))
+    }
+
+    fn new(alg: &'static ECDSASigningAlgorithm, key_pair: ec::KeyPair)
+           -> ECDSAKeyPair {
+        let d = private_key::private_key_as_scalar(alg.private_key_ops,
+                                                   &key_pair.private_key);
+        ECDSAKeyPair {
+            d: alg.private_scalar_ops.to_mont(&d),
+            public_key: key_pair.public_key,
+            alg,
+        }
+    }
+
+    /// Returns a reference to the public key, in the uncompressed form that
+    /// `signature::verify()` takes.
+    pub fn public_key_bytes(&'a self) -> &'a [u8] {
+        &self.public_key[..self.alg.curve.public_key_len]
+    }
+
+    /// Returns the signature of the message `msg`, using a new nonce from
+    /// `rng`.
+    pub fn sign(&self, msg: &[u8], rng: &rand::SecureRandom)
+                -> Result<signature::Signature, error::Unspecified> {
+        // NSA Guide Step 4: "Use the selected hash function to compute H =
+        // Hash(M)."
+        let m_hash = digest::digest(self.alg.digest_alg, msg);
+        self.sign_digest(&m_hash, rng)
+    }
+
+    /// Returns the signature of the message whose digest is `m_hash`, which
+    /// must have been computed with the algorithm's digest algorithm. The
+    /// signature is the same as `sign()` would compute for the message, given
+    /// the same nonce.
+    pub fn sign_digest(&self, m_hash: &digest::Digest,
+                       rng: &rand::SecureRandom)
+                       -> Result<signature::Signature, error::Unspecified> {
+        init::init_once();
+        self.sign_(m_hash, || new_nonce(self.alg, rng))
+    }
+
+    /// Returns the signature of the message `msg`, using a nonce from `nonces`
+    /// if it has one and a new nonce from `rng` otherwise.
+    ///
+    /// The signature takes a few scalar multiplications when the nonce comes
+    /// from `nonces`, instead of a point multiplication and an inversion. The
+    /// pool must be for the same curve as the key pair.
+    #[cfg(feature = "use_heap")]
+    pub fn sign_with_nonce_pool(&self, nonces: &ECDSANoncePool, msg: &[u8],
+                                rng: &rand::SecureRandom)
+                                -> Result<signature::Signature,
+                                          error::Unspecified> {
+        if nonces.alg.curve.id != self.alg.curve.id {
+            return Err(error::Unspecified);
+        }
+        init::init_once();
+        let m_hash = digest::digest(self.alg.digest_alg, msg);
+        self.sign_(&m_hash, || match nonces.take() {
+            Some(nonce) => Ok(nonce),
+            None => new_nonce(self.alg, rng),
+        })
+    }
+
+    // Signs as documented in the NSA Suite B Implementer's Guide to ECDSA
+    // Section 3.4.1: ECDSA Signature Generation. Steps 1 through 3 are done
+    // by `generate_nonces`, maybe ahead of time, and Step 4 is done by the
+    // caller.
+    fn sign_<F>(&self, m_hash: &digest::Digest, mut next_nonce: F)
+                -> Result<signature::Signature, error::Unspecified>
+                where F: FnMut() -> Result<Nonce, error::Unspecified> {
+        if m_hash.algorithm() != self.alg.digest_alg {
+            return Err(error::Unspecified);
+        }
+
+        let ops = self.alg.private_scalar_ops;
+        let scalar_ops = ops.scalar_ops;
+
+        // NSA Guide Step 5: "Compute e = OS2I(H) mod n."
+        let e = digest_scalar(scalar_ops, m_hash);
+
+        // Like `generate_private_key`, give up after a number of tries that
+        // is only reached when something is very wrong.
+        for _ in 0..100 {
+            let Nonce { k_inv, r } = next_nonce()?;
+
+            // NSA Guide Step 6: "Compute s = (k**−1 * (e + d*r)) mod n. If
+            // s = 0, return to Step 1."
+            let s = {
+                let dr = scalar_ops.scalar_product(&self.d, &r);
+                let e_plus_dr = ops.scalar_sum(&e, &dr);
+                scalar_ops.scalar_product(&k_inv, &e_plus_dr)
+            };
+            if scalar_ops.common.is_zero(&s) {
+                continue;
+            }
+
+            // NSA Guide Step 7: "Return (r, s)."
+            let mut sig = [0; signature_impl::MAX_LEN];
+            let sig_len = (self.alg.format_rs)(scalar_ops, &r, &s, &mut sig);
+            return Ok(signature_impl::signature_from_bytes(&sig[..sig_len]));
+        }
+
+        Err(error::Unspecified)
+    }
+}
+
+/// An ECDSA nonce *k*, in the form that signing needs it: k**-1 (mod n), and
+/// r, the x-coordinate of k*G (mod n). Nonces only depend on the curve, not on
+/// the key or the message, but each one must only be used for one signature,
+/// so `Nonce` is neither `Copy` nor `Clone`.
+struct Nonce {
+    k_inv: Scalar<R>,
+    r: Scalar,
+}
+
+impl Nonce {
+    // A placeholder for `generate_nonces` to overwrite.
+    fn zero() -> Self { Nonce { k_inv: Scalar::zero(), r: Scalar::zero() } }
+}
+
+// The most nonces that one call of `generate_nonces` computes.
+const NONCE_BATCH_MAX_LEN: usize = 16;
+
+fn new_nonce(alg: &ECDSASigningAlgorithm, rng: &rand::SecureRandom)
+             -> Result<Nonce, error::Unspecified> {
+    let mut nonces = [Nonce::zero()];
+    generate_nonces(alg, rng, &mut nonces)?;
+    Ok(core::mem::replace(&mut nonces[0], Nonce::zero()))
+}
+
+// Fills `out` with new nonces. Each nonce takes its own point multiplication
+// but all of them share one field inversion to convert the points to affine
+// coordinates, and one scalar inversion for the k**-1 values, using
+// Montgomery's trick.
+fn generate_nonces(alg: &ECDSASigningAlgorithm, rng: &rand::SecureRandom,
+                   out: &mut [Nonce]) -> Result<(), error::Unspecified> {
+    assert!(out.len() <= NONCE_BATCH_MAX_LEN);
+    let num_nonces = out.len();
+    let priv_ops = alg.private_key_ops;
+    let scalar_ops = alg.private_scalar_ops;
+    let cops = priv_ops.common;
+
+    let mut k = [Scalar::zero(); NONCE_BATCH_MAX_LEN];
+    let mut points = [Point::new_at_infinity(); NONCE_BATCH_MAX_LEN];
+    let mut z = [Elem::zero(); NONCE_BATCH_MAX_LEN];
+    let mut zz_inv = [Elem::zero(); NONCE_BATCH_MAX_LEN];
+    let mut k_inv = [Scalar::zero(); NONCE_BATCH_MAX_LEN];
+
+    'batch: for _ in 0..100 {
+        for i in 0..num_nonces {
+            // NSA Guide Step 1: "Generate a random per-message secret number
+            // k such that 0 < k < n."
+            k[i] = private_key::random_scalar(priv_ops, rng)?;
+
+            // NSA Guide Step 2: "Compute the elliptic curve point R = kG."
+            points[i] = priv_ops.point_mul_base(&k[i]);
+
+            // R isn't at infinity because 0 < k < n and the curve has prime
+            // order n, so z isn't zero.
+            z[i] = cops.point_z(&points[i]);
+        }
+        priv_ops.elems_inverse_squared(&z[..num_nonces],
+                                       &mut zz_inv[..num_nonces]);
+
+        for i in 0..num_nonces {
+            // NSA Guide Step 3: "Compute r = xR mod n. If r = 0, return to
+            // Step 1."
+            let x = cops.elem_product(&cops.point_x(&points[i]), &zz_inv[i]);
+
+            // As in `big_endian_affine_from_jacobian`, check that R is on the
+            // curve in case the computation went wrong.
+            let y = {
+                let zzzz_inv = cops.elem_squared(&zz_inv[i]);
+                let zzz_inv = cops.elem_product(&z[i], &zzzz_inv);
+                cops.elem_product(&cops.point_y(&points[i]), &zzz_inv)
+            };
+            verify_affine_point_is_on_the_curve(cops, (&x, &y))?;
+
+            let r = scalar_ops.elem_reduced_to_scalar(&cops.elem_unencoded(&x));
+            if cops.is_zero(&r) {
+                continue 'batch;
+            }
+            out[i].r = r;
+        }
+
+        scalar_ops.scalar_ops.scalars_inv_to_mont(&k[..num_nonces],
+                                                  &mut k_inv[..num_nonces]);
+        for (out, k_inv) in out.iter_mut().zip(k_inv.iter()) {
+            out.k_inv = *k_inv;
+        }
+        return Ok(());
+    }
+
+    Err(error::Unspecified)
+}
+
+/// A bounded pool of precomputed ECDSA nonces, for signing with less latency
+/// using `ECDSAKeyPair::sign_with_nonce_pool()`.
+///
+/// Most of the work of an ECDSA signature is computing its nonce, which
+/// doesn't depend on the key or the message: a point multiplication and two
+/// inversions. `precompute()` does that work ahead of time, e.g. on threads
+/// that are otherwise idle, in batches that share their inversions. Signing
+/// with a precomputed nonce leaves only a few scalar multiplications.
+///
+/// Each nonce is taken out of the pool by exactly one signature. Taking
+/// nonces and putting them into the pool doesn't take any locks, so any number
+/// of threads can share a pool. When the pool is empty, signing computes a new
+/// nonce itself, the same as `ECDSAKeyPair::sign()`.
+///
+/// Anybody who learns a nonce and the signature that used it can compute the
+/// private key, so a pool needs the same protection as the key pair it is
+/// used with. Typically each key pair has its own pool.
+#[cfg(feature = "use_heap")]
+pub struct ECDSANoncePool {
+    alg: &'static ECDSASigningAlgorithm,
+    nonces: pool::Pool<Nonce>,
+}
+
+#[cfg(feature = "use_heap")]
+impl ECDSANoncePool {
+    /// Constructs an empty pool with room for `capacity` nonces for key pairs
+    /// of `alg`'s curve.
+    pub fn new(alg: &'static ECDSASigningAlgorithm, capacity: usize) -> Self {
+        ECDSANoncePool {
+            alg,
+            nonces: pool::Pool::new(capacity),
+        }
+    }
+
+    /// Fills the empty slots of the pool with new nonces from `rng`. At most
+    /// `capacity()` nonces are computed even if other threads are taking
+    /// nonces out of the pool at the same time.
+    #[allow(box_pointers)]
+    pub fn precompute(&self, rng: &rand::SecureRandom)
+                      -> Result<(), error::Unspecified> {
+        init::init_once();
+        let capacity = self.capacity();
+        let mut remaining = capacity;
+        let mut batch = std::vec::Vec::with_capacity(NONCE_BATCH_MAX_LEN);
+        loop {
+            let batch_len = core::cmp::min(
+                core::cmp::min(capacity - self.len(), remaining),
+                NONCE_BATCH_MAX_LEN);
+            if batch_len == 0 {
+                return Ok(());
+            }
+            batch.extend((0..batch_len).map(|_| Nonce::zero()));
+            generate_nonces(self.alg, rng, &mut batch)?;
+            for nonce in batch.drain(..) {
+                self.nonces.put(std::boxed::Box::new(nonce));
+            }
+            remaining -= batch_len;
+        }
+    }
+
+    /// The number of nonces in the pool.
+    pub fn len(&self) -> usize { self.nonces.len() }
+
+    /// The most nonces the pool holds.
+    pub fn capacity(&self) -> usize { self.nonces.capacity() }
+
+    // Moves a nonce out of the pool, so that no other signature can use it.
+    #[allow(box_pointers)]
+    fn take(&self) -> Option<Nonce> {
+        self.nonces.take().map(|nonce| *nonce)
     }
 }
 
@@ -256,6 +767,62 @@ fn split_rs_fixed<'a>(
     Ok((r, s))
 }
 
+fn format_rs_fixed(ops: &'static ScalarOps, r: &Scalar, s: &Scalar,
+                   out: &mut [u8]) -> usize {
+    let num_limbs = ops.common.num_limbs;
+    let scalar_len = ops.scalar_bytes_len();
+    let (r_out, rest) = out.split_at_mut(scalar_len);
+    big_endian_from_limbs_padded(&r.limbs[..num_limbs], r_out);
+    let (s_out, _) = rest.split_at_mut(scalar_len);
+    big_endian_from_limbs_padded(&s.limbs[..num_limbs], s_out);
+    2 * scalar_len
+}
+
+fn format_rs_asn1(ops: &'static ScalarOps, r: &Scalar, s: &Scalar,
+                  out: &mut [u8]) -> usize {
+    // This assumes `a` is not zero since neither `r` or `s` is allowed to be
+    // zero.
+    fn format_integer_tlv(ops: &ScalarOps, a: &Scalar, out: &mut [u8])
+                          -> usize {
+        let mut fixed = [0u8; ec::SCALAR_MAX_BYTES + 1];
+        let fixed = &mut fixed[..(ops.scalar_bytes_len() + 1)];
+        big_endian_from_limbs_padded(&a.limbs[..ops.common.num_limbs],
+                                     &mut fixed[1..]);
+
+        // Since `a` is non-zero, there is a non-zero byte, and `fixed[0]` is
+        // zero so it can be the prefix that keeps the high bit of the first
+        // byte from making the value negative.
+        let first_index = fixed.iter().position(|b| *b != 0).unwrap();
+        let first_index =
+            if fixed[first_index] & 0x80 != 0 {
+                first_index - 1
+            } else {
+                first_index
+            };
+        let value = &fixed[first_index..];
+
+        out[0] = der::Tag::Integer as u8;
+
+        // Lengths less than 128 are encoded in one byte.
+        assert!(value.len() < 128);
+        out[1] = value.len() as u8;
+
+        out[2..][..value.len()].copy_from_slice(value);
+        2 + value.len()
+    }
+
+    out[0] = der::Tag::Sequence as u8;
+    let r_tlv_len = format_integer_tlv(ops, r, &mut out[2..]);
+    let s_tlv_len = format_integer_tlv(ops, s, &mut out[2..][r_tlv_len..]);
+
+    // Lengths less than 128 are encoded in one byte.
+    let value_len = r_tlv_len + s_tlv_len;
+    assert!(value_len < 128);
+    out[1] = value_len as u8;
+
+    2 + value_len
+}
+
 fn split_rs_asn1<'a>(
         _ops: &'static ScalarOps, input: &mut untrusted::Reader<'a>)
         -> Result<(untrusted::Input<'a>, untrusted::Input<'a>),
@@ -267,8 +834,7 @@ fn split_rs_asn1<'a>(
     })
 }
 
-/// Calculate the digest of `msg` using the digest algorithm `digest_alg`. Then
-/// convert the digest to a scalar in the range [0, n) as described in
+/// Convert the digest `m_hash` to a scalar in the range [0, n) as described in
 /// NIST's FIPS 186-4 Section 4.2. Note that this is one of the few cases where
 /// a `Scalar` is allowed to have the value zero.
 ///
@@ -293,10 +859,8 @@ fn split_rs_asn1<'a>(
 /// right will give a value less than 2**255, which is less than `n`. The
 /// analogous argument applies for P-384. However, it does *not* apply in
 /// general; for example, it doesn't apply to P-521.
-fn digest_scalar(ops: &ScalarOps, digest_alg: &'static digest::Algorithm,
-                 msg: untrusted::Input) -> Scalar {
-    let digest = digest::digest(digest_alg, msg.as_slice_less_safe());
-    digest_scalar_(ops, digest.as_ref())
+fn digest_scalar(ops: &ScalarOps, m_hash: &digest::Digest) -> Scalar {
+    digest_scalar_(ops, m_hash.as_ref())
 }
 
 // This is a separate function solely so that we can test specific digest
@@ -314,25 +878,20 @@ fn digest_scalar_(ops: &ScalarOps, digest: &[u8]) -> Scalar {
         cops, AllowZero::Yes, untrusted::Input::from(digest)).unwrap()
 }
 
-fn twin_mul(ops: &PrivateKeyOps, g_scalar: &Scalar, p_scalar: &Scalar,
-            p_xy: &(Elem<R>, Elem<R>)) -> Point {
-    // XXX: Inefficient. TODO: implement interleaved wNAF multiplication.
-    let scaled_g = ops.point_mul_base(g_scalar);
-    let scaled_p = ops.point_mul(p_scalar, p_xy);
-    ops.common.point_sum(&scaled_g, &scaled_p)
-}
-
 
 /// Signing of fixed-length (PKCS#11 style) ECDSA signatures using the
 /// P-256 curve and SHA-256.
 ///
 /// See "`ECDSA_*_FIXED` Details" in `ring::signature`'s module-level
 /// documentation for more details.
-#[doc(hidden)]
 pub static ECDSA_P256_SHA256_FIXED_SIGNING: ECDSASigningAlgorithm =
         ECDSASigningAlgorithm {
     curve: &ec::suite_b::curve::P256,
+    private_key_ops: &p256::PRIVATE_KEY_OPS,
+    private_scalar_ops: &p256::PRIVATE_SCALAR_OPS,
+    digest_alg: &digest::SHA256,
     pkcs8_template: &EC_PUBLIC_KEY_P256_PKCS8_V1_TEMPLATE,
+    format_rs: format_rs_fixed,
     id: ECDSASigningAlgorithmID::ECDSA_P256_SHA256_FIXED_SIGNING,
 };
 
@@ -354,11 +913,14 @@ pub static ECDSA_P256_SHA256_FIXED: ECDSAVerificationAlgorithm =
 ///
 /// See "`ECDSA_*_FIXED` Details" in `ring::signature`'s module-level
 /// documentation for more details.
-#[doc(hidden)]
 pub static ECDSA_P384_SHA384_FIXED_SIGNING: ECDSASigningAlgorithm =
         ECDSASigningAlgorithm {
     curve: &ec::suite_b::curve::P384,
+    private_key_ops: &p384::PRIVATE_KEY_OPS,
+    private_scalar_ops: &p384::PRIVATE_SCALAR_OPS,
+    digest_alg: &digest::SHA384,
     pkcs8_template: &EC_PUBLIC_KEY_P384_PKCS8_V1_TEMPLATE,
+    format_rs: format_rs_fixed,
     id: ECDSASigningAlgorithmID::ECDSA_P384_SHA384_FIXED_SIGNING,
 };
 
@@ -380,11 +942,14 @@ pub static ECDSA_P384_SHA384_FIXED: ECDSAVerificationAlgorithm =
 ///
 /// See "`ECDSA_*_ASN1` Details" in `ring::signature`'s module-level
 /// documentation for more details.
-#[doc(hidden)]
 pub static ECDSA_P256_SHA256_ASN1_SIGNING: ECDSASigningAlgorithm =
         ECDSASigningAlgorithm {
     curve: &ec::suite_b::curve::P256,
+    private_key_ops: &p256::PRIVATE_KEY_OPS,
+    private_scalar_ops: &p256::PRIVATE_SCALAR_OPS,
+    digest_alg: &digest::SHA256,
     pkcs8_template: &EC_PUBLIC_KEY_P256_PKCS8_V1_TEMPLATE,
+    format_rs: format_rs_asn1,
     id: ECDSASigningAlgorithmID::ECDSA_P256_SHA256_ASN1_SIGNING,
 };
 
@@ -442,11 +1007,14 @@ pub static ECDSA_P384_SHA256_ASN1: ECDSAVerificationAlgorithm =
 ///
 /// See "`ECDSA_*_ASN1` Details" in `ring::signature`'s module-level
 /// documentation for more details.
-#[doc(hidden)]
 pub static ECDSA_P384_SHA384_ASN1_SIGNING: ECDSASigningAlgorithm =
         ECDSASigningAlgorithm {
     curve: &ec::suite_b::curve::P384,
+    private_key_ops: &p384::PRIVATE_KEY_OPS,
+    private_scalar_ops: &p384::PRIVATE_SCALAR_OPS,
+    digest_alg: &digest::SHA384,
     pkcs8_template: &EC_PUBLIC_KEY_P384_PKCS8_V1_TEMPLATE,
+    format_rs: format_rs_asn1,
     id: ECDSASigningAlgorithmID::ECDSA_P384_SHA384_ASN1_SIGNING,
 };
 
@@ -90,19 +90,12 @@ pub fn unary_op<M, E: Encoding>(
     r
 }
 
-// a := f(a);
-#[inline]
-pub fn unary_op_assign<M, E: Encoding>(
-        f: unsafe extern fn(r: *mut Limb, a: *const Limb), a: &mut Elem<M, E>) {
-    unsafe { f(a.limbs.as_mut_ptr(), a.limbs.as_ptr()) }
-}
-
-// a := f(a, a);
-#[inline]
-pub fn unary_op_from_binary_op_assign<M, E: Encoding>(
-        f: unsafe extern fn(r: *mut Limb, a: *const Limb, b: *const Limb),
-        a: &mut Elem<M, E>) {
-    unsafe { f(a.limbs.as_mut_ptr(), a.limbs.as_ptr(), a.limbs.as_ptr()) }
-}
-
+// Every `Elem`, `Scalar`, and `Point` is sized for P-384, the largest curve,
+// and the operations only look at the curve's `num_limbs` limbs. Sizing them
+// exactly for P-256 instead wouldn't pay for the per-curve types it requires:
+// with `MAX_LIMBS` cut to P-256's size, P-256 ECDSA signing and ECDH
+// key generation ran no faster, since nearly all the time is spent in the
+// assembly language field and point arithmetic. For the same reason, the
+// `CommonOps` function pointers cost nothing that matters; they point to
+// assembly language functions that couldn't be inlined anyway.
 pub const MAX_LIMBS: usize = (384 + (LIMB_BITS - 1)) / LIMB_BITS;
@@ -13,10 +13,14 @@
 // CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
 use arithmetic::montgomery::*;
+use c;
 use core::marker::PhantomData;
 use error;
 use untrusted;
 
+#[cfg(feature = "use_heap")]
+use std;
+
 pub use limb::*; // XXX
 pub use self::elem::*; // XXX
 
@@ -144,16 +148,19 @@ impl CommonOps {
         mul_mont(self.elem_mul_mont, a, b)
     }
 
-    #[inline]
-    pub fn elem_square(&self, a: &mut Elem<R>) {
-        unary_op_assign(self.elem_sqr_mont, a);
-    }
-
     #[inline]
     pub fn elem_squared(&self, a: &Elem<R>) -> Elem<R> {
         unary_op(self.elem_sqr_mont, a)
     }
 
+    /// Returns `a**-1 (mod q)`. Panics if `a` is zero.
+    pub fn elem_inverse(&self, a: &Elem<R>) -> Elem<R> {
+        // The inverse of a * R**-1 is a**-1 * R, i.e. the Montgomery
+        // encoding of a**-1.
+        let a = self.elem_product(&self.elem_unencoded(a), &ONE);
+        inverse_consttime(&a, &self.q.p[..self.num_limbs])
+    }
+
     #[inline]
     pub fn is_zero<M, E: Encoding>(&self, a: &elem::Elem<M, E>) -> bool {
         limbs_are_zero_constant_time(&a.limbs[..self.num_limbs]) ==
@@ -169,6 +176,7 @@ impl CommonOps {
         }
     }
 
+    #[cfg_attr(not(test), allow(dead_code))]
     pub fn point_sum(&self, a: &Point, b: &Point) -> Point {
         let mut r = Point::new_at_infinity();
         unsafe {
@@ -208,7 +216,6 @@ struct Mont {
 /// Operations on private keys, for ECDH and ECDSA signing.
 pub struct PrivateKeyOps {
     pub common: &'static CommonOps,
-    elem_inv_squared: fn(a: &Elem<R>) -> Elem<R>,
     point_mul_base_impl: fn(a: &Scalar) -> Point,
     point_mul_impl: unsafe extern fn(r: *mut Limb/*[3][num_limbs]*/,
                                      p_scalar: *const Limb/*[num_limbs]*/,
@@ -235,7 +242,53 @@ impl PrivateKeyOps {
 
     #[inline]
     pub fn elem_inverse_squared(&self, a: &Elem<R>) -> Elem<R> {
-        (self.elem_inv_squared)(a)
+        self.common.elem_squared(&self.common.elem_inverse(a))
+    }
+
+    /// Returns the affine coordinates (x, y) of `p`, using one inversion.
+    /// Panics if `p` is the point at infinity.
+    pub fn point_affine(&self, p: &Point) -> (Elem<R>, Elem<R>) {
+        let ops = self.common;
+        let z = ops.point_z(p);
+        assert!(ops.elem_verify_is_not_zero(&z).is_ok());
+
+        let z_inv = ops.elem_inverse(&z);
+        let zz_inv = ops.elem_squared(&z_inv);
+        let zzz_inv = ops.elem_product(&zz_inv, &z_inv);
+
+        let x_aff = ops.elem_product(&ops.point_x(p), &zz_inv);
+        let y_aff = ops.elem_product(&ops.point_y(p), &zzz_inv);
+        (x_aff, y_aff)
+    }
+
+    /// Sets `out[i]` to the same value as `elem_inverse_squared(&a[i])` for
+    /// each `i`, using Montgomery's trick so that only one inversion is done.
+    /// Panics if any element of `a` is zero or if `a` and `out` have different
+    /// lengths.
+    pub fn elems_inverse_squared(&self, a: &[Elem<R>], out: &mut [Elem<R>]) {
+        assert_eq!(a.len(), out.len());
+        if a.is_empty() {
+            return;
+        }
+        let ops = self.common;
+        for a in a {
+            assert!(!ops.is_zero(a));
+        }
+
+        // out[i] = a[0]*a[1]*...*a[i].
+        out[0] = a[0];
+        for i in 1..a.len() {
+            out[i] = ops.elem_product(&out[i - 1], &a[i]);
+        }
+
+        let mut acc = self.elem_inverse_squared(&out[a.len() - 1]);
+        for i in (1..a.len()).rev() {
+            // acc == (a[0]*...*a[i])**-2.
+            let prefix_squared = ops.elem_squared(&out[i - 1]);
+            out[i] = ops.elem_product(&acc, &prefix_squared);
+            ops.elem_mul(&mut acc, &ops.elem_squared(&a[i]));
+        }
+        out[0] = acc;
     }
 }
 
@@ -276,7 +329,6 @@ impl PublicKeyOps {
 pub struct ScalarOps {
     pub common: &'static CommonOps,
 
-    scalar_inv_to_mont_impl: fn(a: &Scalar) -> Scalar<R>,
     scalar_mul_mont: unsafe extern fn(r: *mut Limb, a: *const Limb,
                                       b: *const Limb),
 }
@@ -291,7 +343,65 @@ impl ScalarOps {
     /// because zero isn't invertible.
     pub fn scalar_inv_to_mont(&self, a: &Scalar) -> Scalar<R> {
         assert!(!self.common.is_zero(a));
-        (self.scalar_inv_to_mont_impl)(a)
+        let cops = self.common;
+        let one: Scalar = Scalar {
+            limbs: ONE.limbs,
+            m: PhantomData,
+            encoding: PhantomData,
+        };
+        // As in `CommonOps::elem_inverse`, invert a * R**-1 to get the
+        // Montgomery encoding of a**-1.
+        let a = self.scalar_product(a, &one);
+        inverse_consttime(&a, &cops.n.limbs[..cops.num_limbs])
+    }
+
+    /// Sets `out[i]` to the same value as `scalar_inv_to_mont(&a[i])` for
+    /// each `i`, using Montgomery's trick so that only one inversion is done.
+    /// Panics if any element of `a` is zero or if `a` and `out` have different
+    /// lengths.
+    pub fn scalars_inv_to_mont(&self, a: &[Scalar], out: &mut [Scalar<R>]) {
+        assert_eq!(a.len(), out.len());
+        if a.is_empty() {
+            return;
+        }
+        for a in a {
+            assert!(!self.common.is_zero(a));
+        }
+
+        // The intermediate values don't have any encoding that `Encoding` can
+        // express, so the products are done on the raw limbs. Writing
+        // mont(x, y) = x*y/R, the prefix products are
+        //
+        //     out[i] = a[0]*a[1]*...*a[i] / R**i,
+        //
+        // so that the inverse of the last one is (a[0]*...*a[n-1])**-1 * R**n.
+        // Each step back then peels off one factor of R along with one
+        // element.
+        let mul = |x: &[Limb; MAX_LIMBS], y: &[Limb; MAX_LIMBS]| {
+            let mut r = [0; MAX_LIMBS];
+            unsafe {
+                (self.scalar_mul_mont)(r.as_mut_ptr(), x.as_ptr(), y.as_ptr())
+            }
+            r
+        };
+
+        out[0].limbs = a[0].limbs;
+        for i in 1..a.len() {
+            out[i].limbs = mul(&out[i - 1].limbs, &a[i].limbs);
+        }
+
+        let last = Scalar {
+            limbs: out[a.len() - 1].limbs,
+            m: PhantomData,
+            encoding: PhantomData,
+        };
+        let mut acc = self.scalar_inv_to_mont(&last).limbs;
+        for i in (1..a.len()).rev() {
+            // acc == (a[0]*...*a[i])**-1 * R**(i + 1).
+            out[i].limbs = mul(&acc, &out[i - 1].limbs);
+            acc = mul(&acc, &a[i].limbs);
+        }
+        out[0].limbs = acc;
     }
 
     #[inline]
@@ -303,19 +413,152 @@ impl ScalarOps {
     }
 }
 
+/// Operations on private scalars needed by ECDSA signing.
+pub struct PrivateScalarOps {
+    pub scalar_ops: &'static ScalarOps,
+
+    n_rr: Scalar<RR>,
+}
+
+impl PrivateScalarOps {
+    #[inline]
+    pub fn to_mont(&self, a: &Scalar) -> Scalar<R> {
+        self.scalar_ops.scalar_product(a, &self.n_rr)
+    }
+
+    /// Returns `a + b (mod n)`, in constant time.
+    pub fn scalar_sum(&self, a: &Scalar, b: &Scalar) -> Scalar {
+        let cops = self.scalar_ops.common;
+        let mut r = Scalar::zero();
+        unsafe {
+            LIMBS_add_mod(r.limbs.as_mut_ptr(), a.limbs.as_ptr(),
+                          b.limbs.as_ptr(), cops.n.limbs.as_ptr(),
+                          cops.num_limbs)
+        }
+        r
+    }
+
+    /// Returns `a` reduced (mod n). Since q < 2n for both curves, one
+    /// conditional subtraction of n is enough.
+    pub fn elem_reduced_to_scalar(&self, a: &Elem<Unencoded>) -> Scalar {
+        let cops = self.scalar_ops.common;
+        let num_limbs = cops.num_limbs;
+        let mut r = Scalar {
+            limbs: a.limbs,
+            m: PhantomData,
+            encoding: PhantomData,
+        };
+        limbs_reduce_once_constant_time(&mut r.limbs[..num_limbs],
+                                        &cops.n.limbs[..num_limbs]);
+        r
+    }
+}
+
 /// Operations on public scalars needed by ECDSA signature verification.
 pub struct PublicScalarOps {
     pub scalar_ops: &'static ScalarOps,
     pub public_key_ops: &'static PublicKeyOps,
 
-    // XXX: `PublicScalarOps` shouldn't depend on `PrivateKeyOps`, but it does
-    // temporarily until `twin_mul` is rewritten.
-    pub private_key_ops: &'static PrivateKeyOps,
-
     pub q_minus_n: Elem<Unencoded>,
+
+    twin_mul_impl: unsafe extern fn(r: *mut Limb/*[3][num_limbs]*/,
+                                    g_scalar: *const Limb/*[num_limbs]*/,
+                                    p_scalar: *const Limb/*[num_limbs]*/,
+                                    p_x: *const Limb/*[num_limbs]*/,
+                                    p_y: *const Limb/*[num_limbs]*/),
+
+    #[cfg_attr(not(feature = "use_heap"), allow(dead_code))]
+    point_odd_multiples_impl:
+        unsafe extern fn(table: *mut Limb/*[table_len][3][num_limbs]*/,
+                         table_len: c::size_t,
+                         p_x: *const Limb/*[num_limbs]*/,
+                         p_y: *const Limb/*[num_limbs]*/),
+
+    #[cfg_attr(not(feature = "use_heap"), allow(dead_code))]
+    twin_mul_table_impl:
+        unsafe extern fn(r: *mut Limb/*[3][num_limbs]*/,
+                         g_scalar: *const Limb/*[num_limbs]*/,
+                         p_scalar: *const Limb/*[num_limbs]*/,
+                         p_table: *const Limb/*[..][3][num_limbs]*/,
+                         p_window_size: c::uint),
+}
+
+/// The odd multiples P, 3P, 5P, ... of a public point P, for use with
+/// `PublicScalarOps::twin_mul_table`.
+#[cfg(feature = "use_heap")]
+#[allow(box_pointers)]
+pub struct PointTable {
+    // The points are packed using `num_limbs` limbs per coordinate, as
+    // dictated by the C code, so this can't be a slice of `Point`.
+    limbs: std::boxed::Box<[Limb]>,
 }
 
+// The window size used for the digits of the scalar multiplying P in
+// `twin_mul_table`. A `PointTable` of 2**(w - 1) points costs 1.5KB
+// (P-256) or 2.25KB (P-384) on 64-bit targets.
+#[cfg(feature = "use_heap")]
+const POINT_TABLE_WINDOW_SIZE: c::uint = 5;
+
 impl PublicScalarOps {
+    /// Returns `g_scalar`*G + `p_scalar`*P, where G is the generator.
+    ///
+    /// This is *not* constant-time, so it must only be used when the scalars
+    /// and the point are all public, i.e. for signature verification.
+    #[inline]
+    pub fn twin_mul(&self, g_scalar: &Scalar, p_scalar: &Scalar,
+                    &(ref p_x, ref p_y): &(Elem<R>, Elem<R>)) -> Point {
+        let mut r = Point::new_at_infinity();
+        unsafe {
+            (self.twin_mul_impl)(r.xyz.as_mut_ptr(), g_scalar.limbs.as_ptr(),
+                                 p_scalar.limbs.as_ptr(), p_x.limbs.as_ptr(),
+                                 p_y.limbs.as_ptr());
+        }
+        r
+    }
+
+    /// Precomputes the multiples of P needed by `twin_mul_table`, so that they
+    /// can be reused for many multiplications with the same P.
+    ///
+    /// This is *not* constant-time, so it must only be used for public points.
+    #[cfg(feature = "use_heap")]
+    #[allow(box_pointers)]
+    pub fn point_odd_multiples(&self, &(ref p_x, ref p_y): &(Elem<R>, Elem<R>))
+                               -> PointTable {
+        let num_points = 1 << (POINT_TABLE_WINDOW_SIZE - 1);
+        let num_limbs = self.public_key_ops.common.num_limbs;
+        let mut limbs = std::vec::Vec::new();
+        limbs.resize(num_points * 3 * num_limbs, 0);
+        unsafe {
+            (self.point_odd_multiples_impl)(limbs.as_mut_ptr(), num_points,
+                                            p_x.limbs.as_ptr(),
+                                            p_y.limbs.as_ptr());
+        }
+        PointTable { limbs: limbs.into_boxed_slice() }
+    }
+
+    /// Returns `g_scalar`*G + `p_scalar`*P, where G is the generator and
+    /// `p_table` was computed from P by `point_odd_multiples`. The result is
+    /// the same as `twin_mul`'s but the multiples of P aren't recomputed, and
+    /// there are fewer of them to add because the window is wider.
+    ///
+    /// This is *not* constant-time, so it must only be used when the scalars
+    /// and the point are all public, i.e. for signature verification.
+    #[cfg(feature = "use_heap")]
+    #[allow(box_pointers)]
+    #[inline]
+    pub fn twin_mul_table(&self, g_scalar: &Scalar, p_scalar: &Scalar,
+                          p_table: &PointTable) -> Point {
+        let mut r = Point::new_at_infinity();
+        unsafe {
+            (self.twin_mul_table_impl)(r.xyz.as_mut_ptr(),
+                                       g_scalar.limbs.as_ptr(),
+                                       p_scalar.limbs.as_ptr(),
+                                       p_table.limbs.as_ptr(),
+                                       POINT_TABLE_WINDOW_SIZE);
+        }
+        r
+    }
+
     #[inline]
     pub fn scalar_as_elem(&self, a: &Scalar) -> Elem<Unencoded> {
         Elem {
@@ -350,27 +593,6 @@ impl PublicScalarOps {
 }
 
 
-// Returns (`a` squared `squarings` times) * `b`.
-fn elem_sqr_mul(ops: &CommonOps, a: &Elem<R>, squarings: usize, b: &Elem<R>)
-                -> Elem<R> {
-    debug_assert!(squarings >= 1);
-    let mut tmp = ops.elem_squared(a);
-    for _ in 1..squarings {
-        ops.elem_square(&mut tmp);
-    }
-    ops.elem_product(&tmp, b)
-}
-
-// Sets `acc` = (`acc` squared `squarings` times) * `b`.
-fn elem_sqr_mul_acc(ops: &CommonOps, acc: &mut Elem<R>, squarings: usize,
-                    b: &Elem<R>) {
-    debug_assert!(squarings >= 1);
-    for _ in 0..squarings {
-        ops.elem_square(acc);
-    }
-    ops.elem_mul(acc, b)
-}
-
 #[inline]
 pub fn elem_parse_big_endian_fixed_consttime(
         ops: &CommonOps, bytes: untrusted::Input)
@@ -421,6 +643,31 @@ fn parse_big_endian_fixed_consttime<M>(
     Ok(r)
 }
 
+// Returns `a**-1 (mod m)` in constant time, using the safegcd algorithm of
+// Bernstein and Yang. The inverse of an `RInverse`-encoded value is
+// `R`-encoded. Panics if `a` isn't invertible.
+fn inverse_consttime<M>(a: &elem::Elem<M, RInverse>, m: &[Limb])
+                        -> elem::Elem<M, R> {
+    let mut r = elem::Elem::zero();
+    let is_invertible = unsafe {
+        LIMBS_mod_inverse_consttime(r.limbs.as_mut_ptr(), a.limbs.as_ptr(),
+                                    m.as_ptr(), m.len())
+    };
+    assert!(is_invertible == LimbMask::True);
+    r
+}
+
+extern {
+    // `r`, `a`, and `b` may alias.
+    fn LIMBS_add_mod(r: *mut Limb, a: *const Limb, b: *const Limb,
+                     m: *const Limb, num_limbs: c::size_t);
+
+    // `r` and `a` may alias.
+    fn LIMBS_mod_inverse_consttime(r: *mut Limb, a: *const Limb,
+                                   m: *const Limb, num_limbs: c::size_t)
+                                   -> LimbMask;
+}
+
 
 #[cfg(test)]
 mod tests {
@@ -605,12 +852,22 @@ mod tests {
     }
 
     fn elem_mul_test(ops: &CommonOps,  file_path: &str) {
+        // Detect the CPU features so that the MULX/ADX code is tested.
+        ::init::init_once();
         test::from_file(file_path, |section, test_case| {
             assert_eq!(section, "");
 
             let mut a = consume_elem(ops, test_case, "a");
             let b = consume_elem(ops, test_case, "b");
             let r = consume_elem(ops, test_case, "r");
+
+            // `elem_squared` may be a dedicated squaring routine.
+            for x in &[a, b, r] {
+                let expected: Elem<R> = ops.elem_product(x, x);
+                assert_limbs_are_equal(ops, &ops.elem_squared(x).limbs,
+                                       &expected.limbs);
+            }
+
             ops.elem_mul(&mut a, &b);
             assert_limbs_are_equal(ops, &a.limbs, &r.limbs);
 
@@ -693,6 +950,162 @@ mod tests {
         let _ = p384::SCALAR_OPS.scalar_inv_to_mont(&ZERO_SCALAR);
     }
 
+    #[test]
+    fn p256_scalars_inv_to_mont_test() {
+        scalars_inv_to_mont_test(
+            &p256::SCALAR_OPS, "src/ec/suite_b/ops/p256_scalar_mul_tests.txt");
+    }
+
+    #[test]
+    fn p384_scalars_inv_to_mont_test() {
+        scalars_inv_to_mont_test(
+            &p384::SCALAR_OPS, "src/ec/suite_b/ops/p384_scalar_mul_tests.txt");
+    }
+
+    // Checks that batched inversion agrees with `scalar_inv_to_mont` for
+    // every prefix of the non-zero scalars in the given file.
+    fn scalars_inv_to_mont_test(ops: &ScalarOps, file_path: &str) {
+        let mut scalars = std::vec::Vec::new();
+        test::from_file(file_path, |section, test_case| {
+            assert_eq!(section, "");
+            let cops = ops.common;
+            for name in &["a", "r"] {
+                let s = consume_scalar(cops, test_case, name);
+                if !cops.is_zero(&s) {
+                    scalars.push(s);
+                }
+            }
+            let _ = test_case.consume_string("b");
+            Ok(())
+        });
+
+        for len in 0..(scalars.len() + 1) {
+            let a = &scalars[..len];
+            let mut actual = std::vec::Vec::new();
+            actual.resize(len, Scalar::zero());
+            ops.scalars_inv_to_mont(a, &mut actual);
+            for (a, actual) in a.iter().zip(actual.iter()) {
+                let expected = ops.scalar_inv_to_mont(a);
+                assert_limbs_are_equal(ops.common, &actual.limbs,
+                                       &expected.limbs);
+            }
+        }
+    }
+
+    #[test]
+    #[should_panic(expected = "!self.common.is_zero(a)")]
+    fn p256_scalars_inv_to_mont_zero_panic_test() {
+        let mut out = [Scalar::zero()];
+        p256::SCALAR_OPS.scalars_inv_to_mont(&[ZERO_SCALAR], &mut out);
+    }
+
+    #[test]
+    fn p256_elem_inverse_test() {
+        elem_inverse_test(&p256::COMMON_OPS,
+                          "src/ec/suite_b/ops/p256_elem_mul_tests.txt");
+    }
+
+    #[test]
+    fn p384_elem_inverse_test() {
+        elem_inverse_test(&p384::COMMON_OPS,
+                          "src/ec/suite_b/ops/p384_elem_mul_tests.txt");
+    }
+
+    // Checks that a * a**-1 == 1 for the non-zero elements in the given file.
+    fn elem_inverse_test(ops: &CommonOps, file_path: &str) {
+        test::from_file(file_path, |section, test_case| {
+            assert_eq!(section, "");
+            for name in &["a", "b", "r"] {
+                let a = consume_elem(ops, test_case, name);
+                if ops.is_zero(&a) {
+                    continue;
+                }
+                let product = ops.elem_product(&a, &ops.elem_inverse(&a));
+                let product = ops.elem_unencoded(&product);
+                assert_limbs_are_equal(ops, &product.limbs, &ONE.limbs);
+            }
+            Ok(())
+        })
+    }
+
+    #[test]
+    #[should_panic(expected = "is_invertible == LimbMask::True")]
+    fn p384_elem_inverse_zero_panic_test() {
+        let _ = p384::COMMON_OPS.elem_inverse(&Elem::zero());
+    }
+
+    #[test]
+    fn p256_scalar_inv_to_mont_test() {
+        scalar_inv_to_mont_test(
+            &p256::SCALAR_OPS, "src/ec/suite_b/ops/p256_scalar_mul_tests.txt");
+    }
+
+    #[test]
+    fn p384_scalar_inv_to_mont_test() {
+        scalar_inv_to_mont_test(
+            &p384::SCALAR_OPS, "src/ec/suite_b/ops/p384_scalar_mul_tests.txt");
+    }
+
+    // Checks that a * a**-1 == 1 for the non-zero scalars in the given file.
+    fn scalar_inv_to_mont_test(ops: &ScalarOps, file_path: &str) {
+        test::from_file(file_path, |section, test_case| {
+            assert_eq!(section, "");
+            let cops = ops.common;
+            for name in &["a", "b", "r"] {
+                let a = consume_scalar(cops, test_case, name);
+                if cops.is_zero(&a) {
+                    continue;
+                }
+                let a_inv = ops.scalar_inv_to_mont(&a);
+                let product = ops.scalar_product(&a, &a_inv);
+                assert_limbs_are_equal(cops, &product.limbs, &ONE.limbs);
+            }
+            Ok(())
+        })
+    }
+
+    #[test]
+    fn p256_elems_inverse_squared_test() {
+        elems_inverse_squared_test(
+            &p256::PRIVATE_KEY_OPS,
+            "src/ec/suite_b/ops/p256_elem_mul_tests.txt");
+    }
+
+    #[test]
+    fn p384_elems_inverse_squared_test() {
+        elems_inverse_squared_test(
+            &p384::PRIVATE_KEY_OPS,
+            "src/ec/suite_b/ops/p384_elem_mul_tests.txt");
+    }
+
+    // Checks that batched inversion agrees with `elem_inverse_squared` for
+    // every prefix of the non-zero elements in the given file.
+    fn elems_inverse_squared_test(ops: &PrivateKeyOps, file_path: &str) {
+        let mut elems = std::vec::Vec::new();
+        test::from_file(file_path, |section, test_case| {
+            assert_eq!(section, "");
+            let cops = ops.common;
+            for name in &["a", "b", "r"] {
+                let e = consume_elem(cops, test_case, name);
+                if !cops.is_zero(&e) {
+                    elems.push(e);
+                }
+            }
+            Ok(())
+        });
+
+        for len in 0..(elems.len() + 1) {
+            let a = &elems[..len];
+            let mut actual = std::vec::Vec::new();
+            actual.resize(len, Elem::zero());
+            ops.elems_inverse_squared(a, &mut actual);
+            for (a, actual) in a.iter().zip(actual.iter()) {
+                let expected = ops.elem_inverse_squared(a);
+                assert_elems_are_equal(ops.common, actual, &expected);
+            }
+        }
+    }
+
     #[test]
     fn p256_point_sum_test() {
         point_sum_test(&p256::PRIVATE_KEY_OPS,
@@ -888,6 +1301,45 @@ mod tests {
                              "src/ec/suite_b/ops/p384_point_mul_base_tests.txt");
     }
 
+    #[test]
+    fn p256_twin_mul_test() {
+        twin_mul_tests(&p256::PUBLIC_SCALAR_OPS, &p256::PRIVATE_KEY_OPS,
+                       "src/ec/suite_b/ops/p256_twin_mul_tests.txt");
+    }
+
+    #[test]
+    fn p384_twin_mul_test() {
+        twin_mul_tests(&p384::PUBLIC_SCALAR_OPS, &p384::PRIVATE_KEY_OPS,
+                       "src/ec/suite_b/ops/p384_twin_mul_tests.txt");
+    }
+
+    fn twin_mul_tests(ops: &PublicScalarOps, priv_ops: &PrivateKeyOps,
+                      file_path: &str) {
+        test::from_file(file_path, |section, test_case| {
+            assert_eq!(section, "");
+            let cops = ops.public_key_ops.common;
+            let g_scalar = consume_scalar(cops, test_case, "g_scalar");
+            let p_scalar = consume_scalar(cops, test_case, "p_scalar");
+            let (x, y) = match consume_point(priv_ops, test_case, "p") {
+                TestPoint::Infinity => {
+                    panic!("can't be inf.");
+                },
+                TestPoint::Affine(x, y) => (x, y),
+            };
+            let expected_result = consume_point(priv_ops, test_case, "r");
+            let actual_result = ops.twin_mul(&g_scalar, &p_scalar, &(x, y));
+            assert_point_actual_equals_expected(priv_ops, &actual_result,
+                                                &expected_result);
+
+            let p_table = ops.point_odd_multiples(&(x, y));
+            let actual_result =
+                ops.twin_mul_table(&g_scalar, &p_scalar, &p_table);
+            assert_point_actual_equals_expected(priv_ops, &actual_result,
+                                                &expected_result);
+            Ok(())
+        })
+    }
+
     fn point_mul_base_tests(ops: &PrivateKeyOps, file_path: &str) {
         test::from_file(file_path, |section, test_case| {
             assert_eq!(section, "");
@@ -1101,7 +1553,7 @@ macro_rules! bench_curve {
             let mut a = Elem::zero();
             a.limbs[0] = 1;
             bench.iter(|| {
-                let _ = PRIVATE_KEY_OPS.elem_inverse(&a);
+                let _ = PRIVATE_KEY_OPS.elem_inverse_squared(&a);
             });
         }
 
@@ -15,8 +15,7 @@
 use c;
 use core::marker::PhantomData;
 use super::*;
-use super::{Mont, elem_sqr_mul, elem_sqr_mul_acc};
-use super::elem::{binary_op, binary_op_assign};
+use super::Mont;
 
 macro_rules! p256_limbs {
     [$limb_7:expr, $limb_6:expr, $limb_5:expr, $limb_4:expr,
@@ -68,56 +67,10 @@ pub static COMMON_OPS: CommonOps = CommonOps {
 
 pub static PRIVATE_KEY_OPS: PrivateKeyOps = PrivateKeyOps {
     common: &COMMON_OPS,
-    elem_inv_squared: p256_elem_inv_squared,
     point_mul_base_impl: p256_point_mul_base_impl,
     point_mul_impl: GFp_nistz256_point_mul,
 };
 
-fn p256_elem_inv_squared(a: &Elem<R>) -> Elem<R> {
-    // Calculate a**-2 (mod q) == a**(q - 3) (mod q)
-    //
-    // The exponent (q - 3) is:
-    //
-    //    0xffffffff00000001000000000000000000000000fffffffffffffffffffffffc
-
-    #[inline]
-    fn sqr_mul(a: &Elem<R>, squarings: usize, b: &Elem<R>) -> Elem<R> {
-        elem_sqr_mul(&COMMON_OPS, a, squarings, b)
-    }
-
-    #[inline]
-    fn sqr_mul_acc(a: &mut Elem<R>, squarings: usize, b: &Elem<R>) {
-        elem_sqr_mul_acc(&COMMON_OPS, a, squarings, b)
-    }
-
-    let b_1 = &a;
-    let b_11       = sqr_mul(b_1,          1, b_1);
-    let b_111      = sqr_mul(&b_11,        1, b_1);
-    let f_11       = sqr_mul(&b_111,       3, &b_111);
-    let fff        = sqr_mul(&f_11,        6, &f_11);
-    let fff_111    = sqr_mul(&fff,         3, &b_111);
-    let fffffff_11 = sqr_mul(&fff_111,    15, &fff_111);
-    let ffffffff   = sqr_mul(&fffffff_11,  2, &b_11);
-
-    // ffffffff00000001
-    let mut acc = sqr_mul(&ffffffff, 31 + 1, b_1);
-
-    // ffffffff00000001000000000000000000000000ffffffff
-    sqr_mul_acc(&mut acc, 96 + 32, &ffffffff);
-
-    // ffffffff00000001000000000000000000000000ffffffffffffffff
-    sqr_mul_acc(&mut acc, 32, &ffffffff);
-
-    // ffffffff00000001000000000000000000000000fffffffffffffffffffffff_11
-    sqr_mul_acc(&mut acc, 30, &fffffff_11);
-
-    // ffffffff00000001000000000000000000000000fffffffffffffffffffffffc
-    COMMON_OPS.elem_square(&mut acc);
-    COMMON_OPS.elem_square(&mut acc);
-
-    acc
-}
-
 fn p256_point_mul_base_impl(g_scalar: &Scalar) -> Point {
     let mut r = Point::new_at_infinity();
     unsafe {
@@ -132,14 +85,23 @@ pub static PUBLIC_KEY_OPS: PublicKeyOps = PublicKeyOps { common: &COMMON_OPS };
 
 pub static SCALAR_OPS: ScalarOps = ScalarOps {
     common: &COMMON_OPS,
-    scalar_inv_to_mont_impl: p256_scalar_inv_to_mont,
     scalar_mul_mont: GFp_p256_scalar_mul_mont,
 };
 
+pub static PRIVATE_SCALAR_OPS: PrivateScalarOps = PrivateScalarOps {
+    scalar_ops: &SCALAR_OPS,
+
+    n_rr: Scalar {
+        limbs: p256_limbs![0x66e12d94, 0xf3d95620, 0x2845b239, 0x2b6bec59,
+                           0x4699799c, 0x49bd6fa6, 0x83244c95, 0xbe79eea2],
+        m: PhantomData,
+        encoding: PhantomData, // RR
+    },
+};
+
 pub static PUBLIC_SCALAR_OPS: PublicScalarOps = PublicScalarOps {
     scalar_ops: &SCALAR_OPS,
     public_key_ops: &PUBLIC_KEY_OPS,
-    private_key_ops: &PRIVATE_KEY_OPS,
 
     q_minus_n: Elem {
         limbs: p256_limbs![0, 0, 0, 0, 0x43190553, 0x58e8617b, 0x0c46353d,
@@ -147,134 +109,11 @@ pub static PUBLIC_SCALAR_OPS: PublicScalarOps = PublicScalarOps {
         m: PhantomData,
         encoding: PhantomData, // Unencoded
     },
-};
-
-fn p256_scalar_inv_to_mont(a: &Scalar<Unencoded>) -> Scalar<R> {
-    // Calculate the modular inverse of scalar |a| using Fermat's Little
-    // Theorem:
-    //
-    //    a**-1 (mod n) == a**(n - 2) (mod n)
-    //
-    // The exponent (n - 2) is:
-    //
-    //    0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc63254f
-
-    #[inline]
-    fn mul(a: &Scalar<R>, b: &Scalar<R>) -> Scalar<R> {
-        binary_op(GFp_p256_scalar_mul_mont, a, b)
-    }
 
-    #[inline]
-    fn sqr(a: &Scalar<R>) -> Scalar<R> {
-        unary_op(GFp_p256_scalar_sqr_mont, a)
-    }
-
-    // Returns (`a` squared `squarings` times) * `b`.
-    fn sqr_mul(a: &Scalar<R>, squarings: c::int, b: &Scalar<R>) -> Scalar<R> {
-        debug_assert!(squarings >= 1);
-        let mut tmp = Scalar::zero();
-        unsafe {
-            GFp_p256_scalar_sqr_rep_mont(tmp.limbs.as_mut_ptr(),
-                                         a.limbs.as_ptr(), squarings)
-        }
-        mul(&tmp, b)
-    }
-
-    // Sets `acc` = (`acc` squared `squarings` times) * `b`.
-    fn sqr_mul_acc(acc: &mut Scalar<R>, squarings: c::int, b: &Scalar<R>) {
-        debug_assert!(squarings >= 1);
-        unsafe {
-            GFp_p256_scalar_sqr_rep_mont(acc.limbs.as_mut_ptr(),
-                                         acc.limbs.as_ptr(), squarings)
-        }
-        binary_op_assign(GFp_p256_scalar_mul_mont, acc, b);
-    }
-
-    fn to_mont(a: &Scalar) -> Scalar<R> {
-        static N_RR: Scalar<Unencoded> = Scalar {
-            limbs: p256_limbs![0x66e12d94, 0xf3d95620, 0x2845b239, 0x2b6bec59,
-                               0x4699799c, 0x49bd6fa6, 0x83244c95, 0xbe79eea2],
-            m: PhantomData,
-            encoding: PhantomData,
-        };
-        binary_op(GFp_p256_scalar_mul_mont, a, &N_RR)
-    }
-
-    // Indexes into `d`.
-    const B_1: usize = 0;
-    const B_10: usize = 1;
-    const B_11: usize = 2;
-    const B_101: usize = 3;
-    const B_111: usize = 4;
-    const B_1111: usize = 5;
-    const B_10101: usize = 6;
-    const B_101111: usize = 7;
-    const DIGIT_COUNT: usize = 8;
-
-    let mut d = [Scalar::zero(); DIGIT_COUNT];
-
-    d[B_1] = to_mont(a);
-    d[B_10] = sqr(&d[B_1]);
-    d[B_11] = mul(&d[B_10], &d[B_1]);
-    d[B_101] = mul(&d[B_10], &d[B_11]);
-    d[B_111] = mul(&d[B_101], &d[B_10]);
-    let b_1010 = sqr(&d[B_101]);
-    d[B_1111] = mul(&b_1010, &d[B_101]);
-    d[B_10101] = sqr_mul(&b_1010, 0 + 1, &d[B_1]);
-    let b_101010 = sqr(&d[B_10101]);
-    d[B_101111] = mul(&b_101010, &d[B_101]);
-    let b_111111 = mul(&b_101010, &d[B_10101]);
-
-    let ff       = sqr_mul(&b_111111,  0 + 2,  &d[B_11]);
-    let ffff     = sqr_mul(&ff,        0 + 8,  &ff);
-    let ffffffff = sqr_mul(&ffff,      0 + 16, &ffff);
-
-    // ffffffff00000000ffffffff
-    let mut acc = sqr_mul(&ffffffff, 32 + 32, &ffffffff);
-
-    // ffffffff00000000ffffffffffffffff
-    sqr_mul_acc(&mut acc, 0 + 32, &ffffffff);
-
-    // The rest of the exponent, in binary, is:
-    //
-    //    1011110011100110111110101010110110100111000101111001111010000100
-    //    1111001110111001110010101100001011111100011000110010010101001111
-
-    static REMAINING_WINDOWS: [(u8, u8); 26] = [
-        (    6, B_101111 as u8),
-        (2 + 3, B_111 as u8),
-        (2 + 2, B_11 as u8),
-        (1 + 4, B_1111 as u8),
-        (    5, B_10101 as u8),
-        (1 + 3, B_101 as u8),
-        (    3, B_101 as u8),
-        (    3, B_101 as u8),
-        (2 + 3, B_111 as u8),
-        (3 + 6, B_101111 as u8),
-        (2 + 4, B_1111 as u8),
-        (1 + 1, B_1 as u8),
-        (4 + 1, B_1 as u8),
-        (2 + 4, B_1111 as u8),
-        (2 + 3, B_111 as u8),
-        (1 + 3, B_111 as u8),
-        (2 + 3, B_111 as u8),
-        (2 + 3, B_101 as u8),
-        (1 + 2, B_11 as u8),
-        (4 + 6, B_101111 as u8),
-        (    2, B_11 as u8),
-        (3 + 2, B_11 as u8),
-        (3 + 2, B_11 as u8),
-        (2 + 1, B_1 as u8),
-        (2 + 5, B_10101 as u8),
-        (2 + 4, B_1111 as u8),
-    ];
-
-    for &(squarings, digit) in &REMAINING_WINDOWS {
-        sqr_mul_acc(&mut acc, squarings as c::int, &d[digit as usize]);
-    }
-
-    acc
-}
+    twin_mul_impl: GFp_nistz256_twin_mult_vartime,
+    point_odd_multiples_impl: GFp_nistz256_point_odd_multiples_vartime,
+    twin_mul_table_impl: GFp_nistz256_twin_mult_table_vartime,
+};
 
 
 extern {
@@ -294,17 +133,29 @@ extern {
                               p_scalar: *const Limb/*[COMMON_OPS.num_limbs]*/,
                               p_x: *const Limb/*[COMMON_OPS.num_limbs]*/,
                               p_y: *const Limb/*[COMMON_OPS.num_limbs]*/);
+    fn GFp_nistz256_twin_mult_vartime(
+        r: *mut Limb/*[3][COMMON_OPS.num_limbs]*/,
+        g_scalar: *const Limb/*[COMMON_OPS.num_limbs]*/,
+        p_scalar: *const Limb/*[COMMON_OPS.num_limbs]*/,
+        p_x: *const Limb/*[COMMON_OPS.num_limbs]*/,
+        p_y: *const Limb/*[COMMON_OPS.num_limbs]*/);
+    fn GFp_nistz256_point_odd_multiples_vartime(
+        table: *mut Limb/*[table_len][3][COMMON_OPS.num_limbs]*/,
+        table_len: c::size_t,
+        p_x: *const Limb/*[COMMON_OPS.num_limbs]*/,
+        p_y: *const Limb/*[COMMON_OPS.num_limbs]*/);
+    fn GFp_nistz256_twin_mult_table_vartime(
+        r: *mut Limb/*[3][COMMON_OPS.num_limbs]*/,
+        g_scalar: *const Limb/*[COMMON_OPS.num_limbs]*/,
+        p_scalar: *const Limb/*[COMMON_OPS.num_limbs]*/,
+        p_table: *const Limb/*[..][3][COMMON_OPS.num_limbs]*/,
+        p_window_size: c::uint);
     fn GFp_nistz256_point_mul_base(r: *mut Limb/*[3][COMMON_OPS.num_limbs]*/,
                                    g_scalar: *const Limb/*[COMMON_OPS.num_limbs]*/);
 
     fn GFp_p256_scalar_mul_mont(r: *mut Limb/*[COMMON_OPS.num_limbs]*/,
                                 a: *const Limb/*[COMMON_OPS.num_limbs]*/,
                                 b: *const Limb/*[COMMON_OPS.num_limbs]*/);
-    fn GFp_p256_scalar_sqr_mont(r: *mut Limb/*[COMMON_OPS.num_limbs]*/,
-                                a: *const Limb/*[COMMON_OPS.num_limbs]*/);
-    fn GFp_p256_scalar_sqr_rep_mont(r: *mut Limb/*[COMMON_OPS.num_limbs]*/,
-                                    a: *const Limb/*[COMMON_OPS.num_limbs]*/,
-                                    rep: c::int);
 }
 
 
@@ -74,6 +74,15 @@ pub fn generate_private_key(ops: &PrivateKeyOps, rng: &rand::SecureRandom)
     Err(error::Unspecified)
 }
 
+/// Returns a random scalar in the range [1, n), generated the same way as a
+/// private key. This is used for ECDSA nonces.
+pub fn random_scalar(ops: &PrivateKeyOps, rng: &rand::SecureRandom)
+                     -> Result<Scalar, error::Unspecified> {
+    let private_key = generate_private_key(ops, rng)?;
+    Ok(private_key_as_scalar(ops, &private_key))
+}
+
+
 
 // The underlying X25519 and Ed25519 code uses an [u8; 32] to store the private
 // key. To make the ECDH and ECDSA code similar to that, we also store the
@@ -140,28 +149,14 @@ pub fn big_endian_affine_from_jacobian(ops: &PrivateKeyOps,
                                        x_out: Option<&mut [u8]>,
                                        y_out: Option<&mut [u8]>, p: &Point)
                                        -> Result<(), error::Unspecified> {
-    let z = ops.common.point_z(p);
-
     // Since we restrict our private key to the range [1, n), the curve has
     // prime order, and we verify that the peer's point is on the curve,
-    // there's no way that the result can be at infinity. But, use `assert!`
-    // instead of `debug_assert!` anyway
-    assert!(ops.common.elem_verify_is_not_zero(&z).is_ok());
-
-    let x = ops.common.point_x(p);
-    let y = ops.common.point_y(p);
-
-    let zz_inv = ops.elem_inverse_squared(&z);
-
-    let x_aff = ops.common.elem_product(&x, &zz_inv);
-
+    // there's no way that the result can be at infinity. But,
+    // `point_affine` uses `assert!` instead of `debug_assert!` anyway.
+    //
     // `y_aff` is needed to validate the point is on the curve. It is also
     // needed in the non-ECDH case where we need to output it.
-    let y_aff = {
-        let zzzz_inv = ops.common.elem_squared(&zz_inv);
-        let zzz_inv = ops.common.elem_product(&z, &zzzz_inv);
-        ops.common.elem_product(&y, &zzz_inv)
-    };
+    let (x_aff, y_aff) = ops.point_affine(p);
 
     // If we validated our inputs correctly and then computed (x, y, z), then
     // (x, y, z) will be on the curve. See
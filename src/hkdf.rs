@@ -95,37 +95,46 @@ pub fn extract(salt: &hmac::SigningKey, secret: &[u8]) -> hmac::SigningKey {
 /// imposed by the HKDF specification, and is necessary to prevent overflow of
 /// the 8-bit iteration counter in the expansion step.
 pub fn expand(prk: &hmac::SigningKey, info: &[u8], out: &mut [u8]) {
+    expand_batch(prk, &mut [(info, out)])
+}
+
+/// Fills each `out` with the output of the HKDF-Expand operation for `prk`
+/// and its `info`.
+///
+/// This is equivalent to calling `expand(prk, info, out)` for each
+/// `(info, out)` pair, but it is faster when there are several of them, as
+/// in the TLS 1.3 and QUIC key schedules, because the work that only depends
+/// on `prk` is done once for all of them.
+///
+/// # Panics
+///
+/// `expand_batch` panics if `expand` would panic for any of the pairs, before
+/// any output is written.
+pub fn expand_batch(prk: &hmac::SigningKey,
+                    outputs: &mut [(&[u8], &mut [u8])]) {
     let digest_alg = prk.digest_algorithm();
-    assert!(out.len() <= 255 * digest_alg.output_len);
+    for &(_, ref out) in outputs.iter() {
+        assert!(out.len() <= 255 * digest_alg.output_len);
+    }
     assert!(digest_alg.block_len >= digest_alg.output_len);
 
-    let mut ctx = hmac::SigningContext::with_key(prk);
-
-    let mut n = 1u8;
-    let mut pos = 0;
-    loop {
-        ctx.update(info);
-        ctx.update(&[n]);
-
-        let t = ctx.sign();
+    let mut key = hmac::BatchSigningKey::new(prk);
+    for &mut (info, ref mut out) in outputs.iter_mut() {
+        expand_(&mut key, digest_alg.output_len, info, out);
+    }
+}
 
-        // Append `t` to the output.
-        let to_copy = if out.len() - pos < digest_alg.output_len {
-            out.len() - pos
-        } else {
-            digest_alg.output_len
+fn expand_(key: &mut hmac::BatchSigningKey, output_len: usize, info: &[u8],
+           out: &mut [u8]) {
+    // T(n) = HMAC(PRK, T(n - 1) || info || n), where T(0) is empty.
+    let mut t: Option<hmac::Signature> = None;
+    for (i, out) in out.chunks_mut(output_len).enumerate() {
+        let n = [(i + 1) as u8];
+        let t_n = match t {
+            Some(ref t) => key.sign(&[t.as_ref(), info, &n]),
+            None => key.sign(&[info, &n]),
         };
-        let t_bytes = t.as_ref();
-        for i in 0..to_copy {
-            out[pos + i] = t_bytes[i];
-        }
-        if to_copy < digest_alg.output_len {
-            break;
-        }
-        pos += digest_alg.output_len;
-
-        ctx = hmac::SigningContext::with_key(prk);
-        ctx.update(t_bytes);
-        n += 1;
+        out.copy_from_slice(&t_n.as_ref()[..out.len()]);
+        t = Some(t_n);
     }
 }
@@ -296,6 +296,31 @@ impl SigningContext {
     /// C analog: `HMAC_Update`
     pub fn update(&mut self, data: &[u8]) { self.inner.update(data); }
 
+    /// Exports the state of the context so that the calculation can be
+    /// resumed later with `SigningContext::import()` and the same key.
+    ///
+    /// Only the state of the inner digest is exported; the outer one is
+    /// recomputed from the key on import, so the key itself is not part of
+    /// the exported state. The exported state is still derived from the key
+    /// and should be protected like the data being authenticated.
+    pub fn export(&self) -> digest::ExportedContext { self.inner.export() }
+
+    /// Restores a context that was exported by `SigningContext::export()`
+    /// from a context for `signing_key`.
+    ///
+    /// Fails if `exported` is not the exported state of a context using the
+    /// digest algorithm of `signing_key`. A context that was exported from a
+    /// context with a different key can't be detected, and will produce a
+    /// wrong signature.
+    pub fn import(signing_key: &SigningKey, exported: &[u8])
+                  -> Result<SigningContext, error::Unspecified> {
+        let digest_alg = signing_key.digest_algorithm();
+        Ok(SigningContext {
+            inner: digest::Context::import(digest_alg, exported)?,
+            outer: signing_key.ctx_prototype.outer.clone(),
+        })
+    }
+
     /// Finalizes the HMAC calculation and returns the HMAC value. `sign`
     /// consumes the context so it cannot be (mis-)used after `sign` has been
     /// called.
@@ -327,6 +352,84 @@ pub fn sign(key: &SigningKey, data: &[u8]) -> Signature {
     ctx.sign()
 }
 
+// A key prepared for calculating the HMACs of many messages that all have the
+// same length, which must not be longer than the digest algorithm's output
+// length. This is what PBKDF2 does on every iteration.
+pub(crate) struct FixedLengthSigningKey {
+    inner: digest::FixedLengthContext,
+    outer: digest::FixedLengthContext,
+}
+
+impl FixedLengthSigningKey {
+    pub(crate) fn new(key: &SigningKey, data_len: usize)
+                      -> FixedLengthSigningKey {
+        let digest_alg = key.digest_algorithm();
+        assert!(data_len <= digest_alg.output_len);
+        // The padded key is exactly one block, so neither context has any
+        // input pending.
+        FixedLengthSigningKey {
+            inner: digest::FixedLengthContext::new(&key.ctx_prototype.inner,
+                                                   data_len),
+            outer: digest::FixedLengthContext::new(&key.ctx_prototype.outer,
+                                                   digest_alg.output_len),
+        }
+    }
+
+    // Sets each element of `signatures`, of which there are at most
+    // `digest::MAX_LANES`, to the HMAC of the corresponding element of
+    // `data`. The digests are computed side by side when that is faster.
+    pub(crate) fn sign_many(&mut self, data: &[&[u8]],
+                            signatures: &mut [Signature]) {
+        assert!(data.len() <= digest::MAX_LANES);
+        assert_eq!(data.len(), signatures.len());
+        if data.is_empty() {
+            return;
+        }
+        let mut inner = [signatures[0].0; digest::MAX_LANES];
+        let inner = &mut inner[..data.len()];
+        self.inner.digest_many(data, inner);
+        let mut inner_values: [&[u8]; digest::MAX_LANES] =
+            [&[]; digest::MAX_LANES];
+        for (value, inner) in inner_values.iter_mut().zip(inner.iter()) {
+            *value = inner.as_ref();
+        }
+        let mut outer = [signatures[0].0; digest::MAX_LANES];
+        let outer = &mut outer[..data.len()];
+        self.outer.digest_many(&inner_values[..data.len()], outer);
+        for (signature, outer) in signatures.iter_mut().zip(outer.iter()) {
+            *signature = Signature(*outer);
+        }
+    }
+}
+
+// A key prepared for calculating the HMACs of many messages of any length.
+// The outer digest always hashes one inner digest, so its padding is only
+// done once for all of the messages. This is what HKDF-Expand does for each
+// output block.
+pub(crate) struct BatchSigningKey<'a> {
+    inner: &'a digest::Context,
+    outer: digest::FixedLengthContext,
+}
+
+impl<'a> BatchSigningKey<'a> {
+    pub(crate) fn new(key: &'a SigningKey) -> BatchSigningKey<'a> {
+        BatchSigningKey {
+            inner: &key.ctx_prototype.inner,
+            outer: digest::FixedLengthContext::new(
+                &key.ctx_prototype.outer, key.digest_algorithm().output_len),
+        }
+    }
+
+    // Returns the HMAC of the concatenation of `parts`.
+    pub(crate) fn sign(&mut self, parts: &[&[u8]]) -> Signature {
+        let mut inner = self.inner.clone();
+        for part in parts {
+            inner.update(part);
+        }
+        Signature(self.outer.digest(inner.finish().as_ref()))
+    }
+}
+
 /// A key to use for HMAC authentication.
 pub struct VerificationKey {
     wrapped: SigningKey,
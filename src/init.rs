@@ -12,13 +12,26 @@
 // OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
 // CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
+// Detects the features of the CPU the first time it is called. After that
+// it is only a load and a branch, and it does nothing at all when the
+// features are fixed at compile time: on iOS, and with the
+// `static_cpu_features` feature.
 #[inline(always)]
 pub fn init_once() {
-    #[cfg(not(target_os = "ios"))]
+    #[cfg(not(any(target_os = "ios", feature = "static_cpu_features")))]
     {
         use std;
-        extern { fn GFp_cpuid_setup(); }
         static INIT: std::sync::Once = std::sync::ONCE_INIT;
-        INIT.call_once(|| unsafe { GFp_cpuid_setup() });
+        INIT.call_once(detect);
     }
 }
+
+#[cfg(not(any(target_os = "ios", feature = "static_cpu_features")))]
+#[cold]
+#[inline(never)]
+fn detect() {
+    use cpu;
+    extern { fn GFp_cpuid_setup(); }
+    unsafe { GFp_cpuid_setup() };
+    cpu::apply_limit();
+}
@@ -30,8 +30,20 @@
 //!         <code>dev_urandom_fallback</code> feature is disabled, such
 //!         fallbacks will not occur. See the documentation for
 //!         <code>rand::SystemRandom</code> for more details.
+//! <tr><td><code>counters</code>
+//!     <td>Count the calls of the main operations, their input lengths, and
+//!         their failures, and optionally sample their durations; see
+//!         <code>ring::counters</code>.
 //! <tr><td><code>rsa_signing</code>
 //!     <td>Enable RSA signing (<code>RSAKeyPair</code> and related things).
+//! <tr><td><code>static_cpu_features</code>
+//!     <td>Use the CPU features that the target is compiled for, e.g. with
+//!         <code>-C target-cpu=...</code> or
+//!         <code>-C target-feature=...</code>, instead of detecting them at
+//!         runtime. This skips all runtime detection, including the parsing
+//!         of <code>/proc/cpuinfo</code> on some ARM Linux systems, but
+//!         features that the target isn't compiled for aren't used even if
+//!         the CPU has them.
 //! </table>
 
 #![doc(html_root_url="https://briansmith.org/rustdoc/")]
@@ -66,7 +78,7 @@
 #![cfg_attr(feature = "internal_benches", allow(unstable_features))]
 #![cfg_attr(feature = "internal_benches", feature(test))]
 
-#[cfg(any(feature = "use_heap", target_os = "linux"))]
+#[cfg(any(feature = "use_heap", unix))]
 extern crate libc;
 
 #[cfg(feature = "internal_benches")]
@@ -86,6 +98,42 @@ extern crate std;
 
 extern crate untrusted;
 
+// `counted!(Operation, len, result)` evaluates to `result` and, when the
+// `counters` feature is enabled, counts it as one call of
+// `counters::Operation::Operation` on `len` bytes that failed if `result`
+// is an `Err`. `counted!(Operation, len, infallible value)` is for calls
+// that can't fail. Without the feature neither `len` nor anything else is
+// evaluated.
+#[cfg(feature = "counters")]
+macro_rules! counted {
+    ( $operation:ident, $len:expr, infallible $value:expr ) => {
+        {
+            let len = $len;
+            let start = ::counters::start(::counters::Operation::$operation);
+            let value = $value;
+            ::counters::finish(::counters::Operation::$operation, len, start,
+                               true);
+            value
+        }
+    };
+    ( $operation:ident, $len:expr, $result:expr ) => {
+        {
+            let len = $len;
+            let start = ::counters::start(::counters::Operation::$operation);
+            let result = $result;
+            ::counters::finish(::counters::Operation::$operation, len, start,
+                               result.is_ok());
+            result
+        }
+    };
+}
+
+#[cfg(not(feature = "counters"))]
+macro_rules! counted {
+    ( $operation:ident, $len:expr, infallible $value:expr ) => { $value };
+    ( $operation:ident, $len:expr, $result:expr ) => { $result };
+}
+
 mod arithmetic;
 
 #[macro_use]
@@ -104,6 +152,11 @@ mod c;
 mod chacha;
 pub mod constant_time;
 
+#[cfg(feature = "counters")]
+pub mod counters;
+
+pub mod cpu;
+
 #[doc(hidden)]
 pub mod der;
 
@@ -117,6 +170,10 @@ mod limb;
 pub mod pbkdf2;
 mod pkcs8;
 mod poly1305;
+
+#[cfg(feature = "use_heap")]
+mod pool;
+
 pub mod rand;
 
 #[cfg(feature = "use_heap")]
@@ -146,9 +146,10 @@ pub fn derive(digest_alg: &'static digest::Algorithm, iterations: u32,
     let output_len = digest_alg.output_len;
 
     // This implementation's performance is asymptotically optimal as described
-    // in https://jbp.io/2015/08/11/pbkdf2-performance-matters/. However, it
-    // hasn't been optimized to the same extent as fastpbkdf2. In particular,
-    // this implementation is probably doing a lot of unnecessary copying.
+    // in https://jbp.io/2015/08/11/pbkdf2-performance-matters/. Like
+    // fastpbkdf2, the iterations after the first one hash directly from the
+    // precomputed inner and outer HMAC states into pre-padded blocks; see
+    // `derive_blocks`.
 
     let secret = hmac::SigningKey::new(digest_alg, secret);
 
@@ -157,24 +158,45 @@ pub fn derive(digest_alg: &'static digest::Algorithm, iterations: u32,
 
     let mut idx: u32 = 0;
 
-    for chunk in out.chunks_mut(output_len) {
-        idx = idx.checked_add(1).expect("derived key too long");
-        derive_block(&secret, iterations, salt, idx, chunk);
+    for chunk in out.chunks_mut(output_len * digest::MAX_LANES) {
+        idx = derive_blocks(&secret, iterations, salt, idx, chunk);
     }
 }
 
-fn derive_block(secret: &hmac::SigningKey, iterations: u32, salt: &[u8],
-                idx: u32, out: &mut [u8]) {
-    let mut ctx = hmac::SigningContext::with_key(secret);
-    ctx.update(salt);
-    ctx.update(&polyfill::slice::be_u8_from_u32(idx));
+// XORs the output blocks that follow block `last_idx` into `out`, which is at
+// most `digest::MAX_LANES` blocks long, and returns the index of the last one.
+// The HMAC chains of the blocks are independent, so they are computed side
+// by side, which `hmac::FixedLengthSigningKey::sign_many` may do at once.
+fn derive_blocks(secret: &hmac::SigningKey, iterations: u32, salt: &[u8],
+                 last_idx: u32, out: &mut [u8]) -> u32 {
+    let output_len = secret.digest_algorithm().output_len;
+    let num_blocks = (out.len() + output_len - 1) / output_len;
+    assert!(num_blocks <= digest::MAX_LANES);
+
+    let first_u = |idx: u32| {
+        let mut ctx = hmac::SigningContext::with_key(secret);
+        ctx.update(salt);
+        ctx.update(&polyfill::slice::be_u8_from_u32(idx));
+        ctx.sign()
+    };
+    let mut idx = last_idx.checked_add(1).expect("derived key too long");
+    let mut u = [first_u(idx); digest::MAX_LANES];
+    for u in u[1..num_blocks].iter_mut() {
+        idx = idx.checked_add(1).expect("derived key too long");
+        *u = first_u(idx);
+    }
+    let u = &mut u[..num_blocks];
 
-    let mut u = ctx.sign();
+    // Every U_i after the first is the HMAC of a digest-length message.
+    let mut fixed_length_secret =
+        hmac::FixedLengthSigningKey::new(secret, output_len);
 
     let mut remaining = iterations;
     loop {
-        for i in 0..out.len() {
-            out[i] ^= u.as_ref()[i];
+        for (out, u) in out.chunks_mut(output_len).zip(u.iter()) {
+            for (out, u) in out.iter_mut().zip(u.as_ref()) {
+                *out ^= *u;
+            }
         }
 
         if remaining == 1 {
@@ -182,8 +204,16 @@ fn derive_block(secret: &hmac::SigningKey, iterations: u32, salt: &[u8],
         }
         remaining -= 1;
 
-        u = hmac::sign(secret, u.as_ref());
+        let mut previous = [u[0]; digest::MAX_LANES];
+        previous[..num_blocks].copy_from_slice(u);
+        let mut data: [&[u8]; digest::MAX_LANES] = [&[]; digest::MAX_LANES];
+        for (data, previous) in data.iter_mut().zip(previous.iter()) {
+            *data = previous.as_ref();
+        }
+        fixed_length_secret.sign_many(&data[..num_blocks], u);
     }
+
+    idx
 }
 
 /// Verifies that a previously-derived (e.g., using `derive`) PBKDF2 value
@@ -217,7 +247,7 @@ pub fn verify(digest_alg: &'static digest::Algorithm, iterations: u32,
         return Err(error::Unspecified);
     }
 
-    let mut derived_buf = [0u8; digest::MAX_OUTPUT_LEN];
+    let mut derived_buf = [0u8; digest::MAX_OUTPUT_LEN * digest::MAX_LANES];
 
     let output_len = digest_alg.output_len;
     let secret = hmac::SigningKey::new(digest_alg, secret);
@@ -225,13 +255,12 @@ pub fn verify(digest_alg: &'static digest::Algorithm, iterations: u32,
 
     let mut matches = 1;
 
-    for previously_derived_chunk in previously_derived.chunks(output_len) {
-        idx = idx.checked_add(1).expect("derived key too long");
-
+    for previously_derived_chunk in
+            previously_derived.chunks(output_len * digest::MAX_LANES) {
         let derived_chunk = &mut derived_buf[..previously_derived_chunk.len()];
         polyfill::slice::fill(derived_chunk, 0);
 
-        derive_block(&secret, iterations, salt, idx, derived_chunk);
+        idx = derive_blocks(&secret, iterations, salt, idx, derived_chunk);
 
         // XXX: This isn't fully constant-time-safe. TODO: Fix that.
         let current_block_matches =
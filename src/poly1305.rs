@@ -18,7 +18,7 @@
 // Work around compiler bug?
 #![allow(non_shorthand_field_patterns)]
 
-use {c, chacha, constant_time, error, polyfill};
+use {c, chacha, polyfill};
 use core;
 
 // The assembly functions we call expect the state to be 8-byte aligned. We do
@@ -147,13 +147,6 @@ impl SigningContext {
     }
 }
 
-pub fn verify(key: Key, msg: &[u8], tag: &Tag)
-              -> Result<(), error::Unspecified> {
-    let mut calculated_tag = [0u8; TAG_LEN];
-    sign(key, msg, &mut calculated_tag);
-    constant_time::verify_slices_are_equal(&calculated_tag[..], tag)
-}
-
 pub fn sign(key: Key, msg: &[u8], tag: &mut Tag) {
     let mut ctx = SigningContext::from_key(key);
     ctx.update(msg);
@@ -167,8 +160,10 @@ pub fn check_state_layout() {
             // See comment above `_poly1305_init_sse2` in poly1305-x86.pl.
             Some(4 * (5 + 1 + 4 + 2 + 4 * 9))
         } else if cfg!(target_arch = "x86_64") {
-            // See comment above `__poly1305_block` in poly1305-x86_64.pl.
-            Some(4 * (5 + 1 + 2 * 2 + 2 + 4 * 9))
+            // See comment above `__poly1305_block` in poly1305-x86_64.pl,
+            // and `poly1305_ifma_state` in poly1305-avx512.c.
+            Some(core::cmp::max(4 * (5 + 1 + 2 * 2 + 2 + 4 * 9),
+                                8 * (3 + 3 + 1 + 3 * 8)))
         } else {
             // TODO(davidben): Figure out the layout of the struct. For now,
             // `OPAQUE_LEN` is taken from OpenSSL.
@@ -193,6 +188,14 @@ impl Key {
         Key { bytes }
     }
 
+    /// Constructs a key from the first `KEY_LEN` bytes of a ChaCha20 key
+    /// stream block, which `derive_using_chacha` would otherwise compute.
+    pub fn from_chacha_block(block: &[u8; chacha::BLOCK_LEN]) -> Key {
+        let mut bytes = [0u8; KEY_LEN];
+        bytes.copy_from_slice(&block[..KEY_LEN]);
+        Key { bytes }
+    }
+
     #[cfg(test)]
     pub fn from_test_vector(bytes: &[u8; KEY_LEN]) -> Key {
         Key { bytes: *bytes }
@@ -218,6 +221,12 @@ const BLOCK_LEN: usize = 16;
 /// The memory manipulated by the assembly.
 type Opaque = [u8; OPAQUE_LEN];
 
+// On x86-64 the state may instead be that of poly1305-avx512.c, which holds
+// the powers r**1..r**8 needed for processing eight blocks at a time.
+#[cfg(target_arch = "x86_64")]
+const OPAQUE_LEN: usize = 256;
+
+#[cfg(not(target_arch = "x86_64"))]
 const OPAQUE_LEN: usize = 192;
 
 #[repr(C)]
@@ -230,6 +239,17 @@ struct Funcs {
 #[inline]
 fn init(state: &mut Opaque, key: &KeyBytes, func: &mut Funcs) -> i32 {
     debug_assert_eq!(state.as_ptr() as usize % 8, 0);
+    #[cfg(target_arch = "x86_64")]
+    unsafe {
+        if GFp_poly1305_ifma_capable() == 1 {
+            GFp_poly1305_init_ifma(state, key);
+            *func = Funcs {
+                blocks_fn: GFp_poly1305_blocks_ifma,
+                emit_fn: GFp_poly1305_emit_ifma,
+            };
+            return 1;
+        }
+    }
     unsafe {
         GFp_poly1305_init_asm(state, key, func)
     }
@@ -275,6 +295,16 @@ extern {
     fn GFp_poly1305_emit(state: &mut Opaque, mac: &mut Tag, nonce: &Nonce);
 }
 
+#[cfg(target_arch = "x86_64")]
+extern {
+    fn GFp_poly1305_ifma_capable() -> c::int;
+    fn GFp_poly1305_init_ifma(state: &mut Opaque, key: &KeyBytes);
+    fn GFp_poly1305_blocks_ifma(state: &mut Opaque, input: *const u8,
+                                len: c::size_t, should_pad: Pad);
+    fn GFp_poly1305_emit_ifma(state: &mut Opaque, mac: &mut Tag,
+                              nonce: &Nonce);
+}
+
 #[cfg(test)]
 mod tests {
     use {error, test};
@@ -313,10 +343,6 @@ mod tests {
                 sign(key, &input, &mut actual_mac);
                 assert_eq!(&expected_mac[..], &actual_mac[..]);
             }
-            {
-                let key = Key::from_test_vector(&key);
-                assert_eq!(Ok(()), verify(key, &input, &expected_mac));
-            }
 
             // Test streaming byte-by-byte.
             {
@@ -339,6 +365,91 @@ mod tests {
         })
     }
 
+    // Compares the AVX-512 IFMA code with the assembly code for many input
+    // lengths, each fed in two parts, using keys and inputs that make the
+    // limbs as large as possible as well as pseudo-random ones.
+    #[cfg(target_arch = "x86_64")]
+    #[test]
+    pub fn test_poly1305_ifma() {
+        if unsafe { GFp_poly1305_ifma_capable() } != 1 {
+            return;
+        }
+
+        fn mac(ifma: bool, key: &KeyAndNonceBytes, input: &[u8], split: usize)
+               -> Tag {
+            let (key, nonce) = key.split_at(BLOCK_LEN);
+            let key = slice_as_array_ref!(key, BLOCK_LEN).unwrap();
+            let mut n = [0u32; BLOCK_LEN / 4];
+            for (n, bytes) in n.iter_mut().zip(nonce.chunks(4)) {
+                *n = polyfill::slice::u32_from_le_u8(
+                    slice_as_array_ref!(bytes, 4).unwrap());
+            }
+
+            let whole = input.len() & !(BLOCK_LEN - 1);
+            let mut last = [0u8; BLOCK_LEN];
+            let remainder = &input[whole..];
+            last[..remainder.len()].copy_from_slice(remainder);
+            last[remainder.len()] = 1;
+
+            let mut opaque = [0u8; OPAQUE_LEN];
+            let mut tag = [0u8; TAG_LEN];
+            with_aligned(&mut opaque, |state| {
+                let mut func = Funcs {
+                    blocks_fn: GFp_poly1305_blocks,
+                    emit_fn: GFp_poly1305_emit,
+                };
+                unsafe {
+                    if ifma {
+                        GFp_poly1305_init_ifma(state, key);
+                        func = Funcs {
+                            blocks_fn: GFp_poly1305_blocks_ifma,
+                            emit_fn: GFp_poly1305_emit_ifma,
+                        };
+                    } else {
+                        let _ = GFp_poly1305_init_asm(state, key, &mut func);
+                    }
+                }
+                for part in &[&input[..split], &input[split..whole]] {
+                    if !part.is_empty() {
+                        func.blocks(state, part, Pad::Pad);
+                    }
+                }
+                if !remainder.is_empty() {
+                    func.blocks(state, &last, Pad::AlreadyPadded);
+                }
+                func.emit(state, &mut tag, &n);
+            });
+            tag
+        }
+
+        let mut random = [0u8; 2 * KEY_LEN + 1300];
+        let mut x = 0x0123456789abcdefu64;
+        for b in random.iter_mut() {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            *b = (x >> 32) as u8;
+        }
+        let ones = [0xffu8; 1300];
+
+        let keys = [[0xffu8; KEY_LEN],
+                    *slice_as_array_ref!(&random[..KEY_LEN], KEY_LEN).unwrap()];
+        let inputs = [&ones[..], &random[2 * KEY_LEN..]];
+        for key in keys.iter() {
+            for input in inputs.iter() {
+                for len in 0..input.len() {
+                    let input = &input[..len];
+                    let whole = len & !(BLOCK_LEN - 1);
+                    for &split in &[0, 16, 256, (whole / 2) & !15] {
+                        let split = core::cmp::min(split, whole);
+                        assert_eq!(mac(true, key, input, split),
+                                   mac(false, key, input, split));
+                    }
+                }
+            }
+        }
+    }
+
     fn test_poly1305_simd(excess: usize, key: &[u8; KEY_LEN], input: &[u8],
                           expected_mac: &[u8; TAG_LEN])
                           -> Result<(), error::Unspecified> {
@@ -26,6 +26,9 @@ pub fn ref_from_mut_ref<'a, T: ?Sized>(x: &'a mut T) -> &'a T { x }
 #[inline(always)]
 pub fn u64_from_usize(x: usize) -> u64 { x as u64 }
 
+#[inline(always)]
+pub fn usize_from_u8(x: u8) -> usize { x as usize }
+
 /// `core::num::Wrapping` doesn't support `rotate_left`.
 /// There is no usable trait for `rotate_left`, so this polyfill just
 /// hard-codes u32. https://github.com/rust-lang/rust/issues/32463
@@ -63,6 +66,18 @@ pub mod slice {
          (value & 0xff) as u8]
     }
 
+    #[inline(always)]
+    pub fn be_u8_from_u64(value: u64) -> [u8; 8] {
+        let hi = be_u8_from_u32((value >> 32) as u32);
+        let lo = be_u8_from_u32(value as u32);
+        [hi[0], hi[1], hi[2], hi[3], lo[0], lo[1], lo[2], lo[3]]
+    }
+
+    #[inline(always)]
+    pub fn u64_from_be_u8(buffer: &[u8; 8]) -> u64 {
+        buffer.iter().fold(0, |acc, &b| (acc << 8) | u64::from(b))
+    }
+
     // https://github.com/rust-lang/rust/issues/27750
     // https://internals.rust-lang.org/t/stabilizing-basic-functions-on-arrays-and-slices/2868
     #[inline(always)]
@@ -0,0 +1,188 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+//! A lock-free pool of owned values that any number of threads can share.
+
+use core;
+use core::sync::atomic::{AtomicPtr, AtomicUsize, Ordering};
+use std;
+
+/// A fixed number of slots, each of which holds either nothing or an owned,
+/// boxed `T`.
+///
+/// A value is taken out of a slot by atomically swapping in null, so each
+/// value is owned by exactly one thread at a time, and it is put into any
+/// empty slot with a compare-exchange. No locks are taken. Because each slot
+/// swaps whole pointers that are never freed while they are in a slot, there
+/// is no ABA problem.
+pub struct Pool<T> {
+    slots: std::vec::Vec<AtomicPtr<T>>,
+
+    // Where `take` and `put` start looking, so that concurrent callers tend
+    // to use different slots.
+    next: AtomicUsize,
+
+    // The values move between threads but no two threads ever access one at
+    // the same time, like the value in a `Mutex`. Thus a `Pool<T>` is `Send`
+    // and `Sync` exactly when `T` is `Send`.
+    values: core::marker::PhantomData<std::sync::Mutex<T>>,
+}
+
+#[allow(box_pointers)]
+impl<T> Pool<T> {
+    /// Constructs a pool with `capacity` empty slots.
+    pub fn new(capacity: usize) -> Self {
+        let mut slots = std::vec::Vec::with_capacity(capacity);
+        for _ in 0..capacity {
+            slots.push(AtomicPtr::new(core::ptr::null_mut()));
+        }
+        Pool {
+            slots: slots,
+            next: AtomicUsize::new(0),
+            values: core::marker::PhantomData,
+        }
+    }
+
+    /// Takes a value out of any slot, or returns `None` if every slot is
+    /// empty.
+    pub fn take(&self) -> Option<std::boxed::Box<T>> {
+        let capacity = self.slots.len();
+        let start = self.next.fetch_add(1, Ordering::Relaxed);
+        (0..capacity)
+            .filter_map(|i| self.take_slot((start + i) % capacity))
+            .next()
+    }
+
+    /// Takes the value out of slot `i`, if there is one.
+    pub fn take_slot(&self, i: usize) -> Option<std::boxed::Box<T>> {
+        let ptr = self.slots[i].swap(core::ptr::null_mut(), Ordering::AcqRel);
+        if ptr.is_null() {
+            return None;
+        }
+        // `ptr` came from `Box::into_raw` in `put`, and swapping null into
+        // the slot made this the only owner of it.
+        Some(unsafe { std::boxed::Box::from_raw(ptr) })
+    }
+
+    /// Puts `value` into any empty slot. If every slot is full then `value` is
+    /// dropped.
+    pub fn put(&self, value: std::boxed::Box<T>) {
+        let ptr = std::boxed::Box::into_raw(value);
+        let capacity = self.slots.len();
+        let start = self.next.load(Ordering::Relaxed);
+        for i in 0..capacity {
+            let slot = &self.slots[(start + i) % capacity];
+            if slot.compare_exchange(core::ptr::null_mut(), ptr,
+                                     Ordering::AcqRel, Ordering::Relaxed)
+                   .is_ok() {
+                return;
+            }
+        }
+        // No slot took ownership of `ptr`, so this still owns it.
+        let _ = unsafe { std::boxed::Box::from_raw(ptr) };
+    }
+
+    /// The number of values in the pool.
+    pub fn len(&self) -> usize {
+        self.slots.iter()
+            .filter(|slot| !slot.load(Ordering::Acquire).is_null())
+            .count()
+    }
+
+    /// The number of slots.
+    #[inline]
+    pub fn capacity(&self) -> usize { self.slots.len() }
+}
+
+#[allow(box_pointers)]
+impl<T> Drop for Pool<T> {
+    fn drop(&mut self) {
+        for i in 0..self.slots.len() {
+            let _ = self.take_slot(i);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use std;
+    use super::Pool;
+
+    #[allow(box_pointers)]
+    #[test]
+    fn test_pool() {
+        let pool = Pool::new(2);
+        assert_eq!(pool.capacity(), 2);
+        assert_eq!(pool.len(), 0);
+        assert!(pool.take().is_none());
+
+        pool.put(std::boxed::Box::new(1));
+        pool.put(std::boxed::Box::new(2));
+        pool.put(std::boxed::Box::new(3)); // Dropped.
+        assert_eq!(pool.len(), 2);
+
+        let mut taken = [*pool.take().unwrap(), *pool.take().unwrap()];
+        taken.sort();
+        assert_eq!(taken, [1, 2]);
+        assert!(pool.take().is_none());
+        assert!(pool.take_slot(0).is_none());
+    }
+
+    // Every value put into the pool is dropped exactly once: when it is taken
+    // and dropped, when it doesn't fit, or when the pool is dropped.
+    #[allow(box_pointers)]
+    #[test]
+    fn test_pool_drops_values() {
+        let value = std::sync::Arc::new(());
+        {
+            let pool = Pool::new(3);
+            for _ in 0..4 {
+                pool.put(std::boxed::Box::new(value.clone()));
+            }
+            assert_eq!(std::sync::Arc::strong_count(&value), 4);
+            let _ = pool.take();
+            assert_eq!(std::sync::Arc::strong_count(&value), 3);
+        }
+        assert_eq!(std::sync::Arc::strong_count(&value), 1);
+    }
+
+    #[allow(box_pointers)]
+    #[test]
+    fn test_pool_threads() {
+        const NUM_THREADS: usize = 4;
+        let pool = std::sync::Arc::new(Pool::new(NUM_THREADS));
+        for i in 0..NUM_THREADS {
+            pool.put(std::boxed::Box::new(i));
+        }
+        let threads = (0..NUM_THREADS).map(|_| {
+            let pool = pool.clone();
+            std::thread::spawn(move || {
+                for _ in 0..1000 {
+                    if let Some(value) = pool.take() {
+                        pool.put(value);
+                    }
+                }
+            })
+        }).collect::<std::vec::Vec<_>>();
+        for thread in threads {
+            thread.join().unwrap();
+        }
+
+        let mut values = (0..NUM_THREADS).filter_map(|_| pool.take())
+                                         .map(|value| *value)
+                                         .collect::<std::vec::Vec<_>>();
+        values.sort();
+        assert_eq!(values, (0..NUM_THREADS).collect::<std::vec::Vec<_>>());
+    }
+}
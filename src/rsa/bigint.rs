@@ -50,15 +50,6 @@ use constant_time;
 #[cfg(feature = "rsa_signing")]
 use {der, rand};
 
-impl AsRef<BIGNUM> for Positive {
-    fn as_ref<'a>(&'a self) -> &'a BIGNUM { self.0.as_ref() }
-}
-
-impl AsRef<BIGNUM> for Nonnegative {
-    fn as_ref<'a>(&'a self) -> &'a BIGNUM { &self.0 }
-}
-
-
 /// Non-negative, non-zero integers.
 ///
 /// This set is sometimes called `Natural` or `Counting`, but texts, libraries,
@@ -105,6 +96,12 @@ impl Positive {
 
     #[inline]
     pub fn bit_length(&self) -> bits::BitLength { self.0.bit_length() }
+
+    #[cfg(feature = "rsa_signing")]
+    #[inline]
+    pub fn fill_be_bytes(&self, out: &mut [u8]) {
+        limb::big_endian_from_limbs_padded(self.0.limbs(), out)
+    }
 }
 
 /// Odd positive integers.
@@ -235,12 +232,6 @@ pub struct Modulus<M> {
     m: PhantomData<M>,
 }
 
-// `Modulus` uniquely owns and references its contents.
-unsafe impl<M> Send for Modulus<M> {}
-
-// `Modulus` is immutable.
-unsafe impl<M> Sync for Modulus<M> {}
-
 impl<M> Modulus<M> {
     fn new(n: OddPositive) -> Result<Self, error::Unspecified> {
         // A `Modulus` must be larger than 1.
@@ -272,7 +263,7 @@ impl<M> Modulus<M> {
 }
 
 #[cfg(feature = "rsa_signing")]
-impl Modulus<super::N> {
+impl<M> Modulus<M> {
     pub fn value(&self) -> &OddPositive { &self.value }
 }
 
@@ -325,13 +316,20 @@ impl<M, E> Elem<M, E> {
             encoding: PhantomData,
         })
     }
+
+    // Like `fill_be_bytes`, but the result is still encoded with `E`'s
+    // Montgomery factors. This is only for serializing precomputed values.
+    #[cfg(feature = "rsa_signing")]
+    pub fn fill_encoded_be_bytes(&self, out: &mut [u8]) {
+        limb::big_endian_from_limbs_padded(self.value.limbs(), out)
+    }
 }
 
 impl<M> Elem<M, R> {
     #[inline]
     pub fn into_unencoded(self, m: &Modulus<M>)
                           -> Result<Elem<M, Unencoded>, error::Unspecified> {
-        elem_reduced_(self, m)
+        elem_reduced_(&self, m)
     }
 }
 
@@ -371,10 +369,7 @@ pub fn elem_mul<M, AF, BF>(a: &Elem<M, AF>, b: Elem<M, BF>, m: &Modulus<M>)
                   error::Unspecified>
         where (AF, BF): ProductEncoding {
     let mut r = b.value;
-    bssl::map_result(unsafe {
-        GFp_BN_mod_mul_mont(&mut r.0, a.value.as_ref(), &r.0, &m.value.as_ref(),
-                            &m.n0)
-    })?;
+    r.set_to_product(Some(&a.value), m)?;
     Ok(Elem {
         value: r,
         m: PhantomData,
@@ -389,10 +384,11 @@ pub fn elem_set_to_product<M, AF, BF>(
         a: &Elem<M, AF>, b: &Elem<M, BF>, m: &Modulus<M>)
         -> Result<(), error::Unspecified>
         where (AF, BF): ProductEncoding {
-    bssl::map_result(unsafe {
-        GFp_BN_mod_mul_mont(r.value.as_mut_ref(), a.value.as_ref(),
-                            b.value.as_ref(), &m.value.as_ref(), &m.n0)
-    })
+    r.value.0.make_limbs(b.value.limbs().len(), |r_limbs| {
+        r_limbs.copy_from_slice(b.value.limbs());
+        Ok(())
+    })?;
+    r.value.set_to_product(Some(&a.value), m)
 }
 
 #[cfg(feature = "rsa_signing")]
@@ -419,19 +415,31 @@ pub fn elem_reduced_once<Larger, Smaller: SlightlySmallerModulus<Larger>>(
 pub fn elem_reduced<Larger, Smaller: NotMuchSmallerModulus<Larger>>(
         a: &Elem<Larger, Unencoded>, m: &Modulus<Smaller>)
         -> Result<Elem<Smaller, RInverse>, error::Unspecified> {
-    let tmp = a.try_clone()?;
-    elem_reduced_(tmp, m)
+    elem_reduced_(a, m)
 }
 
 fn elem_reduced_<LargerM, E: ReductionEncoding, SmallerM>(
-        mut a: Elem<LargerM, E>, m: &Modulus<SmallerM>)
+        a: &Elem<LargerM, E>, m: &Modulus<SmallerM>)
         -> Result<Elem<SmallerM, <E as ReductionEncoding>::Output>,
                   error::Unspecified> {
+    let m_nonnegative = &(m.value.0).0;
+    let m_limbs = m_nonnegative.limbs().len();
+
+    // `GFp_BN_from_montgomery_word` needs room for twice as many limbs as the
+    // modulus has, and it clobbers its input, so reduce a copy.
+    let mut tmp = [0; 2 * MAX_LIMBS];
+    let a_limbs = a.value.limbs();
+    tmp[..a_limbs.len()].copy_from_slice(a_limbs);
+    let mut tmp_top = a_limbs.len();
+
     let mut r = Elem::zero()?;
-    bssl::map_result(unsafe {
-        GFp_BN_from_montgomery_word(r.value.as_mut_ref(), a.value.as_mut_ref(),
-                                    &m.value.as_ref(), &m.n0)
-    })?;
+    bssl::map_result(r.value.0.with_bignum_mut(m_limbs, |r| {
+        repr_c::with_bignum_mut(&mut tmp[..(2 * m_limbs)], &mut tmp_top, |tmp| {
+            m_nonnegative.0.with_bignum(|n| unsafe {
+                GFp_BN_from_montgomery_word(r, tmp, n, &m.n0)
+            })
+        })
+    }))?;
     Ok(r)
 }
 
@@ -440,10 +448,7 @@ pub fn elem_squared<M, E>(a: Elem<M, E>, m: &Modulus<M>)
                   error::Unspecified>
         where (E, E): ProductEncoding {
     let mut value = a.value;
-    bssl::map_result(unsafe {
-        GFp_BN_mod_mul_mont(value.as_mut_ref(), value.as_ref(), value.as_ref(),
-                            &m.value.as_ref(), &m.n0)
-    })?;
+    value.set_to_product(None, m)?;
     Ok(Elem {
         value: value,
         m: PhantomData,
@@ -519,6 +524,13 @@ impl<M> One<M, RR> {
             encoding: PhantomData,
         }))
     }
+
+    // `RR` must be a value previously calculated by `newRR` for the same
+    // modulus, e.g. one that was serialized with `fill_encoded_be_bytes`.
+    #[cfg(feature = "rsa_signing")]
+    pub fn from_precomputed(RR: Elem<M, Unencoded>) -> One<M, RR> {
+        One(Elem::take_storage(RR))
+    }
 }
 
 // Returns 2**(lg R) (mod m).
@@ -539,7 +551,7 @@ fn calculate_RR(m: &Nonnegative) -> Result<Nonnegative, error::Unspecified> {
 
     let num_limbs = m.limbs().len();
 
-    r.as_mut_ref().make_limbs(num_limbs, |limbs| {
+    r.0.make_limbs(num_limbs, |limbs| {
         // Zero all the limbs.
         for limb in limbs.iter_mut() {
             *limb = 0;
@@ -591,6 +603,12 @@ impl<M, E> One<M, E> {
 #[derive(Clone, Copy)]
 pub struct PublicExponent(u64);
 
+#[cfg(any(feature = "rsa_signing", target_arch = "x86_64"))]
+impl PublicExponent {
+    #[inline]
+    pub fn value(&self) -> u64 { self.0 }
+}
+
 // This limit was chosen to bound the performance of the simple
 // exponentiation-by-squaring implementation in `elem_exp_vartime`. In
 // particular, it helps mitigate theoretical resource exhaustion attacks. 33
@@ -644,17 +662,144 @@ pub fn elem_exp_vartime<M>(
     Ok(acc)
 }
 
+/// The number of exponentiations that `elems_exp_65537_x8` does at once.
+#[cfg(target_arch = "x86_64")]
+pub const EXP_65537_X8_LANES: usize = 8;
+
+// RSA-4096 is the largest modulus that crypto/bn/exp65537-avx512.c supports.
+#[cfg(target_arch = "x86_64")]
+const EXP_65537_X8_MAX_LIMBS: usize = 4096 / limb::LIMB_BITS;
+
+/// R * R' (mod m), where R' is the radix-2**52 Montgomery factor that
+/// `elems_exp_65537_x8` uses for moduli of the size of *m*. Multiplying an
+/// unencoded value by it with `elem_mul` encodes the value for
+/// `elems_exp_65537_x8`.
+#[cfg(target_arch = "x86_64")]
+pub struct OneRRX8<M>(Elem<M, RR>);
+
+#[cfg(target_arch = "x86_64")]
+impl<M> OneRRX8<M> {
+    /// Returns `None` if `elems_exp_65537_x8` can't be used with `m` on this
+    /// CPU.
+    pub fn new(oneRR: &One<M, RR>, m: &Modulus<M>)
+               -> Result<Option<Self>, error::Unspecified> {
+        let m_limbs = (m.value.0).0.limbs();
+        if !exp_65537_x8_eligible(m) {
+            return Ok(None);
+        }
+        let mut r = Nonnegative::zero()?;
+        r.0.make_limbs(m_limbs.len(), |limbs| {
+            // `make_limbs` zeroed the limbs above those of `oneRR`.
+            let oneRR = oneRR.0.value.limbs();
+            limbs[..oneRR.len()].copy_from_slice(oneRR);
+            let r = limbs.as_mut_ptr();
+            unsafe {
+                GFp_exp65537_x8_oneRR(r, r, m_limbs.as_ptr(), m_limbs.len());
+            }
+            Ok(())
+        })?;
+        Ok(Some(OneRRX8(Elem {
+            value: r,
+            m: PhantomData,
+            encoding: PhantomData,
+        })))
+    }
+}
+
+/// Returns true if `elems_exp_65537_x8` can be used with `m` on this CPU.
+#[cfg(target_arch = "x86_64")]
+pub fn exp_65537_x8_eligible<M>(m: &Modulus<M>) -> bool {
+    let num_limbs = (m.value.0).0.limbs().len();
+    unsafe { GFp_exp65537_x8_eligible(num_limbs) == 1 }
+}
+
+/// Sets `bases[i]` to `bases[i]**65537 (mod moduli[i].0)` for up to
+/// `EXP_65537_X8_LANES` values at once, using vector instructions. Each value
+/// may have its own modulus, but all the moduli must be the same number of
+/// limbs and satisfy `exp_65537_x8_eligible`.
+///
+/// The addition chain is fixed: sixteen squarings and one multiplication, the
+/// same as `elem_exp_vartime` does for 65537.
+#[cfg(target_arch = "x86_64")]
+pub fn elems_exp_65537_x8<M>(bases: &mut [Elem<M, Unencoded>],
+                             moduli: &[(&Modulus<M>, &OneRRX8<M>)])
+                             -> Result<(), error::Unspecified> {
+    const LEN: usize = EXP_65537_X8_LANES * EXP_65537_X8_MAX_LIMBS;
+
+    let lanes = bases.len();
+    if lanes == 0 || lanes > EXP_65537_X8_LANES || moduli.len() != lanes {
+        return Err(error::Unspecified);
+    }
+    let num_limbs = (moduli[0].0.value.0).0.limbs().len();
+    if !exp_65537_x8_eligible(moduli[0].0) ||
+       num_limbs > EXP_65537_X8_MAX_LIMBS {
+        return Err(error::Unspecified);
+    }
+
+    // The lanes, one after the other, each padded to `num_limbs` limbs.
+    let mut a = [0; LEN];
+    let mut a_mont = [0; LEN];
+    let mut n = [0; LEN];
+    let mut n0 = [0; EXP_65537_X8_LANES];
+    let mut r = [0; LEN];
+
+    for (i, (base, &(m, oneRRX8))) in bases.iter().zip(moduli).enumerate() {
+        let m_limbs = (m.value.0).0.limbs();
+        if m_limbs.len() != num_limbs {
+            return Err(error::Unspecified);
+        }
+        let base_mont: Elem<M, R> =
+            elem_mul(&oneRRX8.0, base.try_clone()?, m)?;
+        let lane = i * num_limbs..(i + 1) * num_limbs;
+        limbs_copy_padded(&mut a[lane.clone()], base.value.limbs());
+        limbs_copy_padded(&mut a_mont[lane.clone()], base_mont.value.limbs());
+        n[lane].copy_from_slice(m_limbs);
+        n0[i] = m.n0[0];
+    }
+
+    unsafe {
+        GFp_exp65537_x8(r.as_mut_ptr(), a.as_ptr(), a_mont.as_ptr(),
+                        n.as_ptr(), n0.as_ptr(), lanes, num_limbs);
+    }
+
+    for (i, base) in bases.iter_mut().enumerate() {
+        base.value.0.make_limbs(num_limbs, |limbs| {
+            limbs.copy_from_slice(&r[i * num_limbs..(i + 1) * num_limbs]);
+            Ok(())
+        })?;
+    }
+    Ok(())
+}
+
+#[cfg(target_arch = "x86_64")]
+fn limbs_copy_padded(r: &mut [limb::Limb], a: &[limb::Limb]) {
+    let (lo, hi) = r.split_at_mut(a.len());
+    lo.copy_from_slice(a);
+    for limb in hi {
+        *limb = 0;
+    }
+}
+
 #[cfg(feature = "rsa_signing")]
 pub fn elem_exp_consttime<M>(
         base: Elem<M, R>, exponent: &OddPositive, oneR: &One<M, R>,
         m: &Modulus<M>) -> Result<Elem<M, Unencoded>, error::Unspecified> {
     let mut r = base.value;
-    bssl::map_result(unsafe {
-        GFp_BN_mod_exp_mont_consttime(&mut r.0, &r.0, exponent.as_ref(),
-                                      exponent.0.bit_length().as_usize_bits(),
-                                      oneR.0.value.as_ref(), &m.value.as_ref(),
-                                      &m.n0)
-    })?;
+    let m_nonnegative = &(m.value.0).0;
+    let p = &(exponent.0).0;
+    bssl::map_result(r.0.with_bignum_mut(m_nonnegative.limbs().len(), |r| {
+        let r: *mut BIGNUM = r;
+        p.0.with_bignum(|p| {
+            oneR.0.value.0.with_bignum(|one_mont| {
+                m_nonnegative.0.with_bignum(|n| unsafe {
+                    GFp_BN_mod_exp_mont_consttime(r, r, p,
+                                                  exponent.bit_length()
+                                                          .as_usize_bits(),
+                                                  one_mont, n, &m.n0)
+                })
+            })
+        })
+    }))?;
     let r = Elem {
         value: r,
         m: PhantomData,
@@ -709,7 +854,29 @@ pub fn elem_set_to_inverse_blinded(
 fn elem_inverse<M>(a: Elem<M, Unencoded>, m: &Modulus<M>)
                    -> Result<Elem<M, R>, InversionError> {
     let a_clone = a.try_clone()?;
-    let inverse = nonnegative_mod_inverse(a.value, &(m.value.0).0)?;
+
+    // The inverse of a * R**-1 is a**-1 * R, i.e. the Montgomery encoding of
+    // a**-1.
+    let mut a = Elem::<M, R>::take_storage(a).into_unencoded(m)?;
+
+    let m_limbs = (m.value.0).0.limbs();
+    let num_limbs = m_limbs.len();
+    let mut inverse = Nonnegative::zero()?;
+    let mut is_invertible = limb::LimbMask::False;
+    a.value.0.make_limbs(num_limbs, |a_limbs| {
+        inverse.0.make_limbs(num_limbs, |r_limbs| {
+            is_invertible = unsafe {
+                LIMBS_mod_inverse_consttime(r_limbs.as_mut_ptr(),
+                                            a_limbs.as_ptr(),
+                                            m_limbs.as_ptr(), num_limbs)
+            };
+            Ok(())
+        })
+    })?;
+    if is_invertible != limb::LimbMask::True {
+        return Err(InversionError::NoInverse);
+    }
+
     let r: Elem<M, R> = Elem {
         value: inverse,
         m: PhantomData,
@@ -723,161 +890,6 @@ fn elem_inverse<M>(a: Elem<M, Unencoded>, m: &Modulus<M>)
     Ok(r)
 }
 
-#[cfg(feature = "rsa_signing")]
-fn nonnegative_mod_inverse(a: Nonnegative, m: &Nonnegative)
-                           -> Result<Nonnegative, InversionError> {
-    use limb::*;
-
-    // Algorithm 2.23 from "Guide to Elliptic Curve Cryptography" [2004] by
-    // Darrel Hankerson, Alfred Menezes, and Scott Vanstone.
-
-    debug_assert!(greater_than(m, &a));
-    if a.is_zero() {
-        return Err(InversionError::NoInverse);
-    }
-
-    // n /= 2; i.e. n >>= 1. `n` must be even, and so no bits are lost.
-    fn halve(n: &mut Nonnegative) {
-        debug_assert!(n.is_even());
-
-        let mut carry = 0;
-        for limb in n.limbs_mut().iter_mut().rev() {
-            let original_value = *limb;
-            *limb = (original_value >> 1) | (carry << (LIMB_BITS - 1));
-            carry = original_value & 1;
-        }
-        n.0.shrunk_by_at_most_one_bit();
-    }
-
-    // n *= 2; i.e. n <<= 1.
-    fn double(n: &mut Nonnegative) -> Result<(), InversionError> {
-        let mut carry = 0;
-        for limb in n.limbs_mut() {
-            let original_value = *limb;
-            *limb = (original_value << 1) | carry;
-            carry = original_value >> (LIMB_BITS - 1);
-        }
-        if carry != 0 {
-            n.0.grow_by_one_bit()?;
-        }
-        Ok(())
-    }
-
-    // r += a.
-    fn add_assign(r: &mut Nonnegative, a: &mut Nonnegative, m_limb_count: usize)
-                  -> Result<(), error::Unspecified> {
-        let mut carry = 0;
-        r.0.make_limbs(m_limb_count, |r_limbs| {
-            a.0.make_limbs(m_limb_count, |a_limbs| {
-                carry = unsafe {
-                    LIMBS_add_assign(r_limbs.as_mut_ptr(), a_limbs.as_ptr(),
-                                     m_limb_count)
-                };
-                Ok(())
-            })
-        })?;
-        // It is possible for the result to be one bit larger than `m`.
-        if carry != 0 {
-            r.0.grow_by_one_bit()?
-        }
-        Ok(())
-    }
-
-    // r -= a. Requires r > a.
-    #[inline]
-    fn sub_assign(r: &mut Nonnegative, a: &mut Nonnegative, m_limb_count: usize)
-                  -> Result<(), error::Unspecified> {
-        r.0.make_limbs(m_limb_count, |r_limbs| {
-            a.0.make_limbs(m_limb_count, |a_limbs| {
-                unsafe {
-                    LIMBS_sub_assign(r_limbs.as_mut_ptr(), a_limbs.as_ptr(),
-                                     m_limb_count);
-                }
-                Ok(())
-            })
-        })
-    }
-
-    let mut u = a;
-    let mut v = m.try_clone()?;
-    let mut x1 = Nonnegative::one()?;
-    let mut x2 = Nonnegative::zero()?;
-    let mut k = 0;
-
-    let m_limbs = m.limbs();
-    let m_limb_count = m_limbs.len();
-
-    while !v.is_zero() {
-        if v.is_even() {
-            halve(&mut v);
-            double(&mut x1)?;
-        } else if u.is_even() {
-            halve(&mut u);
-            double(&mut x2)?;
-        } else if !greater_than(&u, &v) {
-            sub_assign(&mut v, &mut u, m_limb_count)?;
-            halve(&mut v);
-            add_assign(&mut x2, &mut x1, m_limb_count)?;
-            double(&mut x1)?;
-        } else {
-            sub_assign(&mut u, &mut v, m_limb_count)?;
-            halve(&mut u);
-            add_assign(&mut x1, &mut x2, m_limb_count)?;
-            double(&mut x2)?;
-        }
-        k += 1;
-    }
-
-    if !u.is_one() {
-        return Err(InversionError::NoInverse);
-    }
-
-    // Reduce `x1` once if necessary to ensure it is less than `m`.
-    if !greater_than(m, &x1) {
-        debug_assert!(x1.limbs().len() <= m_limb_count + 1);
-        // If `x` is longer than `m` then chop off that top bit.
-        x1.0.make_limbs(m_limb_count, |x1_limbs| {
-            unsafe {
-                LIMBS_sub_assign(x1_limbs.as_mut_ptr(), m_limbs.as_ptr(),
-                                 m_limb_count);
-            }
-            Ok(())
-        })?;
-    }
-    assert!(greater_than(m, &x1));
-
-    // Use the simpler repeated-subtraction reduction in 2.23.
-
-    let n = m.bit_length().as_usize_bits();
-    assert!(k >= n);
-    for _ in n..k {
-        let mut carry = 0;
-        if x1.is_odd() {
-            // x1 += m.
-            x1.0.make_limbs(m_limb_count, |x1_limbs| {
-                carry = unsafe {
-                    LIMBS_add_assign(x1_limbs.as_mut_ptr(), m_limbs.as_ptr(),
-                                     m_limb_count)
-                };
-                Ok(())
-            })?;
-        }
-
-        // x1 /= 2.
-        halve(&mut x1);
-
-        // Shift in the carry bit at the top.
-        if carry != 0 {
-            x1.0.make_limbs(m_limb_count, |limbs| {
-                *limbs.last_mut().unwrap() |= 1 << (LIMB_BITS - 1);
-                Ok(())
-            })?;
-        }
-    }
-
-    Ok(x1)
-}
-
 #[cfg(feature = "rsa_signing")]
 pub enum InversionError {
     NoInverse,
@@ -898,14 +910,11 @@ pub fn elem_verify_equal_consttime<M, E>(a: &Elem<M, E>, b: &Elem<M, E>)
 }
 
 /// Nonnegative integers: `Positive` ∪ {0}.
-struct Nonnegative(BIGNUM);
-
-// `Nonnegative` uniquely owns and references its contents.
-unsafe impl Send for Nonnegative {}
+struct Nonnegative(Limbs);
 
 impl Nonnegative {
     fn zero() -> Result<Self, error::Unspecified> {
-        let r = Nonnegative(BIGNUM::zero());
+        let r = Nonnegative(Limbs::zero());
         debug_assert!(r.is_zero());
         Ok(r)
     }
@@ -924,8 +933,7 @@ impl Nonnegative {
                                 -> Result<Self, error::Unspecified> {
         let mut r = Self::zero()?;
         r.0.make_limbs(
-            ((input.len() * limb::LIMB_BYTES) + limb::LIMB_BYTES - 1) /
-                limb::LIMB_BYTES, |limbs|  {
+            (input.len() + limb::LIMB_BYTES - 1) / limb::LIMB_BYTES, |limbs|  {
             // Rejects empty inputs.
             limb::parse_big_endian_and_pad_consttime(input, limbs)
         })?;
@@ -938,10 +946,6 @@ impl Nonnegative {
     #[cfg(feature = "rsa_signing")]
     fn is_one(&self) -> bool { self.limbs() == &[1] }
 
-    #[cfg(feature = "rsa_signing")]
-    #[inline]
-    fn is_even(&self) -> bool { !self.is_odd() }
-
     #[inline]
     fn is_odd(&self) -> bool {
         self.limbs().first().unwrap_or(&0) & 1 == 1
@@ -960,10 +964,6 @@ impl Nonnegative {
     #[inline]
     fn limbs(&self) -> &[limb::Limb] { self.0.limbs() }
 
-    #[cfg(feature = "rsa_signing")]
-    #[inline]
-    fn limbs_mut(&mut self) -> &mut [limb::Limb] { self.0.limbs_mut() }
-
     fn verify_less_than(&self, other: &Self)
                         -> Result<(), error::Unspecified> {
         if !greater_than(other, self) {
@@ -981,10 +981,6 @@ impl Nonnegative {
         })
     }
 
-    // XXX: This makes it too easy to break invariants on things. TODO: Remove
-    // this ASAP.
-    fn as_mut_ref(&mut self) -> &mut BIGNUM { &mut self.0 }
-
     fn into_elem<M>(self, m: &Modulus<M>)
                     -> Result<Elem<M, Unencoded>, error::Unspecified> {
         self.verify_less_than(&(m.value.0).0)?;
@@ -1004,11 +1000,31 @@ impl Nonnegative {
 
     pub fn try_clone(&self) -> Result<Nonnegative, error::Unspecified> {
         let mut r = Nonnegative::zero()?;
-        bssl::map_result(unsafe {
-            GFp_BN_copy(r.as_mut_ref(), self.as_ref())
+        r.0.make_limbs(self.limbs().len(), |limbs| {
+            limbs.copy_from_slice(self.limbs());
+            Ok(())
         })?;
         Ok(r)
     }
+
+    // self = a * self * R**-1 (mod m), or self = self * self * R**-1 (mod m)
+    // if `a` is `None`. `a` and `self` must be less than `m`.
+    fn set_to_product<M>(&mut self, a: Option<&Nonnegative>, m: &Modulus<M>)
+                         -> Result<(), error::Unspecified> {
+        let m_nonnegative = &(m.value.0).0;
+        bssl::map_result(self.0.with_bignum_mut(m_nonnegative.limbs().len(),
+                                                |r| {
+            let r: *mut BIGNUM = r;
+            m_nonnegative.0.with_bignum(|n| {
+                match a {
+                    Some(a) => a.0.with_bignum(|a| unsafe {
+                        GFp_BN_mod_mul_mont(r, a, r, n, &m.n0)
+                    }),
+                    None => unsafe { GFp_BN_mod_mul_mont(r, r, r, n, &m.n0) },
+                }
+            })
+        }))
+    }
 }
 
 // Returns a > b.
@@ -1043,114 +1059,128 @@ fn n0_from_u64(n0: u64) -> N0 {
     [n0 as limb::Limb, (n0 >> limb::LIMB_BITS) as limb::Limb]
 }
 
-// `BIGNUM` is defined in its own submodule so that its private components are
-// not accessible.
+// `Limbs` and `BIGNUM` are defined in their own submodule so that their private
+// components are not accessible.
 mod repr_c {
-    use {bssl, c, error, limb};
-    use core;
-    use libc;
+    use {c, error, limb};
 
-    // Keep in sync with `bignum_st` in openss/bn.h.
-    #[repr(C)]
-    pub struct BIGNUM {
-        d: *mut limb::Limb,
-        top: c::int,
-        dmax: c::int,
-        flags: c::int,
-    }
+    /// The maximum number of limbs in any value. This is enough for the
+    /// largest supported RSA public modulus, 8192 bits. Keep in sync with
+    /// `BN_MOD_MUL_MONT_MAX_LIMBS` in crypto/bn/montgomery.c.
+    pub const MAX_LIMBS: usize = 8192 / limb::LIMB_BITS;
 
-    impl Drop for BIGNUM {
-        fn drop(&mut self) {
-            // Keep this in sync with `GFp_BN_free()`.
-
-            // In particular, this doesn't work for `BN_FLG_STATIC_DATA`.
-            assert_eq!(self.flags, 0);
-            unsafe {
-                let d: *mut limb::Limb = self.d;
-                libc::free(d as *mut libc::c_void)
-            }
-        }
+    /// The storage of a `Nonnegative`. The limbs are stored inline, so that
+    /// no `Nonnegative` operation allocates memory.
+    //
+    // `top` may be smaller than before after an operation; the limbs past
+    // `top` are not necessarily zero.
+    pub struct Limbs {
+        limbs: [limb::Limb; MAX_LIMBS],
+        top: usize,
     }
 
-    impl BIGNUM {
+    impl Limbs {
         pub fn zero() -> Self {
-            BIGNUM {
-                d: core::ptr::null_mut(),
+            Limbs {
+                limbs: [0; MAX_LIMBS],
                 top: 0,
-                dmax: 0,
-                flags: 0,
             }
         }
 
         #[inline]
-        pub fn limbs(&self) -> &[limb::Limb] {
-            unsafe {
-                core::slice::from_raw_parts(self.d, self.top as usize)
-            }
-        }
+        pub fn limbs(&self) -> &[limb::Limb] { &self.limbs[..self.top] }
 
         #[inline]
         pub fn limbs_mut(&mut self) -> &mut [limb::Limb] {
-            unsafe {
-                core::slice::from_raw_parts_mut(self.d, self.top as usize)
-            }
-        }
-
-        #[cfg(feature = "rsa_signing")]
-        pub fn grow_by_one_bit(&mut self) -> Result<(), error::Unspecified> {
-            let old_top = self.top;
-            let new_top = old_top + 1;
-            bssl::map_result(unsafe {
-                GFp_bn_wexpand(self, new_top)
-            })?;
-            self.top = new_top;
-            self.limbs_mut()[old_top as usize] = 1;
-            Ok(())
-        }
-
-        #[cfg(feature = "rsa_signing")]
-        pub fn shrunk_by_at_most_one_bit(&mut self) {
-            if self.limbs().last().map_or(false, |last| *last == 0) {
-                self.top -= 1;
-            }
+            &mut self.limbs[..self.top]
         }
 
         pub fn make_limbs<F>(&mut self, num_limbs: usize, f: F)
                              -> Result<(), error::Unspecified>
                 where F: FnOnce(&mut [limb::Limb])
                                 -> Result<(), error::Unspecified> {
-            if num_limbs <= self.top as usize {
-                self.top = num_limbs as c::int;
-            } else {
-                let old_top = self.top as usize;
-                bssl::map_result(unsafe {
-                    GFp_bn_wexpand(self, num_limbs as c::int)
-                })?;
-                self.top = num_limbs as c::int;
-
-                // Zero the new upper limbs, leaving the old lower limbs untouched.
-                for limb in &mut self.limbs_mut()[old_top..] {
+            if num_limbs > MAX_LIMBS {
+                return Err(error::Unspecified);
+            }
+            if num_limbs > self.top {
+                // Zero the new upper limbs, leaving the old lower limbs
+                // untouched.
+                for limb in &mut self.limbs[self.top..num_limbs] {
                     *limb = 0;
                 }
             }
+            self.top = num_limbs;
 
             f(self.limbs_mut())?;
 
-            unsafe {
-                GFp_bn_correct_top(self)
-            }
+            self.correct_top();
 
             Ok(())
         }
+
+        // Keep in sync with `GFp_bn_correct_top`.
+        fn correct_top(&mut self) {
+            while self.top > 0 && self.limbs[self.top - 1] == 0 {
+                self.top -= 1;
+            }
+        }
+
+        /// Calls `f` with a `BIGNUM` that refers to `self`'s limbs. The C code
+        /// must not modify the `BIGNUM`.
+        pub fn with_bignum<F, R>(&self, f: F) -> R
+                                 where F: FnOnce(&BIGNUM) -> R {
+            let bn = BIGNUM {
+                d: self.limbs.as_ptr() as *mut limb::Limb,
+                top: self.top as c::int,
+                dmax: self.top as c::int,
+                flags: BN_FLG_STATIC_DATA,
+            };
+            f(&bn)
+        }
+
+        /// Calls `f` with a `BIGNUM` that refers to `self`'s limbs, which the C
+        /// code may modify and grow to up to `max_limbs` limbs.
+        pub fn with_bignum_mut<F, R>(&mut self, max_limbs: usize, f: F) -> R
+                where F: FnOnce(&mut BIGNUM) -> R {
+            with_bignum_mut(&mut self.limbs[..max_limbs], &mut self.top, f)
+        }
     }
 
-    extern {
-        fn GFp_bn_correct_top(r: &mut BIGNUM);
-        fn GFp_bn_wexpand(r: &mut BIGNUM, words: c::int) -> c::int;
+    /// Calls `f` with a `BIGNUM` that refers to the first `*top` limbs of
+    /// `storage`, which the C code may modify and grow to up to
+    /// `storage.len()` limbs, and then updates `*top`.
+    pub fn with_bignum_mut<F, R>(storage: &mut [limb::Limb], top: &mut usize,
+                                 f: F) -> R
+            where F: FnOnce(&mut BIGNUM) -> R {
+        assert!(*top <= storage.len());
+        let mut bn = BIGNUM {
+            d: storage.as_mut_ptr(),
+            top: *top as c::int,
+            dmax: storage.len() as c::int,
+            flags: BN_FLG_STATIC_DATA,
+        };
+        let r = f(&mut bn);
+        // `BN_FLG_STATIC_DATA` prevents the C code from reallocating `d`.
+        assert_eq!(bn.d, storage.as_mut_ptr());
+        assert!(bn.top >= 0 && bn.top <= bn.dmax);
+        *top = bn.top as usize;
+        r
     }
+
+    // Keep in sync with `bignum_st` in GFp/bn.h.
+    #[repr(C)]
+    pub struct BIGNUM {
+        d: *mut limb::Limb,
+        top: c::int,
+        dmax: c::int,
+        flags: c::int,
+    }
+
+    // Keep in sync with GFp/bn.h.
+    const BN_FLG_STATIC_DATA: c::int = 0x02;
 }
 
-pub use self::repr_c::BIGNUM;
+use self::repr_c::{BIGNUM, Limbs, MAX_LIMBS};
 
 extern {
     // `r` and/or 'a' and/or 'b' may alias.
@@ -1158,7 +1188,6 @@ extern {
                             n: &BIGNUM, n0: &N0) -> c::int;
 
     // The use of references here implies lack of aliasing.
-    fn GFp_BN_copy(a: &mut BIGNUM, b: &BIGNUM) -> c::int;
     fn GFp_BN_from_montgomery_word(r: &mut BIGNUM, a: &mut BIGNUM, n: &BIGNUM,
                                    n0: &N0) -> c::int;
 
@@ -1168,6 +1197,20 @@ extern {
                      m: *const limb::Limb, num_limbs: c::size_t);
 }
 
+#[cfg(target_arch = "x86_64")]
+extern {
+    fn GFp_exp65537_x8_eligible(num_limbs: c::size_t) -> c::int;
+
+    // `r` and `oneRR` may alias.
+    fn GFp_exp65537_x8_oneRR(r: *mut limb::Limb, oneRR: *const limb::Limb,
+                             n: *const limb::Limb, num_limbs: c::size_t);
+
+    fn GFp_exp65537_x8(r: *mut limb::Limb, a: *const limb::Limb,
+                       a_mont: *const limb::Limb, n: *const limb::Limb,
+                       n0: *const limb::Limb, lanes: c::size_t,
+                       num_limbs: c::size_t);
+}
+
 #[cfg(feature = "rsa_signing")]
 extern {
     // `r` and `a` may alias.
@@ -1184,15 +1227,17 @@ extern {
                         m: *const limb::Limb, num_limbs: c::size_t,
                         a_limbs: c::size_t);
 
-    fn LIMBS_add_assign(r: *mut limb::Limb, a: *const limb::Limb,
-                        num_limbs: c::size_t) -> limb::Limb;
-    fn LIMBS_sub_assign(r: *mut limb::Limb, a: *const limb::Limb,
-                        num_limbs: c::size_t);
+    // `r` and `a` may alias.
+    fn LIMBS_mod_inverse_consttime(r: *mut limb::Limb, a: *const limb::Limb,
+                                   m: *const limb::Limb, num_limbs: c::size_t)
+                                   -> limb::LimbMask;
 }
 
 #[cfg(test)]
 mod tests {
     use super::*;
+    #[cfg(feature = "rsa_signing")]
+    use init;
     use untrusted;
     use test;
 
@@ -1235,6 +1280,10 @@ mod tests {
     #[cfg(feature = "rsa_signing")]
     #[test]
     fn test_elem_exp_consttime() {
+        // Detect the CPU features so that the same implementation is tested as
+        // is used for RSA signing.
+        init::init_once();
+
         test::from_file("src/rsa/bigint_elem_exp_consttime_tests.txt",
                         |section, test_case| {
             assert_eq!(section, "");
@@ -12,8 +12,9 @@
 // OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
 // CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
-use {error, rand};
+use {error, pool, rand};
 use core;
+use std;
 use super::{bigint, N};
 use arithmetic::montgomery::{R, RR};
 
@@ -76,6 +77,38 @@ impl Blinding {
         Ok(result)
     }
 
+    /// Replaces the blinding factors with fresh ones if they are exhausted, so
+    /// that the next call to `blind` won't need to do so.
+    pub fn prepare(&mut self, e: bigint::PublicExponent,
+                   oneRR: &bigint::One<N, RR>, n: &bigint::Modulus<N>,
+                   rng: &rand::SecureRandom) -> Result<(), error::Unspecified> {
+        let old_contents = core::mem::replace(&mut self.0, None);
+        let new_contents = match old_contents {
+            Some(contents) => {
+                if contents.remaining > 0 {
+                    contents
+                } else {
+                    reset(contents.blinding_factor,
+                          contents.blinding_factor_inv, e, oneRR, n, rng)?
+                }
+            },
+            None => {
+                let elem1 = bigint::Elem::zero()?;
+                let elem2 = bigint::Elem::zero()?;
+                reset(elem1, elem2, e, oneRR, n, rng)?
+            },
+        };
+        let _ = core::mem::replace(&mut self.0, Some(new_contents));
+        Ok(())
+    }
+
+    fn is_prepared(&self) -> bool {
+        match &self.0 {
+            &Some(Contents { remaining, .. }) => remaining > 0,
+            &None => false,
+        }
+    }
+
     #[cfg(test)]
     pub fn remaining(&self) -> usize {
         match &self.0 {
@@ -113,6 +146,68 @@ fn reset(elem1: bigint::Elem<N, R>, elem2: bigint::Elem<N, R>,
     Err(error::Unspecified)
 }
 
+/// A fixed number of `Blinding`s that can be shared between threads.
+///
+/// A `Blinding` is only ever used by one thread at a time: it is taken out of
+/// the pool, used, and put back afterwards. When the pool is empty, e.g. when
+/// there are more concurrent callers than slots, a new `Blinding` is created
+/// for the caller.
+pub struct BlindingPool {
+    blindings: pool::Pool<Blinding>,
+}
+
+impl BlindingPool {
+    pub fn new(num_slots: usize) -> Self {
+        BlindingPool {
+            blindings: pool::Pool::new(num_slots),
+        }
+    }
+
+    #[allow(box_pointers)]
+    pub fn blind<F>(&self, x: bigint::Elem<N>,
+                    e: bigint::PublicExponent, oneRR: &bigint::One<N, RR>,
+                    n: &bigint::Modulus<N>, rng: &rand::SecureRandom, f: F)
+                    -> Result<bigint::Elem<N>, error::Unspecified>
+                    where F: FnOnce(bigint::Elem<N>)
+                                    -> Result<bigint::Elem<N>,
+                                              error::Unspecified> {
+        let mut blinding = match self.blindings.take() {
+            Some(blinding) => blinding,
+            None => std::boxed::Box::new(Blinding::new()),
+        };
+        let result = blinding.blind(x, e, oneRR, n, rng, f);
+        self.blindings.put(blinding);
+        result
+    }
+
+    /// Fills every empty slot with a new `Blinding` and refreshes the
+    /// exhausted ones, so that callers of `blind` don't have to do so.
+    #[allow(box_pointers)]
+    pub fn prepare(&self, e: bigint::PublicExponent,
+                   oneRR: &bigint::One<N, RR>, n: &bigint::Modulus<N>,
+                   rng: &rand::SecureRandom) -> Result<(), error::Unspecified> {
+        for i in 0..self.blindings.capacity() {
+            let mut blinding = match self.blindings.take_slot(i) {
+                Some(blinding) => {
+                    if blinding.is_prepared() {
+                        self.blindings.put(blinding);
+                        continue;
+                    }
+                    blinding
+                },
+                None => std::boxed::Box::new(Blinding::new()),
+            };
+            let result = blinding.prepare(e, oneRR, n, rng);
+            self.blindings.put(blinding);
+            result?;
+        }
+        Ok(())
+    }
+
+    #[cfg(test)]
+    pub fn num_available(&self) -> usize { self.blindings.len() }
+}
+
 
 // The paper suggests reusing blinding factors 32 times. Note that this must
 // never be zero.
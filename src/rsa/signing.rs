@@ -14,11 +14,12 @@
 
 /// RSA PKCS#1 1.5 signatures.
 
-use {bits, der, digest, error, pkcs8};
+use {bits, constant_time, der, digest, error, hmac, pkcs8, polyfill};
 use rand;
 use std;
 use super::{blinding, bigint, N};
 use arithmetic::montgomery::{R, RR, RRR};
+use limb::LIMB_BITS;
 use untrusted;
 
 /// An RSA key pair, used for signing. Feature: `rsa_signing`.
@@ -378,6 +379,118 @@ impl RSAKeyPair {
         })
     }
 
+    /// Serializes the key pair together with the values that `from_der()`
+    /// precomputes, so that `from_precomputed()` can load it again without
+    /// validating and precomputing again.
+    ///
+    /// Validating a key pair and calculating the Montgomery constants for
+    /// `n`, `p`, and `q` dominates the cost of `from_pkcs8()` and
+    /// `from_der()`. The serialized form carries the results, so loading it
+    /// costs little more than copying it. It is a sequence of big-endian
+    /// integers that doesn't need to be aligned, so it can be loaded straight
+    /// from a memory-mapped file.
+    ///
+    /// The serialized form is authenticated with HMAC using `key`, and
+    /// `from_precomputed()` only accepts it with the same key, because it
+    /// skips the checks of the key pair's consistency. `key` should be the
+    /// application's own secret, e.g. generated with
+    /// `hmac::SigningKey::generate()`, and is used only to authenticate
+    /// key pairs that the application itself has validated by importing them
+    /// with `from_pkcs8()` or `from_der()`.
+    ///
+    /// The serialized form contains the private key and so must be protected
+    /// like the PKCS#8 document it came from. It is specific to *ring*, and it
+    /// may change between versions of *ring*, in which case it will be
+    /// rejected by `from_precomputed()`; keep the original key pair so that
+    /// it can be imported again. Some of the precomputed values depend on
+    /// the word size of the target, so a key pair serialized on a 64-bit
+    /// target is rejected on a 32-bit target, and vice versa.
+    pub fn serialize_precomputed(&self, key: &hmac::SigningKey)
+                                 -> Result<std::vec::Vec<u8>,
+                                           error::Unspecified> {
+        let n_len = precomputed_len(self.n.value());
+        let p_len = precomputed_len(self.p.modulus.value());
+
+        let mut out = std::vec::Vec::new();
+        out.push(PRECOMPUTED_VERSION);
+        out.push(LIMB_BITS as u8);
+        write_precomputed(&mut out, n_len, |b| self.n.value().fill_be_bytes(b));
+        write_precomputed(&mut out, 8, |b| {
+            b.copy_from_slice(&polyfill::slice::be_u8_from_u64(self.e.value()))
+        });
+        self.p.write_precomputed(&mut out, p_len);
+        self.q.write_precomputed(&mut out, p_len);
+        write_precomputed(&mut out, p_len,
+                          |b| self.qInv.fill_encoded_be_bytes(b));
+        write_precomputed(&mut out, n_len,
+                          |b| self.oneRR_mod_n.as_ref()
+                                              .fill_encoded_be_bytes(b));
+        write_precomputed(&mut out, n_len,
+                          |b| self.q_mod_n.fill_encoded_be_bytes(b));
+        write_precomputed(&mut out, n_len,
+                          |b| self.qq.value().fill_be_bytes(b));
+
+        let tag = precomputed_tag(key, &out);
+        out.extend_from_slice(tag.as_ref());
+        Ok(out)
+    }
+
+    /// Loads a key pair serialized by `serialize_precomputed()` with the same
+    /// `key`.
+    ///
+    /// The HMAC tag is verified first, and then the values are used as they
+    /// are, with only the cheap checks that they are in range; in particular,
+    /// none of the validation described in the documentation for
+    /// `from_pkcs8()` is done again.
+    pub fn from_precomputed(key: &hmac::SigningKey, input: untrusted::Input)
+                            -> Result<RSAKeyPair, error::Unspecified> {
+        let input = input.as_slice_less_safe();
+        let tag_len = key.digest_algorithm().output_len;
+        if input.len() < tag_len {
+            return Err(error::Unspecified);
+        }
+        let (data, tag) = input.split_at(input.len() - tag_len);
+        constant_time::verify_slices_are_equal(
+            precomputed_tag(key, data).as_ref(), tag)?;
+
+        untrusted::Input::from(data).read_all(error::Unspecified, |input| {
+            if input.read_byte()? != PRECOMPUTED_VERSION {
+                return Err(error::Unspecified);
+            }
+            if polyfill::usize_from_u8(input.read_byte()?) != LIMB_BITS {
+                return Err(error::Unspecified);
+            }
+            let n = read_precomputed(input)?;
+            let e = read_precomputed(input)?;
+            let n_bits = n.bit_length();
+            let (n, e) = super::check_public_modulus_and_exponent(
+                n, e, bits::BitLength::from_usize_bits(2048),
+                super::PRIVATE_KEY_PUBLIC_MODULUS_MAX_BITS,
+                bits::BitLength::from_usize_bits(17))?;
+            let n = n.into_modulus::<N>()?;
+
+            let p = PrivatePrime::from_precomputed(input)?;
+            let q = PrivatePrime::from_precomputed(input)?;
+            let qInv = read_precomputed(input)?.into_elem(&p.modulus)?;
+            let oneRR_mod_n = read_precomputed(input)?.into_elem(&n)?;
+            let q_mod_n = read_precomputed(input)?.into_elem(&n)?;
+            let qq = read_precomputed(input)?.into_odd_positive()?
+                .into_modulus::<QQ>()?;
+
+            Ok(RSAKeyPair {
+                n,
+                e,
+                p,
+                q,
+                qInv: bigint::Elem::take_storage(qInv),
+                oneRR_mod_n: bigint::One::from_precomputed(oneRR_mod_n),
+                q_mod_n: bigint::Elem::take_storage(q_mod_n),
+                qq,
+                n_bits
+            })
+        })
+    }
+
     /// Returns the length in bytes of the key pair's public modulus.
     ///
     /// A signature has the same length as the public modulus.
@@ -386,6 +499,54 @@ impl RSAKeyPair {
     }
 }
 
+// The first byte of the output of `RSAKeyPair::serialize_precomputed`. This
+// must be changed whenever the format or the meaning of any of the values
+// changes.
+//
+// The second byte is `LIMB_BITS`. The Montgomery-encoded values are encoded
+// with R = 2**(LIMB_BITS * num_limbs), which differs between 32-bit and
+// 64-bit targets for moduli whose length isn't a multiple of 64 bits, so they
+// are only valid on targets with the same limb size.
+const PRECOMPUTED_VERSION: u8 = 2;
+
+// Keeps tags for serialized key pairs distinct from HMAC tags that the
+// application computes with the same key for anything else.
+const PRECOMPUTED_LABEL: &'static [u8] = b"ring RSAKeyPair precomputed";
+
+fn precomputed_tag(key: &hmac::SigningKey, data: &[u8]) -> hmac::Signature {
+    let mut ctx = hmac::SigningContext::with_key(key);
+    ctx.update(PRECOMPUTED_LABEL);
+    ctx.update(data);
+    ctx.sign()
+}
+
+// The serialized length of values less than `m`. This is a multiple of the
+// size of a limb on every target so that `fill_be_bytes` has room for all
+// the limbs. The lengths are the same on 32-bit and 64-bit targets, but some
+// of the values aren't; see `PRECOMPUTED_VERSION`.
+fn precomputed_len(m: &bigint::OddPositive) -> usize {
+    (m.bit_length().as_usize_bytes_rounded_up() + 7) / 8 * 8
+}
+
+fn write_precomputed<F>(out: &mut std::vec::Vec<u8>, len: usize, fill: F)
+        where F: FnOnce(&mut [u8]) {
+    debug_assert!(len <= 0xffff);
+    out.push((len >> 8) as u8);
+    out.push(len as u8);
+    let start = out.len();
+    out.resize(start + len, 0);
+    fill(&mut out[start..]);
+}
+
+fn read_precomputed(input: &mut untrusted::Reader)
+                    -> Result<bigint::Positive, error::Unspecified> {
+    let len_hi = input.read_byte()?;
+    let len_lo = input.read_byte()?;
+    let len = (polyfill::usize_from_u8(len_hi) << 8) |
+              polyfill::usize_from_u8(len_lo);
+    bigint::Positive::from_be_bytes_padded(input.skip_and_get_input(len)?)
+}
+
 struct PrivatePrime<M: Prime> {
     modulus: bigint::Modulus<M>,
     exponent: bigint::OddPositive,
@@ -423,6 +584,30 @@ impl<M: Prime> PrivatePrime<M> {
 
         let p = p.into_modulus()?;
         let oneRR = bigint::One::newRR(&p)?;
+        Self::with_oneRR(p, dP, oneRR)
+    }
+
+    // Reads the values written by `write_precomputed`.
+    fn from_precomputed(input: &mut untrusted::Reader)
+                        -> Result<Self, error::Unspecified> {
+        let p = read_precomputed(input)?.into_odd_positive()?
+            .into_modulus::<M>()?;
+        let dP = read_precomputed(input)?.into_odd_positive()?;
+        dP.verify_less_than(p.value())?;
+        let oneRR = read_precomputed(input)?.into_elem(&p)?;
+        Self::with_oneRR(p, dP, bigint::One::from_precomputed(oneRR))
+    }
+
+    fn write_precomputed(&self, out: &mut std::vec::Vec<u8>, len: usize) {
+        write_precomputed(out, len, |b| self.modulus.value().fill_be_bytes(b));
+        write_precomputed(out, len, |b| self.exponent.fill_be_bytes(b));
+        write_precomputed(out, len,
+                          |b| self.oneRR.as_ref().fill_encoded_be_bytes(b));
+    }
+
+    fn with_oneRR(p: bigint::Modulus<M>, dP: bigint::OddPositive,
+                  oneRR: bigint::One<M, RR>)
+                  -> Result<Self, error::Unspecified> {
         let oneRR_clone = oneRR.try_clone()?;
         let oneR = bigint::One::newR(&oneRR, &p)?;
         let oneRRR = bigint::One::newRRR(oneRR_clone, &p)?;
@@ -446,6 +631,64 @@ fn elem_exp_consttime<M, MM>(c: &bigint::Elem<MM>, p: &PrivatePrime<M>)
     bigint::elem_exp_consttime(c_mod_m, &p.exponent, &p.oneR, &p.modulus)
 }
 
+// The most helper threads that `elem_exp_consttime_crt` runs at once, across
+// all signing states. Beyond that, concurrent signing would only oversubscribe
+// the cores, so the extra signatures are computed sequentially instead.
+const MAX_CRT_HELPER_THREADS: usize = 16;
+
+static CRT_HELPER_THREADS: std::sync::atomic::AtomicUsize =
+    std::sync::atomic::AtomicUsize::new(0);
+
+// Releases a slot counted in `CRT_HELPER_THREADS` when dropped.
+struct CrtHelperSlot;
+
+impl CrtHelperSlot {
+    fn acquire() -> Option<Self> {
+        use std::sync::atomic::Ordering;
+        let previous = CRT_HELPER_THREADS.fetch_add(1, Ordering::Relaxed);
+        if previous >= MAX_CRT_HELPER_THREADS {
+            let _ = CRT_HELPER_THREADS.fetch_sub(1, Ordering::Relaxed);
+            return None;
+        }
+        Some(CrtHelperSlot)
+    }
+}
+
+impl Drop for CrtHelperSlot {
+    fn drop(&mut self) {
+        use std::sync::atomic::Ordering;
+        let _ = CRT_HELPER_THREADS.fetch_sub(1, Ordering::Relaxed);
+    }
+}
+
+// Returns `(c**dP (mod p), c**dQ (mod q))`. When `concurrent` is true, the
+// second exponentiation is done on a new thread, if fewer than
+// `MAX_CRT_HELPER_THREADS` such threads are running and one can be spawned.
+fn elem_exp_consttime_crt(key: &std::sync::Arc<RSAKeyPair>,
+                          c: &bigint::Elem<N>, concurrent: bool)
+    -> Result<(bigint::Elem<P>, bigint::Elem<Q>), error::Unspecified> {
+    let slot = if concurrent { CrtHelperSlot::acquire() } else { None };
+    if let Some(slot) = slot {
+        let c_mod_qq = bigint::elem_reduced_once(c, &key.qq)?;
+        let key_q = key.clone();
+        let spawned = std::thread::Builder::new().spawn(move || {
+            let _slot = slot;
+            elem_exp_consttime(&c_mod_qq, &key_q.q)
+        });
+        if let Ok(m_2) = spawned {
+            let m_1 = elem_exp_consttime(c, &key.p);
+            let m_2 = m_2.join().map_err(|_| error::Unspecified)?;
+            return Ok((m_1?, m_2?));
+        }
+        // Otherwise, fall back to doing both exponentiations on this thread.
+    }
+
+    let m_1 = elem_exp_consttime(c, &key.p)?;
+    let c_mod_qq = bigint::elem_reduced_once(c, &key.qq)?;
+    let m_2 = elem_exp_consttime(&c_mod_qq, &key.q)?;
+    Ok((m_1, m_2))
+}
+
 
 // Type-level representations of the different moduli used in RSA signing, in
 // addition to `super::N`. See `super::bigint`'s modulue-level documentation.
@@ -506,6 +749,7 @@ unsafe impl bigint::NotMuchSmallerModulus<QQ> for Q {}
 /// computational efficiency by increasing the frequency of the expensive
 /// modular inversions; managing a pool of `RSASigningState`s in a
 /// most-recently-used fashion would improve the computational efficiency.
+/// `RSASharedSigningState` manages such a pool without locking.
 pub struct RSASigningState {
     key_pair: std::sync::Arc<RSAKeyPair>,
     blinding: blinding::Blinding,
@@ -543,96 +787,262 @@ impl RSASigningState {
     /// platforms, it is done less perfectly. To help mitigate the current
     /// imperfections, and for defense-in-depth, base blinding is always done.
     /// Exponent blinding is not done, but it may be done in the future.
-    #[allow(non_shorthand_field_patterns)] // Work around compiler bug.
     pub fn sign(&mut self, padding_alg: &'static ::signature::RSAEncoding,
                 rng: &rand::SecureRandom, msg: &[u8], signature: &mut [u8])
                 -> Result<(), error::Unspecified> {
-        let mod_bits = self.key_pair.n_bits;
-        if signature.len() != mod_bits.as_usize_bytes_rounded_up() {
+        counted!(RsaSign, msg.len(),
+                 self.sign_(padding_alg, rng, &digest_msg(padding_alg, msg),
+                            signature, false))
+    }
+
+    /// Like `sign`, but the two half-size exponentiations of the Chinese
+    /// Remainder Theorem step (modulo `p` and modulo `q`) are done
+    /// concurrently, the one modulo `q` on a newly-spawned thread.
+    ///
+    /// This reduces the latency of a signature to a little more than half of
+    /// that of `sign`, at the cost of creating a thread and of using two cores
+    /// for the duration of the signing. It is intended for latency-sensitive
+    /// uses where spare cores are available; when throughput matters more,
+    /// `sign` is more efficient.
+    ///
+    /// At most 16 such helper threads run at once in the whole process, no
+    /// matter how many threads call `sign_concurrent`. When that many are
+    /// already running, or if a thread can't be spawned, the exponentiations
+    /// are done sequentially on the calling thread, like `sign` does. The
+    /// signature is the same as the one `sign` would produce.
+    pub fn sign_concurrent(&mut self,
+                           padding_alg: &'static ::signature::RSAEncoding,
+                           rng: &rand::SecureRandom, msg: &[u8],
+                           signature: &mut [u8])
+                           -> Result<(), error::Unspecified> {
+        counted!(RsaSign, msg.len(),
+                 self.sign_(padding_alg, rng, &digest_msg(padding_alg, msg),
+                            signature, true))
+    }
+
+    /// Like `sign`, but signs the message with digest `m_hash` instead of
+    /// digesting the message itself, so that large messages can be digested
+    /// incrementally with a `digest::Context`. `m_hash` must have been
+    /// calculated with `padding_alg`'s digest algorithm. The signature is the
+    /// same as the one `sign` would produce for the message.
+    pub fn sign_digest(&mut self,
+                       padding_alg: &'static ::signature::RSAEncoding,
+                       rng: &rand::SecureRandom, m_hash: &digest::Digest,
+                       signature: &mut [u8])
+                       -> Result<(), error::Unspecified> {
+        counted!(RsaSign, 0usize,
+                 self.sign_(padding_alg, rng, m_hash, signature, false))
+    }
+
+    fn sign_(&mut self, padding_alg: &'static ::signature::RSAEncoding,
+             rng: &rand::SecureRandom, m_hash: &digest::Digest,
+             signature: &mut [u8], concurrent: bool)
+             -> Result<(), error::Unspecified> {
+        let key = &self.key_pair;
+        let blinding = &mut self.blinding;
+        sign(key, padding_alg, rng, m_hash, signature, |base| {
+            blinding.blind(base, key.e, &key.oneRR_mod_n, &key.n, rng, |c| {
+                private_key_op(key, &c, concurrent)
+            })
+        })
+    }
+}
+
+
+/// State used for RSA signing that can be shared between threads. Feature:
+/// `rsa_signing`.
+///
+/// Unlike `RSASigningState`, `sign` takes `&self`, so a single
+/// `RSASharedSigningState`, e.g. in an `Arc`, can be used to sign concurrently
+/// from any number of threads.
+///
+/// # Performance Considerations
+///
+/// `RSASharedSigningState` holds a pool of blinding states (see
+/// `RSASigningState`), which are taken out of and returned to the pool
+/// without locking. Each concurrent call to `sign` uses its own blinding
+/// state; when the pool is empty, because all of its blinding states are in
+/// use, a new one is created, and afterwards it is returned to the pool if
+/// there is room. The pool's size should therefore be at least the number of
+/// threads that will sign concurrently.
+///
+/// Periodically, a blinding state must be refreshed, which requires a
+/// relatively expensive computation. `prepare_blindings` does this ahead of
+/// time for every blinding state in the pool, e.g. in a background thread or
+/// during otherwise-idle periods, so that the refreshing doesn't happen
+/// during `sign`.
+pub struct RSASharedSigningState {
+    key_pair: std::sync::Arc<RSAKeyPair>,
+    blindings: blinding::BlindingPool,
+}
+
+impl RSASharedSigningState {
+    /// Construct an `RSASharedSigningState` for the given `RSAKeyPair` with
+    /// room for `pool_size` blinding states. The pool is initially empty;
+    /// `prepare_blindings` can be used to fill it.
+    pub fn new(key_pair: std::sync::Arc<RSAKeyPair>, pool_size: usize)
+               -> Result<Self, error::Unspecified> {
+        if pool_size == 0 {
             return Err(error::Unspecified);
         }
+        Ok(RSASharedSigningState {
+            key_pair: key_pair,
+            blindings: blinding::BlindingPool::new(pool_size),
+        })
+    }
 
-        let &mut RSASigningState {
-            key_pair: ref key,
-            blinding: ref mut blinding,
-        } = self;
+    /// The `RSAKeyPair`. This can be used, for example, to access the key
+    /// pair's public key through the `RSASharedSigningState`.
+    pub fn key_pair(&self) -> &RSAKeyPair { self.key_pair.as_ref() }
 
-        let m_hash = digest::digest(padding_alg.digest_alg(), msg);
-        padding_alg.encode(&m_hash, signature, mod_bits, rng)?;
+    /// Fill the pool with blinding states, replacing the ones that need to be
+    /// refreshed, using `rng`.
+    pub fn prepare_blindings(&self, rng: &rand::SecureRandom)
+                             -> Result<(), error::Unspecified> {
+        let key = self.key_pair.as_ref();
+        self.blindings.prepare(key.e, &key.oneRR_mod_n, &key.n, rng)
+    }
 
-        // RFC 8017 Section 5.1.2: RSADP, using the Chinese Remainder Theorem
-        // with Garner's algorithm.
+    /// Sign `msg`. This is the same as `RSASigningState::sign`.
+    pub fn sign(&self, padding_alg: &'static ::signature::RSAEncoding,
+                rng: &rand::SecureRandom, msg: &[u8], signature: &mut [u8])
+                -> Result<(), error::Unspecified> {
+        counted!(RsaSign, msg.len(),
+                 self.sign_(padding_alg, rng, &digest_msg(padding_alg, msg),
+                            signature, false))
+    }
 
-        // Step 1. The value zero is also rejected.
-        //
-        // TODO: Avoid having `encode()` pad its output, and then remove
-        // `Positive::from_be_bytes_padded()`.
-        let base = bigint::Positive::from_be_bytes_padded(
-            untrusted::Input::from(signature))?;
-        let base = base.into_elem(&key.n)?;
-
-        // Step 2.
-        let result = blinding.blind(base, key.e, &key.oneRR_mod_n, &key.n, rng,
-                                    |c| {
-            // Step 2.b.i.
-            let m_1 = elem_exp_consttime(&c, &key.p)?;
-            let c_mod_qq = bigint::elem_reduced_once(&c, &key.qq)?;
-            let m_2 = elem_exp_consttime(&c_mod_qq, &key.q)?;
-
-            // Step 2.b.ii isn't needed since there are only two primes.
-
-            // Step 2.b.iii.
-            let p = &key.p.modulus;
-            let m_2 = bigint::elem_widen(m_2);
-            let m_1_minus_m_2 = bigint::elem_sub(m_1, &m_2, p)?;
-            let h = bigint::elem_mul(&key.qInv, m_1_minus_m_2, p)?;
-
-            // Step 2.b.iv. The reduction in the modular multiplication isn't
-            // necessary because `h < p` and `p * q == n` implies `h * q < n`.
-            // Modular arithmetic is used simply to avoid implementing
-            // non-modular arithmetic.
-            let h = bigint::elem_widen(h);
-            let q_times_h = bigint::elem_mul(&key.q_mod_n, h, &key.n)?;
-            let m_2 = bigint::elem_widen(m_2);
-            let m = bigint::elem_add(m_2, q_times_h, &key.n)?;
-
-            // Step 2.b.v isn't needed since there are only two primes.
-
-            // Verify the result to protect against fault attacks as described
-            // in "On the Importance of Checking Cryptographic Protocols for
-            // Faults" by Dan Boneh, Richard A. DeMillo, and Richard J. Lipton.
-            // This check is cheap assuming `e` is small, which is ensured
-            // during `RSAKeyPair` construction. Note that this is the only
-            // validation of `e` that is done other than basic checks on its
-            // size, oddness, and minimum value, since the relationship of `e`
-            // to `d`, `p`, and `q` is not verified during `RSAKeyPair`
-            // construction.
-            let computed = m.try_clone()?;
-            let computed =
-                bigint::elem_mul(&key.oneRR_mod_n.as_ref(), computed, &key.n)?;
-            let verify = bigint::elem_exp_vartime(computed, key.e, &key.n)?;
-            let verify = verify.into_unencoded(&key.n)?;
-            bigint::elem_verify_equal_consttime(&verify, &c)?;
-
-            // Step 3.
-            Ok(m)
-        })?;
-
-        result.fill_be_bytes(signature);
-
-        Ok(())
+    /// Sign `msg`. This is the same as `RSASigningState::sign_concurrent`.
+    pub fn sign_concurrent(&self,
+                           padding_alg: &'static ::signature::RSAEncoding,
+                           rng: &rand::SecureRandom, msg: &[u8],
+                           signature: &mut [u8])
+                           -> Result<(), error::Unspecified> {
+        counted!(RsaSign, msg.len(),
+                 self.sign_(padding_alg, rng, &digest_msg(padding_alg, msg),
+                            signature, true))
+    }
+
+    /// Sign the message with digest `m_hash`. This is the same as
+    /// `RSASigningState::sign_digest`.
+    pub fn sign_digest(&self, padding_alg: &'static ::signature::RSAEncoding,
+                       rng: &rand::SecureRandom, m_hash: &digest::Digest,
+                       signature: &mut [u8])
+                       -> Result<(), error::Unspecified> {
+        counted!(RsaSign, 0usize,
+                 self.sign_(padding_alg, rng, m_hash, signature, false))
+    }
+
+    fn sign_(&self, padding_alg: &'static ::signature::RSAEncoding,
+             rng: &rand::SecureRandom, m_hash: &digest::Digest,
+             signature: &mut [u8], concurrent: bool)
+             -> Result<(), error::Unspecified> {
+        let key = &self.key_pair;
+        sign(key, padding_alg, rng, m_hash, signature, |base| {
+            self.blindings.blind(base, key.e, &key.oneRR_mod_n, &key.n, rng,
+                                 |c| private_key_op(key, &c, concurrent))
+        })
     }
 }
 
+fn digest_msg(padding_alg: &'static ::signature::RSAEncoding, msg: &[u8])
+              -> digest::Digest {
+    digest::digest(padding_alg.digest_alg(), msg)
+}
+
+// Pads `m_hash` into `signature` and then replaces it with the signature.
+// `blind` must compute the private key operation, blinded.
+fn sign<F>(key: &RSAKeyPair, padding_alg: &'static ::signature::RSAEncoding,
+           rng: &rand::SecureRandom, m_hash: &digest::Digest,
+           signature: &mut [u8], blind: F) -> Result<(), error::Unspecified>
+           where F: FnOnce(bigint::Elem<N>)
+                           -> Result<bigint::Elem<N>, error::Unspecified> {
+    let mod_bits = key.n_bits;
+    if signature.len() != mod_bits.as_usize_bytes_rounded_up() {
+        return Err(error::Unspecified);
+    }
+    if m_hash.algorithm() != padding_alg.digest_alg() {
+        return Err(error::Unspecified);
+    }
+
+    padding_alg.encode(m_hash, signature, mod_bits, rng)?;
+
+    // RFC 8017 Section 5.1.2: RSADP, using the Chinese Remainder Theorem
+    // with Garner's algorithm.
+
+    // Step 1. The value zero is also rejected.
+    //
+    // TODO: Avoid having `encode()` pad its output, and then remove
+    // `Positive::from_be_bytes_padded()`.
+    let base = bigint::Positive::from_be_bytes_padded(
+        untrusted::Input::from(signature))?;
+    let base = base.into_elem(&key.n)?;
+
+    // Step 2.
+    let result = blind(base)?;
+
+    // Step 3.
+    result.fill_be_bytes(signature);
+
+    Ok(())
+}
+
+// RFC 8017 Section 5.1.2, step 2.b, for the blinded input `c`.
+fn private_key_op(key: &std::sync::Arc<RSAKeyPair>, c: &bigint::Elem<N>,
+                  concurrent: bool)
+                  -> Result<bigint::Elem<N>, error::Unspecified> {
+    // Step 2.b.i.
+    let (m_1, m_2) = elem_exp_consttime_crt(key, c, concurrent)?;
+
+    // Step 2.b.ii isn't needed since there are only two primes.
+
+    // Step 2.b.iii.
+    let p = &key.p.modulus;
+    let m_2 = bigint::elem_widen(m_2);
+    let m_1_minus_m_2 = bigint::elem_sub(m_1, &m_2, p)?;
+    let h = bigint::elem_mul(&key.qInv, m_1_minus_m_2, p)?;
+
+    // Step 2.b.iv. The reduction in the modular multiplication isn't
+    // necessary because `h < p` and `p * q == n` implies `h * q < n`.
+    // Modular arithmetic is used simply to avoid implementing
+    // non-modular arithmetic.
+    let h = bigint::elem_widen(h);
+    let q_times_h = bigint::elem_mul(&key.q_mod_n, h, &key.n)?;
+    let m_2 = bigint::elem_widen(m_2);
+    let m = bigint::elem_add(m_2, q_times_h, &key.n)?;
+
+    // Step 2.b.v isn't needed since there are only two primes.
+
+    // Verify the result to protect against fault attacks as described
+    // in "On the Importance of Checking Cryptographic Protocols for
+    // Faults" by Dan Boneh, Richard A. DeMillo, and Richard J. Lipton.
+    // This check is cheap assuming `e` is small, which is ensured
+    // during `RSAKeyPair` construction. Note that this is the only
+    // validation of `e` that is done other than basic checks on its
+    // size, oddness, and minimum value, since the relationship of `e`
+    // to `d`, `p`, and `q` is not verified during `RSAKeyPair`
+    // construction.
+    let computed = m.try_clone()?;
+    let computed =
+        bigint::elem_mul(&key.oneRR_mod_n.as_ref(), computed, &key.n)?;
+    let verify = bigint::elem_exp_vartime(computed, key.e, &key.n)?;
+    let verify = verify.into_unencoded(&key.n)?;
+    bigint::elem_verify_equal_consttime(&verify, c)?;
+
+    Ok(m)
+}
+
 
 #[cfg(test)]
 mod tests {
     // We intentionally avoid `use super::*` so that we are sure to use only
     // the public API; this ensures that enough of the API is public.
     use core;
-    use {rand, signature, test};
+    use {digest, hmac, polyfill, rand, signature, test};
     use std;
     use super::super::blinding;
+    use super::{CrtHelperSlot, MAX_CRT_HELPER_THREADS, precomputed_tag};
+    use limb::LIMB_BITS;
     use untrusted;
 
     // `RSAKeyPair::sign` requires that the output buffer is the same length as
@@ -700,6 +1110,130 @@ mod tests {
         }
     }
 
+    // A key pair serialized on a target with the other limb size, or in
+    // another version of the format, is rejected even though its tag is
+    // valid.
+    #[test]
+    fn test_rsa_key_pair_precomputed_header() {
+        const PRIVATE_KEY_DER: &'static [u8] =
+            include_bytes!("signature_rsa_example_private_key.der");
+        let key_bytes_der = untrusted::Input::from(PRIVATE_KEY_DER);
+        let key_pair = signature::RSAKeyPair::from_der(key_bytes_der).unwrap();
+
+        let rng = rand::SystemRandom::new();
+        let key = hmac::SigningKey::generate(&digest::SHA256, &rng).unwrap();
+        let precomputed = key_pair.serialize_precomputed(&key).unwrap();
+        let tag_len = key.digest_algorithm().output_len;
+        let data = &precomputed[..(precomputed.len() - tag_len)];
+        assert_eq!(polyfill::usize_from_u8(data[1]), LIMB_BITS);
+
+        let load = |data: &[u8]| {
+            let mut tagged = data.to_vec();
+            tagged.extend_from_slice(precomputed_tag(&key, data).as_ref());
+            signature::RSAKeyPair::from_precomputed(
+                &key, untrusted::Input::from(&tagged))
+        };
+        assert!(load(data).is_ok());
+
+        let mut other_limb_bits = data.to_vec();
+        other_limb_bits[1] = if LIMB_BITS == 64 { 32 } else { 64 };
+        assert!(load(&other_limb_bits).is_err());
+
+        let mut other_version = data.to_vec();
+        other_version[0] = 1;
+        assert!(load(&other_version).is_err());
+    }
+
+    // When `MAX_CRT_HELPER_THREADS` helper threads are already running,
+    // `sign_concurrent` must fall back to signing on the calling thread.
+    #[test]
+    fn test_signature_rsa_sign_concurrent_helper_limit() {
+        const MESSAGE: &'static [u8] = b"hello, world";
+        let rng = rand::SystemRandom::new();
+
+        const PRIVATE_KEY_DER: &'static [u8] =
+            include_bytes!("signature_rsa_example_private_key.der");
+        let key_bytes_der = untrusted::Input::from(PRIVATE_KEY_DER);
+        let key_pair = signature::RSAKeyPair::from_der(key_bytes_der).unwrap();
+        let key_pair = std::sync::Arc::new(key_pair);
+        let mut signing_state =
+            signature::RSASigningState::new(key_pair).unwrap();
+        let mut expected = vec![0; signing_state.key_pair()
+                                                .public_modulus_len()];
+        signing_state.sign(&signature::RSA_PKCS1_SHA256, &rng, MESSAGE,
+                           &mut expected).unwrap();
+
+        // Other tests may hold some of the slots at the same time.
+        let mut slots = std::vec::Vec::new();
+        while let Some(slot) = CrtHelperSlot::acquire() {
+            slots.push(slot);
+        }
+        assert!(slots.len() <= MAX_CRT_HELPER_THREADS);
+
+        let mut signature = vec![0; expected.len()];
+        signing_state.sign_concurrent(&signature::RSA_PKCS1_SHA256, &rng,
+                                      MESSAGE, &mut signature).unwrap();
+        assert_eq!(signature, expected);
+
+        drop(slots);
+        signing_state.sign_concurrent(&signature::RSA_PKCS1_SHA256, &rng,
+                                      MESSAGE, &mut signature).unwrap();
+        assert_eq!(signature, expected);
+    }
+
+    // `RSASharedSigningState` must produce the same (deterministic, for
+    // PKCS#1 v1.5) signatures as `RSASigningState`, from many threads at once.
+    #[test]
+    fn test_signature_rsa_shared_signing_state() {
+        const MESSAGE: &'static [u8] = b"hello, world";
+        const NUM_THREADS: usize = 8;
+        let rng = rand::SystemRandom::new();
+
+        const PRIVATE_KEY_DER: &'static [u8] =
+            include_bytes!("signature_rsa_example_private_key.der");
+        let key_bytes_der = untrusted::Input::from(PRIVATE_KEY_DER);
+        let key_pair = signature::RSAKeyPair::from_der(key_bytes_der).unwrap();
+        let key_pair = std::sync::Arc::new(key_pair);
+
+        let mut expected = vec![0; key_pair.public_modulus_len()];
+        let mut signing_state =
+            signature::RSASigningState::new(key_pair.clone()).unwrap();
+        signing_state.sign(&signature::RSA_PKCS1_SHA256, &rng, MESSAGE,
+                           &mut expected).unwrap();
+
+        assert!(signature::RSASharedSigningState::new(key_pair.clone(), 0)
+                    .is_err());
+        let shared = std::sync::Arc::new(
+            signature::RSASharedSigningState::new(key_pair, NUM_THREADS)
+                .unwrap());
+        assert_eq!(shared.blindings.num_available(), 0);
+        shared.prepare_blindings(&rng).unwrap();
+        assert_eq!(shared.blindings.num_available(), NUM_THREADS);
+
+        let threads = (0..NUM_THREADS).map(|_| {
+            let shared = shared.clone();
+            let expected = expected.clone();
+            std::thread::spawn(move || {
+                let rng = rand::SystemRandom::new();
+                let mut signature =
+                    vec![0; shared.key_pair().public_modulus_len()];
+                for _ in 0..(blinding::REMAINING_MAX + 1) {
+                    shared.sign(&signature::RSA_PKCS1_SHA256, &rng, MESSAGE,
+                                &mut signature).unwrap();
+                    assert_eq!(&signature[..], &expected[..]);
+                }
+            })
+        }).collect::<std::vec::Vec<_>>();
+        for thread in threads {
+            thread.join().unwrap();
+        }
+
+        // Every blinding state that was used has been returned to the pool.
+        assert!(shared.blindings.num_available() > 0);
+        shared.prepare_blindings(&rng).unwrap();
+        assert_eq!(shared.blindings.num_available(), NUM_THREADS);
+    }
+
     // When we fail to randomly generate an invertible blinding factor too many
     // times in a loop, we fail. This checks that we fail in a reasonable way
     // when that happens.
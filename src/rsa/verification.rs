@@ -14,10 +14,11 @@
 
 /// RSA PKCS#1 1.5 signatures.
 
+use arithmetic::montgomery::RR;
 use core;
-use {bits, digest, error, private, signature};
-use super::{bigint, N, PUBLIC_KEY_PUBLIC_MODULUS_MAX_LEN, RSAParameters,
-            parse_public_key};
+use {bits, digest, error, init, private, signature};
+use super::{bigint, padding, N, PUBLIC_KEY_PUBLIC_MODULUS_MAX_LEN,
+            RSAParameters, parse_public_key};
 use untrusted;
 
 
@@ -25,8 +26,20 @@ impl signature::VerificationAlgorithm for RSAParameters {
     fn verify(&self, public_key: untrusted::Input, msg: untrusted::Input,
               signature: untrusted::Input)
               -> Result<(), error::Unspecified> {
-        let public_key = parse_public_key(public_key)?;
-        verify_rsa(self, public_key, msg, signature)
+        RSAPublicKey::from_der(self, public_key)?.verify(msg, signature)
+    }
+}
+
+impl signature::PrehashedVerificationAlgorithm for RSAParameters {
+    fn digest_alg(&self) -> &'static digest::Algorithm {
+        self.padding_alg.digest_alg()
+    }
+
+    fn verify_digest(&self, public_key: untrusted::Input,
+                     m_hash: &digest::Digest, signature: untrusted::Input)
+                     -> Result<(), error::Unspecified> {
+        RSAPublicKey::from_der(self, public_key)?
+            .verify_digest(m_hash, signature)
     }
 }
 
@@ -64,7 +77,7 @@ macro_rules! rsa_params {
     }
 }
 
-rsa_params!(RSA_PKCS1_2048_8192_SHA1, 2048, &super::padding::RSA_PKCS1_SHA1,
+rsa_params!(RSA_PKCS1_2048_8192_SHA1, 2048, &padding::RSA_PKCS1_SHA1,
             "Verification of signatures using RSA keys of 2048-8192 bits,
              PKCS#1.5 padding, and SHA-1.\n\nSee \"`RSA_PKCS1_*` Details\" in
              `ring::signature`'s module-level documentation for more details.");
@@ -128,53 +141,298 @@ pub fn verify_rsa(params: &RSAParameters,
                   (n, e): (untrusted::Input, untrusted::Input),
                   msg: untrusted::Input, signature: untrusted::Input)
                   -> Result<(), error::Unspecified> {
-    // Partially validate the public key. See
-    // `check_public_modulus_and_exponent()` for more details.
-    let n = bigint::Positive::from_be_bytes(n)?;
-    let e = bigint::Positive::from_be_bytes(e)?;
-    let max_bits = bits::BitLength::from_usize_bytes(
-        PUBLIC_KEY_PUBLIC_MODULUS_MAX_LEN)?;
-
-    // XXX: FIPS 186-4 seems to indicate that the minimum
-    // exponent value is 2**16 + 1, but it isn't clear if this is just for
-    // signing or also for verification. We support exponents of 3 and larger
-    // for compatibility with other commonly-used crypto libraries.
-    let e_min_bits = bits::BitLength::from_usize_bits(2);
-
-    let (n, e) =
-        super::check_public_modulus_and_exponent(n, e, params.min_bits, max_bits,
-                                                 e_min_bits)?;
-    let n_bits = n.bit_length();
-    let n = n.into_modulus::<N>()?;
-
-    // The signature must be the same length as the modulus, in bytes.
-    if signature.len() != n_bits.as_usize_bytes_rounded_up() {
-        return Err(error::Unspecified);
-    }
-
-    // RFC 8017 Section 5.2.2: RSAVP1.
-
-    // Step 1.
-    let s = bigint::Positive::from_be_bytes_padded(signature)?;
-    let s = s.into_elem::<N>(&n)?;
-
-    // Step 2.
-    let s = {
-        // Montgomery encode `s`.
+    RSAPublicKey::from_components(params, (n, e))?.verify(msg, signature)
+}
+
+/// An RSA public key that has been parsed and validated, for verifying many
+/// signatures made with the same key.
+///
+/// `ring::signature::verify()` and `verify_rsa()` validate the public key and
+/// precompute the values needed for Montgomery multiplication modulo *n*
+/// every time they are called, which is a significant fraction of the cost of
+/// verifying a signature with a small public exponent. An `RSAPublicKey` does
+/// that work once.
+///
+/// Only available in `use_heap` mode.
+pub struct RSAPublicKey {
+    padding_alg: &'static padding::RSAVerification,
+    n: bigint::Modulus<N>,
+    oneRR: bigint::One<N, RR>,
+    e: bigint::PublicExponent,
+    n_bits: bits::BitLength,
+
+    // `Some` if `verify_batch` can use `bigint::elems_exp_65537_x8` with this
+    // key.
+    #[cfg(target_arch = "x86_64")]
+    oneRRX8: Option<bigint::OneRRX8<N>>,
+}
+
+impl RSAPublicKey {
+    /// Parses and validates a DER-encoded PKCS#1 `RSAPublicKey`, the same
+    /// encoding that `ring::signature::verify()` expects for `params`.
+    pub fn from_der(params: &RSAParameters,
+                    public_key: untrusted::Input)
+                    -> Result<RSAPublicKey, error::Unspecified> {
+        let public_key = parse_public_key(public_key)?;
+        RSAPublicKey::from_components(params, public_key)
+    }
+
+    /// Validates the public key modulus `n` and exponent `e`, encoded as
+    /// described for `verify_rsa()`.
+    pub fn from_components(params: &RSAParameters,
+                           (n, e): (untrusted::Input, untrusted::Input))
+                           -> Result<RSAPublicKey, error::Unspecified> {
+        init::init_once();
+
+        // Partially validate the public key. See
+        // `check_public_modulus_and_exponent()` for more details.
+        let n = bigint::Positive::from_be_bytes(n)?;
+        let e = bigint::Positive::from_be_bytes(e)?;
+        let max_bits = bits::BitLength::from_usize_bytes(
+            PUBLIC_KEY_PUBLIC_MODULUS_MAX_LEN)?;
+
+        // XXX: FIPS 186-4 seems to indicate that the minimum
+        // exponent value is 2**16 + 1, but it isn't clear if this is just for
+        // signing or also for verification. We support exponents of 3 and
+        // larger for compatibility with other commonly-used crypto libraries.
+        let e_min_bits = bits::BitLength::from_usize_bits(2);
+
+        let (n, e) =
+            super::check_public_modulus_and_exponent(n, e, params.min_bits,
+                                                     max_bits, e_min_bits)?;
+        let n_bits = n.bit_length();
+        let n = n.into_modulus::<N>()?;
         let oneRR = bigint::One::newRR(&n)?;
-        bigint::elem_mul(oneRR.as_ref(), s, &n)?
-    };
-    let m = bigint::elem_exp_vartime(s, e, &n)?;
-    let m = m.into_unencoded(&n)?;
-
-    // Step 3.
-    let mut decoded = [0u8; PUBLIC_KEY_PUBLIC_MODULUS_MAX_LEN];
-    let decoded = &mut decoded[..n_bits.as_usize_bytes_rounded_up()];
-    m.fill_be_bytes(decoded);
-
-    // Verify the padded message is correct.
-    let m_hash = digest::digest(params.padding_alg.digest_alg(),
-                                msg.as_slice_less_safe());
-    untrusted::Input::from(decoded).read_all(
-        error::Unspecified, |m| params.padding_alg.verify(&m_hash, m, n_bits))
+
+        #[cfg(target_arch = "x86_64")]
+        let oneRRX8 = if e.value() == 65537 {
+            bigint::OneRRX8::new(&oneRR, &n)?
+        } else {
+            None
+        };
+
+        Ok(RSAPublicKey {
+            padding_alg: params.padding_alg,
+            n,
+            oneRR,
+            e,
+            n_bits,
+            #[cfg(target_arch = "x86_64")]
+            oneRRX8,
+        })
+    }
+
+    /// Verifies the signature `signature` of message `msg` with this key.
+    /// The result is the same as `verify_rsa()`'s with the parameters and
+    /// public key components that this key was constructed from.
+    pub fn verify(&self, msg: untrusted::Input, signature: untrusted::Input)
+                  -> Result<(), error::Unspecified> {
+        let m_hash = digest::digest(self.padding_alg.digest_alg(),
+                                    msg.as_slice_less_safe());
+        self.verify_digest(&m_hash, signature)
+    }
+
+    /// Verifies the signature `signature` of the message with digest `m_hash`
+    /// with this key. `m_hash` must have been calculated with the digest
+    /// algorithm of the parameters this key was constructed with. See
+    /// `signature::verify_digest()`.
+    pub fn verify_digest(&self, m_hash: &digest::Digest,
+                         signature: untrusted::Input)
+                         -> Result<(), error::Unspecified> {
+        let s = self.parse_signature(m_hash, signature)?;
+
+        // RFC 8017 Section 5.2.2: RSAVP1, Step 2.
+        let s = {
+            // Montgomery encode `s`. `oneRR` was computed when the key was
+            // constructed, which is where most of the savings of reusing an
+            // `RSAPublicKey` come from.
+            bigint::elem_mul(self.oneRR.as_ref(), s, &self.n)?
+        };
+        let m = bigint::elem_exp_vartime(s, self.e, &self.n)?;
+        let m = m.into_unencoded(&self.n)?;
+
+        self.verify_padding(m_hash, m)
+    }
+
+    /// Verifies each signature in `batch`, returning one result per item, in
+    /// the same order; `result[i]` is what
+    /// `batch[i].public_key.verify(batch[i].msg, batch[i].signature)` would
+    /// return.
+    ///
+    /// On x86-64 CPUs that support AVX-512 IFMA, the public key operations of
+    /// signatures made with 2048, 3072 or 4096 bit keys whose exponent is
+    /// 65537 are done eight at a time, one in each lane of the vector
+    /// registers. The keys don't need to be the same; keys of different sizes
+    /// just go in different groups of eight. Every other signature is
+    /// verified separately. An invalid item doesn't affect the results for
+    /// the other items.
+    pub fn verify_batch(batch: &[RSABatchItem])
+                        -> std::vec::Vec<Result<(), error::Unspecified>> {
+        let mut results = std::vec::Vec::with_capacity(batch.len());
+        results.resize(batch.len(), Err(error::Unspecified));
+
+        #[cfg(target_arch = "x86_64")]
+        let mut groups = [
+            BatchGroup::new(), BatchGroup::new(), BatchGroup::new(),
+        ];
+
+        for (i, item) in batch.iter().enumerate() {
+            let key = item.public_key;
+
+            #[cfg(target_arch = "x86_64")]
+            {
+                if let Some(ref oneRRX8) = key.oneRRX8 {
+                    if bigint::exp_65537_x8_eligible(&key.n) {
+                        let m_hash =
+                            digest::digest(key.padding_alg.digest_alg(),
+                                           item.msg.as_slice_less_safe());
+                        let s = match key.parse_signature(&m_hash,
+                                                          item.signature) {
+                            Ok(s) => s,
+                            Err(e) => {
+                                results[i] = Err(e);
+                                continue;
+                            },
+                        };
+                        // Eligible keys are exactly 2048, 3072 or 4096 bits
+                        // when rounded up to whole limbs.
+                        let n_bits = key.n_bits.as_usize_bits();
+                        let group = if n_bits <= 2048 {
+                            &mut groups[0]
+                        } else if n_bits <= 3072 {
+                            &mut groups[1]
+                        } else {
+                            &mut groups[2]
+                        };
+                        group.push(i, m_hash, s, key, oneRRX8);
+                        if group.is_full() {
+                            group.finish(&mut results);
+                        }
+                        continue;
+                    }
+                }
+            }
+
+            results[i] = key.verify(item.msg, item.signature);
+        }
+
+        #[cfg(target_arch = "x86_64")]
+        for group in groups.iter_mut() {
+            group.finish(&mut results);
+        }
+
+        results
+    }
+
+    // Checks the digest algorithm and the length of `signature`, and returns
+    // the signature representative *s*.
+    fn parse_signature(&self, m_hash: &digest::Digest,
+                       signature: untrusted::Input)
+                       -> Result<bigint::Elem<N>, error::Unspecified> {
+        if m_hash.algorithm() != self.padding_alg.digest_alg() {
+            return Err(error::Unspecified);
+        }
+
+        // The signature must be the same length as the modulus, in bytes.
+        if signature.len() != self.n_bits.as_usize_bytes_rounded_up() {
+            return Err(error::Unspecified);
+        }
+
+        // RFC 8017 Section 5.2.2: RSAVP1, Step 1.
+        let s = bigint::Positive::from_be_bytes_padded(signature)?;
+        s.into_elem::<N>(&self.n)
+    }
+
+    // Verifies that the message representative `m` = s**e (mod n) is the
+    // correctly padded encoding of `m_hash`.
+    fn verify_padding(&self, m_hash: &digest::Digest, m: bigint::Elem<N>)
+                      -> Result<(), error::Unspecified> {
+        let n_bits = self.n_bits;
+
+        // RFC 8017 Section 5.2.2: RSAVP1, Step 3.
+        let mut decoded = [0u8; PUBLIC_KEY_PUBLIC_MODULUS_MAX_LEN];
+        let decoded = &mut decoded[..n_bits.as_usize_bytes_rounded_up()];
+        m.fill_be_bytes(decoded);
+
+        // Verify the padded message is correct.
+        untrusted::Input::from(decoded).read_all(
+            error::Unspecified, |m| self.padding_alg.verify(m_hash, m, n_bits))
+    }
+}
+
+/// A signature to be verified as part of a batch with
+/// `RSAPublicKey::verify_batch`.
+pub struct RSABatchItem<'a> {
+    /// The public key.
+    pub public_key: &'a RSAPublicKey,
+
+    /// The signed message.
+    pub msg: untrusted::Input<'a>,
+
+    /// The signature.
+    pub signature: untrusted::Input<'a>,
+}
+
+// Up to `bigint::EXP_65537_X8_LANES` parsed signatures, made with keys with
+// moduli of the same number of limbs, that are waiting for their public key
+// operations to be done together.
+#[cfg(target_arch = "x86_64")]
+struct BatchGroup<'a> {
+    indices: std::vec::Vec<usize>,
+    m_hashes: std::vec::Vec<digest::Digest>,
+    s: std::vec::Vec<bigint::Elem<N>>,
+    keys: std::vec::Vec<&'a RSAPublicKey>,
+    moduli: std::vec::Vec<(&'a bigint::Modulus<N>, &'a bigint::OneRRX8<N>)>,
+}
+
+#[cfg(target_arch = "x86_64")]
+impl<'a> BatchGroup<'a> {
+    fn new() -> Self {
+        BatchGroup {
+            indices: std::vec::Vec::with_capacity(bigint::EXP_65537_X8_LANES),
+            m_hashes: std::vec::Vec::with_capacity(bigint::EXP_65537_X8_LANES),
+            s: std::vec::Vec::with_capacity(bigint::EXP_65537_X8_LANES),
+            keys: std::vec::Vec::with_capacity(bigint::EXP_65537_X8_LANES),
+            moduli: std::vec::Vec::with_capacity(bigint::EXP_65537_X8_LANES),
+        }
+    }
+
+    fn push(&mut self, index: usize, m_hash: digest::Digest,
+            s: bigint::Elem<N>, key: &'a RSAPublicKey,
+            oneRRX8: &'a bigint::OneRRX8<N>) {
+        self.indices.push(index);
+        self.m_hashes.push(m_hash);
+        self.s.push(s);
+        self.keys.push(key);
+        self.moduli.push((&key.n, oneRRX8));
+    }
+
+    fn is_full(&self) -> bool {
+        self.indices.len() == bigint::EXP_65537_X8_LANES
+    }
+
+    // Does the public key operations of the signatures in the group, sets
+    // their results, and empties the group.
+    fn finish(&mut self,
+              results: &mut [Result<(), error::Unspecified>]) {
+        if self.indices.is_empty() {
+            return;
+        }
+
+        // RFC 8017 Section 5.2.2: RSAVP1, Step 2, for every signature in the
+        // group at once.
+        let exp_result = bigint::elems_exp_65537_x8(&mut self.s, &self.moduli);
+
+        for (((&index, m_hash), m), key) in self.indices.iter()
+                .zip(self.m_hashes.iter()).zip(self.s.drain(..))
+                .zip(self.keys.iter()) {
+            results[index] =
+                exp_result.and_then(|()| key.verify_padding(m_hash, m));
+        }
+
+        self.indices.clear();
+        self.m_hashes.clear();
+        self.keys.clear();
+        self.moduli.clear();
+    }
 }
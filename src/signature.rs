@@ -26,11 +26,18 @@
 //! reduce the risks of algorithm agility and to provide consistency with ECDSA
 //! and EdDSA.
 //!
-//! Currently this module does not support digesting the message to be signed
-//! separately from the public key operation, as it is currently being
-//! optimized for Ed25519 and for the implementation of protocols that do not
-//! requiring signing large messages. An interface for efficiently supporting
-//! larger messages may be added later.
+//! Large messages don't need to be in memory all at once. Digest them
+//! incrementally with a `digest::Context` for the algorithm's
+//! `PrehashedVerificationAlgorithm::digest_alg()`, and then pass the finished
+//! `digest::Digest` to `verify_digest()`, `RSASigningState::sign_digest()`,
+//! `ECDSAKeyPair::sign_digest()`, or `Ed25519KeyPair::sign_prehashed()`.
+//! RSA and ECDSA signatures are computed from the digest of the message
+//! anyway, so such a signature is the same as one of the whole message.
+//! Ed25519 signatures hash the message together with other values, so they
+//! can't be computed from a digest. In that case use [Ed25519ph]
+//! (`ED25519PH`), which is a different signature algorithm.
+//!
+//! [Ed25519ph]: https://tools.ietf.org/html/rfc8032#section-5.1
 //!
 //!
 //! # Algorithm Details
@@ -280,11 +287,13 @@
 
 
 use core;
-use {error, init, private};
+use {digest, error, init, private};
 use untrusted;
 
 pub use ec::suite_b::ecdsa::{
     ECDSAKeyPair,
+    ECDSAPublicKey,
+    ECDSASigningAlgorithm,
     ECDSAVerificationAlgorithm,
 
     ECDSA_P256_SHA256_ASN1, ECDSA_P256_SHA256_FIXED,
@@ -296,12 +305,20 @@ pub use ec::suite_b::ecdsa::{
     ECDSA_P384_SHA384_ASN1_SIGNING, ECDSA_P384_SHA384_FIXED_SIGNING,
 };
 
+#[cfg(feature = "use_heap")]
+pub use ec::suite_b::ecdsa::ECDSANoncePool;
+
 pub use ec::curve25519::ed25519::{
     EdDSAParameters,
 
     ED25519,
 
+    Ed25519phParameters,
+    ED25519PH,
+
+    Ed25519BatchItem,
     Ed25519KeyPair,
+    Ed25519PublicKey,
     ED25519_PKCS8_V2_LEN,
     ED25519_PUBLIC_KEY_LEN,
 };
@@ -309,7 +326,7 @@ pub use ec::curve25519::ed25519::{
 pub use pkcs8::PKCS8Document;
 
 #[cfg(all(feature = "rsa_signing", feature = "use_heap"))]
-pub use rsa::signing::{RSAKeyPair, RSASigningState};
+pub use rsa::signing::{RSAKeyPair, RSASharedSigningState, RSASigningState};
 
 #[cfg(all(feature = "rsa_signing", feature = "use_heap"))]
 pub use rsa::{
@@ -343,6 +360,9 @@ pub use rsa::verification::{
     RSA_PSS_2048_8192_SHA256,
     RSA_PSS_2048_8192_SHA384,
     RSA_PSS_2048_8192_SHA512,
+
+    RSABatchItem,
+    RSAPublicKey,
 };
 
 pub use signature_impl::Signature;
@@ -393,5 +413,33 @@ pub fn verify(alg: &VerificationAlgorithm, public_key: untrusted::Input,
               msg: untrusted::Input, signature: untrusted::Input)
               -> Result<(), error::Unspecified> {
     init::init_once();
-    alg.verify(public_key, msg, signature)
+    counted!(Verify, msg.len(), alg.verify(public_key, msg, signature))
+}
+
+/// A signature verification algorithm that can verify a signature given the
+/// digest of the message, instead of the message itself.
+pub trait PrehashedVerificationAlgorithm: VerificationAlgorithm {
+    /// The digest algorithm that the message must be digested with.
+    fn digest_alg(&self) -> &'static digest::Algorithm;
+
+    /// Verify the signature `signature` of the message with digest `m_hash`,
+    /// with the public key `public_key`. `m_hash` must have been calculated
+    /// with `digest_alg()`.
+    fn verify_digest(&self, public_key: untrusted::Input,
+                     m_hash: &digest::Digest, signature: untrusted::Input)
+                     -> Result<(), error::Unspecified>;
+}
+
+/// Verify the signature `signature` of the message with digest `m_hash` with
+/// the public key `public_key` using the algorithm `alg`.
+///
+/// This is the same as `verify` with the message, except that the message can
+/// be digested incrementally, e.g. with a `digest::Context` for
+/// `alg.digest_alg()`, so it doesn't have to be in memory all at once.
+pub fn verify_digest(alg: &PrehashedVerificationAlgorithm,
+                     public_key: untrusted::Input, m_hash: &digest::Digest,
+                     signature: untrusted::Input)
+                     -> Result<(), error::Unspecified> {
+    init::init_once();
+    counted!(Verify, 0usize, alg.verify_digest(public_key, m_hash, signature))
 }
@@ -56,6 +56,8 @@ fn aead_chacha20_poly1305() {
 fn test_aead(aead_alg: &'static aead::Algorithm, file_path: &str) {
     test_aead_key_sizes(aead_alg);
     test_aead_nonce_sizes(aead_alg).unwrap();
+    test_aead_seal_batch(aead_alg);
+    test_aead_stream(aead_alg);
 
     test::from_file(file_path, |section, test_case| {
         assert_eq!(section, "");
@@ -77,8 +79,33 @@ fn test_aead(aead_alg: &'static aead::Algorithm, file_path: &str) {
                                            &mut s_in_out[..], tag_len);
         let o_key = aead::OpeningKey::new(aead_alg, &key_bytes[..])?;
 
+        test_aead_vectored(&s_key, &o_key, &nonce, &ad, &plaintext, &ct, &tag,
+                           error.is_none());
+
         ct.extend(tag);
 
+        // Keys made with `new_compact()` must work exactly like the others.
+        {
+            let s_key = aead::SealingKey::new_compact(aead_alg, &key_bytes)?;
+            let o_key = aead::OpeningKey::new_compact(aead_alg, &key_bytes)?;
+            let mut in_out = plaintext.clone();
+            in_out.extend(vec![0; tag_len]);
+            assert_eq!(s_result, aead::seal_in_place(&s_key, &nonce, &ad,
+                                                     &mut in_out, tag_len));
+            assert_eq!(s_in_out, in_out);
+            if error.is_none() {
+                let mut in_out = ct.clone();
+                assert_eq!(Ok(&plaintext[..]),
+                           aead::open_in_place(&o_key, &nonce, &ad, 0,
+                                               &mut in_out)
+                               .map(|p| &p[..]));
+            }
+
+            let tag = &ct[plaintext.len()..];
+            test_aead_vectored(&s_key, &o_key, &nonce, &ad, &plaintext,
+                               &ct[..plaintext.len()], tag, error.is_none());
+        }
+
         // In release builds, test all prefix lengths from 0 to 4096 bytes.
         // Debug builds are too slow for this, so for those builds, only
         // test a smaller subset.
@@ -188,6 +215,254 @@ fn test_aead(aead_alg: &'static aead::Algorithm, file_path: &str) {
     });
 }
 
+// Checks that `seal_in_place_vectored` and `open_in_place_vectored` agree
+// with the test vector when the AD and the input are split into segments in
+// various ways, in particular ones that don't line up with the AES or
+// ChaCha20 block boundaries.
+fn test_aead_vectored(s_key: &aead::SealingKey, o_key: &aead::OpeningKey,
+                      nonce: &[u8], ad: &[u8], plaintext: &[u8], ct: &[u8],
+                      tag: &[u8], valid: bool) {
+    for &segment_len in &[1, 5, 15, 16, 17, 63, 64, 65, 100] {
+        let ad_segments = ad.chunks(segment_len).collect::<Vec<_>>();
+
+        let mut s_segments = plaintext.chunks(segment_len)
+                                      .map(|s| s.to_vec())
+                                      .collect::<Vec<_>>();
+        // Empty segments must be OK too.
+        s_segments.insert(0, Vec::new());
+        let mut s_tag = vec![0u8; tag.len()];
+        let s_result = {
+            let mut s_in_out =
+                s_segments.iter_mut().map(|s| &mut s[..]).collect::<Vec<_>>();
+            aead::seal_in_place_vectored(s_key, nonce, &ad_segments,
+                                         &mut s_in_out, &mut s_tag)
+        };
+
+        let mut o_segments = ct.chunks(segment_len)
+                               .map(|s| s.to_vec())
+                               .collect::<Vec<_>>();
+        let o_result = {
+            let mut o_in_out =
+                o_segments.iter_mut().map(|s| &mut s[..]).collect::<Vec<_>>();
+            aead::open_in_place_vectored(o_key, nonce, &ad_segments,
+                                         &mut o_in_out, tag)
+        };
+
+        if !valid {
+            assert!(s_result.is_err());
+            assert!(o_result.is_err());
+            continue;
+        }
+
+        assert_eq!(Ok(()), s_result);
+        assert_eq!(&s_segments.concat()[..], ct);
+        assert_eq!(&s_tag[..], tag);
+        assert_eq!(Ok(()), o_result);
+        assert_eq!(&o_segments.concat()[..], plaintext);
+
+        // A wrong tag must be rejected, and the output zeroed.
+        let mut bad_tag = tag.to_vec();
+        bad_tag[0] ^= 1;
+        let mut o_segments = ct.chunks(segment_len)
+                               .map(|s| s.to_vec())
+                               .collect::<Vec<_>>();
+        {
+            let mut o_in_out =
+                o_segments.iter_mut().map(|s| &mut s[..]).collect::<Vec<_>>();
+            assert!(aead::open_in_place_vectored(o_key, nonce, &ad_segments,
+                                                 &mut o_in_out, &bad_tag)
+                        .is_err());
+        }
+        assert!(o_segments.concat().iter().all(|b| *b == 0));
+
+        // The tag must be exactly `tag_len()` bytes.
+        {
+            let mut o_in_out =
+                o_segments.iter_mut().map(|s| &mut s[..]).collect::<Vec<_>>();
+            assert!(aead::open_in_place_vectored(o_key, nonce, &ad_segments,
+                                                 &mut o_in_out,
+                                                 &tag[..(tag.len() - 1)])
+                        .is_err());
+        }
+    }
+}
+
+// Checks that `seal_in_place_batch` seals each record exactly like
+// `seal_in_place`, and that it rejects a batch containing an invalid record
+// without modifying any of the records.
+fn test_aead_seal_batch(aead_alg: &'static aead::Algorithm) {
+    let key_bytes = vec![0x42u8; aead_alg.key_len()];
+    let s_key = aead::SealingKey::new(aead_alg, &key_bytes).unwrap();
+    let tag_len = aead_alg.tag_len();
+
+    // More than eight records, some of them longer than the part of a record
+    // that the ChaCha20-Poly1305 batch code encrypts for all the records of
+    // a group together.
+    let lens = [0, 1, 15, 16, 17, 64, 1200, 4100, 255, 256, 257];
+    let nonces = (0..lens.len()).map(|i| [i as u8; 12]).collect::<Vec<_>>();
+    let ads = (0..lens.len()).map(|i| vec![i as u8; i * 5])
+                             .collect::<Vec<_>>();
+    let inputs = lens.iter().map(|&len| {
+        let mut in_out = (0..len).map(|i| i as u8).collect::<Vec<_>>();
+        in_out.extend_from_slice(&vec![0u8; tag_len]);
+        in_out
+    }).collect::<Vec<_>>();
+
+    let expected = inputs.iter().enumerate().map(|(i, input)| {
+        let mut in_out = input.clone();
+        let out_len = aead::seal_in_place(&s_key, &nonces[i], &ads[i],
+                                          &mut in_out, tag_len).unwrap();
+        in_out.truncate(out_len);
+        in_out
+    }).collect::<Vec<_>>();
+
+    let mut actual = inputs.clone();
+    {
+        let mut records = actual.iter_mut().enumerate().map(|(i, in_out)| {
+            (&nonces[i][..], &ads[i][..], &mut in_out[..])
+        }).collect::<Vec<_>>();
+        aead::seal_in_place_batch(&s_key, &mut records, tag_len).unwrap();
+    }
+    for (actual, expected) in actual.iter().zip(expected.iter()) {
+        assert_eq!(&actual[..expected.len()], &expected[..]);
+    }
+
+    let mut actual = inputs.clone();
+    {
+        let mut records = actual.iter_mut().enumerate().map(|(i, in_out)| {
+            let nonce = if i == 5 { &nonces[i][..11] } else { &nonces[i][..] };
+            (nonce, &ads[i][..], &mut in_out[..])
+        }).collect::<Vec<_>>();
+        assert!(aead::seal_in_place_batch(&s_key, &mut records, tag_len)
+                    .is_err());
+    }
+    assert_eq!(actual, inputs);
+
+    let mut actual = inputs.clone();
+    {
+        let mut records = actual.iter_mut().enumerate().map(|(i, in_out)| {
+            (&nonces[i][..], &ads[i][..], &mut in_out[..])
+        }).collect::<Vec<_>>();
+        assert!(aead::seal_in_place_batch(&s_key, &mut records, tag_len - 1)
+                    .is_err());
+    }
+    assert_eq!(actual, inputs);
+
+    assert!(aead::seal_in_place_batch(&s_key, &mut [], tag_len).is_ok());
+}
+
+// Checks that a message sealed with `aead::stream` chunk by chunk opens again,
+// that each chunk is sealed like a record with the STREAM nonce, and that
+// reordered, truncated and extended messages are rejected.
+fn test_aead_stream(aead_alg: &'static aead::Algorithm) {
+    let key_bytes = vec![0x42u8; aead_alg.key_len()];
+    let s_key = aead::SealingKey::new(aead_alg, &key_bytes).unwrap();
+    let o_key = aead::OpeningKey::new(aead_alg, &key_bytes).unwrap();
+    let tag_len = aead_alg.tag_len();
+    let nonce_prefix = [7u8; aead::NONCE_PREFIX_LEN];
+    let ad = b"backup";
+
+    let plaintexts = [100, 0, 4096, 17, 5].iter().map(|&len| {
+        (0..len).map(|i| i as u8).collect::<Vec<_>>()
+    }).collect::<Vec<_>>();
+    let with_tag_space = |plaintext: &[u8]| {
+        let mut in_out = plaintext.to_vec();
+        in_out.extend(vec![0; tag_len]);
+        in_out
+    };
+
+    let mut chunks = Vec::new();
+    {
+        let (last, rest) = plaintexts.split_last().unwrap();
+        let mut stream =
+            aead::SealingStream::new(&s_key, &nonce_prefix);
+        for plaintext in rest {
+            let mut in_out = with_tag_space(plaintext);
+            let out_len = in_out.len();
+            assert_eq!(Ok(out_len),
+                       stream.seal_chunk(ad, &mut in_out, tag_len));
+            chunks.push(in_out);
+        }
+        let mut in_out = with_tag_space(last);
+        let out_len = in_out.len();
+        assert_eq!(Ok(out_len),
+                   stream.seal_last_chunk(ad, &mut in_out, tag_len));
+        chunks.push(in_out);
+    }
+
+    // Each chunk is a record whose nonce is the prefix, the big-endian chunk
+    // index, and the last-chunk flag. Chunks can be sealed in any order.
+    for (i, plaintext) in plaintexts.iter().enumerate().rev() {
+        let last = i + 1 == plaintexts.len();
+        let mut nonce = nonce_prefix.to_vec();
+        nonce.extend_from_slice(&[0, 0, 0, i as u8, last as u8]);
+        let mut in_out = with_tag_space(plaintext);
+        let out_len = in_out.len();
+        assert_eq!(Ok(out_len),
+                   aead::seal_in_place(&s_key, &nonce, ad, &mut in_out,
+                                       tag_len));
+        assert_eq!(chunks[i], in_out);
+
+        let mut in_out = with_tag_space(plaintext);
+        assert_eq!(Ok(out_len),
+                   aead::seal_stream_chunk(&s_key, &nonce_prefix, i as u32,
+                                           last, ad, &mut in_out, tag_len));
+        assert_eq!(chunks[i], in_out);
+    }
+
+    let open = |chunks: &[Vec<u8>]| -> Result<Vec<u8>, error::Unspecified> {
+        let (last, rest) = chunks.split_last().ok_or(error::Unspecified)?;
+        let mut stream =
+            aead::OpeningStream::new(&o_key, &nonce_prefix);
+        let mut plaintext = Vec::new();
+        for chunk in rest {
+            let mut in_out = chunk.clone();
+            plaintext.extend_from_slice(stream.open_chunk(ad, 0,
+                                                          &mut in_out)?);
+        }
+        let mut in_out = last.clone();
+        plaintext.extend_from_slice(stream.open_last_chunk(ad, 0,
+                                                           &mut in_out)?);
+        Ok(plaintext)
+    };
+
+    let expected = plaintexts.iter().fold(Vec::new(), |mut acc, p| {
+        acc.extend_from_slice(p);
+        acc
+    });
+    assert_eq!(Ok(expected), open(&chunks));
+
+    // Truncated at a chunk boundary.
+    assert!(open(&chunks[..(chunks.len() - 1)]).is_err());
+
+    // Extended by repeating the last chunk.
+    let mut extended = chunks.clone();
+    extended.push(chunks[chunks.len() - 1].clone());
+    assert!(open(&extended).is_err());
+
+    // Reordered.
+    let mut reordered = chunks.clone();
+    reordered.swap(0, 1);
+    assert!(open(&reordered).is_err());
+
+    // A different nonce prefix.
+    {
+        let mut in_out = chunks[0].clone();
+        assert!(aead::OpeningStream::new(&o_key, &[8u8; 7])
+                    .open_chunk(ad, 0, &mut in_out).is_err());
+    }
+
+    // Chunks can be opened in any order, with an input prefix.
+    {
+        let mut in_out = vec![123u8; 5];
+        in_out.extend_from_slice(&chunks[2]);
+        assert_eq!(Ok(&plaintexts[2][..]),
+                   aead::open_stream_chunk(&o_key, &nonce_prefix, 2, false,
+                                           ad, 5, &mut in_out)
+                       .map(|p| &p[..]));
+    }
+}
+
 fn test_aead_key_sizes(aead_alg: &'static aead::Algorithm) {
     let key_len = aead_alg.key_len();
     let key_data = vec![0u8; key_len * 2];
@@ -90,6 +90,153 @@ fn agreement_agree_ephemeral() {
     });
 }
 
+#[test]
+fn agreement_agree_ephemeral_batch() {
+    struct TestCase {
+        alg: &'static agreement::Algorithm,
+        peer_public: Vec<u8>,
+        my_private: Option<Vec<u8>>,
+        my_public: Vec<u8>,
+        output: Option<Vec<u8>>,
+    }
+
+    let mut test_cases = Vec::new();
+    test::from_file("tests/agreement_tests.txt", |section, test_case| {
+        assert_eq!(section, "");
+        let curve_name = test_case.consume_string("Curve");
+        let alg = alg_from_curve_name(&curve_name);
+        let peer_public = test_case.consume_bytes("PeerQ");
+        test_cases.push(match test_case.consume_optional_string("Error") {
+            None => TestCase {
+                alg,
+                peer_public,
+                my_private: Some(test_case.consume_bytes("D")),
+                my_public: test_case.consume_bytes("MyQ"),
+                output: Some(test_case.consume_bytes("Output")),
+            },
+            Some(_) => TestCase {
+                alg,
+                peer_public,
+                my_private: None,
+                my_public: Vec::new(),
+                output: None,
+            },
+        });
+        Ok(())
+    });
+
+    let rng = rand::SystemRandom::new();
+    let generate = |test_case: &TestCase| {
+        match test_case.my_private {
+            Some(ref d) => {
+                let rng = test::rand::FixedSliceRandom { bytes: d };
+                agreement::EphemeralPrivateKey::generate(test_case.alg, &rng)
+            },
+            None => agreement::EphemeralPrivateKey::generate(test_case.alg,
+                                                             &rng),
+        }.unwrap()
+    };
+
+    // Repeat the test cases so that there are batches with more of them than
+    // are done at once.
+    for &alg in &[&agreement::X25519, &agreement::ECDH_P256,
+                  &agreement::ECDH_P384] {
+        let test_cases: Vec<&TestCase> =
+            test_cases.iter().filter(|t| t.alg == alg).cycle()
+                      .take(3 * test_cases.len()).collect();
+
+        let valid: Vec<&&TestCase> =
+            test_cases.iter().filter(|t| t.my_private.is_some()).collect();
+        let private_keys: Vec<agreement::EphemeralPrivateKey> =
+            valid.iter().map(|t| generate(t)).collect();
+        let mut public_keys: Vec<Vec<u8>> =
+            valid.iter().map(|t| vec![0u8; t.my_public.len()]).collect();
+        {
+            let mut out: Vec<&mut [u8]> =
+                public_keys.iter_mut().map(|p| &mut p[..]).collect();
+            assert!(agreement::compute_public_keys(&private_keys, &mut out)
+                        .is_ok());
+        }
+        for (test_case, public_key) in valid.iter().zip(&public_keys) {
+            assert_eq!(&test_case.my_public, public_key);
+        }
+
+        let mut agreements: Vec<(agreement::EphemeralPrivateKey,
+                                 untrusted::Input)> = test_cases.iter()
+            .map(|t| (generate(t), untrusted::Input::from(&t.peer_public)))
+            .collect();
+        // A private key for another algorithm fails without affecting the
+        // others.
+        let other_alg = if alg == &agreement::X25519 {
+            &agreement::ECDH_P256
+        } else {
+            &agreement::X25519
+        };
+        let other_private_key =
+            agreement::EphemeralPrivateKey::generate(other_alg, &rng).unwrap();
+        agreements.insert(1, (other_private_key,
+                              untrusted::Input::from(&test_cases[1]
+                                                          .peer_public)));
+        let mut expected: Vec<Option<&Vec<u8>>> =
+            test_cases.iter().map(|t| t.output.as_ref()).collect();
+        expected.insert(1, None);
+
+        let mut expected = expected.into_iter();
+        agreement::agree_ephemeral_batch(agreements, alg, |result| {
+            let expected = expected.next().unwrap();
+            assert_eq!(result.ok(), expected.map(|e| &e[..]));
+        });
+        assert!(expected.next().is_none());
+    }
+}
+
+#[cfg(feature = "use_heap")]
+#[test]
+fn agreement_ephemeral_key_pair_pool() {
+    let rng = rand::SystemRandom::new();
+
+    for &alg in &[&agreement::X25519, &agreement::ECDH_P256,
+                  &agreement::ECDH_P384] {
+        let pool = agreement::EphemeralKeyPairPool::new(alg, 11);
+        assert_eq!(pool.len(), 0);
+        assert_eq!(pool.capacity(), 11);
+        assert!(pool.precompute(&rng).is_ok());
+        assert_eq!(pool.len(), 11);
+        assert!(pool.precompute(&rng).is_ok());
+        assert_eq!(pool.len(), 11);
+
+        // Take more key pairs than the pool holds, so the last ones are
+        // generated by `take` itself.
+        for i in 0..7 {
+            let my_key_pair = pool.take(&rng).unwrap();
+            let peer_key_pair = pool.take(&rng).unwrap();
+            assert_eq!(pool.len(), if i < 5 { 9 - 2 * i } else { 0 });
+
+            for key_pair in &[&my_key_pair, &peer_key_pair] {
+                assert!(key_pair.private_key().algorithm() == alg);
+                let mut public_key = [0u8; agreement::PUBLIC_KEY_MAX_LEN];
+                let public_key =
+                    &mut public_key[..key_pair.private_key().public_key_len()];
+                assert!(key_pair.private_key().compute_public_key(public_key)
+                            .is_ok());
+                assert_eq!(&public_key[..], key_pair.public_key());
+            }
+
+            let my_public_key = Vec::from(my_key_pair.public_key());
+            let peer_public_key = Vec::from(peer_key_pair.public_key());
+            let output = agreement::agree_ephemeral(
+                my_key_pair.into_private_key(), alg,
+                untrusted::Input::from(&peer_public_key), (),
+                |key_material| Ok(Vec::from(key_material))).unwrap();
+            let peer_output = agreement::agree_ephemeral(
+                peer_key_pair.into_private_key(), alg,
+                untrusted::Input::from(&my_public_key), (),
+                |key_material| Ok(Vec::from(key_material))).unwrap();
+            assert_eq!(output, peer_output);
+        }
+    }
+}
+
 #[test]
 fn test_agreement_ecdh_x25519_rfc_iterated() {
     let mut k =
@@ -0,0 +1,106 @@
+// Copyright 2017 Brian Smith.
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHORS DISCLAIM ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY
+// SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+// OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#![forbid(
+    anonymous_parameters,
+    box_pointers,
+    legacy_directory_ownership,
+    missing_copy_implementations,
+    missing_debug_implementations,
+    missing_docs,
+    trivial_casts,
+    trivial_numeric_casts,
+    unsafe_code,
+    unstable_features,
+    unused_extern_crates,
+    unused_import_braces,
+    unused_qualifications,
+    unused_results,
+    variant_size_differences,
+    warnings,
+)]
+
+extern crate ring;
+
+// This must be the only test in this file because the CPU features are
+// detected once per process, and `cpu::limit` only works before that.
+#[cfg(not(any(target_os = "ios", feature = "static_cpu_features")))]
+#[test]
+fn cpu_limit_baseline() {
+    use ring::{aead, cpu, digest, test};
+
+    assert!(cpu::limit(cpu::Tier::Avx2).is_ok());
+    assert!(cpu::limit(cpu::Tier::Baseline).is_ok());
+    assert!(cpu::limit(cpu::Tier::Avx512).is_ok());
+
+    if cfg!(target_arch = "x86_64") ||
+       cfg!(target_arch = "aarch64") {
+        for &primitive in cpu::ALL_PRIMITIVES.iter() {
+            assert_eq!(cpu::backend(primitive), "generic");
+        }
+    }
+    assert!(cpu::limit(cpu::Tier::Avx512).is_err());
+
+    // The generic implementations must compute the same results.
+    test::from_file("tests/digest_tests.txt", |section, test_case| {
+        assert_eq!(section, "");
+        let digest_alg = test_case.consume_digest_alg("Hash").unwrap();
+        let input = test_case.consume_bytes("Input");
+        let repeat = test_case.consume_usize("Repeat");
+        let expected = test_case.consume_bytes("Output");
+
+        let mut ctx = digest::Context::new(digest_alg);
+        for _ in 0..repeat {
+            ctx.update(&input);
+        }
+        assert_eq!(&expected, &ctx.finish().as_ref());
+        Ok(())
+    });
+
+    for &(aead_alg, file_path) in
+            &[(&aead::AES_128_GCM, "tests/aead_aes_128_gcm_tests.txt"),
+              (&aead::AES_256_GCM, "tests/aead_aes_256_gcm_tests.txt"),
+              (&aead::CHACHA20_POLY1305,
+               "tests/aead_chacha20_poly1305_tests.txt")] {
+        test::from_file(file_path, |section, test_case| {
+            assert_eq!(section, "");
+            let key_bytes = test_case.consume_bytes("KEY");
+            let nonce = test_case.consume_bytes("NONCE");
+            let plaintext = test_case.consume_bytes("IN");
+            let ad = test_case.consume_bytes("AD");
+            let mut ct = test_case.consume_bytes("CT");
+            let tag = test_case.consume_bytes("TAG");
+            let error = test_case.consume_optional_string("FAILS");
+            if error.is_some() {
+                return Ok(());
+            }
+            ct.extend(tag);
+
+            let tag_len = aead_alg.tag_len();
+            let mut in_out = plaintext.clone();
+            in_out.extend(vec![0; tag_len]);
+            let s_key = aead::SealingKey::new(aead_alg, &key_bytes)?;
+            assert_eq!(Ok(ct.len()),
+                       aead::seal_in_place(&s_key, &nonce, &ad, &mut in_out,
+                                           tag_len));
+            assert_eq!(ct, in_out);
+
+            let o_key = aead::OpeningKey::new(aead_alg, &key_bytes)?;
+            assert_eq!(Ok(&plaintext[..]),
+                       aead::open_in_place(&o_key, &nonce, &ad, 0,
+                                           &mut in_out).map(|p| &p[..]));
+            Ok(())
+        });
+    }
+}
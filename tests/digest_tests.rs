@@ -62,6 +62,87 @@ fn digest_misc() {
     });
 }
 
+/// Checks `digest::digest_batch` against `digest::Context` for every message
+/// length up to two blocks, which covers every way the padding can fall.
+#[cfg(feature = "use_heap")]
+#[test]
+fn digest_batch_test() {
+    for alg in &[&digest::SHA1, &digest::SHA256, &digest::SHA384,
+                 &digest::SHA512, &digest::SHA512_256] {
+        let input = (0..((2 * alg.block_len) + 1)).map(|i| i as u8)
+                                                  .collect::<Vec<_>>();
+        let messages = (0..(input.len() + 1)).map(|len| &input[..len])
+                                             .collect::<Vec<_>>();
+        let actual = digest::digest_batch(alg, &messages);
+        assert_eq!(actual.len(), messages.len());
+        for (message, actual) in messages.iter().zip(actual.iter()) {
+            let mut ctx = digest::Context::new(alg);
+            ctx.update(message);
+            assert_eq!(ctx.finish().as_ref(), actual.as_ref());
+            assert_eq!(actual.algorithm(), *alg);
+        }
+    }
+    assert!(digest::digest_batch(&digest::SHA256, &[]).is_empty());
+}
+
+/// Checks that a `Context` that is exported and imported at any point gives
+/// the same digest as one that isn't, and that malformed exported states are
+/// rejected.
+#[cfg(feature = "use_heap")]
+#[test]
+fn digest_export_import_test() {
+    let algs = [&digest::SHA1, &digest::SHA256, &digest::SHA384,
+                &digest::SHA512, &digest::SHA512_256];
+    for alg in algs.iter() {
+        let input = (0..((2 * alg.block_len) + 1)).map(|i| i as u8)
+                                                  .collect::<Vec<_>>();
+        let expected = digest::digest(alg, &input);
+        for split in 0..(input.len() + 1) {
+            let mut ctx = digest::Context::new(alg);
+            ctx.update(&input[..split]);
+            let exported = ctx.export();
+            assert!(exported.as_ref().len() <= digest::MAX_EXPORTED_LEN);
+            let mut ctx = digest::Context::import(alg, exported.as_ref())
+                .unwrap();
+            ctx.update(&input[split..]);
+            assert_eq!(expected.as_ref(), ctx.finish().as_ref());
+        }
+
+        let mut ctx = digest::Context::new(alg);
+        ctx.update(&input[..(alg.block_len + 3)]);
+        let exported = ctx.export();
+        let exported = exported.as_ref();
+
+        for other_alg in algs.iter().filter(|other_alg| **other_alg != *alg) {
+            assert!(digest::Context::import(other_alg, exported).is_err());
+        }
+        assert!(digest::Context::import(alg,
+                                        &exported[..(exported.len() - 1)])
+                    .is_err());
+        let mut extended = exported.to_vec();
+        extended.push(0);
+        assert!(digest::Context::import(alg, &extended).is_err());
+
+        let mut bad_version = exported.to_vec();
+        bad_version[0] ^= 1;
+        assert!(digest::Context::import(alg, &bad_version).is_err());
+
+        // The number of pending bytes must be less than a block.
+        let num_pending_pos = 1 + 1 + 8 + alg.chaining_len;
+        let mut too_many_pending = exported[..num_pending_pos].to_vec();
+        too_many_pending.push(alg.block_len as u8);
+        too_many_pending.extend_from_slice(&input[..alg.block_len]);
+        assert!(digest::Context::import(alg, &too_many_pending).is_err());
+
+        // The total length in bits must fit in a `u64`.
+        let mut too_long = exported.to_vec();
+        for b in &mut too_long[2..10] {
+            *b = 0xff;
+        }
+        assert!(digest::Context::import(alg, &too_long).is_err());
+    }
+}
+
 mod digest_shavs {
     use std::vec::Vec;
     use ring::{digest, test};
@@ -34,7 +34,8 @@
 extern crate ring;
 extern crate untrusted;
 
-use ring::{rand, signature, test};
+use ring::{digest, rand, signature, test};
+use ring::signature::PrehashedVerificationAlgorithm;
 
 #[test]
 fn ecdsa_from_pkcs8_test() {
@@ -128,6 +129,9 @@ fn signature_ecdsa_verify_asn1_test() {
 
         let actual_result = signature::verify(alg, public_key, msg, sig);
         assert_eq!(actual_result.is_ok(), expected_result == "P (0 )");
+        #[cfg(feature = "use_heap")]
+        check_prepared_public_key(alg, public_key, msg, sig,
+                                  actual_result.is_ok());
 
         Ok(())
     });
@@ -163,7 +167,249 @@ fn signature_ecdsa_verify_fixed_test() {
 
         let actual_result = signature::verify(alg, public_key, msg, sig);
         assert_eq!(actual_result.is_ok(), expected_result == "P (0 )");
+        #[cfg(feature = "use_heap")]
+        check_prepared_public_key(alg, public_key, msg, sig,
+                                  actual_result.is_ok());
 
         Ok(())
     });
 }
+
+// Checks that verifying with an `ECDSAPublicKey`, with and without the
+// precomputed table, and verifying a precomputed digest agree with
+// `signature::verify`.
+#[cfg(feature = "use_heap")]
+fn check_prepared_public_key(
+        alg: &'static signature::ECDSAVerificationAlgorithm,
+        public_key: untrusted::Input, msg: untrusted::Input,
+        sig: untrusted::Input, expected_ok: bool) {
+    let m_hash = digest::digest(alg.digest_alg(), msg.as_slice_less_safe());
+    assert_eq!(signature::verify_digest(alg, public_key, &m_hash, sig).is_ok(),
+               expected_ok);
+    match signature::ECDSAPublicKey::from_uncompressed(alg, public_key) {
+        Ok(key) => {
+            assert_eq!(key.verify(msg, sig).is_ok(), expected_ok);
+            let key = signature::ECDSAPublicKey::from_uncompressed_with_table(
+                alg, public_key).unwrap();
+            assert_eq!(key.verify(msg, sig).is_ok(), expected_ok);
+            assert_eq!(key.verify_digest(&m_hash, sig).is_ok(), expected_ok);
+        },
+        Err(_) => {
+            assert!(!expected_ok);
+            assert!(signature::verify_digest(alg, public_key, &m_hash, sig)
+                        .is_err());
+            assert!(signature::ECDSAPublicKey::from_uncompressed_with_table(
+                alg, public_key).is_err());
+        },
+    }
+}
+
+#[cfg(feature = "use_heap")]
+#[test]
+fn signature_ecdsa_verify_batch_test() {
+    let algs = [&signature::ECDSA_P256_SHA256_ASN1,
+                &signature::ECDSA_P256_SHA384_ASN1,
+                &signature::ECDSA_P384_SHA256_ASN1,
+                &signature::ECDSA_P384_SHA384_ASN1];
+    let mut items = [Vec::new(), Vec::new(), Vec::new(), Vec::new()];
+
+    test::from_file("tests/ecdsa_verify_asn1_tests.txt", |section, test_case| {
+        assert_eq!(section, "");
+
+        let curve_name = test_case.consume_string("Curve");
+        let digest_name = test_case.consume_string("Digest");
+        let msg = test_case.consume_bytes("Msg");
+        let public_key = test_case.consume_bytes("Q");
+        let sig = test_case.consume_bytes("Sig");
+        let expected_result = test_case.consume_string("Result");
+
+        let alg_index = match (curve_name.as_str(), digest_name.as_str()) {
+            ("P-256", "SHA256") => 0,
+            ("P-256", "SHA384") => 1,
+            ("P-384", "SHA256") => 2,
+            ("P-384", "SHA384") => 3,
+            _ => {
+                panic!("Unsupported curve+digest: {}+{}", curve_name,
+                       digest_name);
+            }
+        };
+        items[alg_index].push((public_key, msg, sig,
+                               expected_result == "P (0 )"));
+
+        Ok(())
+    });
+
+    for (alg, items) in algs.iter().zip(items.iter()) {
+        // Verify every item twice so that each public key occurs more than
+        // once, in batches both shorter and longer than one chunk.
+        let inputs = items.iter().chain(items.iter()).map(
+            |&(ref public_key, ref msg, ref sig, _)| {
+                (untrusted::Input::from(public_key),
+                 untrusted::Input::from(msg), untrusted::Input::from(sig))
+            }).collect::<Vec<_>>();
+        let expected = items.iter().chain(items.iter())
+            .map(|&(_, _, _, expected)| expected)
+            .collect::<Vec<_>>();
+
+        for len in &[0, 1, 2, 17, inputs.len()] {
+            let len = std::cmp::min(*len, inputs.len());
+            let results = alg.verify_batch(&inputs[..len]);
+            assert_eq!(results.len(), len);
+            for (result, expected) in results.iter().zip(expected.iter()) {
+                assert_eq!(result.is_ok(), *expected);
+            }
+        }
+    }
+}
+
+static SIGNING_ALGS: [(&'static signature::ECDSASigningAlgorithm,
+                       &'static signature::ECDSAVerificationAlgorithm,
+                       Option<usize>); 4] = [
+    (&signature::ECDSA_P256_SHA256_ASN1_SIGNING,
+     &signature::ECDSA_P256_SHA256_ASN1, None),
+    (&signature::ECDSA_P256_SHA256_FIXED_SIGNING,
+     &signature::ECDSA_P256_SHA256_FIXED, Some(2 * 32)),
+    (&signature::ECDSA_P384_SHA384_ASN1_SIGNING,
+     &signature::ECDSA_P384_SHA384_ASN1, None),
+    (&signature::ECDSA_P384_SHA384_FIXED_SIGNING,
+     &signature::ECDSA_P384_SHA384_FIXED, Some(2 * 48)),
+];
+
+// Signatures use random nonces, so this checks that they verify instead of
+// comparing them to expected values. Many signatures are made so that the
+// ASN.1 encoding is exercised with and without the zero byte in front of
+// `r` and `s`.
+#[test]
+fn signature_ecdsa_sign_test() {
+    let rng = rand::SystemRandom::new();
+    let msg = b"hello, world";
+
+    for &(alg, verification_alg, fixed_len) in SIGNING_ALGS.iter() {
+        let pkcs8 = signature::ECDSAKeyPair::generate_pkcs8(alg, &rng).unwrap();
+        let key_pair = signature::ECDSAKeyPair::from_pkcs8(
+            alg, untrusted::Input::from(pkcs8.as_ref())).unwrap();
+        let public_key = untrusted::Input::from(key_pair.public_key_bytes());
+
+        let mut previous_sig = None;
+        for _ in 0..16 {
+            let sig = key_pair.sign(msg, &rng).unwrap();
+            if let Some(fixed_len) = fixed_len {
+                assert_eq!(sig.as_ref().len(), fixed_len);
+            }
+            assert!(signature::verify(verification_alg, public_key,
+                                      untrusted::Input::from(msg),
+                                      untrusted::Input::from(sig.as_ref()))
+                        .is_ok());
+            assert!(signature::verify(verification_alg, public_key,
+                                      untrusted::Input::from(b"hello"),
+                                      untrusted::Input::from(sig.as_ref()))
+                        .is_err());
+            if let Some(previous_sig) = previous_sig {
+                assert!(sig.as_ref() != signature::Signature::as_ref(
+                            &previous_sig));
+            }
+            previous_sig = Some(sig);
+        }
+
+        let m_hash = digest::digest(verification_alg.digest_alg(), msg);
+        let sig = key_pair.sign_digest(&m_hash, &rng).unwrap();
+        assert!(signature::verify(verification_alg, public_key,
+                                  untrusted::Input::from(msg),
+                                  untrusted::Input::from(sig.as_ref()))
+                    .is_ok());
+
+        let wrong_hash = digest::digest(&digest::SHA512, msg);
+        assert!(key_pair.sign_digest(&wrong_hash, &rng).is_err());
+    }
+}
+
+// The "sample" test vectors of RFC 6979 Appendix A.2.5 and A.2.6, which give
+// the nonce k.
+#[test]
+fn signature_ecdsa_sign_fixed_nonce_test() {
+    let vectors = [
+        (&signature::ECDSA_P256_SHA256_FIXED_SIGNING,
+         "C9AFA9D845BA75166B5C215767B1D6934E50C3DB36E89B127B8A622B120F6721",
+         "04\
+          60FED4BA255A9D31C961EB74C6356D68C049B8923B61FA6CE669622E60F29FB6\
+          7903FE1008B8BC99A41AE9E95628BC64F2F1B20C2D7E9F5177A3C294D4462299",
+         "A6E3C57DD01ABE90086538398355DD4C3B17AA873382B0F24D6129493D8AAD60",
+         "EFD48B2AACB6A8FD1140DD9CD45E81D69D2C877B56AAF991C34D0EA84EAF3716\
+          F7CB1C942D657C41D436C7A1B6E29F65F3E900DBB9AFF4064DC4AB2F843ACDA8"),
+        (&signature::ECDSA_P384_SHA384_FIXED_SIGNING,
+         "6B9D3DAD2E1B8C1C05B19875B6659F4DE23C3B667BF297BA\
+          9AA47740787137D896D5724E4C70A825F872C9EA60D2EDF5",
+         "04\
+          EC3A4E415B4E19A4568618029F427FA5DA9A8BC4AE92E02E\
+          06AAE5286B300C64DEF8F0EA9055866064A254515480BC13\
+          8015D9B72D7D57244EA8EF9AC0C621896708A59367F9DFB9\
+          F54CA84B3F1C9DB1288B231C3AE0D4FE7344FD2533264720",
+         "94ED910D1A099DAD3254E9242AE85ABDE4BA15168EAF0CA8\
+          7A555FD56D10FBCA2907E3E83BA95368623B8C4686915CF9",
+         "94EDBB92A5ECB8AAD4736E56C691916B3F88140666CE9FA7\
+          3D64C4EA95AD133C81A648152E44ACF96E36DD1E80FABE46\
+          99EF4AEB15F178CEA1FE40DB2603138F130E740A19624526\
+          203B6351D0A3A94FA329C145786E679E7B82C71A38628AC8"),
+    ];
+
+    for &(alg, private_key, public_key, k, expected_sig) in vectors.iter() {
+        let private_key = test::from_hex(private_key).unwrap();
+        let public_key = test::from_hex(public_key).unwrap();
+        let k = test::from_hex(k).unwrap();
+        let expected_sig = test::from_hex(expected_sig).unwrap();
+
+        let key_pair = signature::ECDSAKeyPair::from_private_key_and_public_key(
+            alg, untrusted::Input::from(&private_key),
+            untrusted::Input::from(&public_key)).unwrap();
+        assert_eq!(key_pair.public_key_bytes(), &public_key[..]);
+
+        let rng = test::rand::FixedSliceRandom { bytes: &k };
+        let sig = key_pair.sign(b"sample", &rng).unwrap();
+        assert_eq!(sig.as_ref(), &expected_sig[..]);
+    }
+}
+
+#[cfg(feature = "use_heap")]
+#[test]
+fn signature_ecdsa_sign_with_nonce_pool_test() {
+    let rng = rand::SystemRandom::new();
+    let msg = b"hello, world";
+
+    for &(alg, verification_alg, _) in SIGNING_ALGS.iter() {
+        let pkcs8 = signature::ECDSAKeyPair::generate_pkcs8(alg, &rng).unwrap();
+        let key_pair = signature::ECDSAKeyPair::from_pkcs8(
+            alg, untrusted::Input::from(pkcs8.as_ref())).unwrap();
+        let public_key = untrusted::Input::from(key_pair.public_key_bytes());
+
+        // More than one batch of nonces.
+        let nonces = signature::ECDSANoncePool::new(alg, 20);
+        assert_eq!(nonces.capacity(), 20);
+        assert_eq!(nonces.len(), 0);
+        nonces.precompute(&rng).unwrap();
+        assert_eq!(nonces.len(), 20);
+        nonces.precompute(&rng).unwrap();
+        assert_eq!(nonces.len(), 20);
+
+        // Once the pool is empty, new nonces are computed instead.
+        for i in 0..25 {
+            let sig = key_pair.sign_with_nonce_pool(&nonces, msg, &rng)
+                .unwrap();
+            assert!(signature::verify(verification_alg, public_key,
+                                      untrusted::Input::from(msg),
+                                      untrusted::Input::from(sig.as_ref()))
+                        .is_ok());
+            assert_eq!(nonces.len(), 20 - std::cmp::min(i + 1, 20));
+        }
+    }
+
+    // The pool must be for the key pair's curve.
+    let alg = &signature::ECDSA_P256_SHA256_FIXED_SIGNING;
+    let pkcs8 = signature::ECDSAKeyPair::generate_pkcs8(alg, &rng).unwrap();
+    let key_pair = signature::ECDSAKeyPair::from_pkcs8(
+        alg, untrusted::Input::from(pkcs8.as_ref())).unwrap();
+    let nonces = signature::ECDSANoncePool::new(
+        &signature::ECDSA_P384_SHA384_FIXED_SIGNING, 1);
+    nonces.precompute(&rng).unwrap();
+    assert!(key_pair.sign_with_nonce_pool(&nonces, msg, &rng).is_err());
+    assert_eq!(nonces.len(), 1);
+}
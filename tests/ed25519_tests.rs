@@ -34,7 +34,7 @@
 extern crate ring;
 extern crate untrusted;
 
-use ring::{signature, test};
+use ring::{rand, signature, test};
 use signature::Ed25519KeyPair;
 
 /// Test vectors from BoringSSL.
@@ -78,8 +78,76 @@ fn test_signature_ed25519() {
         assert!(signature::verify(
             &signature::ED25519, public_key, untrusted::Input::from(&msg),
             untrusted::Input::from(&expected_sig)).is_ok());
+
+        // Test verification with a prepared public key.
+        let prepared = signature::Ed25519PublicKey::from_bytes(public_key)
+            .unwrap();
+        assert_eq!(public_key, prepared.as_bytes());
+        assert!(prepared.verify(untrusted::Input::from(&msg),
+                                untrusted::Input::from(&expected_sig)).is_ok());
+        let mut bad_sig = expected_sig.clone();
+        bad_sig[0] ^= 1;
+        assert!(prepared.verify(untrusted::Input::from(&msg),
+                                untrusted::Input::from(&bad_sig)).is_err());
+        Ok(())
+    });
+}
+
+#[test]
+fn test_signature_ed25519_verify_batch() {
+    let mut vectors = Vec::new();
+    test::from_file("tests/ed25519_tests.txt", |section, test_case| {
+        assert_eq!(section, "");
+        let _ = test_case.consume_bytes("SEED");
+        let public_key = test_case.consume_bytes("PUB");
+        let public_key = signature::Ed25519PublicKey::from_bytes(
+            untrusted::Input::from(&public_key)).unwrap();
+        let msg = test_case.consume_bytes("MESSAGE");
+        let sig = test_case.consume_bytes("SIG");
+        vectors.push((public_key, msg, sig));
         Ok(())
     });
+
+    let rng = rand::SystemRandom::new();
+
+    // Test batches that span several chunks, and with one invalid signature
+    // in various positions.
+    for &len in &[1, 2, 15, 16, 17, 40] {
+        let vectors = &vectors[..len];
+        for &bad in &[0, len / 2, len - 1, len] {
+            let mut sigs = vectors.iter().map(|&(_, _, ref sig)| sig.clone())
+                                  .collect::<Vec<_>>();
+            if bad < len {
+                sigs[bad][0] ^= 1;
+            }
+            let batch = vectors.iter().zip(sigs.iter())
+                .map(|(&(ref public_key, ref msg, _), sig)| {
+                    signature::Ed25519BatchItem {
+                        public_key,
+                        msg: untrusted::Input::from(msg),
+                        signature: untrusted::Input::from(sig),
+                    }
+                }).collect::<Vec<_>>();
+
+            assert_eq!(signature::Ed25519PublicKey::verify_batch(&batch, &rng)
+                           .is_ok(),
+                       bad == len);
+
+            let mut results = vec![Ok(()); len];
+            assert_eq!(signature::Ed25519PublicKey::verify_batch_each(
+                           &batch, &rng, &mut results).is_ok(),
+                       bad == len);
+            for (i, result) in results.iter().enumerate() {
+                assert_eq!(result.is_ok(), i != bad);
+            }
+
+            let mut wrong_len_results = vec![Ok(()); len + 1];
+            assert!(signature::Ed25519PublicKey::verify_batch_each(
+                        &batch, &rng, &mut wrong_len_results).is_err());
+        }
+    }
+
+    assert!(signature::Ed25519PublicKey::verify_batch(&[], &rng).is_ok());
 }
 
 #[test]
@@ -136,3 +204,50 @@ fn test_ed25519_from_pkcs8() {
         Ok(())
     });
 }
+
+/// Test vector from RFC 8032 Section 7.3.
+#[test]
+fn test_signature_ed25519ph() {
+    use ring::digest;
+
+    let seed = test::from_hex(
+        "833fe62409237b9d62ec77587520911e9a759cec1d19755b7da901b96dca3d42")
+        .unwrap();
+    let public_key = test::from_hex(
+        "ec172b93ad5e563bf4932c70e1245034c35467ef2efd4d64ebf819683467e2bf")
+        .unwrap();
+    let msg = b"abc";
+    let expected_sig = test::from_hex(
+        "98a70222f0b8121aa9d30f813d683f809e462b469c7ff87639499bb94e6dae41\
+         31f85042463c2a355a2003d062adf5aaa10b8c61e636062aaad11c2a26083406")
+        .unwrap();
+
+    let public_key = untrusted::Input::from(&public_key);
+    let key_pair = Ed25519KeyPair::from_seed_and_public_key(
+        untrusted::Input::from(&seed), public_key).unwrap();
+
+    // The message may be digested incrementally.
+    let mut ctx = digest::Context::new(&digest::SHA512);
+    ctx.update(&msg[..1]);
+    ctx.update(&msg[1..]);
+    let m_hash = ctx.finish();
+
+    let actual_sig = key_pair.sign_prehashed(&m_hash).unwrap();
+    assert_eq!(&expected_sig[..], actual_sig.as_ref());
+
+    let sig = untrusted::Input::from(&expected_sig);
+    assert!(signature::verify_digest(&signature::ED25519PH, public_key,
+                                     &m_hash, sig).is_ok());
+    assert!(signature::verify(&signature::ED25519PH, public_key,
+                              untrusted::Input::from(msg), sig).is_ok());
+
+    // Ed25519ph signatures aren't Ed25519 signatures of the message.
+    assert!(signature::verify(&signature::ED25519, public_key,
+                              untrusted::Input::from(msg), sig).is_err());
+
+    // Only SHA-512 digests are accepted.
+    let wrong_hash = digest::digest(&digest::SHA256, msg);
+    assert!(key_pair.sign_prehashed(&wrong_hash).is_err());
+    assert!(signature::verify_digest(&signature::ED25519PH, public_key,
+                                     &wrong_hash, sig).is_err());
+}
@@ -33,7 +33,7 @@
 
 extern crate ring;
 
-use ring::{error, hkdf, hmac, test};
+use ring::{digest, error, hkdf, hmac, test};
 
 #[test]
 fn hkdf_tests() {
@@ -60,3 +60,32 @@ fn hkdf_tests() {
         Ok(())
     });
 }
+
+#[test]
+fn hkdf_expand_batch_test() {
+    for digest_alg in &[&digest::SHA1, &digest::SHA256, &digest::SHA384,
+                        &digest::SHA512] {
+        let prk = hmac::SigningKey::new(digest_alg, b"prk");
+        let output_len = digest_alg.output_len;
+        let lens = [0, 1, 12, 16, output_len - 1, output_len, output_len + 1,
+                    2 * output_len, 255 * output_len];
+        let infos = lens.iter().enumerate().map(|(i, _)| vec![i as u8; i * 7])
+                        .collect::<Vec<_>>();
+
+        let expected = lens.iter().zip(infos.iter()).map(|(&len, info)| {
+            let mut out = vec![0u8; len];
+            hkdf::expand(&prk, info, &mut out);
+            out
+        }).collect::<Vec<_>>();
+
+        let mut actual =
+            lens.iter().map(|&len| vec![0u8; len]).collect::<Vec<_>>();
+        {
+            let mut outputs = infos.iter().zip(actual.iter_mut())
+                .map(|(info, out)| (&info[..], &mut out[..]))
+                .collect::<Vec<_>>();
+            hkdf::expand_batch(&prk, &mut outputs);
+        }
+        assert_eq!(expected, actual);
+    }
+}
@@ -96,5 +96,18 @@ fn hmac_test_case_inner(digest_alg: &'static digest::Algorithm,
         assert_eq!(is_ok, signature.as_ref() == output);
     }
 
+    // Multi-part API, exported and imported in the middle.
+    {
+        let (first, second) = input.split_at(input.len() / 2);
+        let mut s_ctx = hmac::SigningContext::with_key(&s_key);
+        s_ctx.update(first);
+        let exported = s_ctx.export();
+        let mut s_ctx =
+            hmac::SigningContext::import(&s_key, exported.as_ref())?;
+        s_ctx.update(second);
+        let signature = s_ctx.sign();
+        assert_eq!(is_ok, signature.as_ref() == output);
+    }
+
     Ok(())
 }
@@ -34,7 +34,8 @@
 extern crate ring;
 extern crate untrusted;
 
-use ring::{der, error, signature, test};
+use ring::{der, digest, error, signature, test};
+use ring::signature::PrehashedVerificationAlgorithm;
 
 #[cfg(feature = "rsa_signing")]
 use ring::rand;
@@ -66,10 +67,10 @@ fn test_signature_rsa_pkcs1_sign() {
         assert_eq!(section, "");
 
         let digest_name = test_case.consume_string("Digest");
-        let alg = match digest_name.as_ref() {
-            "SHA256" => &signature::RSA_PKCS1_SHA256,
-            "SHA384" => &signature::RSA_PKCS1_SHA384,
-            "SHA512" => &signature::RSA_PKCS1_SHA512,
+        let (alg, digest_alg) = match digest_name.as_ref() {
+            "SHA256" => (&signature::RSA_PKCS1_SHA256, &digest::SHA256),
+            "SHA384" => (&signature::RSA_PKCS1_SHA384, &digest::SHA384),
+            "SHA512" => (&signature::RSA_PKCS1_SHA512, &digest::SHA512),
             _ => { panic!("Unsupported digest: {}", digest_name) }
         };
 
@@ -95,6 +96,20 @@ fn test_signature_rsa_pkcs1_sign() {
             vec![0u8; signing_state.key_pair().public_modulus_len()];
         signing_state.sign(alg, &rng, &msg, actual.as_mut_slice()).unwrap();
         assert_eq!(actual.as_slice() == &expected[..], result == "Pass");
+
+        let mut actual_concurrent =
+            vec![0u8; signing_state.key_pair().public_modulus_len()];
+        signing_state.sign_concurrent(alg, &rng, &msg,
+                                      actual_concurrent.as_mut_slice())
+                     .unwrap();
+        assert_eq!(actual_concurrent, actual);
+
+        let mut actual_digest =
+            vec![0u8; signing_state.key_pair().public_modulus_len()];
+        let m_hash = digest::digest(digest_alg, &msg);
+        signing_state.sign_digest(alg, &rng, &m_hash,
+                                  actual_digest.as_mut_slice()).unwrap();
+        assert_eq!(actual_digest, actual);
         Ok(())
     });
 }
@@ -157,6 +172,67 @@ fn test_signature_rsa_pss_sign() {
     });
 }
 
+#[cfg(feature = "rsa_signing")]
+#[test]
+fn test_rsa_key_pair_precomputed() {
+    use ring::hmac;
+
+    let rng = rand::SystemRandom::new();
+    let key = hmac::SigningKey::generate(&digest::SHA256, &rng).unwrap();
+    let other_key = hmac::SigningKey::generate(&digest::SHA256, &rng).unwrap();
+
+    test::from_file("tests/rsa_pkcs1_sign_tests.txt", |section, test_case| {
+        assert_eq!(section, "");
+
+        let _ = test_case.consume_string("Digest");
+        let private_key = test_case.consume_bytes("Key");
+        let msg = test_case.consume_bytes("Msg");
+        let _ = test_case.consume_bytes("Sig");
+        let result = test_case.consume_string("Result");
+        if result != "Pass" {
+            return Ok(());
+        }
+
+        let private_key = untrusted::Input::from(&private_key);
+        let key_pair = signature::RSAKeyPair::from_der(private_key).unwrap();
+        let precomputed = key_pair.serialize_precomputed(&key).unwrap();
+
+        let loaded = signature::RSAKeyPair::from_precomputed(
+            &key, untrusted::Input::from(&precomputed)).unwrap();
+        assert_eq!(loaded.public_modulus_len(), key_pair.public_modulus_len());
+        assert_eq!(loaded.serialize_precomputed(&key).unwrap(), precomputed);
+
+        // PKCS#1 1.5 signatures are deterministic, so the loaded key pair
+        // must produce exactly the same signatures.
+        let sign = |key_pair: signature::RSAKeyPair| {
+            let mut signing_state =
+                signature::RSASigningState::new(std::sync::Arc::new(key_pair))
+                    .unwrap();
+            let mut signature =
+                vec![0u8; signing_state.key_pair().public_modulus_len()];
+            signing_state.sign(&signature::RSA_PKCS1_SHA256, &rng, &msg,
+                               &mut signature).unwrap();
+            signature
+        };
+        assert_eq!(sign(loaded), sign(key_pair));
+
+        assert!(signature::RSAKeyPair::from_precomputed(
+            &other_key, untrusted::Input::from(&precomputed)).is_err());
+        for &i in &[0, 1, precomputed.len() / 2, precomputed.len() - 1] {
+            let mut tampered = precomputed.clone();
+            tampered[i] ^= 1;
+            assert!(signature::RSAKeyPair::from_precomputed(
+                &key, untrusted::Input::from(&tampered)).is_err());
+        }
+        assert!(signature::RSAKeyPair::from_precomputed(
+            &key, untrusted::Input::from(&precomputed[1..])).is_err());
+        assert!(signature::RSAKeyPair::from_precomputed(
+            &key, untrusted::Input::from(&[])).is_err());
+
+        Ok(())
+    });
+}
+
 #[cfg(feature = "rsa_signing")]
 #[test]
 fn test_rsa_key_pair_sync_and_send() {
@@ -206,6 +282,16 @@ fn test_signature_rsa_pkcs1_verify() {
         let actual_result = signature::verify(alg, public_key, msg, sig);
         assert_eq!(actual_result.is_ok(), expected_result == "P");
 
+        let actual_result = signature::RSAPublicKey::from_der(alg, public_key)
+            .and_then(|key| key.verify(msg, sig));
+        assert_eq!(actual_result.is_ok(), expected_result == "P");
+
+        let m_hash = digest::digest(alg.digest_alg(),
+                                    msg.as_slice_less_safe());
+        let actual_result =
+            signature::verify_digest(alg, public_key, &m_hash, sig);
+        assert_eq!(actual_result.is_ok(), expected_result == "P");
+
         Ok(())
     });
 }
@@ -248,10 +334,80 @@ fn test_signature_rsa_pss_verify() {
         let actual_result = signature::verify(alg, public_key, msg, sig);
         assert_eq!(actual_result.is_ok(), expected_result == "P");
 
+        let actual_result = signature::RSAPublicKey::from_der(alg, public_key)
+            .and_then(|key| key.verify(msg, sig));
+        assert_eq!(actual_result.is_ok(), expected_result == "P");
+
+        let m_hash = digest::digest(alg.digest_alg(),
+                                    msg.as_slice_less_safe());
+        let actual_result =
+            signature::verify_digest(alg, public_key, &m_hash, sig);
+        assert_eq!(actual_result.is_ok(), expected_result == "P");
+
         Ok(())
     });
 }
 
+#[test]
+fn test_signature_rsa_verify_batch() {
+    fn read_tests(file: &str,
+                  algs: &[(&str, &'static signature::RSAParameters)],
+                  items: &mut Vec<(signature::RSAPublicKey, Vec<u8>, Vec<u8>,
+                                   bool)>) {
+        test::from_file(file, |section, test_case| {
+            assert_eq!(section, "");
+            let digest_name = test_case.consume_string("Digest");
+            let alg = algs.iter().find(|&&(name, _)| name == digest_name)
+                .map(|&(_, alg)| alg).unwrap();
+            let public_key = test_case.consume_bytes("Key");
+            let msg = test_case.consume_bytes("Msg");
+            let sig = test_case.consume_bytes("Sig");
+            let expected = test_case.consume_string("Result") == "P";
+            match signature::RSAPublicKey::from_der(
+                    alg, untrusted::Input::from(&public_key)) {
+                Ok(key) => items.push((key, msg, sig, expected)),
+                Err(_) => assert!(!expected),
+            }
+            Ok(())
+        });
+    }
+
+    let mut items = Vec::new();
+    read_tests("tests/rsa_pkcs1_verify_tests.txt",
+               &[("SHA1", &signature::RSA_PKCS1_2048_8192_SHA1),
+                 ("SHA256", &signature::RSA_PKCS1_2048_8192_SHA256),
+                 ("SHA384", &signature::RSA_PKCS1_2048_8192_SHA384),
+                 ("SHA512", &signature::RSA_PKCS1_2048_8192_SHA512)],
+               &mut items);
+    read_tests("tests/rsa_pss_verify_tests.txt",
+               &[("SHA256", &signature::RSA_PSS_2048_8192_SHA256),
+                 ("SHA384", &signature::RSA_PSS_2048_8192_SHA384),
+                 ("SHA512", &signature::RSA_PSS_2048_8192_SHA512)],
+               &mut items);
+
+    // Verify every item twice so that the batches mix key sizes, exponents,
+    // and valid and invalid signatures, in groups both shorter and longer
+    // than a full group of eight.
+    let batch = items.iter().chain(items.iter()).map(
+        |&(ref key, ref msg, ref sig, _)| signature::RSABatchItem {
+            public_key: key,
+            msg: untrusted::Input::from(msg),
+            signature: untrusted::Input::from(sig),
+        }).collect::<Vec<_>>();
+    let expected = items.iter().chain(items.iter())
+        .map(|&(_, _, _, expected)| expected)
+        .collect::<Vec<_>>();
+
+    for len in &[0, 1, 7, 8, 9, 17, batch.len()] {
+        let len = std::cmp::min(*len, batch.len());
+        let results = signature::RSAPublicKey::verify_batch(&batch[..len]);
+        assert_eq!(results.len(), len);
+        for (result, expected) in results.iter().zip(expected.iter()) {
+            assert_eq!(result.is_ok(), *expected);
+        }
+    }
+}
+
 // Test for `primitive::verify()`. Read public key parts from a file
 // and use them to verify a signature.
 #[test]
@@ -269,6 +425,25 @@ fn test_signature_rsa_primitive_verification() {
             (untrusted::Input::from(&n), untrusted::Input::from(&e)),
             untrusted::Input::from(&msg), untrusted::Input::from(&sig));
         assert_eq!(result.is_ok(), expected == "Pass");
+
+        // Verify twice with the same `RSAPublicKey` to check that verifying
+        // doesn't consume any of the precomputed state.
+        let key = signature::RSAPublicKey::from_components(
+            &signature::RSA_PKCS1_2048_8192_SHA256,
+            (untrusted::Input::from(&n), untrusted::Input::from(&e)));
+        for _ in 0..2 {
+            let result = key.as_ref().map_err(|e| *e).and_then(|key| {
+                key.verify(untrusted::Input::from(&msg),
+                           untrusted::Input::from(&sig))
+            });
+            assert_eq!(result.is_ok(), expected == "Pass");
+        }
         Ok(())
     })
 }
+
+#[test]
+fn test_rsa_public_key_sync_and_send() {
+    test::compile_time_assert_send::<signature::RSAPublicKey>();
+    test::compile_time_assert_sync::<signature::RSAPublicKey>();
+}